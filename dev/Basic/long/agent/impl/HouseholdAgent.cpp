@@ -198,12 +198,13 @@ Entity::UpdateStatus HouseholdAgent::onFrameTick(timeslice now)
             BigSerial unitId = *itr;
             Unit* unit = const_cast<Unit*>(model->getUnitById(unitId));
 
-            HousingMarket::Entry *entry = const_cast<HousingMarket::Entry*>( getMarket()->getEntryById( unit->getId()) );
+            const HousingMarket::Entry *entry = getMarket()->getEntryById( unit->getId());
 
             // pointer is not null if unit has been entered into the market
             if( entry != nullptr && entry->isBuySellIntervalCompleted() == false)
             {
-                entry->setBuySellIntervalCompleted(true);
+                //the entry is offered to bidders from the next day.
+                getMarket()->setEntryAvailable(unit->getId());
                 #ifdef VERBOSE
                 PrintOutV("[ " << day << "] Buysell complete. agent " << getId() << " unit: " << unitId << endl);
                 #endif
@@ -10,6 +10,7 @@
  */
 
 #include "HousingMarket.hpp"
+#include <boost/unordered_set.hpp>
 #include "workers/Worker.hpp"
 #include "event/LT_EventArgs.hpp"
 #include "message/MessageBus.hpp"
@@ -53,6 +54,18 @@ namespace
         BigSerial unitId;
     };
 
+    class HM_EntryAvailableMsg : public Message
+    {
+    public:
+
+        HM_EntryAvailableMsg(const BigSerial& unitId) : unitId(unitId)
+        {
+            priority = INTERNAL_MESSAGE_PRIORITY;
+        }
+        virtual ~HM_EntryAvailableMsg(){}
+        BigSerial unitId;
+    };
+
     /**
      * Helper to verify if given map contains the given key.
      * @param map to search.
@@ -186,6 +199,85 @@ void HousingMarket::Entry::setOwner(Agent_LT* owner)
     this->owner = owner;
 }
 
+void HousingMarket::EntrySet::insert(Entry* entry)
+{
+    if (positions.insert(std::make_pair(entry->getUnitId(), entries.size())).second)
+    {
+        entries.push_back(entry);
+    }
+}
+
+void HousingMarket::EntrySet::erase(const BigSerial& unitId)
+{
+    boost::unordered_map<BigSerial, size_t>::iterator itr = positions.find(unitId);
+    if (itr != positions.end())
+    {
+        //moves the last entry to the position of the removed one.
+        size_t position = itr->second;
+        positions.erase(itr);
+        Entry* last = entries.back();
+        entries.pop_back();
+        if (position < entries.size())
+        {
+            entries[position] = last;
+            positions[last->getUnitId()] = position;
+        }
+    }
+}
+
+bool HousingMarket::EntrySet::contains(const BigSerial& unitId) const
+{
+    return mapContains(positions, unitId);
+}
+
+size_t HousingMarket::EntrySet::size() const
+{
+    return entries.size();
+}
+
+bool HousingMarket::EntrySet::empty() const
+{
+    return entries.empty();
+}
+
+const HousingMarket::Entry* HousingMarket::EntrySet::at(size_t index) const
+{
+    return entries[index];
+}
+
+const HousingMarket::Entry* HousingMarket::EntrySet::sample(boost::mt19937& generator) const
+{
+    if (entries.empty())
+    {
+        return nullptr;
+    }
+    boost::random::uniform_int_distribution<size_t> distribution(0, entries.size() - 1);
+    return entries[distribution(generator)];
+}
+
+void HousingMarket::EntrySet::sample(boost::mt19937& generator, size_t count, ConstEntryList& outList) const
+{
+    if (count >= entries.size())
+    {
+        outList.insert(outList.end(), entries.begin(), entries.end());
+        return;
+    }
+
+    //Floyd's algorithm: count distinct positions with count draws.
+    boost::unordered_set<size_t> drawn;
+    for (size_t n = entries.size() - count; n < entries.size(); n++)
+    {
+        boost::random::uniform_int_distribution<size_t> distribution(0, n);
+        size_t position = distribution(generator);
+        if (!drawn.insert(position).second)
+        {
+            position = n;
+            drawn.insert(position);
+        }
+        outList.push_back(entries[position]);
+    }
+}
+
 HousingMarket::HousingMarket() : Entity(-1)
 {
 }
@@ -216,20 +308,15 @@ void HousingMarket::removeEntry(const BigSerial& unitId)
 
 void HousingMarket::getAvailableEntries(const IdVector& tazIds, HousingMarket::ConstEntryList& outList)
 {
-    //Iterates over all ids and copies all entries to the outList.
+    //Iterates over all ids and copies all available entries to the outList.
     for (IdVector::const_iterator it = tazIds.begin(); it != tazIds.end(); it++)
     {
-        BigSerial tazId = *it;
-        if (mapContains(entriesByTazId, tazId))
+        const EntrySet* entries = getAvailableEntriesByTazId(*it);
+        if (entries)
         {
-            HousingMarket::EntryMap& map = entriesByTazId.find(tazId)->second;
-            //copy lists.
-            for (HousingMarket::EntryMap::iterator itMap = map.begin(); itMap != map.end(); itMap++)
+            for (size_t n = 0; n < entries->size(); n++)
             {
-                if(itMap->second->isBuySellIntervalCompleted())
-                {
-                    outList.push_back(itMap->second);
-                }
+                outList.push_back(entries->at(n));
             }
         }
     }
@@ -237,14 +324,54 @@ void HousingMarket::getAvailableEntries(const IdVector& tazIds, HousingMarket::C
 
 void HousingMarket::getAvailableEntries(ConstEntryList& outList)
 {
-    //copy(entriesById, outList);
-    for( auto itr = entriesById.begin(); itr != entriesById.end(); itr++)
+    outList.reserve(outList.size() + availableEntries.size());
+    for (size_t n = 0; n < availableEntries.size(); n++)
     {
-        if( (*itr).second->isBuySellIntervalCompleted() == true)
-        {
-            outList.push_back((*itr).second);
-        }
+        outList.push_back(availableEntries.at(n));
+    }
+}
+
+void HousingMarket::setEntryAvailable(const BigSerial& unitId)
+{
+    // entry will be available only on the next tick
+    MessageBus::PostMessage(this, LTMID_HMI_ENTRY_AVAILABLE, MessageBus::MessagePtr( new HM_EntryAvailableMsg(unitId)), true);
+}
+
+const HousingMarket::EntrySet& HousingMarket::getAvailableEntrySet() const
+{
+    return availableEntries;
+}
+
+const HousingMarket::EntrySet* HousingMarket::getAvailableEntriesByZoneHousingType(int zoneHousingType) const
+{
+    EntrySetById::const_iterator itr = availableEntriesByZoneHousingType.find(zoneHousingType);
+    if (itr != availableEntriesByZoneHousingType.end())
+    {
+        return &itr->second;
+    }
+    return nullptr;
+}
+
+const HousingMarket::EntrySet* HousingMarket::getAvailableEntriesByTazId(const BigSerial& tazId) const
+{
+    EntrySetById::const_iterator itr = availableEntriesByTazId.find(tazId);
+    if (itr != availableEntriesByTazId.end())
+    {
+        return &itr->second;
     }
+    return nullptr;
+}
+
+const HousingMarket::EntrySet& HousingMarket::getBTOEntrySet() const
+{
+    return btoEntries;
+}
+
+void HousingMarket::indexAvailableEntry(Entry* entry)
+{
+    availableEntries.insert(entry);
+    availableEntriesByZoneHousingType[entry->getZoneHousingType()].insert(entry);
+    availableEntriesByTazId[entry->getTazId()].insert(entry);
 }
 
 size_t HousingMarket::getEntrySize(unsigned int currTick)
@@ -269,12 +396,12 @@ size_t HousingMarket::getBTOEntrySize()
 
 std::set<BigSerial> HousingMarket::getBTOEntries()
 {
-    return btoEntries;
-}
-
-std::unordered_multimap<int, BigSerial>& HousingMarket::getunitsByZoneHousingType()
-{
-    return unitsByZoneHousingType;
+    std::set<BigSerial> unitIds;
+    for (size_t n = 0; n < btoEntries.size(); n++)
+    {
+        unitIds.insert(btoEntries.at(n)->getUnitId());
+    }
+    return unitIds;
 }
             
 const HousingMarket::Entry* HousingMarket::getEntryById(const BigSerial& unitId)
@@ -326,10 +453,24 @@ void HousingMarket::HandleMessage(Message::MessageType type, const Message& mess
 
                if( newEntry->isBTO() )
                {
-                   btoEntries.insert(unitId);
+                   btoEntries.insert(newEntry);
                }
 
-               unitsByZoneHousingType.insert(std::make_pair<int,BigSerial>( msg.entry.getZoneHousingType(), msg.entry.getUnitId()));
+               if( newEntry->isBuySellIntervalCompleted() )
+               {
+                   indexAvailableEntry(newEntry);
+               }
+            }
+            break;
+        }
+        case LTMID_HMI_ENTRY_AVAILABLE:
+        {
+            const HM_EntryAvailableMsg& msg = MSG_CAST(HM_EntryAvailableMsg, message);
+            Entry* entry = getEntry(entriesById, msg.unitId);
+            if (entry)
+            {
+                entry->setBuySellIntervalCompleted(true);
+                indexAvailableEntry(entry);
             }
             break;
         }
@@ -339,17 +480,17 @@ void HousingMarket::HandleMessage(Message::MessageType type, const Message& mess
             Entry* entry = getEntry(entriesById, msg.unitId);
             if (entry)
             {
-                if( entry->isBTO() )
-                    btoEntries.erase(entry->getUnitId());
+                btoEntries.erase(msg.unitId);
 
-                auto itr = unitsByZoneHousingType.equal_range(entry->getZoneHousingType());
-                for (auto it = itr.first; it != itr.second; it++)
+                //remove from the available entries.
+                availableEntries.erase(msg.unitId);
+                if (mapContains(availableEntriesByZoneHousingType, entry->getZoneHousingType()))
+                {
+                    availableEntriesByZoneHousingType.find(entry->getZoneHousingType())->second.erase(msg.unitId);
+                }
+                if (mapContains(availableEntriesByTazId, entry->getTazId()))
                 {
-                    if (it->second == entry->getUnitId())
-                    {
-                        unitsByZoneHousingType.erase(it);
-                        break;
-                    }
+                    availableEntriesByTazId.find(entry->getTazId())->second.erase(msg.unitId);
                 }
 
                 BigSerial tazId = entry->getTazId();
@@ -10,8 +10,9 @@
  */
 #pragma once
 
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
 #include <boost/unordered_map.hpp>
-#include <unordered_map>
 #include "entities/Entity.hpp"
 #include "database/entity/Unit.hpp"
 #include <set>
@@ -41,7 +42,11 @@ namespace sim_mob
          * other agents.
          * 
          * Bidders should use **getAvailableEntries** method to get 
-         * the current list of available units.
+         * the current list of available units, or sample their choice
+         * set from the indexes returned by **getAvailableEntrySet**,
+         * **getAvailableEntriesByZoneHousingType** and
+         * **getAvailableEntriesByTazId**.
+         * An entry is available once its buy-sell interval is completed.
          * 
          * Th main responsibility is the management of: 
          *  - avaliable units to sell
@@ -106,6 +111,43 @@ namespace sim_mob
             typedef boost::unordered_map<BigSerial, Entry*> EntryMap;
             typedef boost::unordered_map<BigSerial, EntryMap> EntryMapById;
 
+            /**
+             * Set of entries supporting insertion, removal and
+             * uniform sampling in constant time.
+             */
+            class EntrySet
+            {
+            public:
+                void insert(Entry* entry);
+                void erase(const BigSerial& unitId);
+                bool contains(const BigSerial& unitId) const;
+                size_t size() const;
+                bool empty() const;
+                const Entry* at(size_t index) const;
+
+                /**
+                 * Draws an entry uniformly.
+                 * @param generator random number generator.
+                 * @return entry or nullptr if the set is empty.
+                 */
+                const Entry* sample(boost::mt19937& generator) const;
+
+                /**
+                 * Draws up to count distinct entries uniformly
+                 * (all entries if count >= size()).
+                 * @param generator random number generator.
+                 * @param count number of entries to draw.
+                 * @param outList list to receive the entries.
+                 */
+                void sample(boost::mt19937& generator, size_t count, ConstEntryList& outList) const;
+
+            private:
+                std::vector<Entry*> entries;
+                boost::unordered_map<BigSerial, size_t> positions;
+            };
+
+            typedef boost::unordered_map<BigSerial, EntrySet> EntrySetById;
+
         public:
             HousingMarket();
             virtual ~HousingMarket();
@@ -150,6 +192,41 @@ namespace sim_mob
              */
             void getAvailableEntries(ConstEntryList& outList);
 
+            /**
+             * Marks the entry of the given unit as available to bidders.
+             * **Attention** changes are not visible after this call.
+             * a message will be generated and processed on the next
+             * simulation day.
+             * @param unitId of the entry.
+             */
+            void setEntryAvailable(const BigSerial& unitId);
+
+            /**
+             * Gets all the available entries.
+             * @return entries, updated on the beginning of each tick.
+             */
+            const EntrySet& getAvailableEntrySet() const;
+
+            /**
+             * Gets the available entries of the given zone housing type.
+             * @param zoneHousingType of the entries.
+             * @return entries or nullptr if there are none.
+             */
+            const EntrySet* getAvailableEntriesByZoneHousingType(int zoneHousingType) const;
+
+            /**
+             * Gets the available entries of the given taz.
+             * @param tazId of the entries.
+             * @return entries or nullptr if there are none.
+             */
+            const EntrySet* getAvailableEntriesByTazId(const BigSerial& tazId) const;
+
+            /**
+             * Gets the BTO entries, available or not.
+             * @return entries, updated on the beginning of each tick.
+             */
+            const EntrySet& getBTOEntrySet() const;
+
             /**
              * Get a pointer of the entry by given unit identifier.
              * You should not change the returned values.
@@ -168,8 +245,6 @@ namespace sim_mob
 
             std::set<BigSerial> getBTOEntries();
 
-            std::unordered_multimap<int, BigSerial>& getunitsByZoneHousingType();
-
 
         protected:
             /**
@@ -186,12 +261,21 @@ namespace sim_mob
             void onWorkerEnter();
             void onWorkerExit();
 
+            /**
+             * Adds the given entry to the indexes of available entries.
+             */
+            void indexAvailableEntry(Entry* entry);
+
         private:
             EntryMap entriesById; // original copies
             EntryMapById entriesByTazId; // only lookup.
 
-            std::set<BigSerial> btoEntries;
-            std::unordered_multimap<int, BigSerial>unitsByZoneHousingType;
+            EntrySet btoEntries;
+
+            // available entries (buy-sell interval completed), only lookup.
+            EntrySet availableEntries;
+            EntrySetById availableEntriesByZoneHousingType;
+            EntrySetById availableEntriesByTazId;
 
         };
     }
@@ -9,10 +9,15 @@
 #pragma once
 
 #include "entities/Entity.hpp"
-#include <iostream>
-#include <fstream>
-#include <boost/unordered_map.hpp>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
 
 namespace sim_mob
 {
@@ -21,12 +26,13 @@ namespace sim_mob
         /**
          * Entity responsible log messages in a thread-safe way without logs.
          * 
-         * This special agent uses the MessageBus to receive messages to log. 
+         * Each thread appends its messages to its own buffer for each file. Full buffers,
+         * and all the buffers at each tick of this agent, are handed to a writer thread
+         * which writes them to the files. The messages of a thread keep their order in
+         * a file, but the messages of different threads are interleaved by blocks.
          * 
-         * The output is depending on the given configuration.
-         * 
-         * Attention: This agent is designed to work with SimMobility Workers and 
-         * MessageBus system. Do not use it within external threads.
+         * The output is depending on the given configuration. If the compression of the
+         * output files is enabled, the files are written through gzip.
          * 
          */
         class LoggerAgent : public Entity
@@ -83,6 +89,9 @@ namespace sim_mob
                 LOG_NEARSET_POLYTECH_EZ_LINK
             };
 
+            /** number of LogFile values. Keep it after the last one*/
+            static const size_t NUM_LOG_FILES = LOG_NEARSET_POLYTECH_EZ_LINK + 1;
+
             LoggerAgent();
             virtual ~LoggerAgent();
             
@@ -93,9 +102,15 @@ namespace sim_mob
             
             /**
              * Log the given message. 
+             * Messages to files which are not enabled are dropped.
              * @param logMsg to print.
              */
             void log(LogFile outputType, const std::string& logMsg);
+
+            /**
+             * Hands the messages buffered by all the threads to the writer thread.
+             */
+            void flush();
             
         protected:
             /**
@@ -113,10 +128,77 @@ namespace sim_mob
             void onWorkerExit();
 
         private:
-            typedef boost::unordered_map<LogFile, std::ofstream*> Files;
-            boost::unordered_map<LogFile, std::ofstream*> streams; 
+            /**
+             * Messages of a thread which are not handed to the writer thread yet, by file.
+             */
+            struct ThreadBuffers
+            {
+                ThreadBuffers() : buffers(NUM_LOG_FILES) {}
+
+                /** taken by the thread for each message, so it is only contended while flushing*/
+                boost::mutex mutex;
+                std::vector<std::string> buffers;
+            };
+
+            /**
+             * Messages of a file handed to the writer thread.
+             */
+            struct Chunk
+            {
+                LogFile file;
+                std::string data;
+            };
+
+            /**
+             * Opens an output file and writes its header
+             */
+            void openFile(LogFile file, const std::string& fileName, const std::string& header = std::string());
+
+            /**
+             * Gets the buffers of the calling thread, creating them on its first message.
+             */
+            ThreadBuffers& getThreadBuffers();
+
+            /**
+             * Hands the content of a buffer to the writer thread and empties the buffer.
+             */
+            void postChunk(LogFile file, std::string& buffer);
+
+            /**
+             * Writes the chunks until the agent is destroyed. Executed by the writer thread
+             */
+            void runWriter();
+
+            /**
+             * Closes the output files, warning about the files which were not written completely.
+             * Executed by the writer thread
+             */
+            void closeFiles();
+
+            /** the buffers are owned by the agent, not by the threads*/
+            static void releaseThreadBuffers(ThreadBuffers* buffers) {}
+
+            /** output files by LogFile. nullptr if the file is not enabled*/
+            std::vector<FILE*> files;
+
+            /** names of the output files by LogFile*/
+            std::vector<std::string> fileNames;
+            bool compress;
+
+            boost::thread_specific_ptr<ThreadBuffers> threadBuffers;
+            std::vector<boost::shared_ptr<ThreadBuffers> > allThreadBuffers;
+
+            /** protects allThreadBuffers*/
+            boost::mutex threadBuffersMutex;
+
+            std::deque<Chunk> chunks;
+            bool stopWriter;
+
+            /** protects chunks and stopWriter*/
+            boost::mutex chunksMutex;
+            boost::condition_variable chunksAvailable;
 
-            boost::mutex mtx;
+            boost::thread writer;
 
         };
     }
@@ -72,14 +72,21 @@ void BidDao::toRow(Bid& data, Parameters& outParams, bool update)
 }
 
 
+const std::vector<std::string>& BidDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "bid_id", "simulation_day", "seller_id", "bidder_id", "current_unit_id", "new_unit_id", "willingness_to_pay",
+        "wtp_error_term", "affordability_amount", "current_unit_price", "target_price", "hedonic_price",
+        "lag_coefficient", "asking_price", "bid_value", "bids_counter", "logsum", "unit_floor_area", "unit_type_id",
+        "current_postcode", "new_postcode", "move_in_date", "accepted"
+    };
+    return columns;
+}
+
 void BidDao::insertBid(Bid& bid,std::string schema)
 {
 
-    const std::string DB_INSERT_BID = "INSERT INTO " + schema + ".bids"
-                        + " (" + "bid_id" + ", " + "simulation_day" + ", " + "seller_id" + ", " + "bidder_id"+ ", " + "current_unit_id" ", " + "new_unit_id" + ", " + "willingness_to_pay"+ ", "
-                        + "wtp_error_term"+  ", " + "affordability_amount" + ", " + "current_unit_price" + ", " + "target_price" + ", " + "hedonic_price" + ", " + "lag_coefficient" +", " + "asking_price" + ", " + "bid_value"+ ", "
-                        + "bids_counter" + ", " + "logsum" + ", "+ "unit_floor_area" + ", " + "unit_type_id" ", " + "current_postcode" + ", " + "new_postcode" + ", " + "move_in_date" +", " + "accepted"
-                        + ") VALUES (:v1, :v2, :v3, :v4, :v5, :v6, :v7, :v8, :v9, :v10, :v11, :v12, :v13, :v14, :v15, :v16, :v17, :v18, :v19, :v20 ,:v21, :v22, :v23)";
+    const std::string DB_INSERT_BID = buildInsertQuery(schema + ".bids", getInsertColumns());
     insertViaQuery(bid,DB_INSERT_BID);
 
 }
@@ -49,6 +49,11 @@ namespace sim_mob
             */
             std::vector<Building*> getBuildingsByParcelId(const long long parcelId,std::string schema);
 
+            /**
+             * Columns filled by an insert, in the order of the parameters of toRow()
+             */
+            static const std::vector<std::string>& getInsertColumns();
+
             void insertBuilding(Building& building,std::string schema);
         };
     }
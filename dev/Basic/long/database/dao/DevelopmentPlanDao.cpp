@@ -40,13 +40,19 @@ void DevelopmentPlanDao::toRow(DevelopmentPlan& data, Parameters& outParams, boo
     outParams.push_back(data.getLaunchDate());
 }
 
+const std::vector<std::string>& DevelopmentPlanDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "fm_parcel_id", "development_template_id", "unit_type_id", "num_units", "simulation_date",
+        "construction_start_date", "launch_date"
+    };
+    return columns;
+}
+
 void DevelopmentPlanDao::insertDevelopmentPlan(DevelopmentPlan& devPlan,std::string schema)
 {
 
-    const std::string DB_INSERT_DEV_PLAN = "INSERT INTO " + schema + ".development_plans"
-                    + " (" + "fm_parcel_id" + ", " + "development_template_id" + ", " + "unit_type_id" + ", " + "num_units" + ", " + "simulation_date" + ", " + "construction_start_date" + ", "
-                    + "launch_date"
-                    + ") VALUES (:v1, :v2, :v3, :v4, :v5, :v6, :v7)";
+    const std::string DB_INSERT_DEV_PLAN = buildInsertQuery(schema + ".development_plans", getInsertColumns());
     insertViaQuery(devPlan,DB_INSERT_DEV_PLAN);
 
 }
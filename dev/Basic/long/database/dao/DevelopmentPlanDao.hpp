@@ -45,6 +45,11 @@ namespace sim_mob
             * Get the parcels of given parcel id
             */
 
+            /**
+             * Columns filled by an insert, in the order of the parameters of toRow()
+             */
+            static const std::vector<std::string>& getInsertColumns();
+
             void insertDevelopmentPlan(DevelopmentPlan& devPlan,std::string schema);
         };
     }
@@ -85,6 +85,18 @@ void HouseholdDao::toRow(Household& data, Parameters& outParams, bool update)
     outParams.push_back(data.getLastBidStatus());
 }
 
+const std::vector<std::string>& HouseholdDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "hh_id", "lifestyle_id", DB_FIELD_UNIT_ID, DB_FIELD_ETHNICITY_ID, DB_FIELD_VEHICLE_CATEGORY_ID, DB_FIELD_SIZE,
+        DB_FIELD_CHILDUNDER4, DB_FIELD_CHILDUNDER15, "num_adults", DB_FIELD_INCOME, DB_FIELD_HOUSING_DURATION,
+        "workers", "age_of_head", "pending_status_id", "pending_from_date", "unit_pending", "taxi_availability",
+        "vehicle_ownership_option_id", "time_on_market", "time_off_market", "is_bidder", "is_seller",
+        "buy_sell_interval", "tenure_status", "awakened_day", "last_bid_status"
+    };
+    return columns;
+}
+
 void HouseholdDao::insertHousehold(Household& houseHold,std::string schema)
 {
 
@@ -152,12 +164,7 @@ void HouseholdDao::insertHousehold(Household& houseHold,std::string schema)
 
     else
     {
-        const std::string DB_INSERT_HOUSEHOLD_OP = "INSERT INTO " + schema + ".household"
-                            + " (" + "hh_id" + ", "+ "lifestyle_id" + ", "+ DB_FIELD_UNIT_ID + ", "+ DB_FIELD_ETHNICITY_ID + ", "+ DB_FIELD_VEHICLE_CATEGORY_ID + ", "+ DB_FIELD_SIZE + ", "+
-                            DB_FIELD_CHILDUNDER4 + ", "+ DB_FIELD_CHILDUNDER15 + ", " + "num_adults" + ", "+ DB_FIELD_INCOME + ", "+ DB_FIELD_HOUSING_DURATION + ", " + "workers"+ ", "+
-                            "age_of_head" + ", "+ "pending_status_id" + ", " + "pending_from_date" + ", "+ "unit_pending" + ", "+ "taxi_availability" + ", " + "vehicle_ownership_option_id"+ ", "+
-                            + "time_on_market" + ", " + "time_off_market"+ ", "+ "is_bidder" + ", " + "is_seller"+ ", "+ "buy_sell_interval" + ", "+
-                            + "tenure_status"  + ", " + "awakened_day" + ", " +"last_bid_status"") VALUES (:v1, :v2, :v3, :v4, :v5, :v6, :v7 ,:v8, :v9, :v10, :v11, :v12, :v13, :v14, :v15, :v16, :v17, :v18, :v19, :v20, :v21, :v22, :v23, :v24, :V25, :v26)";
+        const std::string DB_INSERT_HOUSEHOLD_OP = buildInsertQuery(schema + ".household", getInsertColumns());
         insertViaQuery(houseHold,DB_INSERT_HOUSEHOLD_OP);
     }
 
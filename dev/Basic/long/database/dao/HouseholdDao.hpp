@@ -42,6 +42,11 @@ namespace sim_mob {
             void toRow(Household& data, db::Parameters& outParams, bool update);
 
         public:
+            /**
+             * Columns filled by an insert, in the order of the parameters of toRow()
+             */
+            static const std::vector<std::string>& getInsertColumns();
+
             void insertHousehold(Household& houseHold,std::string schema);
             std::vector<Household*> getPendingHouseholds(std::tm currentSimYear,std::tm lastDayOfCurrentSimYear);
         };
@@ -30,10 +30,17 @@ void HouseholdUnitDao::toRow(HouseholdUnit& data, Parameters& outParams, bool up
     outParams.push_back(data.getMoveInDate());
 }
 
+const std::vector<std::string>& HouseholdUnitDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "household_id", "unit_id", "move_in_date"
+    };
+    return columns;
+}
+
 void HouseholdUnitDao::insertHouseholdUnit(HouseholdUnit& houseHold,std::string schema)
 {
-    const std::string DB_INSERT_HOUSEHOLD_UNIT = "INSERT INTO " + schema + ".household_unit"
-        + " (" + "household_id" + ", "+ "unit_id" + ", "+ "move_in_date" + ") VALUES (:v1, :v2, :v3)";
+    const std::string DB_INSERT_HOUSEHOLD_UNIT = buildInsertQuery(schema + ".household_unit", getInsertColumns());
     insertViaQuery(houseHold,DB_INSERT_HOUSEHOLD_UNIT);
 }
 
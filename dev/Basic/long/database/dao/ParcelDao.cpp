@@ -97,17 +97,22 @@ std::vector<Parcel*> ParcelDao::getParcelsWithOngoingProjects(std::string schema
     return parcelsWithOngoingProjectsList;
 }
 
+const std::vector<std::string>& ParcelDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "fm_parcel_id", "taz_id", "lot_size", "gpr", "land_use_type_id", "owner_name", "owner_category",
+        "last_transaction_date", "last_transaction_type_total", "psm_per_gps", "lease_type", "lease_start_date",
+        "centroid_x", "centroid_y", "award_date", "award_status", "use_restriction", "development_type_code",
+        "successful_tender_id", "successful_tender_price", "tender_closing_date", "lease", "development_status",
+        "development_allowed", "next_available_date", "last_changed_date"
+    };
+    return columns;
+}
+
 void ParcelDao::insertParcel(Parcel& parcel,std::string schema)
 {
 
-    const std::string DB_INSERT_PARCEL_OP = "INSERT INTO " + schema + ".fm_parcel"
-                                        + " (" + "fm_parcel_id" + ", " + "taz_id" + ", " + "lot_size"
-                                        + ", " + "gpr" + ", " + "land_use_type_id" + ", "
-                                        + "owner_name" + ", " + "owner_category"  + ", "+ "last_transaction_date" + ", " + "last_transaction_type_total" + ", "
-                                        + "psm_per_gps" + ", " + "lease_type" + ", " + "lease_start_date"  + ", " + "centroid_x"
-                                        + ", "+ "centroid_y"  + ", " + "award_date" + ", " + "award_status" + ", " + "use_restriction" + ", " + "development_type_code"  + ", " + "successful_tender_id"
-                                        + ", "+ "successful_tender_price"  + ", " + "tender_closing_date" + ", " + "lease" + ", " + "development_status" + ", " + "development_allowed" + ", " + "next_available_date"  + ", " + "last_changed_date"
-                                        + ") VALUES (:v1, :v2, :v3, :v4, :v5, :v6, :v7, :v8, :v9, :v10, :v11, :v12, :v13, :v14, :v15, :v16, :v17, :v18, :v19, :v20, :v21, :v22, :v23, :v24, :v25, :v26)";
+    const std::string DB_INSERT_PARCEL_OP = buildInsertQuery(schema + ".fm_parcel", getInsertColumns());
     insertViaQuery(parcel,DB_INSERT_PARCEL_OP);
 
 }
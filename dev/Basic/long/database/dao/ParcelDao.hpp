@@ -54,6 +54,11 @@ namespace sim_mob {
              */
             std::vector<Parcel*> getParcelsWithOngoingProjects(std::string schema);
 
+            /**
+             * Columns filled by an insert, in the order of the parameters of toRow()
+             */
+            static const std::vector<std::string>& getInsertColumns();
+
             void insertParcel(Parcel& parcel,std::string schema);
 
             /*
@@ -36,6 +36,11 @@ namespace sim_mob {
             void toRow(Project& data, db::Parameters& outParams, bool update);
 
         public:
+            /**
+             * Columns filled by an insert, in the order of the parameters of toRow()
+             */
+            static const std::vector<std::string>& getInsertColumns();
+
             void insertProject(Project& project,std::string schema);
             std::vector<Project*> loadOngoingProjects(std::string schema);
         };
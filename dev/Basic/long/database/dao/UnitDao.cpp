@@ -70,6 +70,17 @@ void UnitDao::toRow(Unit& data, Parameters& outParams, bool update)
     outParams.push_back(data.getAskingPrice());
 }
 
+const std::vector<std::string>& UnitDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "fm_unit_id", "fm_building_id", "unit_type", "storey_range", "construction_status", "floor_area", "storey",
+        "monthly_rent", "sale_from_date", "occupancy_from_date", "sale_status", "occupancy_status",
+        "last_changed_date", "total_price", "bto_price", "value_date", "tenure_status", "time_on_market",
+        "time_off_market", "bidding_market_entry_day", "asking_price"
+    };
+    return columns;
+}
+
 void UnitDao::insertUnit(Unit& unit,std::string schema)
 {
     if(unit.isExistInDb())
@@ -127,14 +138,7 @@ void UnitDao::insertUnit(Unit& unit,std::string schema)
     else
     {
 
-        const std::string DB_INSERT_UNIT_OP = "INSERT INTO "  + schema + ".fm_unit_res"
-                                + " (" + "fm_unit_id" + ", " + "fm_building_id"
-                                + ", " + "unit_type" + ", "+ "storey_range" + ", "
-                                + "construction_status" + ", " + "floor_area"  + ", "+ "storey" + ", " + "monthly_rent" + ", "
-                                + "sale_from_date" + ", " + "occupancy_from_date"  + ", " + "sale_status"
-                                + ", "+ "occupancy_status"  + ", "  + "last_changed_date" + ", " + "total_price"+ ", " + "bto_price"+ ", " + "value_date" + ", " + "tenure_status"
-                                 + ", " + "time_on_market"  + ", " + "time_off_market"  + ", " + "bidding_market_entry_day"  + ", " + "asking_price"
-                                + ") VALUES (:v1, :v2, :v3, :v4, :v5, :v6, :v7, :v8, :v9, :v10, :v11, :v12, :v13, :v14, :v15, :v16, :v17, :v18, :v19, :v20, :v21)";
+        const std::string DB_INSERT_UNIT_OP = buildInsertQuery(schema + ".fm_unit_res", getInsertColumns());
         insertViaQuery(unit,DB_INSERT_UNIT_OP);
         }
 
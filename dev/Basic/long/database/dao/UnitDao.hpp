@@ -43,6 +43,11 @@ namespace sim_mob {
 
         public:
 
+            /**
+             * Columns filled by an insert, in the order of the parameters of toRow()
+             */
+            static const std::vector<std::string>& getInsertColumns();
+
             void insertUnit(Unit& unit,std::string schema);
 
             /*
@@ -41,12 +41,19 @@ void UnitSaleDao::toRow(UnitSale& data, Parameters& outParams, bool update)
 }
 
 
+const std::vector<std::string>& UnitSaleDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "unit_sale_id", "unit_id", "buyer_id", "seller_id", "unit_price", "transaction_day", "days_on_market_unit",
+        "days_on_market_bidder"
+    };
+    return columns;
+}
+
 void UnitSaleDao::insertUnitSale(UnitSale& unitSale,std::string schema)
 {
 
-    const std::string DB_INSERT_UNIT_SALE = "INSERT INTO " + schema + ".unit_sale"
-                        + " (" + "unit_sale_id " + ", " + "unit_id " + ", " + "buyer_id" + ", " + "seller_id" + ", " + "unit_price" ", " + "transaction_day" ", " + "days_on_market_unit" ", " + "days_on_market_bidder"
-                        + ") VALUES (:v1, :v2, :v3, :v4, :v5, :v6, :v7, :v8)";
+    const std::string DB_INSERT_UNIT_SALE = buildInsertQuery(schema + ".unit_sale", getInsertColumns());
     insertViaQuery(unitSale,DB_INSERT_UNIT_SALE);
 
 }
@@ -39,6 +39,11 @@ namespace sim_mob {
             void toRow(UnitSale& data, db::Parameters& outParams, bool update);
 
         public:
+            /**
+             * Columns filled by an insert, in the order of the parameters of toRow()
+             */
+            static const std::vector<std::string>& getInsertColumns();
+
             void insertUnitSale(UnitSale& bid,std::string schema);
         };
     }
@@ -31,12 +31,18 @@ void VehicleOwnershipChangesDao::toRow(VehicleOwnershipChanges& data, Parameters
     outParams.push_back(data.getStartDate());
 }
 
+const std::vector<std::string>& VehicleOwnershipChangesDao::getInsertColumns()
+{
+    static const std::vector<std::string> columns = {
+        "household_id", "old_vehicle_ownership_option_id", "new_vehicle_ownership_option_id", "start_date"
+    };
+    return columns;
+}
+
 void VehicleOwnershipChangesDao::insertVehicleOwnershipChanges(VehicleOwnershipChanges& vehicleOwnershipChange,std::string schema)
 {
 
-    const std::string DB_INSERT_VEHICLE_OWNERSHIP_CHANGES = "INSERT INTO " + schema + ".vehicle_ownership_changes"
-                    + " (" + "household_id" + ", " + "old_vehicle_ownership_option_id" + ", " + "new_vehicle_ownership_option_id" + ", " + "start_date"
-                    + ") VALUES (:v1, :v2, :v3, :v4)";
+    const std::string DB_INSERT_VEHICLE_OWNERSHIP_CHANGES = buildInsertQuery(schema + ".vehicle_ownership_changes", getInsertColumns());
     insertViaQuery(vehicleOwnershipChange,DB_INSERT_VEHICLE_OWNERSHIP_CHANGES);
 
 }
@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 #include <ctime>
+#include <stdexcept>
 #include <unistd.h>
 
 #include "GenConfig.h"
@@ -44,6 +45,7 @@
 #include "database/dao/VehicleOwnershipChangesDao.hpp"
 #include "database/dao/HouseholdDao.hpp"
 #include "database/dao/HouseholdUnitDao.hpp"
+#include "database/PG_BulkWriter.hpp"
 #include "util/HelperFunctions.hpp"
 #include "util/Statistics.hpp"
 
@@ -142,74 +144,79 @@ void loadDataToOutputSchema(db::DB_Connection& conn,std::string &currentOutputSc
         SimulationStartPointDao simStartPointDao(conn);
         simStartPointDao.insertSimulationStartPoint(*simStartPointObj.get(),currentOutputSchema);
 
+        //the new rows are streamed with COPY, by up to opSchemaWriters tables at the same time on separate
+        //connections. The rows of existing units and households are updated one at a time, as before
+        PG_BulkWriter bulkWriter(conn.getConnectionStr(), config.ltParams.opSchemaWriters);
+
         std::vector<boost::shared_ptr<Building> > buildings = developerModel.getBuildingsVec();
-        std::vector<boost::shared_ptr<Building> >::iterator buildingsItr;
         BuildingDao buildingDao(conn);
-        for(buildingsItr = buildings.begin(); buildingsItr != buildings.end(); ++buildingsItr)
-        {
-            buildingDao.insertBuilding(*(*buildingsItr),currentOutputSchema);
-        }
+        bulkWriter.addTable(buildingDao, currentOutputSchema + ".fm_building", BuildingDao::getInsertColumns(), buildings.begin(), buildings.end());
 
         std::vector<boost::shared_ptr<Parcel> > parcels = developerModel.getProfitableParcelsVec();
-        std::vector<boost::shared_ptr<Parcel> >::iterator parcelsItr;
         ParcelDao parcelDao(conn,"fm_parcel");
-        for(parcelsItr = parcels.begin(); parcelsItr != parcels.end(); ++parcelsItr)
-        {
-            parcelDao.insertParcel(*(*parcelsItr),currentOutputSchema);
-        }
+        bulkWriter.addTable(parcelDao, currentOutputSchema + ".fm_parcel", ParcelDao::getInsertColumns(), parcels.begin(), parcels.end());
 
         std::vector<boost::shared_ptr<Unit> > units = developerModel.getUnitsVec();
+        std::vector<boost::shared_ptr<Unit> > newUnits;
         std::vector<boost::shared_ptr<Unit> >::iterator unitsItr;
         UnitDao unitDao(conn);
         for(unitsItr = units.begin(); unitsItr != units.end(); ++unitsItr)
         {
-            unitDao.insertUnit(*(*unitsItr),currentOutputSchema);
+            if((*unitsItr)->isExistInDb())
+            {
+                unitDao.insertUnit(*(*unitsItr),currentOutputSchema);
+            }
+            else
+            {
+                newUnits.push_back(*unitsItr);
+            }
         }
+        bulkWriter.addTable(unitDao, currentOutputSchema + ".fm_unit_res", UnitDao::getInsertColumns(), newUnits.begin(), newUnits.end());
 
+        HM_Model::UnitList updatedUnits = housingMarketModel.getUnits();
+        updatedUnits.resize(100);
+        HM_Model::UnitList newUpdatedUnits;
+        HM_Model::UnitList::iterator updatedUnitsItr;
+        for(updatedUnitsItr = updatedUnits.begin(); updatedUnitsItr != updatedUnits.end(); ++updatedUnitsItr)
+        {
+            (*updatedUnitsItr)->setTimeOnMarket((*updatedUnitsItr)->getRemainingTimeOnMarket());
+            (*updatedUnitsItr)->setTimeOffMarket((*updatedUnitsItr)->getRemainingTimeOffMarket());
+            if((*updatedUnitsItr)->isExistInDb())
+            {
+                unitDao.insertUnit(*(*updatedUnitsItr),currentOutputSchema);
+            }
+            else
+            {
+                newUpdatedUnits.push_back(*updatedUnitsItr);
+            }
+        }
+        bulkWriter.addTable(unitDao, currentOutputSchema + ".fm_unit_res", UnitDao::getInsertColumns(), newUpdatedUnits.begin(), newUpdatedUnits.end());
 
         std::vector<boost::shared_ptr<Project> > projects = developerModel.getProjectsVec();
-        std::vector<boost::shared_ptr<Project> >::iterator projectsItr;
         ProjectDao projectDao(conn);
-        for(projectsItr = projects.begin(); projectsItr != projects.end(); ++projectsItr)
-        {
-            projectDao.insertProject(*(*projectsItr),currentOutputSchema);
-        }
+        bulkWriter.addTable(projectDao, currentOutputSchema + ".fm_project", ProjectDao::getInsertColumns(), projects.begin(), projects.end());
 
         std::vector<boost::shared_ptr<Bid> > bids = housingMarketModel.getNewBids();
-        std::vector<boost::shared_ptr<Bid> >::iterator bidsItr;
         BidDao bidDao(conn);
-        for(bidsItr = bids.begin(); bidsItr != bids.end(); ++bidsItr)
-        {
-            bidDao.insertBid(*(*bidsItr),currentOutputSchema);
-        }
+        bulkWriter.addTable(bidDao, currentOutputSchema + ".bids", BidDao::getInsertColumns(), bids.begin(), bids.end());
 
         std::vector<boost::shared_ptr<UnitSale> > unitSales = housingMarketModel.getUnitSales();
-        std::vector<boost::shared_ptr<UnitSale> >::iterator unitSalesItr;
         UnitSaleDao unitSaleDao(conn);
-        for(unitSalesItr = unitSales.begin(); unitSalesItr != unitSales.end(); ++unitSalesItr)
-        {
-            unitSaleDao.insertUnitSale(*(*unitSalesItr),currentOutputSchema);
-        }
+        bulkWriter.addTable(unitSaleDao, currentOutputSchema + ".unit_sale", UnitSaleDao::getInsertColumns(), unitSales.begin(), unitSales.end());
 
         std::vector<boost::shared_ptr<DevelopmentPlan> > devPlans = developerModel.getDevelopmentPlansVec();
-        std::vector<boost::shared_ptr<DevelopmentPlan> >::iterator devPlansItr;
         DevelopmentPlanDao devPlanDao(conn);
-        for(devPlansItr = devPlans.begin(); devPlansItr != devPlans.end(); ++devPlansItr)
-        {
-            devPlanDao.insertDevelopmentPlan(*(*devPlansItr),currentOutputSchema);
-        }
+        bulkWriter.addTable(devPlanDao, currentOutputSchema + ".development_plans", DevelopmentPlanDao::getInsertColumns(), devPlans.begin(), devPlans.end());
 
         std::vector<boost::shared_ptr<VehicleOwnershipChanges> > vehicleOwnershipChanges = housingMarketModel.getVehicleOwnershipChanges();
-        std::vector<boost::shared_ptr<VehicleOwnershipChanges> >::iterator vehOwnChangeItr;
         VehicleOwnershipChangesDao vehOwnChangeDao(conn);
-        for(vehOwnChangeItr = vehicleOwnershipChanges.begin(); vehOwnChangeItr != vehicleOwnershipChanges.end(); ++vehOwnChangeItr)
-        {
-            vehOwnChangeDao.insertVehicleOwnershipChanges(*(*vehOwnChangeItr),currentOutputSchema);
-        }
+        bulkWriter.addTable(vehOwnChangeDao, currentOutputSchema + ".vehicle_ownership_changes", VehicleOwnershipChangesDao::getInsertColumns(),
+                            vehicleOwnershipChanges.begin(), vehicleOwnershipChanges.end());
 
         HouseholdDao hhDao(conn);
 
         HM_Model::HouseholdList *households = housingMarketModel.getHouseholdList();
+        HM_Model::HouseholdList newHouseholds;
         HM_Model::HouseholdList::iterator houseHoldItr;
         for(houseHoldItr = households->begin(); houseHoldItr != households->end(); ++houseHoldItr)
         {
@@ -220,25 +227,27 @@ void loadDataToOutputSchema(db::DB_Connection& conn,std::string &currentOutputSc
                     {
                         (*houseHoldItr)->setExistInDB(true);
                     }
-                    hhDao.insertHousehold(*(*houseHoldItr),currentOutputSchema);
+
+                    if((*houseHoldItr)->getExistInDB())
+                    {
+                        hhDao.insertHousehold(*(*houseHoldItr),currentOutputSchema);
+                    }
+                    else
+                    {
+                        newHouseholds.push_back(*houseHoldItr);
+                    }
                 }
         }
+        bulkWriter.addTable(hhDao, currentOutputSchema + ".household", HouseholdDao::getInsertColumns(), newHouseholds.begin(), newHouseholds.end());
 
         std::vector<boost::shared_ptr<HouseholdUnit> > hhUnits = housingMarketModel.getNewHouseholdUnits();
         HouseholdUnitDao hhUnitDao(conn);
-        for (boost::shared_ptr<HouseholdUnit> hhUnit :hhUnits)
-        {
-            hhUnitDao.insertHouseholdUnit(*hhUnit,currentOutputSchema);
-        }
+        bulkWriter.addTable(hhUnitDao, currentOutputSchema + ".household_unit", HouseholdUnitDao::getInsertColumns(), hhUnits.begin(), hhUnits.end());
 
-        HM_Model::UnitList updatedUnits = housingMarketModel.getUnits();
-        updatedUnits.resize(100);
-        HM_Model::UnitList::iterator updatedUnitsItr;
-        for(updatedUnitsItr = updatedUnits.begin(); updatedUnitsItr != updatedUnits.end(); ++updatedUnitsItr)
+        //a failed table ends the run, as a database error of the inserts did
+        if(!bulkWriter.write())
         {
-            (*updatedUnitsItr)->setTimeOnMarket((*updatedUnitsItr)->getRemainingTimeOnMarket());
-            (*updatedUnitsItr)->setTimeOffMarket((*updatedUnitsItr)->getRemainingTimeOffMarket());
-            unitDao.insertUnit(*(*updatedUnitsItr),currentOutputSchema);
+            throw std::runtime_error("Failed to write some tables to output schema " + currentOutputSchema);
         }
 
         SimulationStoppedPointDao simStoppedPointDao(conn);
@@ -405,6 +414,7 @@ void performMain(int simulationNumber, std::list<std::string>& resLogFiles)
         PrintOutV("XML Config currentOutputSchema " << config.ltParams.currentOutputSchema << endl);
         PrintOutV("XML Config opSchemaloadingInterval " << config.ltParams.opSchemaloadingInterval << endl);
         PrintOutV("XML Config initialLoading " << config.ltParams.initialLoading << endl);
+        PrintOutV("XML Config startup loaders " << config.ltParams.startupLoaders << endl);
         PrintOutV("XML Config launch BTO " << config.ltParams.launchBTO << endl);
         PrintOutV("XML Config launch private presale " << config.ltParams.launchPrivatePresale << endl);
         
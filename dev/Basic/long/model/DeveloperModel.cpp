@@ -12,6 +12,7 @@
 #include "DeveloperModel.hpp"
 #include "util/LangHelpers.hpp"
 #include "util/HelperFunctions.hpp"
+#include "util/ParallelTableLoader.hpp"
 #include "agent/impl/DeveloperAgent.hpp"
 #include "core/AgentsLookup.hpp"
 #include "database/DB_Connection.hpp"
@@ -102,87 +103,110 @@ void DeveloperModel::startImpl() {
 
     if (conn.isConnected())
     {
-        ParcelsWithHDB *HDB_Parcel = nullptr;
-        if(initLoading)
-        {
-            loadData<ParcelsWithHDBDao>(conn,parcelsWithHDB,parcelsWithHDB_ById,&ParcelsWithHDB::getFmParcelId);
-            PrintOutV("Parcels with HDB loaded " << parcelsWithHDB.size() << std::endl);
-            HDB_Parcel->saveParcelsWithHDB(parcelsWithHDB,"parcelsWithHDB");
-        }
+        //independent tables are loaded at the same time, each loader on its own connections.
+        const std::string& mainSchema = config.schemas.main_schema;
+        const std::string& calibrationSchema = config.schemas.calibration_schema;
+        ParallelTableLoader loader(dbConfig, config.ltParams.startupLoaders);
 
-        if(!initLoading)
+        if(initLoading)
         {
-            parcelsWithHDB = HDB_Parcel->loadSerializedData();
-            indexData(parcelsWithHDB,parcelsWithHDB_ById,&ParcelsWithHDB::getFmParcelId);
-            PrintOutV("parcelsWithHDB loaded from disk"<<parcelsWithHDB.size() << std::endl );
+            loader.addTable<ParcelsWithHDBDao>("parcels_with_hdb", mainSchema, parcelsWithHDB, parcelsWithHDB_ById, &ParcelsWithHDB::getFmParcelId);
         }
 
         //Load developers
-        //loadData<DeveloperDao>(conn, developers);
+        //loader.addTable<DeveloperDao>("developer", mainSchema, developers);
         //Load templates
-        loadData<TemplateDao>(conn, templates);
+        loader.addTable<TemplateDao>("template", mainSchema, templates);
         //Load parcels
-        loadData<ParcelDao>(conn_scenario, parcelTable, initParcelList, parcelsById, &Parcel::getId);
-        ParcelDao parcelDao(conn,parcelTable);
-        emptyParcels = parcelDao.getEmptyParcels();
-        //Index all empty parcels.
-        for (ParcelList::iterator it = emptyParcels.begin(); it != emptyParcels.end(); it++) {
-            emptyParcelsById.insert(std::make_pair((*it)->getId(), *it));
-        }
-
-        freeholdParcels = parcelDao.getFreeholdParcels();
-        //Index all freehold parcels.
-        for (ParcelList::iterator it = freeholdParcels.begin(); it != freeholdParcels.end(); it++) {
-            freeholdParcelsById.insert(std::make_pair((*it)->getId(), *it));
-        }
-
-        PostcodeDao postcodeDao(conn);
-        postcodes = postcodeDao.getPostcodeByTaz();
-        for (PostcodeList::iterator it = postcodes.begin(); it != postcodes.end(); it++) {
-            postcodeByTaz.insert(std::make_pair((*it)->getTazId(), *it));
-        }
+        loader.addTable("parcels", scenarioSchema, [this, &parcelTable](DB_Connection& c)
+        {
+            loadData<ParcelDao>(c, parcelTable, initParcelList, parcelsById, &Parcel::getId);
+            return initParcelList.size();
+        });
+        loader.addTable("empty_parcels", mainSchema, [this, &parcelTable](DB_Connection& c)
+        {
+            ParcelDao parcelDao(c,parcelTable);
+            emptyParcels = parcelDao.getEmptyParcels();
+            indexData(emptyParcels, emptyParcelsById, &Parcel::getId);
+            return emptyParcels.size();
+        });
+        loader.addTable("freehold_parcels", mainSchema, [this, &parcelTable](DB_Connection& c)
+        {
+            ParcelDao parcelDao(c,parcelTable);
+            freeholdParcels = parcelDao.getFreeholdParcels();
+            indexData(freeholdParcels, freeholdParcelsById, &Parcel::getId);
+            return freeholdParcels.size();
+        });
+        loader.addTable("postcode_by_taz", mainSchema, [this](DB_Connection& c)
+        {
+            PostcodeDao postcodeDao(c);
+            postcodes = postcodeDao.getPostcodeByTaz();
+            indexData(postcodes, postcodeByTaz, &Postcode::getTazId);
+            return postcodes.size();
+        });
         //load DevelopmentType-Templates
-        loadData<DevelopmentTypeTemplateDao>(conn, developmentTypeTemplates);
+        loader.addTable<DevelopmentTypeTemplateDao>("development_type_template", mainSchema, developmentTypeTemplates);
         //load Template - UnitType
-        loadData<TemplateUnitTypeDao>(conn, templateUnitTypes);
+        loader.addTable<TemplateUnitTypeDao>("template_unit_type", mainSchema, templateUnitTypes);
         //load the unit types
-        loadData<UnitTypeDao>(conn, unitTypes, unitTypeById,&UnitType::getId);
+        loader.addTable<UnitTypeDao>("unit_type", mainSchema, unitTypes, unitTypeById, &UnitType::getId);
         //load buildings
-        loadData<BuildingDao>(conn,buildings);
+        loader.addTable<BuildingDao>("building", mainSchema, buildings);
 
-        loadData<ParcelAmenitiesDao>(conn,amenities,amenitiesById,&ParcelAmenities::getFmParcelId);
+        loader.addTable<ParcelAmenitiesDao>("parcel_amenities", mainSchema, amenities, amenitiesById, &ParcelAmenities::getFmParcelId);
 
-        loadData<MacroEconomicsDao>(conn,macroEconomics,macroEconomicsById,&MacroEconomics::getExFactorId);
+        loader.addTable<MacroEconomicsDao>("macro_economics", mainSchema, macroEconomics, macroEconomicsById, &MacroEconomics::getExFactorId);
 
         //commented as this is not used in 2012 now.
-        //loadData<LogsumForDevModelDao>(conn,accessibilityList,accessibilityByTazId,&LogsumForDevModel::gettAZ2012Id);
+        //loader.addTable<LogsumForDevModelDao>("logsum_for_dev_model", mainSchema, accessibilityList, accessibilityByTazId, &LogsumForDevModel::gettAZ2012Id);
 
-        //loadData<TAO_Dao>(conn_calibration,taoList,taoByQuarterStr,&TAO::getQuarter);
-        //PrintOutV("TAO by quarters loaded " << taoList.size() << std::endl);
-        loadTAO(conn_calibration);
+        loader.addTable("tao", calibrationSchema, [this](DB_Connection& c) { loadTAO(c); return taoList.size(); });
+        loader.addTable<UnitPriceSumDao>("unit_price_sum", mainSchema, unitPriceSumList, unitPriceSumByParcelId, &UnitPriceSum::getFmParcelId);
+        loader.addTable<TazLevelLandPriceDao>("taz_level_land_price", calibrationSchema, tazLevelLandPriceList, tazLevelLandPriceByTazId, &TazLevelLandPrice::getTazId);
+        loader.addTable<BuildingAvgAgePerParcelDao>("building_avg_age_per_parcel", mainSchema, buildingAvgAgePerParcel, BuildingAvgAgeByParceld, &BuildingAvgAgePerParcel::getFmParcelId);
+        loader.addTable<ROILimitsDao>("roi_limits", calibrationSchema, roiLimits, roiLimitsByDevTypeId, &ROILimits::getDevelopmentTypeId);
 
-        loadData<UnitPriceSumDao>(conn,unitPriceSumList,unitPriceSumByParcelId,&UnitPriceSum::getFmParcelId);
-        PrintOutV("unit price sums loaded " << unitPriceSumList.size() << std::endl);
+        if(config.ltParams.launchBTO)
+        {
+            loader.addTable("bto_units", mainSchema, [this](DB_Connection& c)
+            {
+                std::tm currentSimYear = getDateBySimDay(simYear,0);
+                UnitDao unitDao(c);
+                btoUnits = unitDao.getBTOUnits(currentSimYear);
+                return btoUnits.size();
+            });
+        }
+        if(config.ltParams.launchPrivatePresale)
+        {
+            loader.addTable("private_presale_units", mainSchema, [this](DB_Connection& c)
+            {
+                UnitDao unitDao(c);
+                privatePresaleUnits = unitDao.getPrivatePresaleUnits();
+                return privatePresaleUnits.size();
+            });
+        }
 
-        loadData<TazLevelLandPriceDao>(conn_calibration,tazLevelLandPriceList,tazLevelLandPriceByTazId,&TazLevelLandPrice::getTazId);
-        PrintOutV("land values loaded " << tazLevelLandPriceList.size() << std::endl);
+        loader.addTable("hedonic_coeffs", mainSchema, [this](DB_Connection& c) { loadHedonicCoeffs(c); return hedonicCoefficientsList.size(); });
+        loader.addTable("lag_private_t", mainSchema, [this](DB_Connection& c) { loadPrivateLagT(c); return privateLagsList.size(); });
+        loader.addTable("hedonic_logsums", mainSchema, [this](DB_Connection& c) { loadHedonicLogsums(c); return hedonicLogsumsList.size(); });
+        loader.addTable("hedonic_coeffs_by_unit_type", mainSchema, [this](DB_Connection& c) { loadHedonicCoeffsByUnitType(c); return hedonicCoefficientsByUnitTypeList.size(); });
+        loader.addTable("tao_by_unit_type", mainSchema, [this](DB_Connection& c) { loadTaoByUnitType(c); return taoByUnitTypeList.size(); });
+        loader.addTable("private_lag_by_unit_type", mainSchema, [this](DB_Connection& c) { loadPrivateLagTByUT(c); return lagPrivateTByUTList.size(); });
 
-        loadData<BuildingAvgAgePerParcelDao>(conn,buildingAvgAgePerParcel,BuildingAvgAgeByParceld,&BuildingAvgAgePerParcel::getFmParcelId);
-        PrintOutV("building average age per parcel loaded " << buildingAvgAgePerParcel.size() << std::endl);
-        loadData<ROILimitsDao>(conn_calibration,roiLimits,roiLimitsByDevTypeId,&ROILimits::getDevelopmentTypeId);
-        PrintOutV("roi limits loaded " << roiLimits.size() << std::endl);
+        loader.run();
+        loader.printReport();
 
-        std::tm currentSimYear = getDateBySimDay(simYear,0);
-        UnitDao unitDao(conn);
-        if(config.ltParams.launchBTO)
+        ParcelsWithHDB *HDB_Parcel = nullptr;
+        if(initLoading)
         {
-            btoUnits = unitDao.getBTOUnits(currentSimYear);
+            HDB_Parcel->saveParcelsWithHDB(parcelsWithHDB,"parcelsWithHDB");
         }
-        if(config.ltParams.launchPrivatePresale)
+        else
         {
-            privatePresaleUnits = unitDao.getPrivatePresaleUnits();
+            parcelsWithHDB = HDB_Parcel->loadSerializedData();
+            indexData(parcelsWithHDB,parcelsWithHDB_ById,&ParcelsWithHDB::getFmParcelId);
+            PrintOutV("parcelsWithHDB loaded from disk"<<parcelsWithHDB.size() << std::endl );
         }
-        //ongoingBtoUnits = unitDao.getOngoingBTOUnits(currentSimYear);
 
         setRealEstateAgentIds(housingMarketModel->getRealEstateAgentIds());
 
@@ -200,6 +224,7 @@ void DeveloperModel::startImpl() {
                 projectIdForDevAgent = simStoppedPointList[simStoppedPointList.size()-1]->getProjectId();
             }
 
+            ParcelDao parcelDao(conn,parcelTable);
             parcelsWithOngoingProjects = parcelDao.getParcelsWithOngoingProjects(config.schemas.main_schema);
             //Index all parcels with ongoing projects.
             for (ParcelList::iterator it = parcelsWithOngoingProjects.begin(); it != parcelsWithOngoingProjects.end(); it++) {
@@ -225,12 +250,6 @@ void DeveloperModel::startImpl() {
             projectIdForDevAgent = config.ltParams.developerModel.initialProjectId;
         }
 
-        loadHedonicCoeffs(conn);
-        loadPrivateLagT(conn);
-        loadHedonicLogsums(conn);
-        loadHedonicCoeffsByUnitType(conn);
-        loadTaoByUnitType(conn);
-        loadPrivateLagTByUT(conn);
     }
 
 
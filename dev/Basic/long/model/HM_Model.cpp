@@ -63,6 +63,7 @@
 #include "core/DataManager.hpp"
 #include "core/AgentsLookup.hpp"
 #include "util/HelperFunctions.hpp"
+#include "util/ParallelTableLoader.hpp"
 #include "conf/ConfigManager.hpp"
 #include "conf/ConfigParams.hpp"
 #include "message/LT_Message.hpp"
@@ -81,6 +82,7 @@
 #include "model/JobAssignmentModel.hpp"
 #include "model/HedonicPriceSubModel.hpp"
 #include "model/SchoolAssignmentSubModel.hpp"
+#include "model/ScreeningSubModel.hpp"
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
@@ -614,8 +616,7 @@ double HM_Model::ComputeHedonicPriceLogsumFromMidterm(BigSerial taz)
 
     for(int n = 0; n < tazLogsumWeights.size(); n++)
     {
-        PersonParams personParam = PredayLT_LogsumManager::getInstance().computeLogsum( tazLogsumWeights[n]->getIndividualId(), taz, workTaz, vehicleOwnership );
-        double lg = personParam.getDpbLogsum();
+        double lg = logsumCache.getDpbLogsum( tazLogsumWeights[n]->getIndividualId(), taz, workTaz, vehicleOwnership );
         double weight = tazLogsumWeights[n]->getWeight();
 
         Individual *individual = this->getIndividualById(tazLogsumWeights[n]->getIndividualId());
@@ -1030,6 +1031,11 @@ std::vector<PopulationPerPlanningArea*> HM_Model::getPopulationByPlanningAreaId(
     return populationPPAvector;
 }
 
+const HM_Model::PopulationPerPlanningAreaList& HM_Model::getPopulationPerPlanningArea() const
+{
+    return populationPerPlanningArea;
+}
+
 
 HM_Model::HitsIndividualLogsumList HM_Model::getHitsIndividualLogsumVec() const
 {
@@ -1491,6 +1497,12 @@ void HM_Model::startImpl()
     resume = config.ltParams.resume;
     conn.setSchema(config.schemas.main_schema);
     PredayLT_LogsumManager::getInstance();
+
+    logsumCache.setEnabled(config.ltParams.logsumCache.enabled);
+    if (config.ltParams.logsumCache.enabled && !config.ltParams.logsumCache.file.empty())
+    {
+        logsumCache.load(config.ltParams.logsumCache.file);
+    }
     DB_Connection conn_calibration(sim_mob::db::POSTGRES, dbConfig);
     conn_calibration.connect();
     conn_calibration.setSchema(config.schemas.calibration_schema);
@@ -1503,270 +1515,143 @@ void HM_Model::startImpl()
 
     if (conn.isConnected() && conn_calibration.isConnected())
     {
-        loadLTVersion(conn);
-        loadStudyAreas(conn);
-        loadResidentialWTP_Coeffs(conn_calibration);
-
-        loadData<ScreeningModelFactorsDao>( conn_calibration, screeningModelFactorsList, screeningModelFactorsMap, &ScreeningModelFactors::getId );
-        PrintOutV("Number of screening Model Factors: " << screeningModelFactorsList.size() << std::endl );
+        //independent tables are loaded at the same time, each loader on its own connections.
+        const std::string& mainSchema = config.schemas.main_schema;
+        const std::string& calibrationSchema = config.schemas.calibration_schema;
+        ParallelTableLoader loader(dbConfig, config.ltParams.startupLoaders);
 
+        loader.addTable("lt_version", mainSchema, [this](DB_Connection& c) { loadLTVersion(c); return ltVersionList.size(); });
+        loader.addTable("study_area", mainSchema, [this](DB_Connection& c) { loadStudyAreas(c); return studyAreas.size(); });
+        loader.addTable("residential_wtp_coefficients", calibrationSchema, [this](DB_Connection& c) { loadResidentialWTP_Coeffs(c); return resWTP_Coeffs.size(); });
+        loader.addTable<ScreeningModelFactorsDao>("screening_model_factors", calibrationSchema, screeningModelFactorsList, screeningModelFactorsMap, &ScreeningModelFactors::getId);
 
         if(config.ltParams.schoolAssignmentModel.enabled)
         {
-            loadSchools(conn);
-            loadTravelTime(conn_calibration);
-            loadEzLinkStops(conn_calibration);
-            loadStudentStops(conn_calibration);
-            loadSchoolDesks(conn);
-
-            loadData<HouseholdPlanningAreaDao>( conn, hhPlanningAreaList, hhPlanningAreaMap, &HouseholdPlanningArea::getHouseHoldId);
-            PrintOutV("Number of household planning area rows: " << hhPlanningAreaList.size() << std::endl );
-
-            loadData<HHCoordinatesDao>( conn, hhCoordinates, hhCoordinatesById, &HHCoordinates::getHouseHoldId);
-            PrintOutV("Number of household coordinate rows: " << hhCoordinates.size() << std::endl );
-
-            loadData<SchoolAssignmentCoefficientsDao>( conn_calibration, schoolAssignmentCoefficients, SchoolAssignmentCoefficientsById, &SchoolAssignmentCoefficients::getParameterId);
-            PrintOutV("Number of School Assignment Coefficients rows: " << schoolAssignmentCoefficients.size() << std::endl );
-
-            assignNearestUniToEzLinkStops();
-            assignNearestPolytechToEzLinkStops();
-
-        }
-
-        if(config.ltParams.jobAssignmentModel.enabled)
-        {
-            loadJobsByTazAndIndustryType(conn);
-            loadJobAssignments(conn);
-            loadJobsByTazAndIndustryType(conn);
-        }
-
-        {
-            soci::session sql;
-            sql.open(soci::postgresql, conn.getConnectionStr());
-
-            std::string storedProc = config.schemas.calibration_schema + "workers_grp_by_logsum_params";
-
-            //SQL statement
-            soci::rowset<WorkersGrpByLogsumParams> workers_grp_by_logsum_params = (sql.prepare << "select * from " + storedProc);
-
-            for (soci::rowset<WorkersGrpByLogsumParams>::const_iterator itWorkersGrpByLogsumParams = workers_grp_by_logsum_params.begin();
-                                                                        itWorkersGrpByLogsumParams  != workers_grp_by_logsum_params.end();
-                                                                        ++itWorkersGrpByLogsumParams )
+            loader.addTable("school", mainSchema, [this](DB_Connection& c) { loadSchools(c); return schools.size(); });
+            loader.addTable("travel_time", calibrationSchema, [this](DB_Connection& c) { loadTravelTime(c); return travelTimeByOriginDestTaz.size(); });
+            loader.addTable("ez_link_stop", calibrationSchema, [this](DB_Connection& c) { loadEzLinkStops(c); return ezLinkStops.size(); });
+            loader.addTable("student_stop", calibrationSchema, [this](DB_Connection& c) { loadStudentStops(c); return studentStops.size(); });
+            loader.addTable("school_desk", mainSchema, [this](DB_Connection& c) { loadSchoolDesks(c); return schoolDesksBySchoolId.size(); });
+            loader.addTable<HouseholdPlanningAreaDao>("household_planning_area", mainSchema, hhPlanningAreaList, hhPlanningAreaMap, &HouseholdPlanningArea::getHouseHoldId);
+            loader.addTable<HHCoordinatesDao>("household_coordinates", mainSchema, hhCoordinates, hhCoordinatesById, &HHCoordinates::getHouseHoldId);
+            loader.addTable<SchoolAssignmentCoefficientsDao>("school_assignment_coefficients", calibrationSchema, schoolAssignmentCoefficients, SchoolAssignmentCoefficientsById, &SchoolAssignmentCoefficients::getParameterId);
+
+            loader.addTable("primary_school_individuals", mainSchema, [this, simYear](DB_Connection& c)
             {
-                WorkersGrpByLogsumParams* this_row = new WorkersGrpByLogsumParams(*itWorkersGrpByLogsumParams );
-                workersGrpByLogsumParams.push_back(this_row);
-                workersGrpByLogsumParamsById.insert(std::make_pair(this_row->getIndividualId(), this_row));
-            }
-
-            PrintOutV("Number of WorkersGrpByLogsumParams: " << workersGrpByLogsumParams.size() << std::endl );
-        }
-
-
-
-        {
-            soci::session sql;
-            sql.open(soci::postgresql, conn.getConnectionStr());
-
-            std::string storedProc = conn.getSchema() + "building_match";
-
-            //SQL statement
-            soci::rowset<BuildingMatch> buildingMatchsql = (sql.prepare << "select * from " + storedProc);
-
-            for (soci::rowset<BuildingMatch>::const_iterator itBuildingMatch   = buildingMatchsql.begin();
-                                                             itBuildingMatch  != buildingMatchsql.end();
-                                                           ++itBuildingMatch )
+                std::tm currentSimYear = getDateBySimDay(simYear,0);
+                IndividualDao indDao(c);
+                primarySchoolIndList = indDao.getPrimarySchoolIndividual(currentSimYear);
+                indexData(primarySchoolIndList, primarySchoolIndById, &Individual::getId);
+                return primarySchoolIndList.size();
+            });
+
+            loader.addTable("pre_school_individuals", mainSchema, [this, simYear](DB_Connection& c)
             {
-                BuildingMatch* this_row = new BuildingMatch(*itBuildingMatch );
-                buildingMatch.push_back(this_row);
-                buildingMatchById.insert(std::make_pair(this_row->getFm_building(), this_row));
-            }
-
-            PrintOutV("Number of BuildingMatch: " << buildingMatch.size() << std::endl );
+                std::tm currentSimYear = getDateBySimDay(simYear,0);
+                IndividualDao indDao(c);
+                preSchoolIndList = indDao.getPreSchoolIndividual(currentSimYear);
+                indexData(preSchoolIndList, preSchoolIndById, &Individual::getId);
+                return preSchoolIndList.size();
+            });
         }
 
-
+        if(config.ltParams.jobAssignmentModel.enabled)
         {
-            soci::session sql;
-            sql.open(soci::postgresql, conn.getConnectionStr());
-
-            std::string storedProc = conn.getSchema() + "sla_building";
-
-            //SQL statement
-            soci::rowset<SlaBuilding> slaBuildingsql = (sql.prepare << "select * from " + storedProc);
-
-            for (soci::rowset<SlaBuilding>::const_iterator itBuildingMatch   = slaBuildingsql.begin();
-                                                           itBuildingMatch  != slaBuildingsql.end();
-                                                         ++itBuildingMatch )
+            loader.addTable("jobs_with_taz_and_industry_type", mainSchema, [this](DB_Connection& c)
             {
-                SlaBuilding* this_row = new SlaBuilding(*itBuildingMatch );
-                slaBuilding.push_back(this_row);
-                slaBuildingById.insert(std::make_pair(this_row->getSla_building_id(), this_row));
-            }
-
-            PrintOutV("Number of Sla Buildings: " << slaBuilding.size() << std::endl );
+                //loaded twice, as it was before the tables were loaded in parallel.
+                loadJobsByTazAndIndustryType(c);
+                loadJobsByTazAndIndustryType(c);
+                return jobsWithTazAndIndustryType.size();
+            });
+            loader.addTable("job_assignment_coefficients", mainSchema, [this](DB_Connection& c) { loadJobAssignments(c); return jobAssignmentCoeffs.size(); });
         }
 
-        loadData<LogsumMtzV2Dao>( conn_calibration, logsumMtzV2, logsumMtzV2ById, &LogsumMtzV2::getTazId );
-        PrintOutV("Number of LogsumMtzV2: " << logsumMtzV2.size() << std::endl );
-
-        loadData<ScreeningModelCoefficientsDao>( conn_calibration, screeningModelCoefficientsList, screeningModelCoefficicientsMap, &ScreeningModelCoefficients::getId );
-        PrintOutV("Number of screening Model Coefficients: " << screeningModelCoefficientsList.size() << std::endl );
+        loader.addTable("workers_grp_by_logsum_params", mainSchema, [this](DB_Connection& c) { loadWorkersGrpByLogsumParams(c); return workersGrpByLogsumParams.size(); });
+        loader.addTable("building_match", mainSchema, [this](DB_Connection& c) { loadBuildingMatch(c); return buildingMatch.size(); });
+        loader.addTable("sla_building", mainSchema, [this](DB_Connection& c) { loadSlaBuildings(c); return slaBuilding.size(); });
+        loader.addTable<LogsumMtzV2Dao>("logsum_mtz_v2", calibrationSchema, logsumMtzV2, logsumMtzV2ById, &LogsumMtzV2::getTazId);
+        loader.addTable<ScreeningModelCoefficientsDao>("screening_model_coefficients", calibrationSchema, screeningModelCoefficientsList, screeningModelCoefficicientsMap, &ScreeningModelCoefficients::getId);
 
         //if initial loading load data from database. otherwise load data from binary files saved in the disk from the initial run.
         if(initialLoading)
         {
-
-            //Load households
-            loadData<HouseholdDao>(conn, households, householdsById, &Household::getId);
-            PrintOutV("Number of households: " << households.size() << " Households used: " << households.size()  << std::endl);
-
-            //load individuals
-            loadData<IndividualDao>(conn, individuals, individualsById, &Individual::getId);
-            PrintOutV("Initial Individuals: " << individuals.size() << std::endl);
-
-            loadData<AlternativeHedonicPriceDao>( conn, alternativeHedonicPrices, alternativeHedonicPriceById, &AlternativeHedonicPrice::getId );
-            PrintOutV("Number of Alternative Hedonic Price rows: " << alternativeHedonicPrices.size() << std::endl );
-
-            loadData<ZonalLanduseVariableValuesDao>( conn_calibration, zonalLanduseVariableValues, zonalLanduseVariableValuesById, &ZonalLanduseVariableValues::getAltId );
-            PrintOutV("Number of zonal landuse variable values: " << zonalLanduseVariableValues.size() << std::endl );
-
-            loadData<PopulationPerPlanningAreaDao>( conn, populationPerPlanningArea, populationPerPlanningAreaById, &PopulationPerPlanningArea::getPlanningAreaId );
-            PrintOutV("Number of PopulationPerPlanningArea rows: " << populationPerPlanningArea.size() << std::endl );
-
-            loadData<DistanceMRTDao>( conn, mrtDistances, mrtDistancesById, &DistanceMRT::getHouseholdId);
-            PrintOutV("Number of mrt distances: " << mrtDistances.size() << std::endl );
-
-            loadData<AwakeningDao>(conn_calibration, awakening, awakeningById,  &Awakening::getId);
-            PrintOutV("Awakening probability: " << awakening.size() << std::endl );
+            loader.addTable<HouseholdDao>("household", mainSchema, households, householdsById, &Household::getId);
+            loader.addTable<IndividualDao>("individual", mainSchema, individuals, individualsById, &Individual::getId);
+            loader.addTable<AlternativeHedonicPriceDao>("alternative_hedonic_price", mainSchema, alternativeHedonicPrices, alternativeHedonicPriceById, &AlternativeHedonicPrice::getId);
+            loader.addTable<ZonalLanduseVariableValuesDao>("zonal_landuse_variable_values", calibrationSchema, zonalLanduseVariableValues, zonalLanduseVariableValuesById, &ZonalLanduseVariableValues::getAltId);
+            loader.addTable<PopulationPerPlanningAreaDao>("population_per_planning_area", mainSchema, populationPerPlanningArea, populationPerPlanningAreaById, &PopulationPerPlanningArea::getPlanningAreaId);
+            loader.addTable<DistanceMRTDao>("distance_mrt", mainSchema, mrtDistances, mrtDistancesById, &DistanceMRT::getHouseholdId);
+            loader.addTable<AwakeningDao>("awakening", calibrationSchema, awakening, awakeningById, &Awakening::getId);
         }
 
-        //Load units
-        loadData<UnitDao>(conn, units, unitsById, &Unit::getId);
+        loader.addTable<UnitDao>("unit", mainSchema, units, unitsById, &Unit::getId);
         if(config.ltParams.launchPrivatePresale)
         {
-            UnitDao unitDao(conn);
-            privatePresaleUnits =  unitDao.getPrivatePresaleUnits();
-            for (UnitList::const_iterator it = privatePresaleUnits.begin(); it != privatePresaleUnits.end(); it++)
+            loader.addTable("private_presale_units", mainSchema, [this](DB_Connection& c)
             {
-                privatePresaleUnitsMap.insert(std::make_pair((*it)->getId(), (*it)->getId()));
-            }
+                UnitDao unitDao(c);
+                privatePresaleUnits = unitDao.getPrivatePresaleUnits();
+                for (UnitList::const_iterator it = privatePresaleUnits.begin(); it != privatePresaleUnits.end(); it++)
+                {
+                    privatePresaleUnitsMap.insert(std::make_pair((*it)->getId(), (*it)->getId()));
+                }
+                return privatePresaleUnits.size();
+            });
         }
 
-        PrintOutV("Number of units: " << units.size() << ". Units Used: " << units.size() << std::endl);
+        loader.addTable("pending_households", mainSchema, [this, simYear](DB_Connection& c)
+        {
+            HouseholdDao hhDao(c);
+            std::tm currentSimYear = getDateBySimDay(simYear,0);
+            std::tm lastDayOfCurrentSimYear = getDateBySimDay(simYear,364);
+            pendingHouseholds = hhDao.getPendingHouseholds(currentSimYear,lastDayOfCurrentSimYear);
+            return pendingHouseholds.size();
+        });
+
+        loader.addTable<UnitTypeDao>("unit_type", mainSchema, unitTypes, unitTypesById, &UnitType::getId);
+        loader.addTable<PostcodeDao>("postcode", mainSchema, postcodes, postcodesById, &Postcode::getAddressId);
+        loader.addTable<VehicleOwnershipCoefficientsDao>("vehicle_ownership_coefficients", mainSchema, vehicleOwnershipCoeffs, vehicleOwnershipCoeffsById, &VehicleOwnershipCoefficients::getVehicleOwnershipOptionId);
+        loader.addTable<TaxiAccessCoefficientsDao>("taxi_access_coefficients", calibrationSchema, taxiAccessCoeffs, taxiAccessCoeffsById, &TaxiAccessCoefficients::getParameterId);
+        loader.addTable<EstablishmentDao>("establishment", mainSchema, establishments, establishmentsById, &Establishment::getId);
+        loader.addTable<JobDao>("job", mainSchema, jobs, jobsById, &Job::getId);
+        loader.addTable<HousingInterestRateDao>("housing_interest_rate", mainSchema, housingInterestRates, housingInterestRatesById, &HousingInterestRate::getId);
+        loader.addTable<LogSumVehicleOwnershipDao>("vehicle_ownership_logsum", mainSchema, vehicleOwnershipLogsums, vehicleOwnershipLogsumById, &LogSumVehicleOwnership::getHouseholdId);
+        loader.addTable<TazDao>("taz", mainSchema, tazs, tazById, &Taz::getId);
+        loader.addTable<HouseHoldHitsSampleDao>("household_hits_sample", mainSchema, houseHoldHits, houseHoldHitsById, &HouseHoldHitsSample::getHouseholdId);
+        loader.addTable<TazLogsumWeightDao>("taz_logsum_weight", calibrationSchema, tazLogsumWeights, tazLogsumWeightById, &TazLogsumWeight::getGroupLogsum);
+        loader.addTable<PlanningAreaDao>("planning_area", mainSchema, planningArea, planningAreaById, &PlanningArea::getId);
+        loader.addTable<PlanningSubzoneDao>("planning_subzone", mainSchema, planningSubzone, planningSubzoneById, &PlanningSubzone::getId);
+        loader.addTable<MtzDao>("mtz", mainSchema, mtz, mtzById, &Mtz::getId);
+        loader.addTable<MtzTazDao>("mtz_taz", mainSchema, mtzTaz, mtzTazById, &MtzTaz::getMtzId);
+        loader.addTable<AlternativeDao>("alternative", calibrationSchema, alternative, alternativeById, &Alternative::getId);
 
-        HouseholdDao hhDao(conn);
-        std::tm currentSimYear = getDateBySimDay(simYear,0);
-        std::tm lastDayOfCurrentSimYear = getDateBySimDay(simYear,364);
-        pendingHouseholds = hhDao.getPendingHouseholds(currentSimYear,lastDayOfCurrentSimYear);
+        //only used with Hits2008 data
+        //loader.addTable<Hits2008ScreeningProbDao>("hits2008_screening_prob", mainSchema, hits2008ScreeningProb, hits2008ScreeningProbById, &Hits2008ScreeningProb::getId);
 
+        loader.addTable<HitsIndividualLogsumDao>("hits_individual_logsum", mainSchema, hitsIndividualLogsum, hitsIndividualLogsumById, &HitsIndividualLogsum::getId);
+        loader.addTable<IndvidualVehicleOwnershipLogsumDao>("individual_vehicle_ownership_logsum", calibrationSchema, IndvidualVehicleOwnershipLogsums, IndvidualVehicleOwnershipLogsumById, &IndvidualVehicleOwnershipLogsum::getHouseholdId);
+        loader.addTable<ScreeningCostTimeDao>("screening_cost_time", calibrationSchema, screeningCostTime, screeningCostTimeById, &ScreeningCostTime::getId);
+        loader.addTable<AccessibilityFixedPzidDao>("accessibility_fixed_pzid", calibrationSchema, accessibilityFixedPzid, accessibilityFixedPzidById, &AccessibilityFixedPzid::getId);
+        loader.addTable<TenureTransitionRateDao>("tenure_transition_rate", calibrationSchema, tenureTransitionRate, tenureTransitionRateById, &TenureTransitionRate::getId);
+        loader.addTable<OwnerTenantMovingRateDao>("owner_tenant_moving_rate", calibrationSchema, ownerTenantMovingRate, ownerTenantMovingRateById, &OwnerTenantMovingRate::getId);
+        loader.addTable<IndvidualEmpSecDao>("individual_emp_sec", mainSchema, indEmpSecList, indEmpSecbyIndId, &IndvidualEmpSec::getIndvidualId);
 
-        //Load unit types
-        loadData<UnitTypeDao>(conn, unitTypes, unitTypesById, &UnitType::getId);
-        PrintOutV("Number of unit types: " << unitTypes.size() << std::endl);
+        loader.run();
+        loader.printReport();
 
         if(config.ltParams.schoolAssignmentModel.enabled)
         {
-            IndividualDao indDao(conn);
-            primarySchoolIndList = indDao.getPrimarySchoolIndividual(currentSimYear);
-            //Index all primary school inds.
-            for (IndividualList::iterator it = primarySchoolIndList.begin(); it != primarySchoolIndList.end(); it++) {
-                primarySchoolIndById.insert(std::make_pair((*it)->getId(), *it));
-            }
-
-            preSchoolIndList = indDao.getPreSchoolIndividual(currentSimYear);
-            //Index all pre school inds.
-            for (IndividualList::iterator it = preSchoolIndList.begin(); it != preSchoolIndList.end(); it++) {
-                preSchoolIndById.insert(std::make_pair((*it)->getId(), *it));
-
-            }
-
-            loadData<HouseholdPlanningAreaDao>( conn, hhPlanningAreaList, hhPlanningAreaMap, &HouseholdPlanningArea::getHouseHoldId);
-            PrintOutV("Number of household planning area rows: " << hhPlanningAreaList.size() << std::endl );
-
-            loadData<HHCoordinatesDao>( conn, hhCoordinates, hhCoordinatesById, &HHCoordinates::getHouseHoldId);
-            PrintOutV("Number of household coordinate rows: " << hhCoordinates.size() << std::endl );
-
-            loadData<SchoolAssignmentCoefficientsDao>( conn_calibration, schoolAssignmentCoefficients, SchoolAssignmentCoefficientsById, &SchoolAssignmentCoefficients::getParameterId);
-            PrintOutV("Number of School Assignment Coefficients rows: " << schoolAssignmentCoefficients.size() << std::endl );
-
-            loadData<IndvidualEmpSecDao>( conn, indEmpSecList, indEmpSecbyIndId, &IndvidualEmpSec::getIndvidualId );
-            PrintOutV("Number of Indvidual Emp Sec rows: " << indEmpSecList.size() << std::endl );
+            assignNearestUniToEzLinkStops();
+            assignNearestPolytechToEzLinkStops();
         }
 
+        PrintOutV("Number of households: " << households.size() << " Households used: " << households.size()  << std::endl);
+        PrintOutV("Initial Individuals: " << individuals.size() << std::endl);
+        PrintOutV("Number of units: " << units.size() << ". Units Used: " << units.size() << std::endl);
         PrintOutV("Number of pre school individuals: " << preSchoolIndList.size() << std::endl );
         PrintOutV("Number of primary school individuals: " << primarySchoolIndList.size() << std::endl );
-
-        loadData<PostcodeDao>(conn, postcodes, postcodesById,   &Postcode::getAddressId);
-        PrintOutV("Number of postcodes: " << postcodes.size() << std::endl );
         PrintOutV("Number of postcodes by id: " << postcodesById.size() << std::endl );
-
-        loadData<VehicleOwnershipCoefficientsDao>(conn,vehicleOwnershipCoeffs,vehicleOwnershipCoeffsById, &VehicleOwnershipCoefficients::getVehicleOwnershipOptionId);
-        PrintOutV("Vehicle Ownership coefficients: " << vehicleOwnershipCoeffs.size() << std::endl );
-
-        loadData<TaxiAccessCoefficientsDao>(conn_calibration,taxiAccessCoeffs,taxiAccessCoeffsById, &TaxiAccessCoefficients::getParameterId);
-        PrintOutV("Taxi access coefficients: " << taxiAccessCoeffs.size() << std::endl );
-
-        loadData<EstablishmentDao>(conn, establishments, establishmentsById, &Establishment::getId);
-        PrintOutV("Number of establishments: " << establishments.size() << std::endl );
-
-        loadData<JobDao>( conn, jobs, jobsById, &Job::getId);
-        PrintOutV("Number of jobs: " << jobs.size() << std::endl );
-
-        loadData<HousingInterestRateDao>( conn, housingInterestRates, housingInterestRatesById, &HousingInterestRate::getId);
-        PrintOutV("Number of interest rate quarters: " << housingInterestRates.size() << std::endl );
-
-        loadData<LogSumVehicleOwnershipDao>( conn, vehicleOwnershipLogsums, vehicleOwnershipLogsumById, &LogSumVehicleOwnership::getHouseholdId);
-        PrintOutV("Number of vehicle ownership logsums: " << vehicleOwnershipLogsums.size() << std::endl );
-
-        loadData<TazDao>( conn, tazs, tazById, &Taz::getId);
-        PrintOutV("Number of taz: " << tazs.size() << std::endl );
-
-        loadData<HouseHoldHitsSampleDao>( conn, houseHoldHits, houseHoldHitsById, &HouseHoldHitsSample::getHouseholdId);
-        PrintOutV("Number of houseHoldHits: " << houseHoldHits.size() << std::endl );
-
-        loadData<TazLogsumWeightDao>( conn_calibration, tazLogsumWeights, tazLogsumWeightById, &TazLogsumWeight::getGroupLogsum );
-        PrintOutV("Number of tazLogsumWeights: " << tazLogsumWeights.size() << std::endl );
-
-        loadData<PlanningAreaDao>( conn, planningArea, planningAreaById, &PlanningArea::getId );
-        PrintOutV("Number of planning areas: " << planningArea.size() << std::endl );
-
-        loadData<PlanningSubzoneDao>( conn, planningSubzone, planningSubzoneById, &PlanningSubzone::getId );
-        PrintOutV("Number of planing subzones: " << planningSubzone.size() << std::endl );
-
-        loadData<MtzDao>( conn, mtz, mtzById, &Mtz::getId );
-        PrintOutV("Number of Mtz: " << mtz.size() << std::endl );
-
-        loadData<MtzTazDao>( conn, mtzTaz, mtzTazById, &MtzTaz::getMtzId );
-        PrintOutV("Number of mtz taz lookups: " << mtzTaz.size() << std::endl );
-
-        loadData<AlternativeDao>( conn_calibration, alternative, alternativeById, &Alternative::getId );
-        PrintOutV("Number of alternative region names: " << alternative.size() << std::endl );
-
-        //only used with Hits2008 data
-        //loadData<Hits2008ScreeningProbDao>( conn, hits2008ScreeningProb, hits2008ScreeningProbById, &Hits2008ScreeningProb::getId );
-        //PrintOutV("Number of hits2008 screening probabilities: " << hits2008ScreeningProb.size() << std::endl );
-
-        loadData<HitsIndividualLogsumDao>( conn, hitsIndividualLogsum, hitsIndividualLogsumById, &HitsIndividualLogsum::getId );
-        PrintOutV("Number of Hits Individual Logsum rows: " << hitsIndividualLogsum.size() << std::endl );
-
-        loadData<IndvidualVehicleOwnershipLogsumDao>( conn_calibration, IndvidualVehicleOwnershipLogsums, IndvidualVehicleOwnershipLogsumById, &IndvidualVehicleOwnershipLogsum::getHouseholdId );
-        PrintOutV("Number of Hits Individual VehicleOwnership Logsum rows: " << IndvidualVehicleOwnershipLogsums.size() << std::endl );
-
-        loadData<ScreeningCostTimeDao>( conn_calibration, screeningCostTime, screeningCostTimeById, &ScreeningCostTime::getId );
-        PrintOutV("Number of Screening Cost Time rows: " << screeningCostTime.size() << std::endl );
-
-        loadData<AccessibilityFixedPzidDao>( conn_calibration, accessibilityFixedPzid, accessibilityFixedPzidById, &AccessibilityFixedPzid::getId );
-        PrintOutV("Number of Accessibility fixed pz id rows: " << accessibilityFixedPzid.size() << std::endl );
-
-        loadData<TenureTransitionRateDao>( conn_calibration, tenureTransitionRate, tenureTransitionRateById, &TenureTransitionRate::getId );
-        PrintOutV("Number of Tenure Transition rate rows: " << tenureTransitionRate.size() << std::endl );
-
-        loadData<OwnerTenantMovingRateDao>( conn_calibration, ownerTenantMovingRate, ownerTenantMovingRateById, &OwnerTenantMovingRate::getId );
-        PrintOutV("Number of Owner Tenant Moving Rate rows: " << ownerTenantMovingRate.size() << std::endl );
-
-        loadData<IndvidualEmpSecDao>( conn, indEmpSecList, indEmpSecbyIndId, &IndvidualEmpSec::getIndvidualId );
-        PrintOutV("Number of Indvidual Emp Sec rows: " << indEmpSecList.size() << std::endl );
-
     }
 
 
@@ -2382,6 +2267,10 @@ void HM_Model::startImpl()
         }
     }
 
+    //the screening tables use the alternatives and population loaded above, or reloaded from disk
+    ScreeningSubModel screeningSubModel;
+    screeningSubModel.buildScreeningTables(this, screeningTables);
+    PrintOutV("Screening tables built for " << screeningTables.size() << " alternatives" << std::endl);
 
     PrintOutV("The synthetic population contains " << household_stats.adultSingaporean_global << " adult Singaporeans." << std::endl);
     PrintOutV("Minors. Male: " << household_stats.maleChild_global << " Female: " << household_stats.femaleChild_global << std::endl);
@@ -2423,6 +2312,73 @@ void  HM_Model::loadLTVersion(DB_Connection &conn)
     PrintOutV("LT Database Baseline user id: " << ltVersionList.back()->getUser_id() << endl);
 }
 
+void HM_Model::loadWorkersGrpByLogsumParams(DB_Connection &conn)
+{
+    soci::session sql;
+    sql.open(soci::postgresql, conn.getConnectionStr());
+
+    ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
+    std::string storedProc = config.schemas.calibration_schema + "workers_grp_by_logsum_params";
+
+    //SQL statement
+    soci::rowset<WorkersGrpByLogsumParams> workers_grp_by_logsum_params = (sql.prepare << "select * from " + storedProc);
+
+    for (soci::rowset<WorkersGrpByLogsumParams>::const_iterator itWorkersGrpByLogsumParams = workers_grp_by_logsum_params.begin();
+                                                                itWorkersGrpByLogsumParams  != workers_grp_by_logsum_params.end();
+                                                                ++itWorkersGrpByLogsumParams )
+    {
+        WorkersGrpByLogsumParams* this_row = new WorkersGrpByLogsumParams(*itWorkersGrpByLogsumParams );
+        workersGrpByLogsumParams.push_back(this_row);
+        workersGrpByLogsumParamsById.insert(std::make_pair(this_row->getIndividualId(), this_row));
+    }
+
+    PrintOutV("Number of WorkersGrpByLogsumParams: " << workersGrpByLogsumParams.size() << std::endl );
+}
+
+void HM_Model::loadBuildingMatch(DB_Connection &conn)
+{
+    soci::session sql;
+    sql.open(soci::postgresql, conn.getConnectionStr());
+
+    std::string storedProc = conn.getSchema() + "building_match";
+
+    //SQL statement
+    soci::rowset<BuildingMatch> buildingMatchsql = (sql.prepare << "select * from " + storedProc);
+
+    for (soci::rowset<BuildingMatch>::const_iterator itBuildingMatch   = buildingMatchsql.begin();
+                                                     itBuildingMatch  != buildingMatchsql.end();
+                                                   ++itBuildingMatch )
+    {
+        BuildingMatch* this_row = new BuildingMatch(*itBuildingMatch );
+        buildingMatch.push_back(this_row);
+        buildingMatchById.insert(std::make_pair(this_row->getFm_building(), this_row));
+    }
+
+    PrintOutV("Number of BuildingMatch: " << buildingMatch.size() << std::endl );
+}
+
+void HM_Model::loadSlaBuildings(DB_Connection &conn)
+{
+    soci::session sql;
+    sql.open(soci::postgresql, conn.getConnectionStr());
+
+    std::string storedProc = conn.getSchema() + "sla_building";
+
+    //SQL statement
+    soci::rowset<SlaBuilding> slaBuildingsql = (sql.prepare << "select * from " + storedProc);
+
+    for (soci::rowset<SlaBuilding>::const_iterator itBuildingMatch   = slaBuildingsql.begin();
+                                                   itBuildingMatch  != slaBuildingsql.end();
+                                                 ++itBuildingMatch )
+    {
+        SlaBuilding* this_row = new SlaBuilding(*itBuildingMatch );
+        slaBuilding.push_back(this_row);
+        slaBuildingById.insert(std::make_pair(this_row->getSla_building_id(), this_row));
+    }
+
+    PrintOutV("Number of Sla Buildings: " << slaBuilding.size() << std::endl );
+}
+
 void HM_Model::loadEzLinkStops(DB_Connection &conn)
 {
     soci::session sql;
@@ -2597,6 +2553,16 @@ HM_Model::ScreeningModelFactorsList& HM_Model::getscreeningModelFactorsList()
     return screeningModelFactorsList;
 }
 
+const ScreeningTables& HM_Model::getScreeningTables() const
+{
+    return screeningTables;
+}
+
+LogsumCache& HM_Model::getLogsumCache()
+{
+    return logsumCache;
+}
+
 HM_Model::ScreeningModelCoefficientsList HM_Model::getScreeningModelCoefficientsList()
 {
     return screeningModelCoefficientsList;
@@ -2624,8 +2590,7 @@ void HM_Model::getLogsumOfIndividuals(BigSerial id)
 
     for( int n = 0; n < householdIndividualIds.size(); n++ )
     {
-        PersonParams personParam = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n], taz, -1, 1 );
-        double logsum =  personParam.getDpbLogsum();
+        double logsum = logsumCache.getDpbLogsum( householdIndividualIds[n], taz, -1, 1 );
 
         printIndividualHitsLogsum( householdIndividualIds[n], logsum );
     }
@@ -2760,54 +2725,33 @@ void HM_Model::getLogsumOfHouseholdVO(BigSerial householdId)
 
             ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
             const std::string luaDirTC = "TC";
-            PersonParams personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
-            PersonParams personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams ,luaDirTC);
-            PersonParams personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams ,luaDirTC);
-            PersonParams personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
-            PersonParams personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
-            PersonParams personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams ,luaDirTC);
-
-            double logsumTC0 = personParams0.getDpbLogsum();
-            double logsumTC1 = personParams1.getDpbLogsum();
-            double logsumTC2 = personParams2.getDpbLogsum();
-            double logsumTC3 = personParams3.getDpbLogsum();
-            double logsumTC4 = personParams4.getDpbLogsum();
-            double logsumTC5 = personParams5.getDpbLogsum();
+            double logsumTC0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
+            double logsumTC1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams ,luaDirTC);
+            double logsumTC2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams ,luaDirTC);
+            double logsumTC3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
+            double logsumTC4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
+            double logsumTC5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams ,luaDirTC);
 
             int currentVO = currentHousehold->getVehicleOwnershipOptionId();
 
 
             const std::string luaDirTCZero = "TCZero";
-            personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
-            personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
-            personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
-            personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
-            personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
-            personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
-
-            double logsumTCZero0 = personParams0.getDpbLogsum();
-            double logsumTCZero1 = personParams1.getDpbLogsum();
-            double logsumTCZero2 = personParams2.getDpbLogsum();
-            double logsumTCZero3 = personParams3.getDpbLogsum();
-            double logsumTCZero4 = personParams4.getDpbLogsum();
-            double logsumTCZero5 = personParams5.getDpbLogsum();
+            double logsumTCZero0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
+            double logsumTCZero1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
+            double logsumTCZero2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
+            double logsumTCZero3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
+            double logsumTCZero4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
+            double logsumTCZero5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, currentVO, &personParams,luaDirTCZero);
 
             if(config.ltParams.outputHouseholdLogsums.maxcCost)
             {
                 const std::string luaDirTCPlusOne = "TCPlusOne";
-                personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCPlusOne );
-                personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCPlusOne);
-                personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCPlusOne);
-                personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCPlusOne );
-                personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCPlusOne );
-                personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCPlusOne);
-
-                double logsumTCPlusOne0 = personParams0.getDpbLogsum();
-                double logsumTCPlusOne1 = personParams1.getDpbLogsum();
-                double logsumTCPlusOne2 = personParams2.getDpbLogsum();
-                double logsumTCPlusOne3 = personParams3.getDpbLogsum();
-                double logsumTCPlusOne4 = personParams4.getDpbLogsum();
-                double logsumTCPlusOne5 = personParams5.getDpbLogsum();
+                double logsumTCPlusOne0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCPlusOne );
+                double logsumTCPlusOne1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCPlusOne);
+                double logsumTCPlusOne2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCPlusOne);
+                double logsumTCPlusOne3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCPlusOne );
+                double logsumTCPlusOne4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCPlusOne );
+                double logsumTCPlusOne5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCPlusOne);
 
                 double denominator0 = (logsumTC0 -logsumTCPlusOne0 );
                 double denominator1 = (logsumTC1 -logsumTCPlusOne1 );
@@ -2840,19 +2784,12 @@ void HM_Model::getLogsumOfHouseholdVO(BigSerial householdId)
             if(config.ltParams.outputHouseholdLogsums.maxTime)
             {
                 const std::string luaDirCTlusOne = "CTPlusOne";
-                personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirCTlusOne );
-                personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirCTlusOne);
-                personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirCTlusOne);
-                personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirCTlusOne );
-                personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirCTlusOne );
-                personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirCTlusOne);
-
-                double logsumCTPlusOne0 = personParams0.getDpbLogsum();
-                double logsumCTPlusOne1 = personParams1.getDpbLogsum();
-                double logsumCTPlusOne2 = personParams2.getDpbLogsum();
-                double logsumCTPlusOne3 = personParams3.getDpbLogsum();
-                double logsumCTPlusOne4 = personParams4.getDpbLogsum();
-                double logsumCTPlusOne5 = personParams5.getDpbLogsum();
+                double logsumCTPlusOne0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirCTlusOne );
+                double logsumCTPlusOne1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirCTlusOne);
+                double logsumCTPlusOne2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirCTlusOne);
+                double logsumCTPlusOne3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirCTlusOne );
+                double logsumCTPlusOne4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirCTlusOne );
+                double logsumCTPlusOne5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirCTlusOne);
 
 
                 double logsumScaledMaxTime0 =  (logsumTCZero0- logsumTC0) / (logsumTC5 - logsumCTPlusOne0);
@@ -3027,51 +2964,30 @@ void HM_Model::getLogsumOfHouseholdVOForVO_Model(BigSerial householdId, std::uno
 
                 ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
                 const std::string luaDirTC = "TC";
-                PersonParams personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
-                PersonParams personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTC);
-                PersonParams personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTC);
-                PersonParams personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTC );
-                PersonParams personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTC );
-                PersonParams personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTC);
-
-                double logsumTC0 = personParams0.getDpbLogsum();
-                double logsumTC1 = personParams1.getDpbLogsum();
-                double logsumTC2 = personParams2.getDpbLogsum();
-                double logsumTC3 = personParams3.getDpbLogsum();
-                double logsumTC4 = personParams4.getDpbLogsum();;
-                double logsumTC5 = personParams5.getDpbLogsum();
+                double logsumTC0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
+                double logsumTC1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTC);
+                double logsumTC2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTC);
+                double logsumTC3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTC );
+                double logsumTC4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTC );
+                double logsumTC5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTC);
 
                 const std::string luaDirTCZero = "TCZero";
-                personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCZero );
-                personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCZero);
-                personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCZero);
-                personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCZero );
-                personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCZero );
-                personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCZero);
-
-                double logsumTCZero0 = personParams0.getDpbLogsum();
-                double logsumTCZero1 = personParams1.getDpbLogsum();
-                double logsumTCZero2 = personParams2.getDpbLogsum();
-                double logsumTCZero3 = personParams3.getDpbLogsum();
-                double logsumTCZero4 = personParams4.getDpbLogsum();
-                double logsumTCZero5 = personParams5.getDpbLogsum();
+                double logsumTCZero0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCZero );
+                double logsumTCZero1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCZero);
+                double logsumTCZero2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCZero);
+                double logsumTCZero3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCZero );
+                double logsumTCZero4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCZero );
+                double logsumTCZero5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCZero);
 
                 if(config.ltParams.outputHouseholdLogsums.maxcCost)
                 {
                     const std::string luaDirTCPlusOne = "TCPlusOne";
-                    personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCPlusOne );
-                    personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCPlusOne);
-                    personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCPlusOne);
-                    personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCPlusOne );
-                    personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCPlusOne );
-                    personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCPlusOne);
-
-                    double logsumTCPlusOne0 = personParams0.getDpbLogsum();
-                    double logsumTCPlusOne1 = personParams1.getDpbLogsum();
-                    double logsumTCPlusOne2 = personParams2.getDpbLogsum();
-                    double logsumTCPlusOne3 = personParams3.getDpbLogsum();
-                    double logsumTCPlusOne4 = personParams4.getDpbLogsum();
-                    double logsumTCPlusOne5 = personParams5.getDpbLogsum();
+                    double logsumTCPlusOne0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCPlusOne );
+                    double logsumTCPlusOne1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCPlusOne);
+                    double logsumTCPlusOne2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCPlusOne);
+                    double logsumTCPlusOne3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCPlusOne );
+                    double logsumTCPlusOne4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCPlusOne );
+                    double logsumTCPlusOne5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCPlusOne);
 
                     double denominator0 = (logsumTC0 -logsumTCPlusOne0 );
                     double denominator1 = (logsumTC1 -logsumTCPlusOne1 );
@@ -3104,19 +3020,12 @@ void HM_Model::getLogsumOfHouseholdVOForVO_Model(BigSerial householdId, std::uno
                 if(config.ltParams.outputHouseholdLogsums.maxTime)
                 {
                     const std::string luaDirCTlusOne = "CTPlusOne";
-                    personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirCTlusOne );
-                    personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirCTlusOne);
-                    personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirCTlusOne);
-                    personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirCTlusOne );
-                    personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirCTlusOne );
-                    personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirCTlusOne);
-
-                    double logsumCTPlusOne0 = personParams0.getDpbLogsum();
-                    double logsumCTPlusOne1 = personParams1.getDpbLogsum();
-                    double logsumCTPlusOne2 = personParams2.getDpbLogsum();
-                    double logsumCTPlusOne3 = personParams3.getDpbLogsum();
-                    double logsumCTPlusOne4 = personParams4.getDpbLogsum();
-                    double logsumCTPlusOne5 = personParams5.getDpbLogsum();
+                    double logsumCTPlusOne0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirCTlusOne );
+                    double logsumCTPlusOne1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirCTlusOne);
+                    double logsumCTPlusOne2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirCTlusOne);
+                    double logsumCTPlusOne3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirCTlusOne );
+                    double logsumCTPlusOne4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirCTlusOne );
+                    double logsumCTPlusOne5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirCTlusOne);
 
                     double denominator0 = (logsumTC0 -logsumCTPlusOne0 );
                     double denominator1 = (logsumTC1 -logsumCTPlusOne1 );
@@ -3276,51 +3185,30 @@ void HM_Model::getLogsumOfHitsHouseholdVO(BigSerial householdId)
 
             ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
             const std::string luaDirTC = "TC";
-            PersonParams personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
-            PersonParams personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTC);
-            PersonParams personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTC);
-            PersonParams personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTC );
-            PersonParams personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTC );
-            PersonParams personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTC);
-
-            double logsumTC0 = personParams0.getDpbLogsum();
-            double logsumTC1 = personParams1.getDpbLogsum();
-            double logsumTC2 = personParams2.getDpbLogsum();
-            double logsumTC3 = personParams3.getDpbLogsum();
-            double logsumTC4 = personParams4.getDpbLogsum();;
-            double logsumTC5 = personParams5.getDpbLogsum();
+            double logsumTC0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTC );
+            double logsumTC1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTC);
+            double logsumTC2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTC);
+            double logsumTC3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTC );
+            double logsumTC4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTC );
+            double logsumTC5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTC);
 
             const std::string luaDirTCZero = "TCZero";
-            personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCZero );
-            personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCZero);
-            personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCZero);
-            personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCZero );
-            personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCZero );
-            personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCZero);
-
-            double logsumTCZero0 = personParams0.getDpbLogsum();
-            double logsumTCZero1 = personParams1.getDpbLogsum();
-            double logsumTCZero2 = personParams2.getDpbLogsum();
-            double logsumTCZero3 = personParams3.getDpbLogsum();
-            double logsumTCZero4 = personParams4.getDpbLogsum();
-            double logsumTCZero5 = personParams5.getDpbLogsum();
+            double logsumTCZero0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCZero );
+            double logsumTCZero1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCZero);
+            double logsumTCZero2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCZero);
+            double logsumTCZero3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCZero );
+            double logsumTCZero4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCZero );
+            double logsumTCZero5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCZero);
 
             if(config.ltParams.outputHouseholdLogsums.maxcCost)
             {
                 const std::string luaDirTCPlusOne = "TCPlusOne";
-                personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCPlusOne );
-                personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCPlusOne);
-                personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCPlusOne);
-                personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCPlusOne );
-                personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCPlusOne );
-                personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCPlusOne);
-
-                double logsumTCPlusOne0 = personParams0.getDpbLogsum();
-                double logsumTCPlusOne1 = personParams1.getDpbLogsum();
-                double logsumTCPlusOne2 = personParams2.getDpbLogsum();
-                double logsumTCPlusOne3 = personParams3.getDpbLogsum();
-                double logsumTCPlusOne4 = personParams4.getDpbLogsum();
-                double logsumTCPlusOne5 = personParams5.getDpbLogsum();
+                double logsumTCPlusOne0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirTCPlusOne );
+                double logsumTCPlusOne1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirTCPlusOne);
+                double logsumTCPlusOne2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirTCPlusOne);
+                double logsumTCPlusOne3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirTCPlusOne );
+                double logsumTCPlusOne4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirTCPlusOne );
+                double logsumTCPlusOne5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirTCPlusOne);
 
                 double logsumScaledMaxCost0 = (logsumTC0 - logsumTCZero0) / (logsumTC0 -logsumTCPlusOne0 );
                 logsum.insert(std::make_pair(0,logsumScaledMaxCost0));
@@ -3344,19 +3232,12 @@ void HM_Model::getLogsumOfHitsHouseholdVO(BigSerial householdId)
             if(config.ltParams.outputHouseholdLogsums.maxTime)
             {
                 const std::string luaDirCTlusOne = "CTPlusOne";
-                personParams0 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirCTlusOne );
-                personParams1 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirCTlusOne);
-                personParams2 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirCTlusOne);
-                personParams3 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirCTlusOne );
-                personParams4 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirCTlusOne );
-                personParams5 = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirCTlusOne);
-
-                double logsumCTPlusOne0 = personParams0.getDpbLogsum();
-                double logsumCTPlusOne1 = personParams1.getDpbLogsum();
-                double logsumCTPlusOne2 = personParams2.getDpbLogsum();
-                double logsumCTPlusOne3 = personParams3.getDpbLogsum();
-                double logsumCTPlusOne4 = personParams4.getDpbLogsum();
-                double logsumCTPlusOne5 = personParams5.getDpbLogsum();
+                double logsumCTPlusOne0 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 0 , &personParams,luaDirCTlusOne );
+                double logsumCTPlusOne1 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 1 , &personParams ,luaDirCTlusOne);
+                double logsumCTPlusOne2 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 2 , &personParams ,luaDirCTlusOne);
+                double logsumCTPlusOne3 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 3 , &personParams,luaDirCTlusOne );
+                double logsumCTPlusOne4 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 4 , &personParams,luaDirCTlusOne );
+                double logsumCTPlusOne5 = logsumCache.getDpbLogsum( householdIndividualIds[n],tazH, tazW, 5 , &personParams ,luaDirCTlusOne);
 
                 double logsumScaledMaxTime0 =  (logsumTC0 - logsumTCZero0) / (logsumTC0 -logsumCTPlusOne0 );
                 logsum.insert(std::make_pair(0,logsumScaledMaxTime0));
@@ -3590,18 +3471,15 @@ void HM_Model::getLogsumOfVaryingHomeOrWork(BigSerial householdId)
             if( config.ltParams.outputHouseholdLogsums.fixedHomeVariableWork )
             {
                 const std::string luaDirTC = "TC";
-                personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirTC);
-                logsumTC = personParams.getDpbLogsum();
+                logsumTC = logsumCache.getDpbLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirTC);
 
                 const std::string luaDirTCZero = "TCZero";
-                personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirTCZero);
-                logsumTCZero = personParams.getDpbLogsum();
+                logsumTCZero = logsumCache.getDpbLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirTCZero);
 
                 if(config.ltParams.outputHouseholdLogsums.maxcCost)
                 {
                     const std::string luaDirTCPlusOne = "TCPlusOne";
-                    personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirTCPlusOne);
-                    logsumTCPlusOne = personParams.getDpbLogsum();
+                    logsumTCPlusOne = logsumCache.getDpbLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirTCPlusOne);
 
                     double logsumScaledMaxCost = (logsumTC - logsumTCZero) / (logsumTC -logsumTCPlusOne );
                     logsum.push_back(logsumScaledMaxCost);
@@ -3610,8 +3488,7 @@ void HM_Model::getLogsumOfVaryingHomeOrWork(BigSerial householdId)
                 if(config.ltParams.outputHouseholdLogsums.maxTime)
                 {
                     const std::string luaDirCTlusOne = "CTPlusOne";
-                    personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirCTlusOne);
-                    logsumCTPlusOne = personParams.getDpbLogsum();
+                    logsumCTPlusOne = logsumCache.getDpbLogsum( householdIndividualIds[n],tazHome, tazList, vehicleOwnership , &personParams, luaDirCTlusOne);
 
                     double logsumScaledMaxTime =  (logsumTC - logsumTCZero) / (logsumTC -logsumCTPlusOne );
                     logsum.push_back(logsumScaledMaxTime);
@@ -3619,21 +3496,16 @@ void HM_Model::getLogsumOfVaryingHomeOrWork(BigSerial householdId)
             }
             else if( config.ltParams.outputHouseholdLogsums.fixedWorkVariableHome )
             {
-                personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams );
-
                 const std::string luaDirTC = "TC";
-                personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirTC);
-                logsumTC = personParams.getDpbLogsum();
+                logsumTC = logsumCache.getDpbLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirTC);
 
                 const std::string luaDirTCZero = "TCZero";
-                personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirTCZero);
-                logsumTCZero = personParams.getDpbLogsum();
+                logsumTCZero = logsumCache.getDpbLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirTCZero);
 
                 if(config.ltParams.outputHouseholdLogsums.maxcCost)
                 {
                     const std::string luaDirTCPlusOne = "TCPlusOne";
-                    personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirTCPlusOne);
-                    logsumTCPlusOne = personParams.getDpbLogsum();
+                    logsumTCPlusOne = logsumCache.getDpbLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirTCPlusOne);
 
                     double logsumScaledMaxCost = (logsumTC - logsumTCZero) / (logsumTC -logsumTCPlusOne );
                     logsum.push_back(logsumScaledMaxCost);
@@ -3642,8 +3514,7 @@ void HM_Model::getLogsumOfVaryingHomeOrWork(BigSerial householdId)
                 if(config.ltParams.outputHouseholdLogsums.maxcCost)
                 {
                     const std::string luaDirCTlusOne = "CTPlusOne";
-                    personParams = PredayLT_LogsumManager::getInstance().computeLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirCTlusOne);
-                    logsumCTPlusOne = personParams.getDpbLogsum();
+                    logsumCTPlusOne = logsumCache.getDpbLogsum( householdIndividualIds[n],tazList, tazWork, vehicleOwnership , &personParams, luaDirCTlusOne);
 
                     double logsumScaledMaxTime =  (logsumTC - logsumTCZero) / (logsumTC -logsumCTPlusOne );
                     logsum.push_back(logsumScaledMaxTime);
@@ -4856,6 +4727,16 @@ School* HM_Model::getSchoolById(BigSerial schoolId) const
 
 void HM_Model::stopImpl()
 {
+    const ConfigParams& config = ConfigManager::GetInstance().FullConfig();
+    if (config.ltParams.logsumCache.enabled)
+    {
+        logsumCache.printReport();
+        if (!config.ltParams.logsumCache.file.empty())
+        {
+            logsumCache.save(config.ltParams.logsumCache.file);
+        }
+    }
+
     deleteAll(stats);
     clear_delete_vector(households);
     clear_delete_vector(units);
@@ -68,6 +68,8 @@
 #include "DeveloperModel.hpp"
 #include "agent/impl/HouseholdAgent.hpp"
 #include "database/entity/ResidentialWTP_Coefs.hpp"
+#include "model/ScreeningTables.hpp"
+#include "model/LogsumCache.hpp"
 
 namespace sim_mob
 {
@@ -432,6 +434,7 @@ namespace sim_mob
             ZonalLanduseVariableValues* getZonalLandUseByAlternativeId(int id) const;
             Alternative* getAlternativeByPlanningAreaId(int id) const;
             std::vector<PopulationPerPlanningArea*> getPopulationByPlanningAreaId(BigSerial id)const;
+            const PopulationPerPlanningAreaList& getPopulationPerPlanningArea() const;
             HitsIndividualLogsumList getHitsIndividualLogsumVec() const;
             void setStartDay(int day);
             int getStartDay() const;
@@ -460,6 +463,16 @@ namespace sim_mob
             ScreeningCostTime* getScreeningCostTimeInst(std::string key);
 
             ScreeningModelFactorsList& getscreeningModelFactorsList();
+
+            /**
+             * Household independent terms of the screening model, built at startup.
+             */
+            const ScreeningTables& getScreeningTables() const;
+
+            /**
+             * Cache of the preday logsums, shared by all the household threads.
+             */
+            LogsumCache& getLogsumCache();
             AccessibilityFixedPzidList getAccessibilityFixedPzid();
 
 
@@ -556,6 +569,9 @@ namespace sim_mob
             void loadResidentialWTP_Coeffs(DB_Connection &conn);
             void loadSchoolDesks(DB_Connection &conn);
             void loadSchools(DB_Connection &conn);
+            void loadWorkersGrpByLogsumParams(DB_Connection &conn);
+            void loadBuildingMatch(DB_Connection &conn);
+            void loadSlaBuildings(DB_Connection &conn);
 
             const TravelTime* getTravelTimeByOriginDestTaz(BigSerial originTaz, BigSerial destTaz);
             const ResidentialWTP_Coefs* getResidentialWTP_CoefsByPropertyType(string propertyType);
@@ -744,6 +760,8 @@ namespace sim_mob
 
             ScreeningModelFactorsList screeningModelFactorsList;
             ScreeningModelFactorsMap screeningModelFactorsMap;
+            ScreeningTables screeningTables;
+            LogsumCache logsumCache;
 
 
             std::vector<SimulationStoppedPoint*> simStoppedPointList;
@@ -0,0 +1,331 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "LogsumCache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <boost/cstdint.hpp>
+#include <boost/functional/hash.hpp>
+#include "behavioral/PredayLT_Logsum.hpp"
+#include "logging/Log.hpp"
+
+using namespace sim_mob;
+using namespace sim_mob::long_term;
+
+namespace
+{
+const char FILE_MAGIC[8] = {'L', 'T', 'L', 'O', 'G', 'S', 'U', 'M'};
+const boost::uint32_t FILE_VERSION = 2;
+
+template <typename T>
+void writeValue(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& in, T& value)
+{
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+}
+
+LogsumCache::PersonFingerprint::PersonFingerprint()
+{
+    std::memset(attributes, 0, sizeof(attributes));
+}
+
+LogsumCache::PersonFingerprint::PersonFingerprint(const PersonParams& personParams)
+{
+    int* attribute = attributes;
+    *attribute++ = personParams.getPersonTypeId();
+    *attribute++ = personParams.getAgeId();
+    *attribute++ = personParams.getIsUniversityStudent();
+    *attribute++ = personParams.getIsFemale();
+    *attribute++ = personParams.isStudent();
+    *attribute++ = personParams.getIncomeId();
+    *attribute++ = personParams.getMissingIncome();
+    *attribute++ = personParams.getWorksAtHome();
+    *attribute++ = personParams.getHasFixedWorkTiming();
+    *attribute++ = personParams.hasFixedWorkPlace();
+    *attribute++ = personParams.getFixedSchoolLocation();
+    *attribute++ = personParams.getHH_OnlyAdults();
+    *attribute++ = personParams.getHH_OnlyWorkers();
+    *attribute++ = personParams.getHH_NumUnder4();
+    *attribute++ = personParams.getHH_HasUnder15();
+    *attribute++ = personParams.getMotorLicense();
+    *attribute++ = personParams.hasDrivingLicence();
+    *attribute++ = personParams.getConstVehicleParams().getDrivetrain();
+}
+
+LogsumCache::Key::Key() : individualId(0), homeLocation(-1), workLocation(-1), vehicleOwnership(-1)
+{
+}
+
+bool LogsumCache::Key::operator==(const Key& other) const
+{
+    return individualId == other.individualId && homeLocation == other.homeLocation &&
+           workLocation == other.workLocation && vehicleOwnership == other.vehicleOwnership &&
+           std::memcmp(fingerprint.attributes, other.fingerprint.attributes, sizeof(fingerprint.attributes)) == 0 &&
+           luaDir == other.luaDir;
+}
+
+size_t LogsumCache::KeyHash::operator()(const Key& key) const
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, key.individualId);
+    boost::hash_combine(seed, key.homeLocation);
+    boost::hash_combine(seed, key.workLocation);
+    boost::hash_combine(seed, key.vehicleOwnership);
+    boost::hash_range(seed, key.fingerprint.attributes, key.fingerprint.attributes + PersonFingerprint::NUM_ATTRIBUTES);
+    boost::hash_combine(seed, key.luaDir);
+    return seed;
+}
+
+LogsumCache::LogsumCache() : enabled(true)
+{
+}
+
+void LogsumCache::setEnabled(bool enabled)
+{
+    this->enabled = enabled;
+}
+
+LogsumCache::Key LogsumCache::makeKey(BigSerial individualId, int homeLocation, int workLocation, int vehicleOwnership,
+                                      const PersonParams* personParams, const std::string& luaDir)
+{
+    Key key;
+    key.vehicleOwnership = vehicleOwnership;
+    key.luaDir = luaDir;
+
+    if (personParams)
+    {
+        //computeLogsum() keeps the locations of the person if the given ones are not valid
+        key.fingerprint = PersonFingerprint(*personParams);
+        key.homeLocation = (homeLocation > 0) ? homeLocation : personParams->getHomeLocation();
+        key.workLocation = (workLocation > 0) ? workLocation : personParams->getFixedWorkLocation();
+    }
+    else
+    {
+        key.individualId = individualId;
+        key.homeLocation = homeLocation;
+        key.workLocation = workLocation;
+    }
+    return key;
+}
+
+LogsumCache::Shard& LogsumCache::getShard(const Key& key)
+{
+    //the low bits of the hash select the bucket inside the shard
+    return shards[(KeyHash()(key) >> 8) % NUM_SHARDS];
+}
+
+LogsumCache::Logsums LogsumCache::getLogsums(BigSerial individualId, int homeLocation, int workLocation,
+                                             int vehicleOwnership, const PersonParams* personParams,
+                                             const std::string& luaDir)
+{
+    //computeLogsum() returns empty parameters for a person without id, whatever the other attributes
+    bool cacheable = enabled && (!personParams || !personParams->getPersonId().empty());
+
+    Key key;
+    Shard* shard = nullptr;
+    if (cacheable)
+    {
+        key = makeKey(individualId, homeLocation, workLocation, vehicleOwnership, personParams, luaDir);
+        shard = &getShard(key);
+
+        boost::mutex::scoped_lock lock(shard->mutex);
+        LogsumMap::const_iterator it = shard->logsums.find(key);
+        if (it != shard->logsums.end())
+        {
+            shard->hits++;
+            return it->second;
+        }
+        shard->misses++;
+    }
+
+    PersonParams computed = PredayLT_LogsumManager::getInstance().computeLogsum(individualId, homeLocation, workLocation,
+                                                                                 vehicleOwnership,
+                                                                                 const_cast<PersonParams*>(personParams),
+                                                                                 luaDir);
+    Logsums logsums;
+    logsums.dpbLogsum = computed.getDpbLogsum();
+    logsums.dptLogsum = computed.getDptLogsum();
+    logsums.dpsLogsum = computed.getDpsLogsum();
+    logsums.travelProbability = computed.getTravelProbability();
+    logsums.tripsExpected = computed.getTripsExpected();
+
+    if (cacheable)
+    {
+        boost::mutex::scoped_lock lock(shard->mutex);
+        shard->logsums.insert(std::make_pair(key, logsums));
+    }
+    return logsums;
+}
+
+double LogsumCache::getDpbLogsum(BigSerial individualId, int homeLocation, int workLocation, int vehicleOwnership,
+                                 const PersonParams* personParams, const std::string& luaDir)
+{
+    return getLogsums(individualId, homeLocation, workLocation, vehicleOwnership, personParams, luaDir).dpbLogsum;
+}
+
+bool LogsumCache::load(const std::string& fileName)
+{
+    std::ifstream in(fileName.c_str(), std::ios::binary);
+    if (!in)
+    {
+        PrintOutV("Logsum cache file " << fileName << " not found. The cache starts empty." << std::endl);
+        return false;
+    }
+
+    char magic[sizeof(FILE_MAGIC)];
+    boost::uint32_t version = 0;
+    boost::uint64_t numEntries = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 ||
+        !readValue(in, version) || version != FILE_VERSION || !readValue(in, numEntries))
+    {
+        PrintOutV("Logsum cache file " << fileName << " has an unknown format. The cache starts empty." << std::endl);
+        return false;
+    }
+
+    boost::uint64_t numLoaded = 0;
+    for (; numLoaded < numEntries; numLoaded++)
+    {
+        Key key;
+        Logsums logsums;
+        boost::int64_t individualId = 0;
+        boost::int32_t value = 0;
+        boost::uint32_t luaDirLength = 0;
+
+        if (!readValue(in, individualId))
+        {
+            break;
+        }
+        key.individualId = individualId;
+
+        bool valid = true;
+        for (size_t i = 0; i < PersonFingerprint::NUM_ATTRIBUTES && valid; i++)
+        {
+            valid = readValue(in, value);
+            key.fingerprint.attributes[i] = value;
+        }
+        valid = valid && readValue(in, value);
+        key.homeLocation = value;
+        valid = valid && readValue(in, value);
+        key.workLocation = value;
+        valid = valid && readValue(in, value);
+        key.vehicleOwnership = value;
+        valid = valid && readValue(in, luaDirLength);
+        if (valid)
+        {
+            key.luaDir.resize(luaDirLength);
+            valid = luaDirLength == 0 || static_cast<bool>(in.read(&key.luaDir[0], luaDirLength));
+        }
+        valid = valid && readValue(in, logsums.dpbLogsum) && readValue(in, logsums.dptLogsum) &&
+                readValue(in, logsums.dpsLogsum) && readValue(in, logsums.travelProbability) &&
+                readValue(in, logsums.tripsExpected);
+        if (!valid)
+        {
+            break;
+        }
+
+        Shard& shard = getShard(key);
+        boost::mutex::scoped_lock lock(shard.mutex);
+        shard.logsums.insert(std::make_pair(key, logsums));
+    }
+
+    if (numLoaded < numEntries)
+    {
+        PrintOutV("Logsum cache file " << fileName << " is truncated. Loaded " << numLoaded << " of " << numEntries
+                  << " logsums." << std::endl);
+        return false;
+    }
+
+    PrintOutV("Loaded " << numLoaded << " logsums from " << fileName << std::endl);
+    return true;
+}
+
+bool LogsumCache::save(const std::string& fileName) const
+{
+    std::ofstream out(fileName.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        PrintOutV("Logsum cache file " << fileName << " could not be opened for writing." << std::endl);
+        return false;
+    }
+
+    boost::uint64_t numEntries = 0;
+    for (size_t i = 0; i < NUM_SHARDS; i++)
+    {
+        boost::mutex::scoped_lock lock(shards[i].mutex);
+        numEntries += shards[i].logsums.size();
+    }
+
+    out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    writeValue(out, FILE_VERSION);
+    writeValue(out, numEntries);
+
+    //entries added while saving are not written, to keep the count of the header
+    boost::uint64_t numWritten = 0;
+    for (size_t i = 0; i < NUM_SHARDS && numWritten < numEntries; i++)
+    {
+        boost::mutex::scoped_lock lock(shards[i].mutex);
+        for (LogsumMap::const_iterator it = shards[i].logsums.begin();
+             it != shards[i].logsums.end() && numWritten < numEntries; ++it, numWritten++)
+        {
+            const Key& key = it->first;
+            writeValue(out, static_cast<boost::int64_t>(key.individualId));
+            for (size_t j = 0; j < PersonFingerprint::NUM_ATTRIBUTES; j++)
+            {
+                writeValue(out, static_cast<boost::int32_t>(key.fingerprint.attributes[j]));
+            }
+            writeValue(out, static_cast<boost::int32_t>(key.homeLocation));
+            writeValue(out, static_cast<boost::int32_t>(key.workLocation));
+            writeValue(out, static_cast<boost::int32_t>(key.vehicleOwnership));
+            writeValue(out, static_cast<boost::uint32_t>(key.luaDir.size()));
+            out.write(key.luaDir.data(), key.luaDir.size());
+
+            const Logsums& logsums = it->second;
+            writeValue(out, logsums.dpbLogsum);
+            writeValue(out, logsums.dptLogsum);
+            writeValue(out, logsums.dpsLogsum);
+            writeValue(out, logsums.travelProbability);
+            writeValue(out, logsums.tripsExpected);
+        }
+    }
+
+    out.close();
+    if (!out)
+    {
+        PrintOutV("Logsum cache file " << fileName << " could not be written." << std::endl);
+        return false;
+    }
+
+    PrintOutV("Saved " << numWritten << " logsums to " << fileName << std::endl);
+    return true;
+}
+
+void LogsumCache::printReport() const
+{
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+    size_t numEntries = 0;
+    for (size_t i = 0; i < NUM_SHARDS; i++)
+    {
+        boost::mutex::scoped_lock lock(shards[i].mutex);
+        hits += shards[i].hits;
+        misses += shards[i].misses;
+        numEntries += shards[i].logsums.size();
+    }
+
+    unsigned long long lookups = hits + misses;
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2);
+    report << "Logsum cache: " << numEntries << " entries, " << lookups << " lookups, " << hits << " hits ("
+           << ((lookups > 0) ? 100.0 * hits / lookups : 0.0) << "%), " << misses << " logsums computed" << std::endl;
+    PrintOutV(report.str());
+}
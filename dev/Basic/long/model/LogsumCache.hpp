@@ -0,0 +1,149 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <string>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/unordered_map.hpp>
+#include "behavioral/params/PersonParams.hpp"
+#include "Types.hpp"
+
+namespace sim_mob
+{
+    namespace long_term
+    {
+        /**
+         * Memoizes the logsums computed by PredayLT_LogsumManager::computeLogsum().
+         *
+         * Logsums computed from the person parameters built by the long-term model are keyed by the attributes
+         * read by the preday models (see PersonFingerprint), so persons with the same characteristics share entries.
+         * Logsums of persons loaded from the preday population are keyed by the id of the person.
+         * In both cases the key also holds the home TAZ, the work TAZ, the vehicle ownership and the lua directory.
+         *
+         * The cache is split in shards with their own lock, so the household threads rarely wait on each other.
+         * A logsum missing from the cache is computed outside of the lock; two threads missing the same key
+         * compute the same value and the first one is kept.
+         *
+         * The entries can be saved at the end of a run and loaded at the start of the next one. A saved file is
+         * only valid for the same population, zone costs and lua scripts, and must be deleted when they change.
+         */
+        class LogsumCache : private boost::noncopyable
+        {
+        public:
+            /**
+             * Logsums of a person, as computed by the preday models.
+             */
+            struct Logsums
+            {
+                Logsums() : dpbLogsum(0), dptLogsum(0), dpsLogsum(0), travelProbability(0), tripsExpected(0) {}
+
+                double dpbLogsum;
+                double dptLogsum;
+                double dpsLogsum;
+                double travelProbability;
+                double tripsExpected;
+            };
+
+            LogsumCache();
+
+            /**
+             * Enables or disables the cache. When disabled, all the logsums are computed.
+             */
+            void setEnabled(bool enabled);
+
+            /**
+             * Returns the logsums computed by PredayLT_LogsumManager::computeLogsum() with the same arguments,
+             * computing them only if they are not cached.
+             */
+            Logsums getLogsums(BigSerial individualId, int homeLocation = -1, int workLocation = -1,
+                               int vehicleOwnership = -1, const PersonParams* personParams = nullptr,
+                               const std::string& luaDir = std::string());
+
+            /**
+             * Returns the day pattern binary logsum (see getLogsums()).
+             */
+            double getDpbLogsum(BigSerial individualId, int homeLocation = -1, int workLocation = -1,
+                                int vehicleOwnership = -1, const PersonParams* personParams = nullptr,
+                                const std::string& luaDir = std::string());
+
+            /**
+             * Adds the entries of a file written by save() to the cache.
+             * @return true if the file was read
+             */
+            bool load(const std::string& fileName);
+
+            /**
+             * Writes all the entries of the cache to a file.
+             * @return true if the file was written
+             */
+            bool save(const std::string& fileName) const;
+
+            /**
+             * Prints the number of entries and the hit rate of the cache.
+             */
+            void printReport() const;
+
+        private:
+            /**
+             * Attributes of a person read by the preday logsum models, other than the locations and vehicle ownership.
+             */
+            struct PersonFingerprint
+            {
+                static const size_t NUM_ATTRIBUTES = 18;
+
+                PersonFingerprint();
+                explicit PersonFingerprint(const PersonParams& personParams);
+
+                int attributes[NUM_ATTRIBUTES];
+            };
+
+            struct Key
+            {
+                Key();
+
+                /** id of the person loaded from the preday population, or 0 if the fingerprint is used*/
+                BigSerial individualId;
+                PersonFingerprint fingerprint;
+                int homeLocation;
+                int workLocation;
+                int vehicleOwnership;
+                std::string luaDir;
+
+                bool operator==(const Key& other) const;
+            };
+
+            struct KeyHash
+            {
+                size_t operator()(const Key& key) const;
+            };
+
+            typedef boost::unordered_map<Key, Logsums, KeyHash> LogsumMap;
+
+            struct Shard
+            {
+                Shard() : hits(0), misses(0) {}
+
+                LogsumMap logsums;
+                unsigned long long hits;
+                unsigned long long misses;
+                mutable boost::mutex mutex;
+            };
+
+            static const size_t NUM_SHARDS = 64;
+
+            /**
+             * Builds the key of a computeLogsum() call
+             */
+            static Key makeKey(BigSerial individualId, int homeLocation, int workLocation, int vehicleOwnership,
+                               const PersonParams* personParams, const std::string& luaDir);
+
+            Shard& getShard(const Key& key);
+
+            bool enabled;
+            Shard shards[NUM_SHARDS];
+        };
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <model/ScreeningSubModel.hpp>
 #include <util/TimeCheck.hpp>
+#include <map>
 
 namespace sim_mob
 {
@@ -90,329 +91,280 @@ namespace sim_mob
             return dwellingType;
         }
 
-        void ScreeningSubModel::getScreeningProbabilities( int hhId, std::vector<double> &probabilities, HM_Model *modelArg, int day )
+        void ScreeningSubModel::buildScreeningTables(HM_Model *modelArg, ScreeningTables &tables)
         {
             model = modelArg;
-            Household* household = model->getHouseholdById(hhId);
-            const Unit* unit = model->getUnitById( household->getUnitId() );
+            tables.clear();
 
-            ComputeHeadOfHousehold(household);
+            HM_Model::ScreeningModelCoefficientsList coefficientsList = model->getScreeningModelCoefficientsList();
 
-            PlanningArea* planningArea = nullptr;
-            BigSerial id = ComputeHomePlanningArea(planningArea, household);
+            if( coefficientsList.empty() )
+            {
+                AgentsLookupSingleton::getInstance().getLogger().log(LoggerAgent::LOG_ERROR, "Screening model coefficients are missing. Households will not be screened.");
+                return;
+            }
 
-            planningArea = model->getPlanningAreaById(id);
+            ScreeningModelCoefficients *coefficients = coefficientsList[0];
 
-            if(!planningArea)
-                return;
-            
-            std::vector<PopulationPerPlanningArea*> populationPerPlanningArea = model->getPopulationByPlanningAreaId(planningArea->getId());
+            tables.hhSizeDiffCoefficient    = coefficients->gethhsize_diff();
+            tables.logIncomeDiffCoefficient = coefficients->getlog_hhinc_diff();
+            tables.youngerThan4Coefficient  = coefficients->getf_age4_n4();
+            tables.between5And19Coefficient = coefficients->getf_age19_n19();
+            tables.olderThan65Coefficient   = coefficients->getf_age65_n65();
+            tables.chineseCoefficient       = coefficients->getf_chn_nchn();
+            tables.malayCoefficient         = coefficients->getf_mal_nmal();
+            tables.indianCoefficient        = coefficients->getf_indian_nind();
 
-            double populationTotal   = 0;
+            //population of each planning area, in total and by dwelling type.
+            struct DwellingTypeStats
+            {
+                DwellingTypeStats() : avgHouseholdSize(0), avgHouseholdIncome(0), counter(0), sumFloorArea(0) {}
 
-            double populationChinese = 0;
-            double populationMalay   = 0;
-            double populationIndian  = 0;
-            double populationOther   = 0;
+                double avgHouseholdSize;
+                double avgHouseholdIncome;
+                int    counter;
+                double sumFloorArea;
+            };
 
-            bool  bHouseholdEthnicityChinese = false;
-            bool  bHouseholdEthnicityMalay   = false;
-            bool  bHouseholdEthnicityIndian  = false;
+            struct PopulationTotals
+            {
+                PopulationTotals() : total(0), chinese(0), youngerThan4(0), between5And19(0), olderThan65(0) {}
 
-            double populationYoungerThan4   = 0;
-            double population5To19          = 0;
-            double populationGreaterThan65  = 0;
+                double total;
+                double chinese;
+                double youngerThan4;
+                double between5And19;
+                double olderThan65;
+            };
 
-            double bHouseholdMemberYoungerThan4  = false;
-            double bHouseholdMember5To19         = false;
-            double bHouseholdMemberGreaterThan65 = false;
+            std::map<std::pair<BigSerial, int>, DwellingTypeStats> statsByPlanningAreaDwellingType;
 
-            double  avgHouseholdSize = 0;
-            double  avgHouseholdIncome = 0;
-            int     unitTypeCounter = 0;
-            int     populationByunitType = 0;
-            int     sumFloorArea = 0;
+            //stats of the whole population, for the alternatives without population of their dwelling type
+            DwellingTypeStats globalStats;
+            std::map<BigSerial, PopulationTotals> totalsByPlanningArea;
 
-            if( household->getEthnicityId() == 1 )
-                bHouseholdEthnicityChinese = true;
+            const HM_Model::PopulationPerPlanningAreaList& populationPerPlanningArea = model->getPopulationPerPlanningArea();
 
-            if( household->getEthnicityId() == 2 )
-                bHouseholdEthnicityMalay = true;
+            for(size_t n = 0; n < populationPerPlanningArea.size(); n++)
+            {
+                const PopulationPerPlanningArea *population = populationPerPlanningArea[n];
 
-            if( household->getEthnicityId() == 3 )
-                bHouseholdEthnicityIndian = true;
+                PopulationTotals &totals = totalsByPlanningArea[population->getPlanningAreaId()];
+                totals.total += population->getPopulation();
 
-            std::vector<BigSerial> individualIds = household->getIndividuals();
+                if( population->getEthnicityId() == 1 )
+                    totals.chinese += population->getPopulation();
 
-            for( int n = 0; n < individualIds.size(); n++ )
-            {
-                Individual* thisMember = model->getIndividualById(individualIds[n]);
+                if( population->getAgeCategoryId() == 0 )
+                    totals.youngerThan4 += population->getPopulation();
 
-                if( thisMember->getAgeCategoryId()  == 0 )
-                    bHouseholdMemberYoungerThan4 = true;
+                if( population->getAgeCategoryId() > 0 && population->getAgeCategoryId() < 4 )
+                    totals.between5And19 += population->getPopulation();
 
-                if( thisMember->getAgeCategoryId() > 0 && thisMember->getAgeCategoryId() < 4 )
-                    bHouseholdMember5To19 = true;
+                if( population->getAgeCategoryId() > 12 )
+                    totals.olderThan65 += population->getPopulation();
 
-                if( thisMember->getAgeCategoryId() > 12 )
-                    bHouseholdMemberGreaterThan65 = true;
+                DwellingTypeStats &stats = statsByPlanningAreaDwellingType[std::make_pair((BigSerial)population->getPlanningAreaId(), GetDwellingType(population->getUnitType()))];
+                stats.avgHouseholdSize += population->getAvgHhSize();
+                stats.avgHouseholdIncome += population->getAvgIncome();
+                stats.counter++;
+                stats.sumFloorArea += population->getFloorArea();
+
+                globalStats.avgHouseholdSize += population->getAvgHhSize();
+                globalStats.avgHouseholdIncome += population->getAvgIncome();
+                globalStats.counter++;
+                globalStats.sumFloorArea += population->getFloorArea();
             }
 
-            for(int n = 0; n < populationPerPlanningArea.size(); n++)
+            for(std::map<BigSerial, PopulationTotals>::const_iterator it = totalsByPlanningArea.begin(); it != totalsByPlanningArea.end(); ++it)
             {
-                populationTotal += populationPerPlanningArea[n]->getPopulation();
-
-                if(populationPerPlanningArea[n]->getEthnicityId() == 1 )
-                    populationChinese = populationChinese + populationPerPlanningArea[n]->getPopulation();
+                ScreeningTables::PopulationFractions &fractions = tables.populationFractions[it->first];
+                fractions.youngerThan4  = it->second.youngerThan4  / it->second.total;
+                fractions.between5And19 = it->second.between5And19 / it->second.total;
+                fractions.olderThan65   = it->second.olderThan65   / it->second.total;
+                fractions.chinese       = it->second.chinese       / it->second.total;
+            }
 
-                if(populationPerPlanningArea[n]->getEthnicityId() == 2 )
-                    populationMalay = populationMalay + populationPerPlanningArea[n]->getPopulation();
+            const ConfigParams& config = ConfigManager::GetInstance().FullConfig();
+            bool bToaPayohScenario = config.ltParams.scenario.enabled && config.ltParams.scenario.scenarioName == "ToaPayohScenario";
 
-                if(populationPerPlanningArea[n]->getEthnicityId() == 3 )
-                    populationIndian = populationIndian + populationPerPlanningArea[n]->getPopulation();
+            HM_Model::AlternativeList &alternatives = model->getAlternatives();
+            HM_Model::ScreeningModelFactorsList &factorsList = model->getscreeningModelFactorsList();
 
-                if(populationPerPlanningArea[n]->getEthnicityId() == 4 )
-                    populationOther = populationOther + populationPerPlanningArea[n]->getPopulation();
+            for( size_t n = 0; n < alternatives.size(); n++ )
+            {
+                const Alternative *alternative = alternatives[n];
 
-                if(populationPerPlanningArea[n]->getAgeCategoryId() == 0 )
-                     populationYoungerThan4 = populationYoungerThan4 + populationPerPlanningArea[n]->getPopulation();
+                if ( model->getZonalLandUseByAlternativeId(n + 1) == nullptr)
+                    continue;
 
-                if(populationPerPlanningArea[n]->getAgeCategoryId() > 0 && populationPerPlanningArea[n]->getAgeCategoryId()< 4 )
-                     population5To19 = population5To19 + populationPerPlanningArea[n]->getPopulation();
+                std::map<std::pair<BigSerial, int>, DwellingTypeStats>::const_iterator statsItr = statsByPlanningAreaDwellingType.find(std::make_pair(alternative->getPlanAreaId(), (int)alternative->getDwellingTypeId()));
+                const DwellingTypeStats &stats = ( statsItr != statsByPlanningAreaDwellingType.end() ) ? statsItr->second : globalStats;
 
-                if(populationPerPlanningArea[n]->getAgeCategoryId() > 12 )
-                     populationGreaterThan65 = populationGreaterThan65 + populationPerPlanningArea[n]->getPopulation();
-            }
+                double avgHouseholdSize   = stats.avgHouseholdSize   / stats.counter;
+                double avgHouseholdIncome = stats.avgHouseholdIncome / stats.counter;
 
-            double probabilitySum = 0;
+                double logPopulationByHousingType   = log((double)stats.counter); //1 logarithm of population by housing type in the zone     persons
+                double populationDensity            = (double)stats.counter / stats.sumFloorArea * 100.0;   //2 population density  persons per hectare
 
-            for( int n = 0; n < model->getAlternatives().size(); n++ )
-            {
-                if( model->getAlternatives()[n]->getUnitTypeCounter() == 0 )
-                {
-                    for(int m = 0; m < populationPerPlanningArea.size(); m++)
-                    {
-                        int unitType = populationPerPlanningArea[m]->getUnitType();
-
-                        int dwellingType = GetDwellingType(unitType);
-
-                        if( dwellingType == model->getAlternatives()[n]->getDwellingTypeId() )
-                        {
-                            avgHouseholdSize += populationPerPlanningArea[m]->getAvgHhSize();
-                            avgHouseholdIncome += populationPerPlanningArea[m]->getAvgIncome();
-                            unitTypeCounter++;
-                            populationByunitType += populationPerPlanningArea[m]->getPopulation();
-                            sumFloorArea += populationPerPlanningArea[m]->getFloorArea();
-                        }
-                    }
+                ScreeningModelFactors *factors = factorsList[n];
 
-                    model->getAlternatives()[n]->setAvgHouseholdSize(avgHouseholdSize );
-                    model->getAlternatives()[n]->setAvgHouseholdIncome(avgHouseholdIncome );
-                    model->getAlternatives()[n]->setUnitTypeCounter(unitTypeCounter );
-                    model->getAlternatives()[n]->setPopulationByUnitType(populationByunitType );
-                    model->getAlternatives()[n]->setSumFloorArea(sumFloorArea);
-                }
-                else
+                double logZonalMedianHousingPrice   = 0.0;  //18 logarithm of the zonal median housing price by housing type    in (2005) SGD
                 {
-                    avgHouseholdSize  = model->getAlternatives()[n]->getAvgHouseholdSize();
-                    avgHouseholdIncome = model->getAlternatives()[n]->getAvgHouseholdIncome();
-                    unitTypeCounter = model->getAlternatives()[n]->getUnitTypeCounter();
-                    populationByunitType = model->getAlternatives()[n]->getPopulationByUnitType();
-                    sumFloorArea = model->getAlternatives()[n]->getSumFloorArea();
-                }
-
-                avgHouseholdSize    = avgHouseholdSize    / unitTypeCounter;
-                avgHouseholdIncome  = avgHouseholdIncome  / unitTypeCounter;
-
-                int bHighInc = 0;
+                    string strId = to_string(alternative->getPlanAreaId()) + to_string(alternative->getDwellingTypeId());
+                    int key = std::atoi( strId.c_str());
 
-                if(household->getIncome() > 7000 )
-                    bHighInc = 1;
+                    typedef boost::unordered_multimap<BigSerial, AlternativeHedonicPrice*>::iterator altmm_itr;
 
-                ZonalLanduseVariableValues *zonalLanduseVariableValues = model->getZonalLandUseByAlternativeId(n + 1);
+                    std::pair< altmm_itr,altmm_itr > its = model->getAlternativeHedonicPriceById().equal_range(key);
+                    int count = std::distance(its.first, its.second);
 
-                double income = household->getIncome();
+                    if(count > 0)
+                    {
+                        auto it = its.first;
+                        std::advance(it, count/2);
 
-                /*
-                 * If the income is zero. We'll try to deduce an income for that household base on the
-                 * current value of its property. We'll assume one third of the salary of that household
-                 * was used to get a 30 year mortgage and that the household has been fully paid for.
-                 */
-                if( income ==  0 )
-                {
-                    //multiple by a million cos the currentUnitPrice is expressed in millions. Divide by 30 * 12 assumming a 30 year mortgage
-                    //multiply by 3 cos only a third of the income was used to pay the mortgage.
-                    income = 3.0 * 1000000.0 * household->getCurrentUnitPrice() / ( 30 * 12 );
+                        logZonalMedianHousingPrice = it->second->getTotalPrice();
+                    }
                 }
 
-                if ( zonalLanduseVariableValues == nullptr)
-                    continue;
-
-                double logPopulationByHousingType   = log((double)unitTypeCounter); //1 logarithm of population by housing type in the zone     persons
-                double populationDensity            = (double)unitTypeCounter / (double)sumFloorArea * 100.0;   //2 population density  persons per hectare
-
-                double commercialLandFraction           = model->getscreeningModelFactorsList()[n]->getF_loc_com(); //3 zonal average fraction of commercial land within a 500-meter buffer area from a residential postcode (weighted by no. of residential unit within the buffer)    percentage point
-                double residentialLandFraction          = model->getscreeningModelFactorsList()[n]->getF_loc_res(); //4 zonal average fraction of residential land within a 500-meter buffer area from a residential postcode  (weighted by no. of residential unit within the buffer)  percentage point
-                double openSpaceFraction                = model->getscreeningModelFactorsList()[n]->getF_loc_open();//5 zonal average fraction of open space within a 500-meter buffer area from a residential postcode (weighted by residential unit within the buffer)    percentage point 
-                double oppurtunityDiversityIndex        = model->getscreeningModelFactorsList()[n]->getOdi10_loc(); //6 zonal average local land use mix (opportunity diversity) index: 1-(|lu1/t-1/9|+|lu2/t-1/9|+|lu3/t-1/9|+|lu4/t-1/9|+|lu5/t-1/9|+|lu6/t-1/9|+|lu7/t-1/9|+|lu8/t-1/9|+|lu9/t-1/9|)/(16/9)
-                double distanceToMrt                    = model->getscreeningModelFactorsList()[n]->getDis2mrt();   //7 zonal average distance to the nearest MRT station   in kilometer
-                double distanceToExp                    = model->getscreeningModelFactorsList()[n]->getDis2exp();   //8 zonal average distance to the nearest express way   in kilometer
-                double accessbilityManufacturJobs       = model->getscreeningModelFactorsList()[n]->getAcc_t_mfg(); 
-                double accessibilityOfficeJobs          = model->getscreeningModelFactorsList()[n]->getAcc_t_off();
-                double publicTransitTime                = model->getscreeningModelFactorsList()[n]->getTime_ave();
-                double publicTransitCost                = model->getscreeningModelFactorsList()[n]->getCost_ave();
-                
-                double fractionYoungerThan4         = ( populationYoungerThan4 / populationTotal ) * bHouseholdMemberYoungerThan4;  //10 zonal fraction of population younger than 4 years old x dummy if presence of kids younger than 4 years old in the household (=1, yes; =0, no)  percentage point
-                double fractionBetween5And19        = ( population5To19 / populationTotal ) * bHouseholdMember5To19;    //11 zonal fraction of population between 5 and 19 years old x dummy if presence of children in the household  (=1, yes; =0, no)    percentage point
-                double fractionOlderThan65          = ( populationGreaterThan65 / populationTotal ) * bHouseholdMemberGreaterThan65;    //12 zonal fraction of population older than 65 years old x dummy if presence of seniors in the household  (=1, yes; =0, no)    percentage point
-                double fractionOfChinese            = ( populationChinese / populationTotal ) * bHouseholdEthnicityChinese; //13 zonal fraction of Chinese population x  dummy if household is Chinese (=1, yes; =0, no)    percentage point
-                double fractionOfMalay              = ( populationChinese / populationTotal ) * bHouseholdEthnicityMalay;   //14 zonal fraction of Malay population x  dummy if household is Malay (=1, yes; =0, no)    percentage point
-                double fractionOfIndian             = ( populationChinese / populationTotal ) * bHouseholdEthnicityIndian;  //15 zonal fraction of Indian population x  dummy if household is Indian (=1, yes; =0, no)  percentage point
-                double householdSizeMinusZoneAvg    = fabs( avgHouseholdSize - household->getSize());   //16 absolute difference between zonal average household size by housing type
-                double logHouseholdInconeMinusZoneAvg= fabs( log(avgHouseholdIncome ) - log( income ) );    //17 absolute difference between logarithm of the zonal median household montly income by housing type and logarithm of the household income    SGD
-                double logZonalMedianHousingPrice   = 0.0;  //18 logarithm of the zonal median housing price by housing type    in (2005) SGD
-                double privateCondoHhSizeOne        = 0.0;  //19 = 1, if household size is 1, living in private condo/apartment
-                double landedPropertyHhSizeOne      = 0.0;  //20 = 1, if household size is 1, living in landed property
-                double otherHousingHhSizeOne        = 0.0;  //21 = 1, if household size is 1, living in other types of housing units
-                double hdb45                        = 0.0;
+                double hdb45 = 0.0;
+                double singleHighIncomeCoefficient = 0.0;
 
-                if( model->getAlternatives()[n]->getDwellingTypeId() == 600 )
-                {
-                    if( household->getSize() == 1 )
-                        privateCondoHhSizeOne = 1.0;
-                }
+                if( alternative->getDwellingTypeId() == 600 )
+                    singleHighIncomeCoefficient = coefficients->getDWL600();
                 else
-                if( model->getAlternatives()[n]->getDwellingTypeId() == 700 )
-                {
-                    if( household->getSize() == 1 )
-                        landedPropertyHhSizeOne = 1.0;
-                }
+                if( alternative->getDwellingTypeId() == 700 )
+                    singleHighIncomeCoefficient = coefficients->getDWL700();
                 else
-                if(model->getAlternatives()[n]->getDwellingTypeId() == 400 || model->getAlternatives()[n]->getDwellingTypeId() == 500 )
-                {
+                if( alternative->getDwellingTypeId() == 400 || alternative->getDwellingTypeId() == 500 )
                     hdb45 = 1.0;
-                }
                 else
-                {
-                    if( household->getSize() == 1 )
-                        otherHousingHhSizeOne = 1.0;
-                }
+                    singleHighIncomeCoefficient = coefficients->getDWL800();
+
+                double staticUtility =  ( logPopulationByHousingType          * coefficients->getln_popdwl()        ) +
+                                        ( populationDensity                   * coefficients->getden_respop_ha()    ) +
+                                        ( factors->getF_loc_com()             * coefficients->getf_loc_com()        ) +    //3 zonal average fraction of commercial land within a 500-meter buffer area
+                                        ( factors->getF_loc_res()             * coefficients->getf_loc_res()        ) +    //4 zonal average fraction of residential land within a 500-meter buffer area
+                                        ( factors->getF_loc_open()            * coefficients->getf_loc_open()       ) +    //5 zonal average fraction of open space within a 500-meter buffer area
+                                        ( factors->getOdi10_loc()             * coefficients->getodi10_loc()        ) +    //6 zonal average local land use mix (opportunity diversity) index
+                                        ( factors->getDis2mrt()               * coefficients->getdis2mrt()          ) +    //7 zonal average distance to the nearest MRT station   in kilometer
+                                        ( factors->getDis2exp()               * coefficients->getdis2exp()          ) +    //8 zonal average distance to the nearest express way   in kilometer
+                                        ( factors->getAcc_t_mfg()             * coefficients->getaccmanufact_jobs() ) +
+                                        ( factors->getAcc_t_off()             * coefficients->getaccoffice_jobs()   ) +
+                                        ( factors->getTime_ave()              * coefficients->getpt_tt()            ) +
+                                        ( factors->getCost_ave()              * coefficients->getpt_cost()          ) +
+                                        ( logZonalMedianHousingPrice          * coefficients->getlog_price05tt_med() ) +
+                                        ( hdb45                               * coefficients->getDWL400_500()       );
+
+                tables.staticUtility.push_back(staticUtility);
+                tables.avgHouseholdSize.push_back(avgHouseholdSize);
+                tables.logAvgHouseholdIncome.push_back(log(avgHouseholdIncome));
+                tables.singleHighIncomeCoefficient.push_back(singleHighIncomeCoefficient);
+                tables.scenarioFactor.push_back( (bToaPayohScenario && alternative->getPlanAreaId() == 50) ? 2.0 : 1.0 );
+            }
+        }
 
-                BigSerial id = 0;
+        void ScreeningSubModel::getScreeningProbabilities( int hhId, std::vector<double> &probabilities, HM_Model *modelArg, int day )
+        {
+            model = modelArg;
+            Household* household = model->getHouseholdById(hhId);
 
+            PlanningArea* planningArea = nullptr;
+            BigSerial id = ComputeHomePlanningArea(planningArea, household);
 
-                if( model->getAlternatives()[n]->getMedianHedonicPrice() > 0.000001 )
-                {
-                    logZonalMedianHousingPrice =  model->getAlternatives()[n]->getMedianHedonicPrice();
-                }
-                else
-                {
-                    string strId = to_string(model->getAlternatives()[n]->getPlanAreaId()) + to_string(model->getAlternatives()[n]->getDwellingTypeId());
-                    int key = std::atoi( strId.c_str());
+            planningArea = model->getPlanningAreaById(id);
 
-                    typedef boost::unordered_multimap<BigSerial, AlternativeHedonicPrice*>::iterator altmm_itr;
-                    typedef boost::unordered_multimap<BigSerial, AlternativeHedonicPrice*> altmmap;
+            if(!planningArea)
+                return;
 
-                    std::pair< altmm_itr,altmm_itr > its = model->getAlternativeHedonicPriceById().equal_range(key);
-                    int count = 0;
+            const ScreeningTables &tables = model->getScreeningTables();
 
-                    for (altmm_itr it = its.first; it != its.second; it++)
-                    {
-                        count++;
-                    }
+            ScreeningTables::PopulationFractions fractions;
+            boost::unordered_map<BigSerial, ScreeningTables::PopulationFractions>::const_iterator fractionsItr = tables.populationFractions.find(planningArea->getId());
 
-                    if(count > 0)
-                    {
-                        auto it = its.first;
-                        std::advance(it, count/2);
+            if( fractionsItr != tables.populationFractions.end() )
+                fractions = fractionsItr->second;
 
-                        logZonalMedianHousingPrice = it->second->getTotalPrice();
-                    }
+            double bHouseholdEthnicityChinese = ( household->getEthnicityId() == 1 );
+            double bHouseholdEthnicityMalay   = ( household->getEthnicityId() == 2 );
+            double bHouseholdEthnicityIndian  = ( household->getEthnicityId() == 3 );
 
-                    model->getAlternatives()[n]->setMedianHedonicPrice( logZonalMedianHousingPrice );
-                }
+            double bHouseholdMemberYoungerThan4  = false;
+            double bHouseholdMember5To19         = false;
+            double bHouseholdMemberGreaterThan65 = false;
 
-                int m = 0;
-
-                double oddsRatio =  ( logPopulationByHousingType* model->getScreeningModelCoefficientsList()[m]->getln_popdwl() ) +
-                                    ( populationDensity         * model->getScreeningModelCoefficientsList()[m]->getden_respop_ha()     ) +
-                                    ( commercialLandFraction    * model->getScreeningModelCoefficientsList()[m]->getf_loc_com()         ) +
-                                    ( residentialLandFraction   * model->getScreeningModelCoefficientsList()[m]->getf_loc_res()         ) +
-                                    ( openSpaceFraction         * model->getScreeningModelCoefficientsList()[m]->getf_loc_open()        ) +
-                                    ( oppurtunityDiversityIndex * model->getScreeningModelCoefficientsList()[m]->getodi10_loc()         ) +
-                                    ( distanceToMrt             * model->getScreeningModelCoefficientsList()[m]->getdis2mrt()           ) +
-                                    ( distanceToExp             * model->getScreeningModelCoefficientsList()[m]->getdis2exp()           ) +
-                                    ( accessbilityManufacturJobs* model->getScreeningModelCoefficientsList()[m]->getaccmanufact_jobs()  ) +
-                                    ( accessibilityOfficeJobs   * model->getScreeningModelCoefficientsList()[m]->getaccoffice_jobs()    ) +
-                                    ( publicTransitTime         * model->getScreeningModelCoefficientsList()[m]->getpt_tt()             ) +
-                                    ( publicTransitCost         * model->getScreeningModelCoefficientsList()[m]->getpt_cost()           ) +
-                                    ( fractionYoungerThan4      * model->getScreeningModelCoefficientsList()[m]->getf_age4_n4()         ) +
-                                    ( fractionBetween5And19     * model->getScreeningModelCoefficientsList()[m]->getf_age19_n19()       ) +
-                                    ( fractionOlderThan65       * model->getScreeningModelCoefficientsList()[m]->getf_age65_n65()       ) +
-                                    ( fractionOfChinese         * model->getScreeningModelCoefficientsList()[m]->getf_chn_nchn()        ) +
-                                    ( fractionOfMalay           * model->getScreeningModelCoefficientsList()[m]->getf_mal_nmal()        ) +
-                                    ( fractionOfIndian          * model->getScreeningModelCoefficientsList()[m]->getf_indian_nind()     ) +
-                                    ( householdSizeMinusZoneAvg * model->getScreeningModelCoefficientsList()[m]->gethhsize_diff()       ) +
-                                    ( logHouseholdInconeMinusZoneAvg * model->getScreeningModelCoefficientsList()[m]->getlog_hhinc_diff() ) +
-                                    ( logZonalMedianHousingPrice* model->getScreeningModelCoefficientsList()[m]->getlog_price05tt_med() ) +
-                                    ( privateCondoHhSizeOne     * model->getScreeningModelCoefficientsList()[m]->getDWL600() * bHighInc ) +
-                                    ( landedPropertyHhSizeOne   * model->getScreeningModelCoefficientsList()[m]->getDWL700() * bHighInc ) +
-                                    ( otherHousingHhSizeOne     * model->getScreeningModelCoefficientsList()[m]->getDWL800() * bHighInc ) +
-                                    ( hdb45                     * model->getScreeningModelCoefficientsList()[m]->getDWL400_500() );
-
-                /*
-                PrintOut("n: " <<    populationByunitType       << " 0 " << planningArea->getId()  << " hhid:  " << hhId << " " <<
-                                     logPopulationByHousingType << " 1 " << ln_popdwl        << " " <<
-                                     populationDensity          << " 2 " << den_respop_ha    << " " <<
-                                     commercialLandFraction     << " 3 " << f_loc_com        << " " <<
-                                     residentialLandFraction    << " 4 " << f_loc_res        << " " <<
-                                     openSpaceFraction          << " 5 " << f_loc_open       << " " <<
-                                     oppurtunityDiversityIndex  << " 6 " << odi10_loc        << " " <<
-                                     distanceToMrt              << " 7 " << dis2mrt          << " " <<
-                                     distanceToExp              << " 8 " << dis2exp          << " " <<
-                                     householdWorkerLogsumAverage << " 9 " << hh_dgp_w_lgsm1 << " " <<
-                                     fractionYoungerThan4       << " a " << f_age4_n4        << " " <<
-                                     fractionBetween5And19      << " b " << f_age19_n19      << " " <<
-                                     fractionOlderThan65        << " c " << f_age65_n65      << " " <<
-                                     fractionOfChinese          << " d " << f_chn_nchn       << " " <<
-                                     fractionOfMalay            << " e " << f_mal_nmal       << " " <<
-                                     fractionOfIndian           << " f " << f_indian_nind    << " " <<
-                                     householdSizeMinusZoneAvg  << " g " << hhsize_diff      << " " <<
-                                     logHouseholdInconeMinusZoneAvg << " h " << log_hhinc_diff << " " <<
-                                     logZonalMedianHousingPrice << " i " << log_price05tt_med  << " " <<
-                                     privateCondoHhSizeOne      << " j " << DWL600  << " " <<
-                                     landedPropertyHhSizeOne    << " k " << DWL700  << " " <<
-                                     otherHousingHhSizeOne      << " l " << DWL800  << std::endl);
-                */
-
-                if( std::isnan(oddsRatio) )
-                    oddsRatio = 0.0;
+            std::vector<BigSerial> individualIds = household->getIndividuals();
 
-                if( std::isinf( oddsRatio) )
-                    oddsRatio = 0.0;
+            for( int n = 0; n < individualIds.size(); n++ )
+            {
+                Individual* thisMember = model->getIndividualById(individualIds[n]);
 
+                if( thisMember->getAgeCategoryId()  == 0 )
+                    bHouseholdMemberYoungerThan4 = true;
 
-                 const ConfigParams& config = ConfigManager::GetInstance().FullConfig();
-                 bool bToaPayohScenario = false;
+                if( thisMember->getAgeCategoryId() > 0 && thisMember->getAgeCategoryId() < 4 )
+                    bHouseholdMember5To19 = true;
 
-                 if( config.ltParams.scenario.enabled && config.ltParams.scenario.scenarioName == "ToaPayohScenario")
-                     bToaPayohScenario = true;
+                if( thisMember->getAgeCategoryId() > 12 )
+                    bHouseholdMemberGreaterThan65 = true;
+            }
 
-                 double probability = exp(oddsRatio);
+            double income = household->getIncome();
 
-                if(  bToaPayohScenario  && model->getAlternatives()[n]->getPlanAreaId() == 50 )
-                {
-                    probability = probability * 2.0;
-                }
+            /*
+             * If the income is zero. We'll try to deduce an income for that household base on the
+             * current value of its property. We'll assume one third of the salary of that household
+             * was used to get a 30 year mortgage and that the household has been fully paid for.
+             */
+            if( income ==  0 )
+            {
+                //multiple by a million cos the currentUnitPrice is expressed in millions. Divide by 30 * 12 assumming a 30 year mortgage
+                //multiply by 3 cos only a third of the income was used to pay the mortgage.
+                income = 3.0 * 1000000.0 * household->getCurrentUnitPrice() / ( 30 * 12 );
+            }
+
+            double logIncome = log( income );
+            double householdSize = household->getSize();
+            double singleHighIncome = ( household->getSize() == 1 && household->getIncome() > 7000 ) ? 1.0 : 0.0;
+
+            //10 to 15: zonal fractions of the population x dummies of the household (=1, yes; =0, no)
+            //The malay and indian terms use the fraction of chinese population, as estimated.
+            double householdUtility = ( fractions.youngerThan4  * bHouseholdMemberYoungerThan4  * tables.youngerThan4Coefficient  ) +
+                                      ( fractions.between5And19 * bHouseholdMember5To19         * tables.between5And19Coefficient ) +
+                                      ( fractions.olderThan65   * bHouseholdMemberGreaterThan65 * tables.olderThan65Coefficient   ) +
+                                      ( fractions.chinese       * bHouseholdEthnicityChinese    * tables.chineseCoefficient       ) +
+                                      ( fractions.chinese       * bHouseholdEthnicityMalay      * tables.malayCoefficient         ) +
+                                      ( fractions.chinese       * bHouseholdEthnicityIndian     * tables.indianCoefficient        );
+
+            const size_t numAlternatives = tables.size();
+            const double *staticUtility = tables.staticUtility.data();
+            const double *avgHouseholdSize = tables.avgHouseholdSize.data();
+            const double *logAvgHouseholdIncome = tables.logAvgHouseholdIncome.data();
+            const double *singleHighIncomeCoefficient = tables.singleHighIncomeCoefficient.data();
+            const double *scenarioFactor = tables.scenarioFactor.data();
+
+            probabilities.resize(numAlternatives);
+            double *probability = probabilities.data();
+            double probabilitySum = 0;
 
-                probabilities.push_back(probability);
+            for( size_t n = 0; n < numAlternatives; n++ )
+            {
+                double oddsRatio =  staticUtility[n] + householdUtility +
+                                    ( fabs( avgHouseholdSize[n] - householdSize )  * tables.hhSizeDiffCoefficient    ) +    //16 absolute difference between zonal average household size by housing type
+                                    ( fabs( logAvgHouseholdIncome[n] - logIncome ) * tables.logIncomeDiffCoefficient ) +    //17 absolute difference between logarithm of the zonal median household montly income by housing type and logarithm of the household income
+                                    ( singleHighIncome * singleHighIncomeCoefficient[n] );                                  //19 to 21 = 1, if household size is 1, by type of housing
+
+                if( std::isnan(oddsRatio) || std::isinf(oddsRatio) )
+                    oddsRatio = 0.0;
 
-                probabilitySum += probability;
+                probability[n] = exp(oddsRatio) * scenarioFactor[n];
+                probabilitySum += probability[n];
             }
 
-            for( int n = 0; n < probabilities.size(); n++)
+            for( size_t n = 0; n < numAlternatives; n++ )
             {
-                probabilities[n] = probabilities[n]/ probabilitySum;
+                probability[n] = probability[n] / probabilitySum;
             }
 
 
@@ -32,6 +32,16 @@ namespace sim_mob
                 ScreeningSubModel();
                 virtual ~ScreeningSubModel();
 
+                /**
+                 * Computes the household independent terms of the screening model for all the alternatives.
+                 * Called once by HM_Model at startup, after the alternatives and the population are loaded.
+                 */
+                void buildScreeningTables(HM_Model *model, ScreeningTables &tables);
+
+                /**
+                 * Computes the screening probabilities of a household from the tables of the model.
+                 * Does not modify the model, so households can be screened by several threads at the same time.
+                 */
                 void getScreeningProbabilities(int hhId, std::vector<double> &probabilities, HM_Model *model, int day);
 
                 BigSerial ComputeHomePlanningArea(PlanningArea *planningAreaWork, Household *household);
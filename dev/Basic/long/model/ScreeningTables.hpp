@@ -0,0 +1,87 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "Types.hpp"
+
+namespace sim_mob
+{
+    namespace long_term
+    {
+        /**
+         * Household independent terms of the screening model, computed once at startup
+         * (see ScreeningSubModel::buildScreeningTables).
+         *
+         * The arrays hold one value per alternative with land use variables, in the order of
+         * HM_Model::getAlternatives(), so a household screening is a single pass over them.
+         * The tables are only read after startup and can be shared by all the household threads.
+         */
+        struct ScreeningTables
+        {
+            /**
+             * Fractions of the population of a planning area.
+             * They are NaN for a planning area without population, as the screening model divides by zero.
+             */
+            struct PopulationFractions
+            {
+                PopulationFractions() : youngerThan4(std::numeric_limits<double>::quiet_NaN()),
+                                        between5And19(std::numeric_limits<double>::quiet_NaN()),
+                                        olderThan65(std::numeric_limits<double>::quiet_NaN()),
+                                        chinese(std::numeric_limits<double>::quiet_NaN()) {}
+
+                double youngerThan4;
+                double between5And19;
+                double olderThan65;
+                double chinese;
+            };
+
+            /** utility of the land use, population density and price terms*/
+            std::vector<double> staticUtility;
+
+            /** average household size of the population of the alternative*/
+            std::vector<double> avgHouseholdSize;
+
+            /** logarithm of the average household income of the population of the alternative*/
+            std::vector<double> logAvgHouseholdIncome;
+
+            /** coefficient applied to single person, high income households (DWL600, DWL700, DWL800 or 0)*/
+            std::vector<double> singleHighIncomeCoefficient;
+
+            /** factor applied to the probability of the alternative by the scenario*/
+            std::vector<double> scenarioFactor;
+
+            /** population fractions by planning area id*/
+            boost::unordered_map<BigSerial, PopulationFractions> populationFractions;
+
+            /** coefficients of the household dependent terms*/
+            double hhSizeDiffCoefficient = 0;
+            double logIncomeDiffCoefficient = 0;
+            double youngerThan4Coefficient = 0;
+            double between5And19Coefficient = 0;
+            double olderThan65Coefficient = 0;
+            double chineseCoefficient = 0;
+            double malayCoefficient = 0;
+            double indianCoefficient = 0;
+
+            size_t size() const
+            {
+                return staticUtility.size();
+            }
+
+            void clear()
+            {
+                staticUtility.clear();
+                avgHouseholdSize.clear();
+                logAvgHouseholdIncome.clear();
+                singleHighIncomeCoefficient.clear();
+                scenarioFactor.clear();
+                populationFractions.clear();
+            }
+        };
+    }
+}
@@ -16,6 +16,7 @@
 #include "database/entity/HouseHoldHitsSample.hpp"
 #include "database/entity/Job.hpp"
 #include <boost/random/mersenne_twister.hpp>
+#include <boost/random/normal_distribution.hpp>
 #include <model/WillingnessToPaySubModel.hpp>
 #include "core/AgentsLookup.hpp"
 #include "core/DataManager.hpp"
@@ -209,8 +210,7 @@ namespace sim_mob
 
                 if( ZZ_logsumhh == -1 )
                 {
-                    PersonParams personParam = PredayLT_LogsumManager::getInstance().computeLogsum( headOfHousehold->getId(), homeTaz, workTaz, household->getVehicleOwnershipOptionId() );
-                    ZZ_logsumhh = personParam.getDpbLogsum();
+                    ZZ_logsumhh = model->getLogsumCache().getDpbLogsum( headOfHousehold->getId(), homeTaz, workTaz, household->getVehicleOwnershipOptionId() );
 
                     BigSerial groupId = hitssample->getGroupId();
                     boost::shared_ptr<HM_Model::HouseholdGroup> thisHHGroup(new HM_Model::HouseholdGroup(groupId, homeTaz, ZZ_logsumhh ));
@@ -454,162 +454,179 @@ namespace sim_mob
             return V;
         }
 
-        double WillingnessToPaySubModel::calculateResidentialWillingnessToPay(const Unit* unit, const Household* household, double& wtp_e, double day, HM_Model *model)
+        void WillingnessToPaySubModel::calculateResidentialWillingnessToPay(const std::vector<const Unit*>& units, const Household* household, double day, HM_Model *model,
+                                                                            boost::mt19937& generator, std::vector<double>& willingnessToPay, std::vector<double>& wtp_e)
         {
-            double willingnessToPay;
-            int unitTypeId = unit->getUnitType();
-            const ResidentialWTP_Coefs *wtpCoeffs = nullptr;
-            bool nonHDB = false;
+            const size_t numUnits = units.size();
+            willingnessToPay.resize(numUnits);
+            wtp_e.resize(numUnits);
 
-            if( (unitTypeId == 1) || (unitTypeId == 2) || (unitTypeId == 3) || (unitTypeId == 65))
-            {
-                wtpCoeffs = model->getResidentialWTP_CoefsByPropertyType("hdb_123");
-            }
-            else if(unitTypeId == 4)
-            {
-                wtpCoeffs = model->getResidentialWTP_CoefsByPropertyType("hdb_4");
-            }
-            else if(unitTypeId == 5 || unitTypeId == 6)
-            {
-                wtpCoeffs = model->getResidentialWTP_CoefsByPropertyType("hdb_5");
-            }
-            else
-            {
-                wtpCoeffs = model->getResidentialWTP_CoefsByPropertyType("private");
-                nonHDB = true;
-            }
+            if( numUnits == 0 )
+                return;
 
-            Postcode *unitPostcode = model->getPostcodeById( model->getUnitSlaAddressId( unit->getId() ) );
-            BigSerial tazId = unitPostcode->getTazId();
-            double logsumTaz = model->ComputeHedonicPriceLogsumFromDatabase( tazId );
-            Household* householdT = const_cast<Household*>(household);
-            householdT->setLogsum(logsumTaz);
+            //coefficients by property type, looked up once for all the units
+            const ResidentialWTP_Coefs *hdb123Coeffs  = model->getResidentialWTP_CoefsByPropertyType("hdb_123");
+            const ResidentialWTP_Coefs *hdb4Coeffs    = model->getResidentialWTP_CoefsByPropertyType("hdb_4");
+            const ResidentialWTP_Coefs *hdb5Coeffs    = model->getResidentialWTP_CoefsByPropertyType("hdb_5");
+            const ResidentialWTP_Coefs *privateCoeffs = model->getResidentialWTP_CoefsByPropertyType("private");
 
-            double missingAge = 0;
-            double ageOfUnit = 0;
+            //household terms, the same for all the units
             double carDummy = 0;
             if(household->getVehicleCategoryId() > 0)
             {
                 carDummy = 1;
             }
-            if( (unit->getOccupancyFromDate().tm_year == 8099)|| (unit->getOccupancyFromDate().tm_year == 0))
-            {
-                missingAge = 1;
-            }
-            else
-            {
-                ageOfUnit= HITS_SURVEY_YEAR  - 1900 + ( day / 365 ) - unit->getOccupancyFromDate().tm_year;
-            }
 
-            if(nonHDB && ageOfUnit > 50)
-            {
-                ageOfUnit = 50;
-            }
-            if(!nonHDB && ageOfUnit > 40)
+            double logIncome = log(household->getIncome());
+
+            double fullTimeWorkers = household->getWorkers();
+            double oneTwoFullTimeWorkers = 0;
+            if(fullTimeWorkers == 1 || fullTimeWorkers == 2)
             {
-                ageOfUnit = 40;
+                oneTwoFullTimeWorkers = 1;
             }
 
-            ageOfUnit = ageOfUnit/10.0;// (age of unit is divided by 10 in Roberto's model')
+            double hhSizeWorkersDiff = household->getSize()- household->getWorkers();
 
-            const PostcodeAmenities *pcAmenities = DataManagerSingleton::getInstance().getAmenitiesById( model->getUnitSlaAddressId( unit->getId() ) );
-            double distanceMall = pcAmenities->getDistanceToMall();
-            //Chetan. 3 July 2017.
-            //Temp fix cos XiaoHu added some distanceToMall in meters
-            if(distanceMall > 100 )
-                distanceMall = distanceMall / 1000;
+            boost::normal_distribution<> nd( 0.0, sde);
+            double logsumTaz = 0;
 
-            double distanceToMRT = pcAmenities->getDistanceToMRT();
-            double isMRT_2_400m = 0;
-            if( (distanceToMRT > 0.200) && (distanceToMRT < 0.400))
+            for( size_t n = 0; n < numUnits; n++ )
             {
-                isMRT_2_400m = 1;
-            }
+                const Unit *unit = units[n];
+                int unitTypeId = unit->getUnitType();
+                const ResidentialWTP_Coefs *wtpCoeffs = nullptr;
+                bool nonHDB = false;
 
-            double freeholdApartment = 0;
-            double freeholdCondo = 0;
-            double freeholdTerrace = 0;
-            double freeholdDetached = 0;
+                if( (unitTypeId == 1) || (unitTypeId == 2) || (unitTypeId == 3) || (unitTypeId == 65))
+                {
+                    wtpCoeffs = hdb123Coeffs;
+                }
+                else if(unitTypeId == 4)
+                {
+                    wtpCoeffs = hdb4Coeffs;
+                }
+                else if(unitTypeId == 5 || unitTypeId == 6)
+                {
+                    wtpCoeffs = hdb5Coeffs;
+                }
+                else
+                {
+                    wtpCoeffs = privateCoeffs;
+                    nonHDB = true;
+                }
 
-            if(unitTypeId >=7 && unitTypeId <=11)
-            {
-                freeholdApartment = 1;
-            }
-            else if(unitTypeId >=12 && unitTypeId <= 16)
-            {
-                freeholdCondo = 1;
-            }
-            else if(unitTypeId >= 17 && unitTypeId <= 21)
-            {
-                freeholdTerrace = 1;
-            }
-            else if(unitTypeId >=27 && unitTypeId <=31)
-            {
-                freeholdDetached = 1;
-            }
+                BigSerial slaAddressId = model->getUnitSlaAddressId( unit->getId() );
+                Postcode *unitPostcode = model->getPostcodeById( slaAddressId );
+                BigSerial tazId = unitPostcode->getTazId();
+                logsumTaz = model->ComputeHedonicPriceLogsumFromDatabase( tazId );
 
-            double bus200_400m = 0;
-            if(pcAmenities->getDistanceToBus() >= 0.200 && pcAmenities->getDistanceToBus() <= 0.400)
-            {
-                bus200_400m = 1;
-            }
+                double missingAge = 0;
+                double ageOfUnit = 0;
+                if( (unit->getOccupancyFromDate().tm_year == 8099)|| (unit->getOccupancyFromDate().tm_year == 0))
+                {
+                    missingAge = 1;
+                }
+                else
+                {
+                    ageOfUnit= HITS_SURVEY_YEAR  - 1900 + ( day / 365 ) - unit->getOccupancyFromDate().tm_year;
+                }
 
-            double fullTimeWorkers = household->getWorkers();
-            double oneTwoFullTimeWorkers = 0;
-            if(fullTimeWorkers == 1 || fullTimeWorkers == 2)
-            {
-                oneTwoFullTimeWorkers = 1;
-            }
+                if(nonHDB && ageOfUnit > 50)
+                {
+                    ageOfUnit = 50;
+                }
+                if(!nonHDB && ageOfUnit > 40)
+                {
+                    ageOfUnit = 40;
+                }
 
-            double logArea = log(unit->getFloorArea()/10);//for the estimation of this coeff, we have to rescale to comparable with other units. - Roberto
-            double hhSizeWorkersDiff = household->getSize()- household->getWorkers();
+                ageOfUnit = ageOfUnit/10.0;// (age of unit is divided by 10 in Roberto's model')
 
-            Taz *taz = model->getTazById(tazId);
-            double mature = 0;
-            double matureOther = 0;
-            if(taz->getHdbTownType().compare("mature") == 0)
-            {
-                mature = 1;
-            }
-            else if (taz->getHdbTownType().compare("mature") == 0)
-            {
-                matureOther = 1;
-            }
+                const PostcodeAmenities *pcAmenities = DataManagerSingleton::getInstance().getAmenitiesById( slaAddressId );
+                double distanceMall = pcAmenities->getDistanceToMall();
+                //Chetan. 3 July 2017.
+                //Temp fix cos XiaoHu added some distanceToMall in meters
+                if(distanceMall > 100 )
+                    distanceMall = distanceMall / 1000;
 
-            willingnessToPay =  wtpCoeffs->getConstant() +
-                                wtpCoeffs->getLogArea() * logArea
-                                + wtpCoeffs->getLogsumTaz() * logsumTaz
-                                + wtpCoeffs->getAge() * ageOfUnit + wtpCoeffs->getAgeSquared() * (ageOfUnit * ageOfUnit)
-                                + wtpCoeffs->getCarDummy() * carDummy + wtpCoeffs->getCarIntoLogsumTaz() * carDummy * logsumTaz
-                                + wtpCoeffs->getDistanceMall() * distanceMall
-                                + wtpCoeffs->getMrt200m400m() * isMRT_2_400m
-                                + wtpCoeffs->getMatureDummy() * mature + wtpCoeffs->getMatureOtherDummy() * matureOther
-                                + wtpCoeffs->getFloorNumber() * unit->getStorey()
-                                + wtpCoeffs->getLogIncome() * log(household->getIncome())
-                                + wtpCoeffs->getLogIncomeIntoLogArea() * log(household->getIncome()) * logArea
-                                + wtpCoeffs->getFreeholdApartment() * freeholdApartment
-                                + wtpCoeffs->getFreeholdCondo() * freeholdCondo
-                                + wtpCoeffs->getFreeholdTerrace() * freeholdTerrace
-                                + wtpCoeffs->getFreeholdDetached() * freeholdDetached
-                                + wtpCoeffs->getBus200m400mDummy() * bus200_400m
-                                + wtpCoeffs->getOneTwoFullTimeWorkerDummy() * oneTwoFullTimeWorkers
-                                + wtpCoeffs->getFullTimeWorkersTwoIntoLogArea() * oneTwoFullTimeWorkers * logArea
-                                + wtpCoeffs->getHhSizeworkersDiff() * hhSizeWorkersDiff;
-
-                boost::mt19937 rng( clock() );
-                boost::normal_distribution<> nd( 0.0, sde);
-                boost::variate_generator<boost::mt19937&,  boost::normal_distribution<> > var_nor(rng, nd);
-                wtp_e  = var_nor();
+                double distanceToMRT = pcAmenities->getDistanceToMRT();
+                double isMRT_2_400m = 0;
+                if( (distanceToMRT > 0.200) && (distanceToMRT < 0.400))
+                {
+                    isMRT_2_400m = 1;
+                }
 
-                //needed when wtp model is expressed as log wtp
-                willingnessToPay = exp(willingnessToPay);
-//              if(isinf(willingnessToPay) )
-//              {
-//                  PrintOutV("wtp is inf for"<< unit->getId()<<std::endl);
-//              }
+                double freeholdApartment = 0;
+                double freeholdCondo = 0;
+                double freeholdTerrace = 0;
+                double freeholdDetached = 0;
 
-                return willingnessToPay;
+                if(unitTypeId >=7 && unitTypeId <=11)
+                {
+                    freeholdApartment = 1;
+                }
+                else if(unitTypeId >=12 && unitTypeId <= 16)
+                {
+                    freeholdCondo = 1;
+                }
+                else if(unitTypeId >= 17 && unitTypeId <= 21)
+                {
+                    freeholdTerrace = 1;
+                }
+                else if(unitTypeId >=27 && unitTypeId <=31)
+                {
+                    freeholdDetached = 1;
+                }
+
+                double bus200_400m = 0;
+                if(pcAmenities->getDistanceToBus() >= 0.200 && pcAmenities->getDistanceToBus() <= 0.400)
+                {
+                    bus200_400m = 1;
+                }
+
+                double logArea = log(unit->getFloorArea()/10);//for the estimation of this coeff, we have to rescale to comparable with other units. - Roberto
 
+                Taz *taz = model->getTazById(tazId);
+                double mature = 0;
+                double matureOther = 0;
+                if(taz->getHdbTownType().compare("mature") == 0)
+                {
+                    mature = 1;
+                }
+                else if (taz->getHdbTownType().compare("mature") == 0)
+                {
+                    matureOther = 1;
+                }
+
+                double V =  wtpCoeffs->getConstant() +
+                            wtpCoeffs->getLogArea() * logArea
+                            + wtpCoeffs->getLogsumTaz() * logsumTaz
+                            + wtpCoeffs->getAge() * ageOfUnit + wtpCoeffs->getAgeSquared() * (ageOfUnit * ageOfUnit)
+                            + wtpCoeffs->getCarDummy() * carDummy + wtpCoeffs->getCarIntoLogsumTaz() * carDummy * logsumTaz
+                            + wtpCoeffs->getDistanceMall() * distanceMall
+                            + wtpCoeffs->getMrt200m400m() * isMRT_2_400m
+                            + wtpCoeffs->getMatureDummy() * mature + wtpCoeffs->getMatureOtherDummy() * matureOther
+                            + wtpCoeffs->getFloorNumber() * unit->getStorey()
+                            + wtpCoeffs->getLogIncome() * logIncome
+                            + wtpCoeffs->getLogIncomeIntoLogArea() * logIncome * logArea
+                            + wtpCoeffs->getFreeholdApartment() * freeholdApartment
+                            + wtpCoeffs->getFreeholdCondo() * freeholdCondo
+                            + wtpCoeffs->getFreeholdTerrace() * freeholdTerrace
+                            + wtpCoeffs->getFreeholdDetached() * freeholdDetached
+                            + wtpCoeffs->getBus200m400mDummy() * bus200_400m
+                            + wtpCoeffs->getOneTwoFullTimeWorkerDummy() * oneTwoFullTimeWorkers
+                            + wtpCoeffs->getFullTimeWorkersTwoIntoLogArea() * oneTwoFullTimeWorkers * logArea
+                            + wtpCoeffs->getHhSizeworkersDiff() * hhSizeWorkersDiff;
+
+                //needed when wtp model is expressed as log wtp
+                willingnessToPay[n] = exp(V);
+                wtp_e[n] = nd(generator);
+            }
+
+            //the household keeps the logsum of the last unit, as if the units were evaluated one by one.
+            Household* householdT = const_cast<Household*>(household);
+            householdT->setLogsum(logsumTaz);
         }
     }
 
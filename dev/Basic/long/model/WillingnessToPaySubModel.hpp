@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <vector>
+#include <boost/random/mersenne_twister.hpp>
 #include "Common.hpp"
 #include "Types.hpp"
 #include "database/entity/Unit.hpp"
@@ -28,7 +30,21 @@ namespace sim_mob
             virtual ~WillingnessToPaySubModel();
 
             double CalculateWillingnessToPay(const Unit* unit, const Household* household, double& wtp_e, double day, HM_Model *model);
-            double calculateResidentialWillingnessToPay(const Unit* unit, const Household* household, double& wtp_e, double day, HM_Model *model);
+
+            /**
+             * Computes the willingness to pay of a household for several units.
+             * The coefficients and the household terms are computed once for all the units.
+             *
+             * @param units units to evaluate
+             * @param household bidding household
+             * @param day current day
+             * @param model housing market model
+             * @param generator generator of the wtp errors, usually the one of the worker of the household
+             * @param willingnessToPay willingness to pay for each unit, in millions of dollars
+             * @param wtp_e error of the willingness to pay for each unit
+             */
+            void calculateResidentialWillingnessToPay(const std::vector<const Unit*>& units, const Household* household, double day, HM_Model *model,
+                                                      boost::mt19937& generator, std::vector<double>& willingnessToPay, std::vector<double>& wtp_e);
 
             void FindHDBType( int unitType);
             void FindHouseholdSize(const Household* household);
@@ -10,9 +10,12 @@
  * Created on May 16, 2013, 5:13 PM
  */
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <boost/format.hpp>
 #include <boost/make_shared.hpp>
+#include <boost/random/discrete_distribution.hpp>
 #include "HouseholdBidderRole.hpp"
 #include "message/LT_Message.hpp"
 #include "event/EventPublisher.hpp"
@@ -34,6 +37,7 @@
 #include "model/WillingnessToPaySubModel.hpp"
 #include "util/PrintLog.hpp"
 #include "model/VehicleOwnershipModel.hpp"
+#include "workers/Worker.hpp"
 
 
 using std::list;
@@ -508,11 +512,10 @@ int HouseholdBidderRole::getMoveInWaitingTimeInDays()
     return moveInWaitingTimeInDays;
 }
 
-void HouseholdBidderRole::calculateMaxSurplusEntry(const HousingMarket::Entry* entry,double &maxSurplus, double &finalBid, double &maxWp,double &maxAffordability,double &maxWtpe,BigSerial &maxEntryUnitId)
+bool HouseholdBidderRole::isEligibleEntry(const HousingMarket::Entry* entry)
 {
     HM_Model* model = getParent()->getModel();
     const Household* household = getParent()->getHousehold();
-    ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
 
     const Unit* unit = model->getUnitById(entry->getUnitId());
     const HM_Model::TazStats* stats = model->getTazStatsByUnitId(entry->getUnitId());
@@ -529,6 +532,20 @@ void HouseholdBidderRole::calculateMaxSurplusEntry(const HousingMarket::Entry* e
         flatEligibility = false;
 
     if( stats && flatEligibility )
+        return true;
+
+    printError( (boost::format("[day %1%]Could not compute bid value for unit %2%. Eligibility: %3% Stats: %4%") % day % unit->getId() % flatEligibility % stats ).str() );
+    return false;
+}
+
+void HouseholdBidderRole::calculateMaxSurplusEntry(const HousingMarket::Entry* entry, double wp, double wtp_e, double &maxSurplus, double &finalBid, double &maxWp,double &maxAffordability,double &maxWtpe,BigSerial &maxEntryUnitId)
+{
+    HM_Model* model = getParent()->getModel();
+    const Household* household = getParent()->getHousehold();
+    ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
+
+    const Unit* unit = model->getUnitById(entry->getUnitId());
+
     {
         const Unit *hhUnit = model->getUnitById( household->getUnitId() );
 
@@ -538,11 +555,8 @@ void HouseholdBidderRole::calculateMaxSurplusEntry(const HousingMarket::Entry* e
 
         Postcode *oldPC = model->getPostcodeById(postcodeCurrent);
         Postcode *newPC = model->getPostcodeById( model->getUnitSlaAddressId( unit->getId() ) );
-        double wtp_e = 0;
 
         //The willingness to pay is in millions of dollars
-        WillingnessToPaySubModel wtp_m;
-        double wp = wtp_m.calculateResidentialWillingnessToPay(unit, household, wtp_e,day, model);
         {
             int unit_type = unit->getUnitType();
 
@@ -609,12 +623,6 @@ void HouseholdBidderRole::calculateMaxSurplusEntry(const HousingMarket::Entry* e
             maxWtpe = wtp_e;
         }
     }
-    else
-    {
-        printError( (boost::format("[day %1%]Could not compute bid value for unit %2%. Eligibility: %3% Stats: %4%") % day % unit->getId() % flatEligibility % stats ).str() );
-    }
-
-
 }
 
 bool HouseholdBidderRole::pickEntryToBid()
@@ -630,10 +638,9 @@ bool HouseholdBidderRole::pickEntryToBid()
 
     const double minUnitsInZoneHousingType = 2;
 
-    //get available entries (for preferable zones if exists)
-    HousingMarket::ConstEntryList entries;
-
-    market->getAvailableEntries(entries);
+    //available entries, indexed by the market. The choice set is drawn from them.
+    const HousingMarket::EntrySet& entries = market->getAvailableEntrySet();
+    boost::mt19937& generator = getParent()->currWorkerProvider->getGenerator();
 
     BigSerial maxEntryUnitId = INVALID_ID;
     double maxSurplus = INT_MIN; // holds the wp of the entry with maximum surplus.
@@ -666,52 +673,28 @@ bool HouseholdBidderRole::pickEntryToBid()
 
     if(config.ltParams.housingModel.bidderUnitChoiceset.randomChoiceset == true)
     {
-        while (screenedEntries.size() < config.ltParams.housingModel.bidderUnitChoiceset.bidderChoicesetSize)
-        {
-            double randomDraw = (double) rand() / RAND_MAX * entries.size();
-            screenedEntries.insert(entries[randomDraw]);
-        }
+        HousingMarket::ConstEntryList sampledEntries;
+        entries.sample(generator, config.ltParams.housingModel.bidderUnitChoiceset.bidderChoicesetSize, sampledEntries);
+        screenedEntries.insert(sampledEntries.begin(), sampledEntries.end());
     }
     else
-    if(config.ltParams.housingModel.bidderUnitChoiceset.shanRobertoChoiceset == true)
+    if(config.ltParams.housingModel.bidderUnitChoiceset.shanRobertoChoiceset == true &&
+       std::accumulate(householdScreeningProbabilities.begin(), householdScreeningProbabilities.end(), 0.0) > 0)
     {
+        //draws the zone housing types in constant time (alias method).
+        boost::random::discrete_distribution<int> zoneHousingTypeDistribution(householdScreeningProbabilities.begin(), householdScreeningProbabilities.end());
+
         for (int n = 0; n < entries.size() && screenedEntries.size() < config.ltParams.housingModel.bidderUnitChoiceset.bidderChoicesetSize; n++)
         {
-            double randomDraw = (double) rand() / RAND_MAX;
-            int zoneHousingType = -1;
-            double cummulativeProbability = 0.0;
-            for (int m = 0; m < householdScreeningProbabilities.size(); m++)
-            {
-                cummulativeProbability += householdScreeningProbabilities[m];
-                if (cummulativeProbability > randomDraw)
-                {
-                    zoneHousingType = m + 1; //housing type is a one-based index
-                    break;
-                }
-            }
-
-
-            auto range = market->getunitsByZoneHousingType().equal_range(zoneHousingType);
-            int numUnits = distance(range.first, range.second); //find the number of units in the above zoneHousingType
-
-            if (numUnits < minUnitsInZoneHousingType)
-                continue;
-
-
-            if (numUnits == 0)
-                continue;
-
-            int offset = (float) rand() / RAND_MAX * (numUnits - 1);
-            advance(range.first, offset); // change a random unit in that zoneHousingType
-
-            const BigSerial unitId = (range.first)->second;
+            int zoneHousingType = zoneHousingTypeDistribution(generator) + 1; //housing type is a one-based index
 
+            const HousingMarket::EntrySet* zoneHousingTypeEntries = market->getAvailableEntriesByZoneHousingType(zoneHousingType);
 
-            const HousingMarket::Entry *entry = market->getEntryById(unitId);
-
-            if (entry == nullptr || entry->isBuySellIntervalCompleted() == false)
+            if (zoneHousingTypeEntries == nullptr || zoneHousingTypeEntries->size() < minUnitsInZoneHousingType)
                 continue;
 
+            // choose a random unit in that zoneHousingType
+            const HousingMarket::Entry *entry = zoneHousingTypeEntries->sample(generator);
 
             const Unit *thisUnit = model->getUnitById(entry->getUnitId());
 
@@ -721,19 +704,11 @@ bool HouseholdBidderRole::pickEntryToBid()
 
                 if (thisUnit->getTenureStatus() == 2 && getParent()->getFutureTransitionOwn() == false) //rented
                 {
-                    std::set<const HousingMarket::Entry *>::iterator screenedEntriesItr;
-                    screenedEntriesItr = std::find(screenedEntries.begin(), screenedEntries.end(), entry);
-
-                    if (screenedEntriesItr == screenedEntries.end())
-                        screenedEntries.insert(entry);
+                    screenedEntries.insert(entry);
                 }
                 else if (thisUnit->getTenureStatus() == 1) //owner-occupied
                 {
-                    std::set<const HousingMarket::Entry *>::iterator screenedEntriesItr;
-                    screenedEntriesItr = std::find(screenedEntries.begin(), screenedEntries.end(), entry);
-
-                    if (screenedEntriesItr == screenedEntries.end())
-                        screenedEntries.insert(entry);
+                    screenedEntries.insert(entry);
                 }
             }
         }
@@ -745,23 +720,14 @@ bool HouseholdBidderRole::pickEntryToBid()
             screenedEntriesVec.push_back(*itr);
 
 
-        //btoEntries will contain pointers all the units in our 'units' vector that are marked as BTOs.
-        set<BigSerial> btoEntries = market->getBTOEntries();
-
         //Add x number of BTO units to the screenedUnit vector if the household is eligible for it
-        for(int n = 0; n < config.ltParams.housingModel.bidderUnitChoiceset.bidderBTOChoicesetSize && btoEntries.size() != 0; n++)
-        {
-            int offset = (float)rand() / RAND_MAX * ( btoEntries.size() - 1 );
-
-            auto itr =  btoEntries.begin();
-            std::advance( itr, offset);
-
-            const HousingMarket::Entry* entry = market->getEntryById(*itr);
-
-            screenedEntries.insert(entry);
-            screenedEntriesVec.push_back(entry);
+        HousingMarket::ConstEntryList btoEntries;
+        market->getBTOEntrySet().sample(generator, config.ltParams.housingModel.bidderUnitChoiceset.bidderBTOChoicesetSize, btoEntries);
 
-            btoEntries.erase(*itr);
+        for(size_t n = 0; n < btoEntries.size(); n++)
+        {
+            screenedEntries.insert(btoEntries[n]);
+            screenedEntriesVec.push_back(btoEntries[n]);
         }
 
         std::string choiceset(" ");
@@ -779,32 +745,52 @@ bool HouseholdBidderRole::pickEntryToBid()
     // Choose the unit to bid with max surplus. However, we are not iterating through the whole list of available units.
     // We choose from a subset of units set by the housingMarketSearchPercentage parameter in the long term XML file.
     // This is done to replicate the real life scenario where a household will only visit a certain percentage of vacant units before settling on one.
-    for(int n = 0; n < screenedEntries.size(); n++)
+    // The entries are evaluated in unit id order, so the chosen entry only depends on the generator of the worker.
+    HousingMarket::ConstEntryList candidateEntries(screenedEntries.begin(), screenedEntries.end());
+    std::sort(candidateEntries.begin(), candidateEntries.end(), [](const HousingMarket::Entry* lhs, const HousingMarket::Entry* rhs)
     {
-        auto itr = screenedEntries.begin();
-        advance(itr, n);
-
-        const HousingMarket::Entry* entry = *itr;
+        return lhs->getUnitId() < rhs->getUnitId();
+    });
 
-        if( entry->getAskingPrice() < 0.01 )
+    for(size_t n = 0; n < candidateEntries.size(); n++)
+    {
+        if( candidateEntries[n]->getAskingPrice() < 0.01 )
         {
-            printError( (boost::format( "[unit %1%] Asking price is suspiciously low at %2%.") % entry->getUnitId() % entry->getAskingPrice() ).str());
+            printError( (boost::format( "[unit %1%] Asking price is suspiciously low at %2%.") % candidateEntries[n]->getUnitId() % candidateEntries[n]->getAskingPrice() ).str());
         }
-
-        calculateMaxSurplusEntry(entry,maxSurplus,finalBid,maxWp,maxAffordability,maxWtpe,maxEntryUnitId);
-
     }
 
-
-
     //calculate surplus of your own unit and compare with the screened entries.
-       {
+    {
         BigSerial uid = household->getUnitId();
         const HousingMarket::Entry *curEntry = market->getEntryById( uid );
 
         if(curEntry != nullptr)
-            calculateMaxSurplusEntry(curEntry,maxSurplus,finalBid,maxWp,maxAffordability,maxWtpe,maxEntryUnitId);
-       }
+            candidateEntries.push_back(curEntry);
+    }
+
+    //the willingness to pay for all the eligible entries is computed at once
+    HousingMarket::ConstEntryList eligibleEntries;
+    std::vector<const Unit*> eligibleUnits;
+
+    for(size_t n = 0; n < candidateEntries.size(); n++)
+    {
+        if( isEligibleEntry(candidateEntries[n]) )
+        {
+            eligibleEntries.push_back(candidateEntries[n]);
+            eligibleUnits.push_back(model->getUnitById(candidateEntries[n]->getUnitId()));
+        }
+    }
+
+    std::vector<double> willingnessToPay;
+    std::vector<double> wtpErrors;
+    WillingnessToPaySubModel wtp_m;
+    wtp_m.calculateResidentialWillingnessToPay(eligibleUnits, household, day, model, generator, willingnessToPay, wtpErrors);
+
+    for(size_t n = 0; n < eligibleEntries.size(); n++)
+    {
+        calculateMaxSurplusEntry(eligibleEntries[n], willingnessToPay[n], wtpErrors[n], maxSurplus, finalBid, maxWp, maxAffordability, maxWtpe, maxEntryUnitId);
+    }
 
     biddingEntry = CurrentBiddingEntry(maxEntryUnitId, finalBid, maxWp, maxSurplus, maxWtpe, maxAffordability );
     return biddingEntry.isValid();
@@ -112,7 +112,16 @@ namespace sim_mob
             void setUnitIdToBeOwned(BigSerial unitId);
             BigSerial getUnitIdToBeOwned();
 
-            void calculateMaxSurplusEntry(const HousingMarket::Entry* entry,double &maxSurplus, double &finalBid, double &maxWp,double &maxAffordability, double &maxWtpe,BigSerial &maxEntryUnitId);
+            /**
+             * Checks if the household can bid for the unit of an entry. Logs an error if it cannot.
+             */
+            bool isEligibleEntry(const HousingMarket::Entry* entry);
+
+            /**
+             * Computes the bid and the surplus of an entry, given the willingness to pay of the household for its unit,
+             * and keeps them if the surplus is the maximum so far.
+             */
+            void calculateMaxSurplusEntry(const HousingMarket::Entry* entry, double wp, double wtp_e, double &maxSurplus, double &finalBid, double &maxWp,double &maxAffordability, double &maxWtpe,BigSerial &maxEntryUnitId);
 
         protected:
 
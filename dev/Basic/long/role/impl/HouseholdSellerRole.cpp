@@ -9,7 +9,9 @@
  * 
  * Created on May 16, 2013, 5:13 PM
  */
+#include <algorithm>
 #include <cmath>
+#include <vector>
 #include <boost/make_shared.hpp>
 #include "HouseholdSellerRole.hpp"
 #include "util/Statistics.hpp"
@@ -423,7 +425,6 @@ void HouseholdSellerRole::handleReceivedBid(const Bid &bid, BigSerial unitId)
 {
     bool decision = false;
     ExpectationEntry entry;
-    const double dHalf = 0.5;
 
     if(getCurrentExpectation(unitId, entry))
     {
@@ -454,12 +455,11 @@ void HouseholdSellerRole::handleReceivedBid(const Bid &bid, BigSerial unitId)
             }
             else if( fabs(maxBidOfDay->getBidValue() - bid.getBidValue()) < EPSILON )
             {
-                // bids are exactly equal. Randomly choose one.
-
-                double randomDraw = (double)rand()/RAND_MAX;
+                // bids are exactly equal. The bidder with the lowest id wins, so the winner
+                // does not depend on the order in which the bids of the day are received.
 
                 //drop the current bid
-                if(randomDraw < dHalf)
+                if(bid.getBidderId() < maxBidOfDay->getBidderId())
                 {
                     replyBid(*getParent(), *maxBidOfDay, entry, BETTER_OFFER, dailyBidCounter);
                     maxBidsOfDay.erase(unitId);
@@ -588,9 +588,18 @@ void HouseholdSellerRole::notifyWinnerBidders()
     HousingMarket* market = getParent()->getMarket();
     ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
 
-    for (Bids::iterator itr = maxBidsOfDay.begin(); itr != maxBidsOfDay.end(); itr++)
+    //the units are processed in id order: a bidder with the max bid of several units wins the one with the lowest id.
+    std::vector<BigSerial> unitIds;
+    unitIds.reserve(maxBidsOfDay.size());
+    for (Bids::const_iterator itr = maxBidsOfDay.begin(); itr != maxBidsOfDay.end(); itr++)
+    {
+        unitIds.push_back(itr->first);
+    }
+    std::sort(unitIds.begin(), unitIds.end());
+
+    for (std::vector<BigSerial>::const_iterator itr = unitIds.begin(); itr != unitIds.end(); itr++)
     {
-        Bid& maxBidOfDay = itr->second;
+        Bid& maxBidOfDay = maxBidsOfDay.at(*itr);
         ExpectationEntry entry;
 
         Household *household = getParent()->getModel()->getHouseholdById(maxBidOfDay.getBidderId());
@@ -111,6 +111,30 @@ namespace sim_mob
             }
         }
 
+        /**
+         * Reserves room for the given number of entries in an index,
+         * so that it is not rehashed while the entries are inserted.
+         * Indexes which can not be reserved are left as they are.
+         * @param map index to reserve.
+         * @param size number of entries to insert.
+         */
+        template <typename K, typename T>
+        inline void reserveIndex(boost::unordered_map<K, T>& map, size_t size)
+        {
+            map.reserve(map.size() + size);
+        }
+
+        template <typename K, typename T>
+        inline void reserveIndex(boost::unordered_multimap<K, T>& map, size_t size)
+        {
+            map.reserve(map.size() + size);
+        }
+
+        template <typename M>
+        inline void reserveIndex(M& map, size_t size)
+        {
+        }
+
         /**
          * Load data from datasouce from given connection using the 
          * given list and template DAO.
@@ -159,6 +183,7 @@ namespace sim_mob
         inline void loadData(db::DB_Connection& conn, K& list, M& map, F getter) 
         {
             loadData<T>(conn, list);
+            reserveIndex(map, list.size());
             //Index all buildings.
             for (typename K::iterator it = list.begin(); it != list.end(); it++) 
             {
@@ -173,6 +198,7 @@ namespace sim_mob
         inline void loadData(db::DB_Connection& conn, const std::string &tableName,K& list, M& map, F getter)
         {
             loadData<T>(conn, tableName, list);
+            reserveIndex(map, list.size());
             //Index all buildings.
             for (typename K::iterator it = list.begin(); it != list.end(); it++)
             {
@@ -183,6 +209,7 @@ namespace sim_mob
         template <typename K, typename M, typename F>
         inline void indexData( K &list, M& map, F getter)
         {
+            reserveIndex(map, list.size());
             //Index all data.
             for (typename K::iterator it = list.begin(); it != list.end(); it++)
             {
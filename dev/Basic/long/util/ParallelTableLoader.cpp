@@ -0,0 +1,152 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "ParallelTableLoader.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <boost/chrono.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include "logging/Log.hpp"
+
+using namespace sim_mob;
+using namespace sim_mob::db;
+using namespace sim_mob::long_term;
+
+namespace
+{
+double secondsSince(const boost::chrono::steady_clock::time_point& start)
+{
+    return boost::chrono::duration<double>(boost::chrono::steady_clock::now() - start).count();
+}
+}
+
+ParallelTableLoader::ParallelTableLoader(const DB_Config& dbConfig, unsigned int numLoaders) :
+        dbConfig(dbConfig), numLoaders(std::max(numLoaders, 1u)), nextTable(0), runSeconds(0)
+{
+}
+
+void ParallelTableLoader::addTable(const std::string& name, const std::string& schema, const LoadFunction& load)
+{
+    Table table;
+    table.name = name;
+    table.schema = schema;
+    table.load = load;
+    table.loaded = false;
+    table.rows = 0;
+    table.seconds = 0;
+
+    if (!tableNames.insert(name).second)
+    {
+        throw std::runtime_error("ParallelTableLoader: table " + name + " added twice");
+    }
+    tables.push_back(table);
+}
+
+void ParallelTableLoader::run()
+{
+    boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+    error = std::exception_ptr();
+
+    size_t numThreads = std::min<size_t>(numLoaders, tables.size() - nextTable);
+    if (numThreads == 1)
+    {
+        runLoader();
+    }
+    else if (numThreads > 1)
+    {
+        boost::thread_group loaders;
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            loaders.create_thread(boost::bind(&ParallelTableLoader::runLoader, this));
+        }
+        loaders.join_all();
+    }
+
+    runSeconds = secondsSince(start);
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void ParallelTableLoader::runLoader()
+{
+    //connections of this loader, by schema
+    std::map<std::string, boost::shared_ptr<DB_Connection> > connections;
+
+    boost::unique_lock<boost::mutex> lock(tablesMutex);
+    while (nextTable < tables.size() && !error)
+    {
+        Table& table = tables[nextTable++];
+        lock.unlock();
+
+        std::exception_ptr loadError;
+        size_t rows = 0;
+        boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+        try
+        {
+            boost::shared_ptr<DB_Connection>& conn = connections[table.schema];
+            if (!conn)
+            {
+                conn.reset(new DB_Connection(POSTGRES, dbConfig));
+                conn->setSchema(table.schema);
+                if (!conn->connect())
+                {
+                    throw std::runtime_error("ParallelTableLoader: could not connect to schema " + table.schema);
+                }
+            }
+            rows = table.load(*conn);
+        }
+        catch (...)
+        {
+            loadError = std::current_exception();
+        }
+        double seconds = secondsSince(start);
+
+        lock.lock();
+        table.loaded = true;
+        table.rows = rows;
+        table.seconds = seconds;
+        if (loadError && !error)
+        {
+            error = loadError;
+        }
+    }
+}
+
+void ParallelTableLoader::printReport() const
+{
+    std::vector<const Table*> sortedTables;
+    double totalSeconds = 0;
+    for (std::vector<Table>::const_iterator it = tables.begin(); it != tables.end(); ++it)
+    {
+        if (it->loaded)
+        {
+            sortedTables.push_back(&(*it));
+            totalSeconds += it->seconds;
+        }
+    }
+    std::sort(sortedTables.begin(), sortedTables.end(), [](const Table* lhs, const Table* rhs)
+    {
+        return lhs->seconds > rhs->seconds;
+    });
+
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2);
+    report << "Loaded " << sortedTables.size() << " tables in " << runSeconds << " s with up to " << numLoaders
+           << " loaders (" << totalSeconds << " s of table loading)" << std::endl;
+    for (std::vector<const Table*>::const_iterator it = sortedTables.begin(); it != sortedTables.end(); ++it)
+    {
+        report << "    " << std::left << std::setw(40) << (*it)->name << std::right << std::setw(10) << (*it)->rows
+               << " rows " << std::setw(8) << (*it)->seconds << " s" << std::endl;
+    }
+    PrintOutV(report.str());
+}
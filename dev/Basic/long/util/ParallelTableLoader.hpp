@@ -0,0 +1,128 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <exception>
+#include <set>
+#include <string>
+#include <vector>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+#include "database/DB_Config.hpp"
+#include "database/DB_Connection.hpp"
+#include "util/HelperFunctions.hpp"
+
+namespace sim_mob
+{
+    namespace long_term
+    {
+        /**
+         * Loads the tables of a model at startup, several at the same time.
+         *
+         * Each table is loaded by a function receiving a connection to the schema of the table. The tables are
+         * loaded by up to numLoaders threads; every thread opens its own connection to each schema it reads, so
+         * at most numLoaders connections per schema are open at the same time.
+         *
+         * The tables are loaded in no particular order, so their load functions must not read the data of the other
+         * tables, nor write to the same containers. Post-processing involving several tables is done after run().
+         *
+         * After run(), printReport() prints the time spent loading each table.
+         */
+        class ParallelTableLoader : private boost::noncopyable
+        {
+        public:
+            /**
+             * Loads a table with the given connection and returns the number of loaded rows.
+             */
+            typedef boost::function<size_t (db::DB_Connection&)> LoadFunction;
+
+            /**
+             * @param dbConfig configuration of the database
+             * @param numLoaders maximum number of tables loaded at the same time
+             */
+            ParallelTableLoader(const db::DB_Config& dbConfig, unsigned int numLoaders);
+
+            /**
+             * Adds a table to load
+             * @param name name of the table, used in the report
+             * @param schema schema of the connection given to the load function
+             * @param load function loading the table
+             */
+            void addTable(const std::string& name, const std::string& schema, const LoadFunction& load);
+
+            /**
+             * Adds a table loaded with loadData<DaoType>() into the given list and indexed into the given map.
+             */
+            template <typename DaoType, typename K, typename M, typename F>
+            void addTable(const std::string& name, const std::string& schema, K& list, M& map, F getter)
+            {
+                addTable(name, schema, [&list, &map, getter](db::DB_Connection& conn)
+                {
+                    loadData<DaoType>(conn, list, map, getter);
+                    return list.size();
+                });
+            }
+
+            /**
+             * Adds a table loaded with loadData<DaoType>() into the given list.
+             */
+            template <typename DaoType, typename K>
+            void addTable(const std::string& name, const std::string& schema, K& list)
+            {
+                addTable(name, schema, [&list](db::DB_Connection& conn)
+                {
+                    loadData<DaoType>(conn, list);
+                    return list.size();
+                });
+            }
+
+            /**
+             * Loads all the tables added so far.
+             * Throws the first exception raised by a load function (the tables being loaded at that time are
+             * completed, but no other table is started).
+             */
+            void run();
+
+            /**
+             * Prints the number of rows and the load time of each table, slowest first.
+             */
+            void printReport() const;
+
+        private:
+            struct Table
+            {
+                std::string name;
+                std::string schema;
+                LoadFunction load;
+                bool loaded;
+                size_t rows;
+                double seconds;
+            };
+
+            /**
+             * Loads tables until all are loaded or a load fails. Executed by each loader thread
+             */
+            void runLoader();
+
+            db::DB_Config dbConfig;
+            unsigned int numLoaders;
+            std::vector<Table> tables;
+            std::set<std::string> tableNames;
+
+            /** index of the next table to start*/
+            size_t nextTable;
+
+            /** first exception thrown by a load function*/
+            std::exception_ptr error;
+
+            /** wall clock time of the last run()*/
+            double runSeconds;
+
+            /** protects the state of the tables, nextTable and error*/
+            boost::mutex tablesMutex;
+        };
+    }
+}
@@ -356,6 +356,7 @@ void ExpandMidTermConfigFile::printSettings()
 	//Multi-threading
 	std::cout << "\nNumber of threads:\n"
 	          << "  For loading agents: " << mtCfg.getThreadsNumInPersonLoader() << std::endl
+	          << "  Demand windows loaded ahead: " << mtCfg.getPersonLoaderPreloadWindows() << std::endl
 	          << "  For processing agents: " << mtCfg.personWorkGroupSize() << std::endl;
 
     //Print the network (this will go to a different output file...)
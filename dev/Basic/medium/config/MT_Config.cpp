@@ -25,7 +25,7 @@ MT_Config::MT_Config() :
        regionRestrictionEnabled(false), midTermRunMode(MT_Config::MT_NONE), pedestrianWalkSpeed(0), numPredayThreads(0),
 			configSealed(false), fileOutputEnabled(false), consoleOutput(false), predayRunMode(MT_Config::PREDAY_NONE),
 			calibrationMethodology(MT_Config::WSPSA), logsumComputationFrequency(0), supplyUpdateInterval(0),
-			activityScheduleLoadInterval(0), busCapacity(0), populationSource(db::POSTGRES), granPersonTicks(0),threadsNumInPersonLoader(0),
+			activityScheduleLoadInterval(0), busCapacity(0), populationSource(db::POSTGRES), granPersonTicks(0),threadsNumInPersonLoader(0), personLoaderPreloadWindows(0),
 			energyModelEnabled(false)
 {
 }
@@ -313,6 +313,19 @@ void MT_Config::setThreadsNumInPersonLoader(unsigned int number)
 	}
 }
 
+unsigned int MT_Config::getPersonLoaderPreloadWindows() const
+{
+	return personLoaderPreloadWindows;
+}
+
+void MT_Config::setPersonLoaderPreloadWindows(unsigned int windows)
+{
+	if(!configSealed)
+	{
+		personLoaderPreloadWindows = windows;
+	}
+}
+
 bool MT_Config::RunningMidSupply() const {
     return (midTermRunMode == MT_Config::MT_SUPPLY);
 }
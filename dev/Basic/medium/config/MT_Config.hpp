@@ -187,6 +187,23 @@ struct ScreenLineParams
 	std::string fileName;
 };
 
+/**
+ * Represents the checkpoint element of the supply section of the configuration file
+ */
+struct CheckpointParams
+{
+	CheckpointParams() : time(0), fileName(""), restartFileName("") {}
+
+	///Time of the day at which the state of the simulation is written to fileName
+	DailyTime time;
+
+	///Name of the checkpoint file to write. Empty if no checkpoint is written
+	std::string fileName;
+
+	///Name of the checkpoint file from which the simulation restarts. Empty if the simulation starts from scratch
+	std::string restartFileName;
+};
+
 /**
  * represent the incident data section of the config file
  */
@@ -800,6 +817,18 @@ public:
 	 */
 	void setThreadsNumInPersonLoader(unsigned int number);
 
+	/**
+	 * get number of demand windows loaded ahead of the simulation by the person loader
+	 * @return the number of windows loaded in background; 0 if the demand is loaded synchronously
+	 */
+	unsigned int getPersonLoaderPreloadWindows() const;
+
+	/**
+	 * set number of demand windows loaded ahead of the simulation by the person loader
+	 * @param windows number of windows
+	 */
+	void setPersonLoaderPreloadWindows(unsigned int windows);
+
 	/**
 	 * Enumerator for mid term run mode
 	 */
@@ -814,6 +843,9 @@ public:
 	/// screen line counts parameter
 	ScreenLineParams screenLineParams;
 
+	/// checkpoint and restart parameters
+	CheckpointParams checkpointParams;
+
 	/// Number of ticks to wait before updating all Person agents.
 	unsigned int granPersonTicks;
 
@@ -871,6 +903,9 @@ private:
 	/** the threads number in person loader*/
 	unsigned int threadsNumInPersonLoader;
 
+	/** number of demand windows loaded ahead of the simulation by the person loader thread*/
+	unsigned int personLoaderPreloadWindows;
+
 	/// supply update interval in frames
 	unsigned supplyUpdateInterval;
 
@@ -21,6 +21,7 @@ namespace
 const int DEFAULT_NUM_THREADS_DEMAND = 2; // default number of threads for demand
 const double NUM_METERS_IN_KM = 1000.0;
 const unsigned NUM_SECONDS_IN_AN_HOUR = 3600;
+const unsigned NUM_MS_IN_HALF_AN_HOUR = 1800000;
 
 unsigned int ProcessTimegranUnits(xercesc::DOMElement* node)
 {
@@ -146,6 +147,7 @@ void ParseMidTermConfigFile::processSupplyNode(xercesc::DOMElement* node)
 	processDwellTimeElement(GetSingleElementByName(node, "dwell_time_parameters", true));
 	processWalkSpeedElement(GetSingleElementByName(node, "pedestrian_walk_speed", true));
 	processThreadsNumInPersonLoaderElement(GetSingleElementByName(node, "thread_number_in_person_loader", true));
+	processCheckpointElement(GetSingleElementByName(node, "checkpoint"));
 	processStatisticsOutputNode(GetSingleElementByName(node, "output_statistics", true));
 	processBusCapactiyElement(GetSingleElementByName(node, "bus_default_capacity", true));
 	processSpeedDensityParamsNode(GetSingleElementByName(node, "speed_density_params", true));
@@ -444,6 +446,35 @@ void ParseMidTermConfigFile::processThreadsNumInPersonLoaderElement(xercesc::DOM
 
 	unsigned int num = ParseUnsignedInt(GetNamedAttributeValue(node, "value", true), 1);
 	mtCfg.setThreadsNumInPersonLoader(num);
+
+	//number of 30 minute demand windows loaded in background, ahead of the simulation. 0 loads the demand synchronously
+	mtCfg.setPersonLoaderPreloadWindows(ParseUnsignedInt(GetNamedAttributeValue(node, "preload_windows", false), 0u));
+}
+
+void ParseMidTermConfigFile::processCheckpointElement(xercesc::DOMElement* node)
+{
+	if(!node)
+	{
+		return;
+	}
+
+	mtCfg.checkpointParams.fileName = ParseString(GetNamedAttributeValue(node, "file", false), "");
+	mtCfg.checkpointParams.restartFileName = ParseString(GetNamedAttributeValue(node, "restart_file", false), "");
+
+	if(!mtCfg.checkpointParams.fileName.empty())
+	{
+		mtCfg.checkpointParams.time = ParseDailyTime(GetNamedAttributeValue(node, "time", true));
+
+		//the demand is loaded in half hour windows. The persons of the windows starting from the checkpoint time are
+		//loaded again after a restart, so the checkpoint must be at the start of a window
+		if(mtCfg.checkpointParams.time.getValue() % NUM_MS_IN_HALF_AN_HOUR != 0)
+		{
+			std::stringstream msg;
+			msg << "Invalid value for <checkpoint time=\"" << mtCfg.checkpointParams.time.getStrRepr()
+			    << "\">. Expected: \"time at the start of an hour or half hour\"";
+			throw std::runtime_error(msg.str());
+		}
+	}
 }
 
 void ParseMidTermConfigFile::processBusCapactiyElement(xercesc::DOMElement* node)
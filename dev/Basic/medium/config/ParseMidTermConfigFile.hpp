@@ -122,6 +122,13 @@ private:
 	 */
 	void processThreadsNumInPersonLoaderElement(xercesc::DOMElement* node);
 
+	/**
+	 * processes the checkpoint element included in xml file.
+	 *
+	 * @param node node corresponding to the checkpoint element inside xml file
+	 */
+	void processCheckpointElement(xercesc::DOMElement* node);
+
 	/**
      * processes model scripts element in config xml
      *
@@ -0,0 +1,768 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "MT_Checkpoint.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+#include "conf/ConfigManager.hpp"
+#include "conf/ConfigParams.hpp"
+#include "entities/conflux/Conflux.hpp"
+#include "entities/conflux/SegmentStats.hpp"
+#include "entities/misc/TripChain.hpp"
+#include "entities/params/PT_NetworkEntities.hpp"
+#include "entities/roles/activityRole/ActivityPerformer.hpp"
+#include "entities/roles/driver/DriverFacets.hpp"
+#include "entities/roles/passenger/Passenger.hpp"
+#include "entities/TrainController.hpp"
+#include "geospatial/network/RoadNetwork.hpp"
+#include "logging/Log.hpp"
+#include "Person_MT.hpp"
+#include "util/LangHelpers.hpp"
+
+using namespace sim_mob;
+using namespace sim_mob::medium;
+
+namespace
+{
+const char FILE_MAGIC[8] = {'S', 'M', 'M', 'T', 'C', 'K', 'P', 'T'};
+const boost::uint32_t FILE_VERSION = 1;
+
+/**markers of the records of the file*/
+const boost::uint8_t RECORD_END = 0;
+const boost::uint8_t RECORD_PERSON = 1;
+
+/**kinds of trip chain items*/
+const boost::uint8_t ITEM_ACTIVITY = 0;
+const boost::uint8_t ITEM_TRIP = 1;
+
+/**
+ * State of a person at the time of the checkpoint
+ */
+enum PersonState
+{
+	/**the person (re)starts its current sub-trip or activity, after the given offset*/
+	STATE_RESUME = 0,
+
+	/**the person is performing an activity, until the given end time*/
+	STATE_ACTIVITY = 1,
+
+	/**the person is driving on its path*/
+	STATE_ON_ROAD = 2
+};
+
+template <typename T>
+void writeValue(std::ostream& out, const T& value)
+{
+	out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T readValue(std::istream& in)
+{
+	T value;
+	if (!in.read(reinterpret_cast<char*>(&value), sizeof(T)))
+	{
+		throw std::runtime_error("MT_Checkpoint: the checkpoint file is truncated");
+	}
+	return value;
+}
+
+void writeString(std::ostream& out, const std::string& value)
+{
+	writeValue(out, static_cast<boost::uint32_t>(value.size()));
+	out.write(value.data(), value.size());
+}
+
+std::string readString(std::istream& in)
+{
+	boost::uint32_t length = readValue<boost::uint32_t>(in);
+	std::string value(length, '\0');
+	if (length > 0 && !in.read(&value[0], length))
+	{
+		throw std::runtime_error("MT_Checkpoint: the checkpoint file is truncated");
+	}
+	return value;
+}
+
+void writeWayPoint(std::ostream& out, const WayPoint& wayPoint)
+{
+	writeValue(out, static_cast<boost::uint8_t>(wayPoint.type));
+
+	switch (wayPoint.type)
+	{
+	case WayPoint::INVALID:
+		break;
+	case WayPoint::NODE:
+		writeValue(out, static_cast<boost::uint32_t>(wayPoint.node->getNodeId()));
+		break;
+	case WayPoint::BUS_STOP:
+		writeString(out, wayPoint.busStop->getStopCode());
+		break;
+	case WayPoint::TRAIN_STOP:
+		if (wayPoint.trainStop->getTrainStopIds().empty())
+		{
+			throw std::runtime_error("MT_Checkpoint: train stop without id");
+		}
+		writeString(out, wayPoint.trainStop->getTrainStopIds().front());
+		break;
+	case WayPoint::MRT_PLATFORM:
+		writeString(out, wayPoint.platform->getPlatformNo());
+		break;
+	case WayPoint::TAXI_STAND:
+		writeValue(out, static_cast<boost::uint32_t>(wayPoint.taxiStand->getStandId()));
+		break;
+	default:
+	{
+		std::stringstream msg;
+		msg << "MT_Checkpoint: way points of type " << wayPoint.type << " can not be written";
+		throw std::runtime_error(msg.str());
+	}
+	}
+}
+
+void throwNetworkMismatch(const std::string& element, const std::string& id)
+{
+	throw std::runtime_error("MT_Checkpoint: " + element + " " + id + " of the checkpoint is not in the network. "
+			"The checkpoint was written for another network");
+}
+
+WayPoint readWayPoint(std::istream& in)
+{
+	const RoadNetwork* network = RoadNetwork::getInstance();
+	boost::uint8_t type = readValue<boost::uint8_t>(in);
+
+	switch (type)
+	{
+	case WayPoint::INVALID:
+		return WayPoint();
+	case WayPoint::NODE:
+	{
+		boost::uint32_t id = readValue<boost::uint32_t>(in);
+		const Node* node = network->getById(network->getMapOfIdvsNodes(), id);
+		if (!node)
+		{
+			throwNetworkMismatch("node", boost::lexical_cast<std::string>(id));
+		}
+		return WayPoint(node);
+	}
+	case WayPoint::BUS_STOP:
+	{
+		std::string code = readString(in);
+		const BusStop* stop = BusStop::findBusStop(code);
+		if (!stop)
+		{
+			throwNetworkMismatch("bus stop", code);
+		}
+		return WayPoint(stop);
+	}
+	case WayPoint::TRAIN_STOP:
+	{
+		std::string id = readString(in);
+		const TrainStop* stop = PT_NetworkCreater::getInstance().findMRT_Stop(id);
+		if (!stop)
+		{
+			throwNetworkMismatch("train stop", id);
+		}
+		return WayPoint(stop);
+	}
+	case WayPoint::MRT_PLATFORM:
+	{
+		std::string platformNo = readString(in);
+		TrainController<Person_MT>* trainController = TrainController<Person_MT>::getInstance();
+		const Platform* platform = trainController ? trainController->getPlatformFromId(platformNo) : nullptr;
+		if (!platform)
+		{
+			throwNetworkMismatch("platform", platformNo);
+		}
+		return WayPoint(platform);
+	}
+	case WayPoint::TAXI_STAND:
+	{
+		boost::uint32_t id = readValue<boost::uint32_t>(in);
+		const TaxiStand* stand = network->getById(network->getMapOfIdvsTaxiStands(), id);
+		if (!stand)
+		{
+			throwNetworkMismatch("taxi stand", boost::lexical_cast<std::string>(id));
+		}
+		return WayPoint(stand);
+	}
+	default:
+		throw std::runtime_error("MT_Checkpoint: invalid way point type in the checkpoint file");
+	}
+}
+
+/**
+ * Writes the fields common to the trips, sub-trips and activities
+ */
+void writeItemFields(std::ostream& out, const TripChainItem& item)
+{
+	writeString(out, item.getPersonID());
+	writeValue(out, static_cast<boost::int32_t>(item.itemType));
+	writeValue(out, static_cast<boost::int32_t>(item.purpose));
+	writeValue(out, static_cast<boost::uint32_t>(item.sequenceNumber));
+	writeValue(out, static_cast<boost::uint32_t>(item.startTime.getValue()));
+	writeValue(out, static_cast<boost::uint32_t>(item.endTime.getValue()));
+	writeValue(out, static_cast<boost::int32_t>(item.requestTime));
+	writeWayPoint(out, item.origin);
+	writeWayPoint(out, item.destination);
+	writeValue(out, static_cast<boost::int32_t>(item.originType));
+	writeValue(out, static_cast<boost::int32_t>(item.destinationType));
+	writeValue(out, static_cast<boost::int32_t>(item.originZoneCode));
+	writeValue(out, static_cast<boost::int32_t>(item.destinationZoneCode));
+	writeString(out, item.travelMode);
+	writeString(out, item.startLocationId);
+	writeString(out, item.endLocationId);
+	writeString(out, item.startLocationType);
+	writeString(out, item.endLocationType);
+	writeString(out, item.vehicleTypeDriven);
+	writeString(out, item.serviceLine);
+	writeValue(out, static_cast<boost::uint32_t>(item.edgeId));
+	writeValue(out, static_cast<boost::uint32_t>(item.load_factor));
+}
+
+void readItemFields(std::istream& in, TripChainItem& item)
+{
+	item.setPersonID(readString(in));
+	item.itemType = static_cast<TripChainItem::ItemType>(readValue<boost::int32_t>(in));
+	item.purpose = static_cast<StopType>(readValue<boost::int32_t>(in));
+	item.sequenceNumber = readValue<boost::uint32_t>(in);
+	item.startTime = DailyTime(readValue<boost::uint32_t>(in));
+	item.endTime = DailyTime(readValue<boost::uint32_t>(in));
+	item.requestTime = readValue<boost::int32_t>(in);
+	item.origin = readWayPoint(in);
+	item.destination = readWayPoint(in);
+	item.originType = static_cast<TripChainItem::LocationType>(readValue<boost::int32_t>(in));
+	item.destinationType = static_cast<TripChainItem::LocationType>(readValue<boost::int32_t>(in));
+	item.originZoneCode = readValue<boost::int32_t>(in);
+	item.destinationZoneCode = readValue<boost::int32_t>(in);
+	item.travelMode = readString(in);
+	item.startLocationId = readString(in);
+	item.endLocationId = readString(in);
+	item.startLocationType = readString(in);
+	item.endLocationType = readString(in);
+	item.vehicleTypeDriven = readString(in);
+	item.serviceLine = readString(in);
+	item.edgeId = readValue<boost::uint32_t>(in);
+	item.load_factor = readValue<boost::uint32_t>(in);
+}
+
+void writeSubTrip(std::ostream& out, const SubTrip& subTrip)
+{
+	writeItemFields(out, subTrip);
+	writeString(out, subTrip.tripID);
+	writeString(out, subTrip.ptLineId);
+	writeValue(out, static_cast<boost::int32_t>(subTrip.cbdTraverseType));
+	writeValue(out, static_cast<boost::uint8_t>(subTrip.isPT_Walk));
+	writeValue(out, subTrip.walkTime);
+	writeValue(out, static_cast<boost::uint8_t>(subTrip.isTT_Walk));
+}
+
+SubTrip readSubTrip(std::istream& in)
+{
+	SubTrip subTrip;
+	readItemFields(in, subTrip);
+	subTrip.tripID = readString(in);
+	subTrip.ptLineId = readString(in);
+	subTrip.cbdTraverseType = static_cast<TravelMetric::CDB_TraverseType>(readValue<boost::int32_t>(in));
+	subTrip.isPT_Walk = readValue<boost::uint8_t>(in);
+	subTrip.walkTime = readValue<double>(in);
+	subTrip.isTT_Walk = readValue<boost::uint8_t>(in);
+	return subTrip;
+}
+
+void writeItem(std::ostream& out, const TripChainItem* item)
+{
+	if (const Activity* activity = dynamic_cast<const Activity*>(item))
+	{
+		writeValue(out, ITEM_ACTIVITY);
+		writeItemFields(out, *activity);
+		writeValue(out, static_cast<boost::uint8_t>(activity->location != nullptr));
+		if (activity->location)
+		{
+			writeValue(out, static_cast<boost::uint32_t>(activity->location->getNodeId()));
+		}
+		writeValue(out, static_cast<boost::uint8_t>(activity->isPrimary));
+		writeValue(out, static_cast<boost::uint8_t>(activity->isFlexible));
+		writeValue(out, static_cast<boost::uint8_t>(activity->isMandatory));
+	}
+	else if (const Trip* trip = dynamic_cast<const Trip*>(item))
+	{
+		writeValue(out, ITEM_TRIP);
+		writeItemFields(out, *trip);
+		writeString(out, trip->tripID);
+
+		const std::vector<SubTrip>& subTrips = trip->getSubTrips();
+		writeValue(out, static_cast<boost::uint32_t>(subTrips.size()));
+		for (std::vector<SubTrip>::const_iterator it = subTrips.begin(); it != subTrips.end(); ++it)
+		{
+			writeSubTrip(out, *it);
+		}
+	}
+	else
+	{
+		throw std::runtime_error("MT_Checkpoint: unknown trip chain item");
+	}
+}
+
+TripChainItem* readItem(std::istream& in)
+{
+	boost::uint8_t kind = readValue<boost::uint8_t>(in);
+
+	if (kind == ITEM_ACTIVITY)
+	{
+		Activity* activity = new Activity();
+		try
+		{
+			readItemFields(in, *activity);
+			if (readValue<boost::uint8_t>(in))
+			{
+				const RoadNetwork* network = RoadNetwork::getInstance();
+				boost::uint32_t id = readValue<boost::uint32_t>(in);
+				activity->location = network->getById(network->getMapOfIdvsNodes(), id);
+				if (!activity->location)
+				{
+					throwNetworkMismatch("node", boost::lexical_cast<std::string>(id));
+				}
+			}
+			activity->isPrimary = readValue<boost::uint8_t>(in);
+			activity->isFlexible = readValue<boost::uint8_t>(in);
+			activity->isMandatory = readValue<boost::uint8_t>(in);
+		}
+		catch (...)
+		{
+			delete activity;
+			throw;
+		}
+		return activity;
+	}
+	else if (kind == ITEM_TRIP)
+	{
+		Trip* trip = new Trip();
+		try
+		{
+			readItemFields(in, *trip);
+			trip->tripID = readString(in);
+
+			boost::uint32_t numSubTrips = readValue<boost::uint32_t>(in);
+			for (boost::uint32_t i = 0; i < numSubTrips; ++i)
+			{
+				trip->addSubTrip(readSubTrip(in));
+			}
+		}
+		catch (...)
+		{
+			delete trip;
+			throw;
+		}
+		return trip;
+	}
+
+	throw std::runtime_error("MT_Checkpoint: invalid trip chain item in the checkpoint file");
+}
+
+/**
+ * Writes the trip chain of a person and its state at the time of the checkpoint
+ * @param numRewound incremented if the person is a passenger, rewound to its waiting sub-trip
+ * @param droppedVehicles receives the vehicle of such a passenger, which is not restored
+ */
+void writePerson(std::ostream& out, Person_MT& person, const DailyTime& time, unsigned int& numRewound,
+		std::set<const medium::Driver*>& droppedVehicles)
+{
+	const std::vector<TripChainItem*>& tripChain = person.getTripChain();
+	size_t itemIdx = person.currTripChainItem - tripChain.begin();
+	size_t subTripIdx = 0;
+	if ((*person.currTripChainItem)->itemType == TripChainItem::IT_TRIP)
+	{
+		const Trip* trip = dynamic_cast<const Trip*>(*person.currTripChainItem);
+		subTripIdx = person.currSubTrip - trip->getSubTrips().begin();
+	}
+
+	writeString(out, person.getDatabaseId());
+	writeValue(out, static_cast<boost::uint8_t>(person.usesInSimulationTravelTime()));
+
+	writeValue(out, static_cast<boost::uint32_t>(tripChain.size()));
+	for (std::vector<TripChainItem*>::const_iterator it = tripChain.begin(); it != tripChain.end(); ++it)
+	{
+		writeItem(out, *it);
+	}
+
+	const Role<Person_MT>* role = person.getRole();
+	if (!role)
+	{
+		//The person has not started yet
+		DailyTime start = tripChain.front()->startTime;
+		writeValue(out, static_cast<boost::uint32_t>(itemIdx));
+		writeValue(out, static_cast<boost::uint32_t>(subTripIdx));
+		writeValue(out, static_cast<boost::uint8_t>(STATE_RESUME));
+		writeValue(out, static_cast<boost::uint32_t>(start.isAfter(time) ? start.offsetMS_From(time) : 0));
+		return;
+	}
+
+	switch (role->roleType)
+	{
+	case Role<Person_MT>::RL_ACTIVITY:
+	{
+		const ActivityPerformer<Person_MT>* activityPerformer = dynamic_cast<const ActivityPerformer<Person_MT>*>(role);
+		if (!activityPerformer)
+		{
+			throw std::runtime_error("MT_Checkpoint: activity role without activity performer");
+		}
+
+		const DailyTime& simStart = ConfigManager::GetInstance().FullConfig().simStartTime();
+		writeValue(out, static_cast<boost::uint32_t>(itemIdx));
+		writeValue(out, static_cast<boost::uint32_t>(subTripIdx));
+		writeValue(out, static_cast<boost::uint8_t>(STATE_ACTIVITY));
+		writeValue(out, static_cast<boost::uint32_t>(simStart.getValue()
+				+ activityPerformer->getActivityEndTime().getValue()));
+		return;
+	}
+	case Role<Person_MT>::RL_DRIVER:
+	case Role<Person_MT>::RL_BIKER:
+	case Role<Person_MT>::RL_TRUCKER_LGV:
+	case Role<Person_MT>::RL_TRUCKER_HGV:
+	{
+		const DriverMovement* movement = dynamic_cast<const DriverMovement*>(role->Movement());
+		std::vector<const SegmentStats*> path;
+		if (movement)
+		{
+			path = movement->getMesoPathMover().getRemainingPath();
+		}
+
+		if (path.empty())
+		{
+			break;
+		}
+
+		writeValue(out, static_cast<boost::uint32_t>(itemIdx));
+		writeValue(out, static_cast<boost::uint32_t>(subTripIdx));
+		writeValue(out, static_cast<boost::uint8_t>(STATE_ON_ROAD));
+
+		writeValue(out, static_cast<boost::uint32_t>(path.size()));
+		for (std::vector<const SegmentStats*>::const_iterator it = path.begin(); it != path.end(); ++it)
+		{
+			writeValue(out, static_cast<boost::uint32_t>((*it)->getRoadSegment()->getRoadSegmentId()));
+			writeValue(out, static_cast<boost::uint16_t>((*it)->getStatsNumberInSegment()));
+		}
+
+		//A driver in lane infinity enters its first segment again
+		const Lane* lane = person.getCurrLane();
+		bool inLane = (person.getCurrSegStats() == path.front() && lane && lane != path.front()->laneInfinity);
+		writeValue(out, static_cast<boost::uint8_t>(inLane));
+		if (inLane)
+		{
+			writeValue(out, static_cast<boost::uint32_t>(lane->getLaneId()));
+			writeValue(out, person.distanceToEndOfSegment);
+			writeValue(out, static_cast<boost::uint8_t>(person.isQueuing));
+		}
+		return;
+	}
+	case Role<Person_MT>::RL_PASSENGER:
+	case Role<Person_MT>::RL_TRAINPASSENGER:
+	case Role<Person_MT>::RL_TAXIPASSENGER:
+	{
+		//The vehicles are not restored: the passenger waits for another one
+		if (subTripIdx == 0)
+		{
+			throw std::runtime_error("MT_Checkpoint: passenger without a waiting sub-trip");
+		}
+		writeValue(out, static_cast<boost::uint32_t>(itemIdx));
+		writeValue(out, static_cast<boost::uint32_t>(subTripIdx - 1));
+		writeValue(out, static_cast<boost::uint8_t>(STATE_RESUME));
+		writeValue(out, static_cast<boost::uint32_t>(0));
+
+		++numRewound;
+		const Passenger* passenger = dynamic_cast<const Passenger*>(role);
+		if (passenger && passenger->getDriver())
+		{
+			droppedVehicles.insert(passenger->getDriver());
+		}
+		return;
+	}
+	default:
+		break;
+	}
+
+	//The other persons start their current sub-trip again
+	writeValue(out, static_cast<boost::uint32_t>(itemIdx));
+	writeValue(out, static_cast<boost::uint32_t>(subTripIdx));
+	writeValue(out, static_cast<boost::uint8_t>(STATE_RESUME));
+	writeValue(out, static_cast<boost::uint32_t>(0));
+}
+
+/**
+ * Reads the remaining path and the position in the lane of a driver
+ */
+RestoredDriverPosition* readDriverPosition(std::istream& in)
+{
+	const RoadNetwork* network = RoadNetwork::getInstance();
+	RestoredDriverPosition* position = new RestoredDriverPosition();
+
+	try
+	{
+		boost::uint32_t pathSize = readValue<boost::uint32_t>(in);
+		position->path.reserve(pathSize);
+		for (boost::uint32_t i = 0; i < pathSize; ++i)
+		{
+			boost::uint32_t segmentId = readValue<boost::uint32_t>(in);
+			boost::uint16_t statsNum = readValue<boost::uint16_t>(in);
+
+			const RoadSegment* rdSeg = network->getById(network->getMapOfIdVsRoadSegments(), segmentId);
+			Conflux* conflux = rdSeg ? Conflux::getConflux(rdSeg) : nullptr;
+			const SegmentStats* segStats = conflux ? conflux->findSegStats(rdSeg, statsNum) : nullptr;
+			if (!segStats)
+			{
+				throwNetworkMismatch("segment", boost::lexical_cast<std::string>(segmentId));
+			}
+			position->path.push_back(segStats);
+		}
+
+		if (position->path.empty())
+		{
+			throw std::runtime_error("MT_Checkpoint: driver without path in the checkpoint file");
+		}
+
+		if (readValue<boost::uint8_t>(in))
+		{
+			boost::uint32_t laneId = readValue<boost::uint32_t>(in);
+			position->lane = network->getById(network->getMapOfIdVsLanes(), laneId);
+			if (!position->lane || position->lane->getRoadSegmentId()
+					!= position->path.front()->getRoadSegment()->getRoadSegmentId())
+			{
+				throwNetworkMismatch("lane", boost::lexical_cast<std::string>(laneId));
+			}
+			position->distanceToEndOfSegment = readValue<double>(in);
+			position->isQueuing = readValue<boost::uint8_t>(in);
+		}
+	}
+	catch (...)
+	{
+		delete position;
+		throw;
+	}
+	return position;
+}
+}
+
+bool MT_Checkpoint::trackingEnabled = false;
+std::set<Person_MT*> MT_Checkpoint::persons;
+boost::mutex MT_Checkpoint::personsLock;
+
+void MT_Checkpoint::enableTracking()
+{
+	trackingEnabled = true;
+}
+
+bool MT_Checkpoint::isTrackingEnabled()
+{
+	return trackingEnabled;
+}
+
+void MT_Checkpoint::trackPerson(Person_MT* person)
+{
+	if (!trackingEnabled)
+	{
+		return;
+	}
+
+	boost::mutex::scoped_lock lock(personsLock);
+	persons.insert(person);
+}
+
+void MT_Checkpoint::untrackPerson(Person_MT* person)
+{
+	if (!trackingEnabled)
+	{
+		return;
+	}
+
+	boost::mutex::scoped_lock lock(personsLock);
+	persons.erase(person);
+}
+
+void MT_Checkpoint::write(const std::string& fileName, const DailyTime& time, const std::set<Entity*>& removedEntities)
+{
+	//The file is written under another name and renamed once complete, so that a partial checkpoint is never read
+	const std::string tmpFileName = fileName + ".tmp";
+	std::ofstream out(tmpFileName.c_str(), std::ios::binary | std::ios::trunc);
+
+	if (!out)
+	{
+		throw std::runtime_error("MT_Checkpoint: unable to write the checkpoint file " + tmpFileName);
+	}
+
+	out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+	writeValue(out, FILE_VERSION);
+	writeValue(out, static_cast<boost::uint32_t>(time.getValue()));
+
+	unsigned int numWritten = 0;
+	unsigned int numSkipped = 0;
+	unsigned int numRewound = 0;
+	std::set<const medium::Driver*> droppedVehicles;
+	{
+		boost::mutex::scoped_lock lock(personsLock);
+
+		for (std::set<Person_MT*>::const_iterator it = persons.begin(); it != persons.end(); ++it)
+		{
+			Person_MT* person = *it;
+			if (removedEntities.find(person) != removedEntities.end() || person->isToBeRemoved())
+			{
+				continue;
+			}
+
+			//The persons whose trip chain starts after the checkpoint are loaded again with the demand
+			const std::vector<TripChainItem*>& tripChain = person->getTripChain();
+			if (tripChain.empty() || !tripChain.front()->startTime.isBefore(time))
+			{
+				continue;
+			}
+
+			std::ostringstream record;
+			try
+			{
+				writePerson(record, *person, time, numRewound, droppedVehicles);
+			}
+			catch (const std::exception& ex)
+			{
+				Warn() << "MT_Checkpoint: person " << person->getDatabaseId() << " is not written in the checkpoint: "
+				       << ex.what() << std::endl;
+				++numSkipped;
+				continue;
+			}
+
+			writeValue(out, RECORD_PERSON);
+			const std::string data = record.str();
+			out.write(data.data(), data.size());
+			++numWritten;
+		}
+	}
+
+	writeValue(out, RECORD_END);
+	out.close();
+
+	if (!out)
+	{
+		throw std::runtime_error("MT_Checkpoint: error while writing the checkpoint file " + tmpFileName);
+	}
+
+	if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+	{
+		throw std::runtime_error("MT_Checkpoint: unable to rename " + tmpFileName + " to " + fileName);
+	}
+
+	Print() << "Checkpoint at " << time.getStrRepr() << " written to " << fileName << ": " << numWritten
+	        << " persons, " << numSkipped << " skipped, " << numRewound
+	        << " passengers rewound to their waiting sub-trip, " << droppedVehicles.size()
+	        << " vehicles in service not restored" << std::endl;
+}
+
+void MT_Checkpoint::restore(const std::string& fileName, std::set<Entity*>& activeAgents,
+		StartTimePriorityQueue& pendingAgents)
+{
+	std::ifstream in(fileName.c_str(), std::ios::binary);
+
+	if (!in)
+	{
+		throw std::runtime_error("MT_Checkpoint: unable to read the checkpoint file " + fileName);
+	}
+
+	char magic[sizeof(FILE_MAGIC)];
+	if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0
+			|| readValue<boost::uint32_t>(in) != FILE_VERSION)
+	{
+		throw std::runtime_error("MT_Checkpoint: " + fileName + " is not a checkpoint file of this version");
+	}
+
+	const ConfigParams& cfg = ConfigManager::GetInstance().FullConfig();
+	const DailyTime time(readValue<boost::uint32_t>(in));
+
+	if (time != cfg.simStartTime())
+	{
+		throw std::runtime_error("MT_Checkpoint: the checkpoint of " + fileName + " is at " + time.getStrRepr()
+				+ ". The simulation must start at that time");
+	}
+
+	unsigned int numRestored = 0;
+	while (readValue<boost::uint8_t>(in) == RECORD_PERSON)
+	{
+		std::string dbId = readString(in);
+		bool usesInSimulationTravelTime = readValue<boost::uint8_t>(in);
+
+		std::vector<TripChainItem*> tripChain;
+		Person_MT* person = nullptr;
+		try
+		{
+			boost::uint32_t numItems = readValue<boost::uint32_t>(in);
+			for (boost::uint32_t i = 0; i < numItems; ++i)
+			{
+				tripChain.push_back(readItem(in));
+			}
+
+			boost::uint32_t itemIdx = readValue<boost::uint32_t>(in);
+			boost::uint32_t subTripIdx = readValue<boost::uint32_t>(in);
+			boost::uint8_t state = readValue<boost::uint8_t>(in);
+
+			unsigned int startOffset = 0;
+			std::unique_ptr<RestoredDriverPosition> position;
+
+			switch (state)
+			{
+			case STATE_RESUME:
+				startOffset = readValue<boost::uint32_t>(in);
+				break;
+			case STATE_ACTIVITY:
+			{
+				DailyTime end(readValue<boost::uint32_t>(in));
+				if (itemIdx >= tripChain.size())
+				{
+					throw std::runtime_error("MT_Checkpoint: invalid trip chain item index in the checkpoint file");
+				}
+				tripChain[itemIdx]->startTime = time;
+				tripChain[itemIdx]->endTime = end.isAfter(time) ? end : time;
+				break;
+			}
+			case STATE_ON_ROAD:
+				position.reset(readDriverPosition(in));
+				break;
+			default:
+				throw std::runtime_error("MT_Checkpoint: invalid person state in the checkpoint file");
+			}
+
+			person = new Person_MT("DAS_TripChain", cfg.mutexStategy(), -1, dbId);
+			person->setRestoredPosition(position.release());
+			person->setUseInSimulationTravelTime(usesInSimulationTravelTime);
+			person->resumeTripChain(tripChain, itemIdx, subTripIdx);
+			person->setStartTime(startOffset);
+		}
+		catch (...)
+		{
+			safe_delete_item(person);
+			clear_delete_vector(tripChain);
+			throw;
+		}
+
+		trackPerson(person);
+
+		if (person->getStartTime() == 0)
+		{
+			activeAgents.insert(person);
+		}
+		else
+		{
+			pendingAgents.push(person);
+		}
+		++numRestored;
+	}
+
+	Print() << "Checkpoint at " << time.getStrRepr() << " restored from " << fileName << ": " << numRestored
+	        << " persons" << std::endl;
+}
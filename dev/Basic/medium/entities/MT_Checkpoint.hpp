@@ -0,0 +1,86 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <set>
+#include <string>
+#include <boost/thread/mutex.hpp>
+#include "util/DailyTime.hpp"
+
+namespace sim_mob
+{
+
+class Entity;
+class StartTimePriorityQueue;
+
+namespace medium
+{
+
+class Person_MT;
+
+/**
+ * Checkpoint of the travellers of a mid-term supply simulation.
+ *
+ * A checkpoint holds, for each person loaded from the demand whose trip chain has started, the trip chain and the
+ * position of the person in it: the activity being performed, the sub-trip being travelled, or, for the drivers, the
+ * remaining path and the position in the lane. A run started at the time of the checkpoint restores the persons from
+ * the file and loads the demand starting from that time. The vehicles in service are not restored: their passengers
+ * wait for another vehicle at the start of the waiting sub-trip preceding their ride.
+ *
+ * The persons are tracked only when a checkpoint is to be written. The checkpoint is written by the main thread while
+ * the workers wait at the barriers, after the buffers are flipped.
+ */
+class MT_Checkpoint
+{
+public:
+	/**
+	 * Starts tracking the persons created from the demand
+	 */
+	static void enableTracking();
+
+	static bool isTrackingEnabled();
+
+	/**
+	 * Adds a person to the persons written in the checkpoint
+	 * @param person the person
+	 */
+	static void trackPerson(Person_MT* person);
+
+	/**
+	 * Removes a person from the persons written in the checkpoint
+	 * @param person the person
+	 */
+	static void untrackPerson(Person_MT* person);
+
+	/**
+	 * Writes the checkpoint of the tracked persons
+	 * @param fileName the file of the checkpoint
+	 * @param time the time of the checkpoint
+	 * @param removedEntities the entities removed in the current tick
+	 */
+	static void write(const std::string& fileName, const DailyTime& time, const std::set<Entity*>& removedEntities);
+
+	/**
+	 * Creates the persons of a checkpoint. The time of the checkpoint must be the start time of the simulation
+	 * @param fileName the file of the checkpoint
+	 * @param activeAgents the agents starting immediately
+	 * @param pendingAgents the agents starting later
+	 */
+	static void restore(const std::string& fileName, std::set<Entity*>& activeAgents,
+			StartTimePriorityQueue& pendingAgents);
+
+private:
+	/**indicates whether the persons are tracked*/
+	static bool trackingEnabled;
+
+	/**the tracked persons*/
+	static std::set<Person_MT*> persons;
+
+	/**lock for the tracked persons*/
+	static boost::mutex personsLock;
+};
+
+}
+}
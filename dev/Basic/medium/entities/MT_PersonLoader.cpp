@@ -6,6 +6,8 @@
 #include "MT_PersonLoader.hpp"
 
 #include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/chrono.hpp>
 #include <boost/lexical_cast.hpp>
 #include <cmath>
 #include <functional>
@@ -27,6 +29,7 @@
 #include "database/predaydao/PopulationSqlDao.hpp"
 #include "geospatial/network/RoadNetwork.hpp"
 #include "logging/Log.hpp"
+#include "path/PathSetPrefetcher.hpp"
 #include "Person_MT.hpp"
 #include "util/DailyTime.hpp"
 #include "util/Utils.hpp"
@@ -243,6 +246,50 @@ DB_Connection getDB_Connection(const DatabaseDetails& dbInfo)
 	return DB_Connection(sim_mob::db::POSTGRES, dbConfig);
 }
 
+/**
+ * returns the start of the demand window loaded after the window starting at start
+ */
+double getNextWindowStart(double start)
+{
+	double next = start + DEFAULT_LOAD_INTERVAL + DEFAULT_LOAD_INTERVAL;
+	if(next > LAST_30MIN_WINDOW_OF_DAY)
+	{
+		next = next - TWENTY_FOUR_HOURS; //next day starts at 3.25
+	}
+	return next;
+}
+
+/**
+ * registers the car and motorcycle trips in the pathset prefetcher, so that their pathsets are loaded before they start
+ */
+void prefetchPathSets(const unordered_map<string, vector<TripChainItem*> >& tripchains)
+{
+	PathSetPrefetcher& prefetcher = PathSetPrefetcher::getInstance();
+	if (!prefetcher.isEnabled())
+	{
+		return;
+	}
+
+	for (unordered_map<string, vector<TripChainItem*> >::const_iterator it = tripchains.begin(); it != tripchains.end(); ++it)
+	{
+		for (const TripChainItem* item : it->second)
+		{
+			if (item->itemType != TripChainItem::IT_TRIP)
+			{
+				continue;
+			}
+
+			for (const SubTrip& subTrip : static_cast<const Trip*>(item)->getSubTrips())
+			{
+				if (subTrip.travelMode == "Car" || subTrip.travelMode == "Motorcycle")
+				{
+					prefetcher.addDeparture(subTrip.startTime, subTrip.origin.node, subTrip.destination.node);
+				}
+			}
+		}
+	}
+}
+
 }//anon namespace
 
 /**
@@ -362,7 +409,8 @@ private:
 };
 
 MT_PersonLoader::MT_PersonLoader(std::set<sim_mob::Entity*>& activeAgents, StartTimePriorityQueue& pendinAgents)
-	: PeriodicPersonLoader(activeAgents, pendinAgents),isLoadPersonInfo(false)
+	: PeriodicPersonLoader(activeAgents, pendinAgents),isLoadPersonInfo(false),
+	  preloadWindows(MT_Config::getInstance().getPersonLoaderPreloadWindows()), stopLoading(false)
 {
 	ConfigParams& cfg = ConfigManager::GetInstanceRW().FullConfig();
 	dataLoadInterval = SECONDS_IN_ONE_HOUR; //1 hour by default. TODO: must be configurable.
@@ -386,6 +434,7 @@ MT_PersonLoader::MT_PersonLoader(std::set<sim_mob::Entity*>& activeAgents, Start
 
 MT_PersonLoader::~MT_PersonLoader()
 {
+	stopBackgroundLoader();
 }
 
 void MT_PersonLoader::makeSubTrip(const soci::row& r, Trip* parentTrip, unsigned short subTripNo)
@@ -591,19 +640,26 @@ void MT_PersonLoader::loadMRT_Demand()
 	Print() << "PersonLoader:: MRT loaded " << personsLoaded << endl;
 	Print() << "active_agents: " << activeAgents.size() << " | pending_agents: "<< pendingAgents.size() << endl;
 }
-void MT_PersonLoader::loadPersonDemand()
+soci::session& MT_PersonLoader::getSession()
 {
-	if(storedProcName.empty())
+	if(!session)
 	{
-		loadMRT_Demand();
-		return;
+		const ConfigParams& cfg = ConfigManager::GetInstance().FullConfig();
+		session.reset(new soci::session(soci::postgresql, cfg.getDatabaseConnectionString(false)));
 	}
+	return *session;
+}
+
+void MT_PersonLoader::loadWindow(double start, DemandWindow& window)
+{
+	boost::chrono::steady_clock::time_point loadStart = boost::chrono::steady_clock::now();
+	window.start = start;
+
     //Our SQL statement
 	stringstream query;
-    ConfigParams& cfg = ConfigManager::GetInstanceRW().FullConfig();
-	double end = nextLoadStart + DEFAULT_LOAD_INTERVAL;
-	query << "select * from " << storedProcName << "(" << nextLoadStart << "," << end << ")";
-	soci::session sql_(soci::postgresql, cfg.getDatabaseConnectionString(false));
+	double end = start + DEFAULT_LOAD_INTERVAL;
+	query << "select * from " << storedProcName << "(" << start << "," << end << ")";
+	soci::session& sql_ = getSession();
 
 	soci::rowset<soci::row> rs = (sql_.prepare << query.str());
 	unordered_map<string, vector<TripChainItem*> > tripchains;
@@ -623,11 +679,11 @@ void MT_PersonLoader::loadPersonDemand()
 			personTripChain.push_back(constructedTrip);
 
 			//Record the number of trips loaded
-            cfg.numTripsLoaded++;
+            window.numTripsLoaded++;
 		}
 		else
 		{
-            cfg.numTripsNotLoaded++;
+            window.numTripsNotLoaded++;
 			continue;
 		}
 
@@ -638,13 +694,13 @@ void MT_PersonLoader::loadPersonDemand()
 	}
 
 	//Record the total number of persons loaded from the day activity schedule
-    cfg.numPersonsLoaded += tripchains.size();
+    window.numPersonsLoaded = tripchains.size();
 
 	if (!freightStoredProcName.empty())
 	{
 		//Our SQL statement
 		stringstream freightQuery;
-		freightQuery << "select * from " << freightStoredProcName << "(" << nextLoadStart << "," << end << ")";
+		freightQuery << "select * from " << freightStoredProcName << "(" << start << "," << end << ")";
 		std::string freightSql_str = freightQuery.str();
 
 		soci::rowset<soci::row> rsFreight = (sql_.prepare << freightSql_str);
@@ -666,19 +722,139 @@ void MT_PersonLoader::loadPersonDemand()
 		}
 	}
 
-	vector<Person_MT*> persons;
-	int personsLoaded = CellLoader::load(tripchains, persons);
+	prefetchPathSets(tripchains);
+
+	CellLoader::load(tripchains, window.persons);
+
+	window.loadTime = boost::chrono::duration<double>(boost::chrono::steady_clock::now() - loadStart).count();
+}
 
-	for(vector<Person_MT*>::iterator i=persons.begin(); i!=persons.end(); i++)
+void MT_PersonLoader::runBackgroundLoader(double start)
+{
+	try
 	{
-		addOrStashPerson(*i);
+		while (true)
+		{
+			{
+				//stay at most preloadWindows windows ahead of the simulation
+				boost::unique_lock<boost::mutex> lock(windowsMutex);
+				while (!stopLoading && loadedWindows.size() >= preloadWindows)
+				{
+					windowConsumed.wait(lock);
+				}
+				if (stopLoading)
+				{
+					return;
+				}
+			}
+
+			DemandWindow window;
+			loadWindow(start, window);
+
+			{
+				boost::unique_lock<boost::mutex> lock(windowsMutex);
+				if (stopLoading)
+				{
+					for (vector<Person_MT*>::iterator i = window.persons.begin(); i != window.persons.end(); i++)
+					{
+						safe_delete_item(*i);
+					}
+					return;
+				}
+				loadedWindows.push_back(DemandWindow());
+				std::swap(loadedWindows.back(), window);
+			}
+			windowLoaded.notify_one();
+
+			start = getNextWindowStart(start);
+		}
+	}
+	catch (...)
+	{
+		boost::unique_lock<boost::mutex> lock(windowsMutex);
+		loaderError = std::current_exception();
+		windowLoaded.notify_one();
 	}
+}
 
-	//update next load start
-	nextLoadStart = end + DEFAULT_LOAD_INTERVAL;
-	if(nextLoadStart > LAST_30MIN_WINDOW_OF_DAY)
+void MT_PersonLoader::stopBackgroundLoader()
+{
+	if (!loaderThread.joinable())
 	{
-		nextLoadStart = nextLoadStart - TWENTY_FOUR_HOURS; //next day starts at 3.25
+		return;
 	}
+
+	{
+		boost::unique_lock<boost::mutex> lock(windowsMutex);
+		stopLoading = true;
+	}
+	windowConsumed.notify_one();
+	loaderThread.join();
+
+	for (std::deque<DemandWindow>::iterator itWindow = loadedWindows.begin(); itWindow != loadedWindows.end(); itWindow++)
+	{
+		for (vector<Person_MT*>::iterator i = itWindow->persons.begin(); i != itWindow->persons.end(); i++)
+		{
+			safe_delete_item(*i);
+		}
+	}
+	loadedWindows.clear();
 }
 
+void MT_PersonLoader::loadPersonDemand()
+{
+	if(storedProcName.empty())
+	{
+		loadMRT_Demand();
+		return;
+	}
+
+	boost::chrono::steady_clock::time_point waitStart = boost::chrono::steady_clock::now();
+	DemandWindow window;
+
+	if (preloadWindows == 0)
+	{
+		loadWindow(nextLoadStart, window);
+	}
+	else
+	{
+		if (!loaderThread.joinable())
+		{
+			loaderThread = boost::thread(boost::bind(&MT_PersonLoader::runBackgroundLoader, this, nextLoadStart));
+		}
+
+		{
+			boost::unique_lock<boost::mutex> lock(windowsMutex);
+			while (loadedWindows.empty() && !loaderError)
+			{
+				windowLoaded.wait(lock);
+			}
+			if (loadedWindows.empty())
+			{
+				std::rethrow_exception(loaderError);
+			}
+			std::swap(window, loadedWindows.front());
+			loadedWindows.pop_front();
+		}
+		windowConsumed.notify_one();
+	}
+
+	for(vector<Person_MT*>::iterator i=window.persons.begin(); i!=window.persons.end(); i++)
+	{
+		addOrStashPerson(*i);
+	}
+
+	//the counts are only published here, so the loader thread never writes to the configuration
+	ConfigParams& cfg = ConfigManager::GetInstanceRW().FullConfig();
+	cfg.numTripsLoaded += window.numTripsLoaded;
+	cfg.numTripsNotLoaded += window.numTripsNotLoaded;
+	cfg.numPersonsLoaded += window.numPersonsLoaded;
+
+	//the simulation only stalls for the part of the load which was not done in background
+	double waitTime = boost::chrono::duration<double>(boost::chrono::steady_clock::now() - waitStart).count();
+	Print() << "PersonLoader:: window " << window.start << " loaded " << window.persons.size() << " persons in "
+	        << window.loadTime << "s, simulation waited " << waitTime << "s" << endl;
+
+	//update next load start
+	nextLoadStart = getNextWindowStart(window.start);
+}
@@ -3,6 +3,13 @@
 //   license.txt   (http://opensource.org/licenses/MIT)
 
 #pragma once
+#include <deque>
+#include <exception>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 #include <soci/soci.h>
 #include <soci/postgresql/soci-postgresql.h>
 #include "entities/PersonLoader.hpp"
@@ -12,9 +19,16 @@ namespace sim_mob
 {
 namespace medium
 {
+class Person_MT;
+
 /**
  * Sub-class of PersonLoader tailored for loading mid-term persons from day activity schedule
  *
+ * If MT_Config::getPersonLoaderPreloadWindows() is non-zero, a background thread fetches the demand windows and
+ * constructs their persons ahead of the simulation. It stays at most that many windows ahead, and loadPersonDemand()
+ * only hands the persons of the next window over to the pending agents. Otherwise the window is loaded by
+ * loadPersonDemand() itself.
+ *
  * \author Harish Loganathan
  * \zhang huai peng
  */
@@ -34,6 +48,53 @@ protected:
      */
     void loadMRT_Demand();
 private:
+    /**
+     * persons of a 30 minute demand window
+     */
+    struct DemandWindow
+    {
+        DemandWindow() : start(0), loadTime(0), numTripsLoaded(0), numTripsNotLoaded(0), numPersonsLoaded(0)
+        {
+        }
+
+        /** start of the window, in preday's half hour representation*/
+        double start;
+
+        /** persons loaded for the window*/
+        std::vector<Person_MT*> persons;
+
+        /** time taken to fetch the window and construct its persons, in seconds*/
+        double loadTime;
+
+        /** counts of the window, added to the ConfigParams counts by the simulation thread when the window is used*/
+        unsigned int numTripsLoaded;
+        unsigned int numTripsNotLoaded;
+        unsigned int numPersonsLoaded;
+    };
+
+    /**
+     * fetches the trips of a demand window from the database and constructs its persons
+     * @param start start of the window
+     * @param window output
+     */
+    void loadWindow(double start, DemandWindow& window);
+
+    /**
+     * returns the database session, which is opened on first use and reused for all windows
+     */
+    soci::session& getSession();
+
+    /**
+     * function executed by the background loader thread
+     * @param start start of the first window to load
+     */
+    void runBackgroundLoader(double start);
+
+    /**
+     * stops the background loader thread and discards the windows which were not handed over
+     */
+    void stopBackgroundLoader();
+
     /**
      * makes a single sub trip for trip (for now)
      * @param r row from database table
@@ -71,6 +132,33 @@ private:
 
     /**indicate whether load personal info*/
     bool isLoadPersonInfo;
+
+    /** session to the demand database*/
+    boost::shared_ptr<soci::session> session;
+
+    /** maximum number of windows loaded ahead by the background thread; 0 if there is no background thread*/
+    unsigned int preloadWindows;
+
+    /** background loader thread*/
+    boost::thread loaderThread;
+
+    /** windows loaded by the background thread and not yet handed over, in order*/
+    std::deque<DemandWindow> loadedWindows;
+
+    /** protects loadedWindows, stopLoading and loaderError*/
+    boost::mutex windowsMutex;
+
+    /** notified when a window is loaded, or when the loader fails*/
+    boost::condition_variable windowLoaded;
+
+    /** notified when a window is handed over, or when the loader must stop*/
+    boost::condition_variable windowConsumed;
+
+    /** set to stop the background thread*/
+    bool stopLoading;
+
+    /** exception thrown by the background thread, rethrown by loadPersonDemand()*/
+    std::exception_ptr loaderError;
 };
 
 } // namespace medium
@@ -9,6 +9,7 @@
 #include "conf/ConfigManager.hpp"
 #include "config/MT_Config.hpp"
 #include "entities/incident/IncidentManager.hpp"
+#include "entities/MT_Checkpoint.hpp"
 #include "entities/PT_Statistics.hpp"
 #include "entities/TrainController.hpp"
 #include "entities/TripChainOutput.hpp"
@@ -61,7 +62,7 @@ Person_MT::Person_MT(const std::string& src, const MutexStrategy& mtxStrat, int
 : Person(src, mtxStrat, id, databaseID),
 isQueuing(false), distanceToEndOfSegment(0.0), drivingTimeToEndOfLink(0.0), remainingTimeThisTick(0.0),
 requestedNextSegStats(nullptr), requestedNextLane(nullptr), canMoveToNextSegment(NONE), currSegStats(nullptr),
-currLane(nullptr), prevRole(nullptr), currRole(nullptr), nextRole(nullptr), numTicksStuck(0)
+currLane(nullptr), prevRole(nullptr), currRole(nullptr), nextRole(nullptr), numTicksStuck(0), restoredPosition(nullptr)
 {
 }
 
@@ -69,7 +70,7 @@ Person_MT::Person_MT(const std::string& src, const MutexStrategy& mtxStrat, cons
 : Person(src, mtxStrat, tc),
 isQueuing(false), distanceToEndOfSegment(0.0), drivingTimeToEndOfLink(0.0), remainingTimeThisTick(0.0),
 requestedNextSegStats(nullptr), requestedNextLane(nullptr), canMoveToNextSegment(NONE), currSegStats(nullptr),
-currLane(nullptr), prevRole(nullptr), currRole(nullptr), nextRole(nullptr), numTicksStuck(0)
+currLane(nullptr), prevRole(nullptr), currRole(nullptr), nextRole(nullptr), numTicksStuck(0), restoredPosition(nullptr)
 {
 	ConfigParams& cfg = ConfigManager::GetInstanceRW().FullConfig();
 	std::string ptPathsetStoredProcName = cfg.getDatabaseProcMappings().procedureMappings["pt_pathset"];
@@ -95,13 +96,20 @@ currLane(nullptr), prevRole(nullptr), currRole(nullptr), nextRole(nullptr), numT
 		       << "]" << std::endl;
 		tripChain.clear();
 	}
+
+	if (src == "DAS_TripChain")
+	{
+		MT_Checkpoint::trackPerson(this);
+	}
 }
 
 Person_MT::~Person_MT()
 {
+	MT_Checkpoint::untrackPerson(this);
 	safe_delete_item(prevRole);
 	safe_delete_item(currRole);
 	safe_delete_item(nextRole);
+	safe_delete_item(restoredPosition);
 }
 
 void Person_MT::convertToTaxiTrips()
@@ -1019,6 +1027,44 @@ void Person_MT::initTripChain()
 	isFirstTick = true;
 }
 
+void Person_MT::resumeTripChain(const std::vector<TripChainItem*>& tc, size_t itemIdx, size_t subTripIdx)
+{
+	if (itemIdx >= tc.size())
+	{
+		throw std::runtime_error("Person_MT::resumeTripChain() - invalid trip chain item index");
+	}
+
+	tripChain = tc;
+	currTripChainItem = tripChain.begin() + itemIdx;
+
+	if ((*currTripChainItem)->itemType == sim_mob::TripChainItem::IT_TRIP)
+	{
+		std::vector<SubTrip>& subTrips = (dynamic_cast<sim_mob::Trip*> (*currTripChainItem))->getSubTripsRW();
+		if (subTripIdx >= subTrips.size())
+		{
+			throw std::runtime_error("Person_MT::resumeTripChain() - invalid sub-trip index");
+		}
+
+		currSubTrip = subTrips.begin() + subTripIdx;
+
+		if (!updateOD(*currTripChainItem, &(*currSubTrip)))
+		{
+			throw std::runtime_error("Trip/Activity mismatch, or unknown TripChainItem subclass.");
+		}
+	}
+	setNextPathPlanned(false);
+	isFirstTick = true;
+}
+
+void Person_MT::setRestoredPosition(RestoredDriverPosition* position)
+{
+	if (restoredPosition != position)
+	{
+		safe_delete_item(restoredPosition);
+		restoredPosition = position;
+	}
+}
+
 bool Person_MT::updatePersonRole()
 {	
 	if (!nextRole)
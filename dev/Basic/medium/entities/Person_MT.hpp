@@ -25,6 +25,28 @@ namespace medium
 class Conflux;
 class SegmentStats;
 
+/**
+ * Position on the road of a driver restored from a checkpoint of the simulation (see MT_Checkpoint)
+ */
+struct RestoredDriverPosition
+{
+	RestoredDriverPosition() : lane(nullptr), distanceToEndOfSegment(0.0), isQueuing(false)
+	{
+	}
+
+	/**The remaining path of the driver, starting with the segment stats in which it was*/
+	std::vector<const SegmentStats*> path;
+
+	/**The lane of the driver in the first segment stats of the path. NULL if the driver was in the lane infinity*/
+	const Lane* lane;
+
+	/**The distance to the end of the first segment stats of the path, if the driver was in a lane*/
+	double distanceToEndOfSegment;
+
+	/**Indicates whether the driver was queuing, if it was in a lane*/
+	bool isQueuing;
+};
+
 class Person_MT : public Person
 {
 private:
@@ -56,6 +78,9 @@ private:
 	/**Stores the service vehicle information*/
 	FleetController::FleetItem serviceVehicle;
 
+	/**The position at which the person resumes driving, if it was restored from a checkpoint. NULL otherwise*/
+	RestoredDriverPosition* restoredPosition;
+
 	/**Alters trip chain in accordance to route choice for public transit trips*/
 	void convertPublicTransitODsToTrips(PT_Network& ptNetwork,const std::string& ptPathsetStoredProcName);
 
@@ -145,6 +170,15 @@ public:
      */
 	virtual void initTripChain();
 
+	/**
+	 * Resumes a trip chain at the given item, for a person restored from a checkpoint of the simulation
+	 *
+	 * @param tc the trip chain
+	 * @param itemIdx index of the trip chain item at which the person resumes
+	 * @param subTripIdx index of the sub-trip at which the person resumes, if the item is a trip
+	 */
+	void resumeTripChain(const std::vector<TripChainItem*>& tc, size_t itemIdx, size_t subTripIdx);
+
 	/**
 	 * Check if any role changing is required.
 
@@ -290,6 +324,18 @@ public:
 		return serviceVehicle;
 	}
 
+	const RestoredDriverPosition* getRestoredPosition() const
+	{
+		return restoredPosition;
+	}
+
+	/**
+	 * Sets the position at which the person resumes driving. The person takes ownership of the position
+	 *
+	 * @param position the position, or NULL once the person has resumed driving
+	 */
+	void setRestoredPosition(RestoredDriverPosition* position);
+
 	/**
 	 * from current role, export service driver
 	 * @return service driver if current role support service driver
@@ -292,10 +292,20 @@ void Conflux::addAgent(Person_MT* person)
         case Role<Person_MT>::RL_ON_CALL_DRIVER:
         {
             SegmentStats* rdSegStats = const_cast<SegmentStats*>(person->getCurrSegStats()); // person->currSegStats is set when frame_init of role is called
+            const RestoredDriverPosition* restoredPosition = person->getRestoredPosition();
+            if (restoredPosition && restoredPosition->lane)
+            {
+                //a driver restored from a checkpoint is put back in its lane. Its position is set by frame_init
+                person->remainingTimeThisTick = tickTimeInS;
+                rdSegStats->addAgent(restoredPosition->lane, person);
+                person->setRestoredPosition(nullptr);
+                break;
+            }
             person->setCurrLane(rdSegStats->laneInfinity);
             person->distanceToEndOfSegment = rdSegStats->getLength();
             person->remainingTimeThisTick = tickTimeInS;
             rdSegStats->addAgent(rdSegStats->laneInfinity, person);
+            person->setRestoredPosition(nullptr);
             break;
         }
         case Role<Person_MT>::RL_PEDESTRIAN:
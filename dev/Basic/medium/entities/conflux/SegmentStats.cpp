@@ -1118,7 +1118,7 @@ void SegmentStats::setPositionOfLastUpdatedAgentInLane(double positionOfLastUpda
 	laneIt->second->setPositionOfLastUpdatedAgent(positionOfLastUpdatedAgentInLane);
 }
 
-std::map<const Lane*, LaneStats*> SegmentStats::getLaneStats() const
+const std::map<const Lane*, LaneStats*>& SegmentStats::getLaneStats() const
 {
 	return laneStatsMap;
 }
@@ -1345,7 +1345,7 @@ void LaneStats::printAgents() const
             DriverMovement *mov = dynamic_cast<DriverMovement *>(movFacet);
             if(mov)
             {
-                const MesoPathMover pathMover = mov->getMesoPathMover();
+                const MesoPathMover& pathMover = mov->getMesoPathMover();
                 const std::vector<const SegmentStats*>& path = pathMover.getPath();
                 debugMsgs << "(pathStats:";
                 for(auto i = path.begin(); i!=path.end(); i++)
@@ -1000,7 +1000,7 @@ public:
 	 */
 	Lane* laneInfinity;
 
-	std::map<const Lane*, LaneStats*> getLaneStats() const ;
+	const std::map<const Lane*, LaneStats*>& getLaneStats() const ;
 };
 } // namespace medium
 } // namespace sim_mob
@@ -454,6 +454,30 @@ bool DriverMovement::initializePath()
 		parentDriver->origin = person->originNode;
 		parentDriver->goal = person->destNode;
 
+		//A driver restored from a checkpoint resumes the path it was on
+		const RestoredDriverPosition* restoredPosition = person->getRestoredPosition();
+		if (restoredPosition)
+		{
+			pathMover.setPath(restoredPosition->path);
+			const SegmentStats* firstSegStat = restoredPosition->path.front();
+			person->setCurrSegStats(firstSegStat);
+			if (restoredPosition->lane)
+			{
+				currLane = restoredPosition->lane;
+				pathMover.setPositionInSegment(restoredPosition->distanceToEndOfSegment);
+				person->setCurrLane(restoredPosition->lane);
+				person->distanceToEndOfSegment = restoredPosition->distanceToEndOfSegment;
+				person->isQueuing = restoredPosition->isQueuing;
+			}
+			else
+			{
+				person->setCurrLane(firstSegStat->laneInfinity);
+				person->distanceToEndOfSegment = firstSegStat->getLength();
+			}
+			person->setNextPathPlanned(true);
+			return true;
+		}
+
 		if (person->originNode.node == person->destNode.node)
 		{
 			Print() << "DriverMovement::initializePath | Can't initializePath because origin and destination are the same for driver " << person->getId()
@@ -988,16 +1012,8 @@ bool DriverMovement::advanceQueuingVehicle(DriverUpdateParams& params)
 	double finalTimeSpent = 0.0;
 	double finalDistToSegEnd = 0.0;
 
-	int inOutCounter = getOutputCounter(currLane, pathMover.getCurrSegStats());
-	double outRate = getOutputFlowRate(currLane);
-
-	const SegmentStats* nxtSegStat = pathMover.getNextSegStats(false);
-	if (nxtSegStat)
-	{
-		const SegmentStats* nextToNextSegStat = pathMover.getSecondSegStatsAhead();
-		const Lane* laneInNextSegment = getBestTargetLane(nxtSegStat, nextToNextSegStat);
-		inOutCounter = std::min(inOutCounter, getInputCounter(laneInNextSegment, nxtSegStat));
-	}
+	const LaneStats* laneStats = pathMover.getCurrSegStats()->getLaneStats().find(currLane)->second;
+	double outRate = laneStats->laneParams->getOutputFlowRate();
 
 	//The following line of code assumes vehicle length is in cm;
 	//vehicle length and outrate cannot be 0.
@@ -1005,8 +1021,9 @@ bool DriverMovement::advanceQueuingVehicle(DriverUpdateParams& params)
 	//its purpose was not clear to anyone.~Harish
 	finalTimeSpent = initialTimeSpent + initialDistToSegEnd / (PASSENGER_CAR_UNIT * outRate);
 
-	if (inOutCounter > 0 && finalTimeSpent < params.secondsInTick
-			&& pathMover.getCurrSegStats()->getPositionOfLastUpdatedAgentInLane(currLane) == -1)
+	//the lane in the next segment is only chosen if the vehicle can leave the queue in this tick
+	if (finalTimeSpent < params.secondsInTick && laneStats->getPositionOfLastUpdatedAgent() == -1
+			&& getOutputCounterToNextSegment(laneStats) > 0)
 	{
 		res = moveToNextSegment(params);
 		finalDistToSegEnd = pathMover.getPositionInSegment();
@@ -1039,22 +1056,15 @@ bool DriverMovement::advanceMovingVehicle(DriverUpdateParams& params)
 	}
 
 	const SegmentStats* currSegStats = pathMover.getCurrSegStats();
-	const LaneStats *laneStats = currSegStats->getLaneStats().find(currLane)->second;
 	//We can infer that the path is not completed if this function is called.
 	//Therefore currSegStats cannot be NULL. It is safe to use it in this function.
+	//The lane stats are looked up once; the vehicles which stay in the segment
+	//in this tick do not need the lane choice in the next segment.
+	const LaneStats *laneStats = currSegStats->getLaneStats().find(currLane)->second;
 	double velocity = laneStats->getLaneVehSpeed(true);
-	int inOutCounter = getOutputCounter(currLane, currSegStats);
-	const SegmentStats* nxtSegStat = pathMover.getNextSegStats(false);
-
-	if (nxtSegStat)
-	{
-		const SegmentStats* nextToNextSegStat = pathMover.getSecondSegStatsAhead();
-		const Lane* laneInNextSegment = getBestTargetLane(nxtSegStat, nextToNextSegStat);
-		inOutCounter = std::min(inOutCounter, getInputCounter(laneInNextSegment, nxtSegStat));
-	}
 
 	// add driver to queue if required
-	double laneQueueLength = getQueueLength(currLane);
+	double laneQueueLength = laneStats->getQueueLength();
 	if (laneQueueLength > currSegStats->getLength())
 	{
 		addToQueue();
@@ -1081,7 +1091,7 @@ bool DriverMovement::advanceMovingVehicle(DriverUpdateParams& params)
 			updateTrafficSensor(oldDistCovered, oldDistCovered + initialDistToSegEnd - finalDistToSegEnd, velocity, acceleration);
 		}
 	}
-	else if (getInitialQueueLength(currLane) > 0)
+	else if (laneStats->getInitialQueueLength() > 0)
 	{
 		res = advanceMovingVehicleWithInitialQ(params);
 	}
@@ -1090,7 +1100,7 @@ bool DriverMovement::advanceMovingVehicle(DriverUpdateParams& params)
 		finalTimeSpent = initialTimeSpent + initialDistToSegEnd / velocity;
 		if (finalTimeSpent < params.secondsInTick)
 		{
-			if (inOutCounter > 0)
+			if (getOutputCounterToNextSegment(laneStats) > 0)
 			{
 				pathMover.setPositionInSegment(0.0);
 				params.elapsedSeconds = finalTimeSpent;
@@ -1128,29 +1138,19 @@ bool DriverMovement::advanceMovingVehicleWithInitialQ(DriverUpdateParams& params
 
 	const LaneStats *laneStats = pathMover.getCurrSegStats()->getLaneStats().find(currLane)->second;
 	double velocity = laneStats->getLaneVehSpeed(true);
-
-	int inOutCounter = getOutputCounter(currLane, pathMover.getCurrSegStats());
-	double outRate = getOutputFlowRate(currLane);
-
-	const SegmentStats* nxtSegStat = pathMover.getNextSegStats(false);
-	if (nxtSegStat)
-	{
-		const SegmentStats* nextToNextSegStat = pathMover.getSecondSegStatsAhead();
-		const Lane* laneInNextSegment = getBestTargetLane(nxtSegStat, nextToNextSegStat);
-		inOutCounter = std::min(inOutCounter, getInputCounter(laneInNextSegment, nxtSegStat));
-	}
+	double outRate = laneStats->laneParams->getOutputFlowRate();
 
 	//The following line of code assumes vehicle length is in cm;
 	//vehicle length and outrate cannot be 0.
 	//There was a magic factor 3.0 in the denominator. It was removed because
 	//its purpose was not clear to anyone. ~Harish
-	double timeToDissipateQ = getInitialQueueLength(currLane) / (outRate * PASSENGER_CAR_UNIT);
+	double timeToDissipateQ = laneStats->getInitialQueueLength() / (outRate * PASSENGER_CAR_UNIT);
 	double timeToReachEndSeg = initialTimeSpent + initialDistToSegEnd / velocity;
 	finalTimeSpent = std::max(timeToDissipateQ, timeToReachEndSeg);
 
 	if (finalTimeSpent < params.secondsInTick)
 	{
-		if (inOutCounter > 0)
+		if (getOutputCounterToNextSegment(laneStats) > 0)
 		{
 			pathMover.setPositionInSegment(0.0);
 			params.elapsedSeconds = finalTimeSpent;
@@ -1184,6 +1184,19 @@ bool DriverMovement::advanceMovingVehicleWithInitialQ(DriverUpdateParams& params
 	return res;
 }
 
+int DriverMovement::getOutputCounterToNextSegment(const LaneStats* laneStats)
+{
+	int inOutCounter = laneStats->laneParams->getOutputCounter();
+	const SegmentStats* nxtSegStat = pathMover.getNextSegStats(false);
+	if (nxtSegStat)
+	{
+		const SegmentStats* nextToNextSegStat = pathMover.getSecondSegStatsAhead();
+		const Lane* laneInNextSegment = getBestTargetLane(nxtSegStat, nextToNextSegStat);
+		inOutCounter = std::min(inOutCounter, getInputCounter(laneInNextSegment, nxtSegStat));
+	}
+	return inOutCounter;
+}
+
 int DriverMovement::getOutputCounter(const Lane* lane, const SegmentStats* segStats)
 {
 	return segStats->getLaneParams(lane)->getOutputCounter();
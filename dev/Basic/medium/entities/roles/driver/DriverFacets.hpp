@@ -317,6 +317,18 @@ protected:
 	 */
 	int getOutputCounter(const Lane* lane, const SegmentStats* segStats);
 
+	/**
+	 * get the number of vehicles that can move out of the current lane into the
+	 * next segment in this tick. The lane in the next segment is chosen only when
+	 * this is called, so it must be called only for a vehicle reaching the end of
+	 * its segment
+	 *
+	 * @param laneStats lane stats of the current lane
+	 * @return the minimum of the output counter of the current lane and the
+	 * 		input counter of the lane chosen in the next segment
+	 */
+	int getOutputCounterToNextSegment(const LaneStats* laneStats);
+
 	/**
 	 * decrement number of vehicles that can move out of a lane in this tick
 	 *
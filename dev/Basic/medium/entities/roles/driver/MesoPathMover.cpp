@@ -18,13 +18,17 @@ void MesoPathMover::setPath(const std::vector<const SegmentStats*>& segStatPath)
     {
         throw std::runtime_error("cannot assign an empty path to MesoPathMover");
     }
-    path = segStatPath;
-    currSegStatIt = path.begin();
+    path = MesoPathPool::getInstance().intern(segStatPath);
+    currSegStatIdx = 0;
 }
 
-const std::vector<const SegmentStats*>  MesoPathMover::getPath() const
+std::vector<const SegmentStats*> MesoPathMover::getRemainingPath() const
 {
-    return path;
+    if (isPathCompleted())
+    {
+        return std::vector<const SegmentStats*>();
+    }
+    return std::vector<const SegmentStats*>(path->begin() + currSegStatIdx, path->end());
 }
 
 void MesoPathMover::resetPath(const std::vector<const SegmentStats*>& segStatPath)
@@ -33,24 +37,30 @@ void MesoPathMover::resetPath(const std::vector<const SegmentStats*>& segStatPat
     {
         throw std::runtime_error("cannot assign an empty path to MesoPathMover");
     }
-    if (!path.empty() && (currSegStatIt != path.end()))
+    if (!isPathCompleted())
     {
-        const SegmentStats* currSegStat = *currSegStatIt;
-        path.clear();
-        path = segStatPath;
-        currSegStatIt = std::find(path.begin(), path.end(), currSegStat);
-        if (currSegStatIt == path.end())
+        const SegmentStats* currSegStat = (*path)[currSegStatIdx];
+        Path::const_iterator it = std::find(segStatPath.begin(), segStatPath.end(), currSegStat);
+        if (it == segStatPath.end())
         {
             throw std::runtime_error("MesoPathMover::resetPath() - new path does not contain current segment");
         }
+        path = MesoPathPool::getInstance().intern(segStatPath);
+        currSegStatIdx = it - segStatPath.begin();
     }
     else
     {
-        path = segStatPath;
-        currSegStatIt = path.begin();
+        path = MesoPathPool::getInstance().intern(segStatPath);
+        currSegStatIdx = 0;
     }
 }
 
+void MesoPathMover::updatePath(const Path& modifiedPath)
+{
+    path = MesoPathPool::getInstance().intern(modifiedPath);
+    currSegStatIdx = std::min(currSegStatIdx, path->size());
+}
+
 void MesoPathMover::buildSegStatsPath(const std::vector<WayPoint> &pathWayPts,
                                       std::vector<const SegmentStats *>& pathSegStats)
 {
@@ -78,19 +88,19 @@ void MesoPathMover::buildSegStatsPath(const std::vector<WayPoint> &pathWayPts,
 
 const SegmentStats* MesoPathMover::getCurrSegStats() const
 {
-    if (currSegStatIt == path.end())
+    if (isPathCompleted())
     {
         return nullptr;
     }
-    return (*currSegStatIt);
+    return (*path)[currSegStatIdx];
 }
 
 void MesoPathMover::setSegmentStatIterator(const SegmentStats* currSegStats)
 {
-    currSegStatIt = std::find(path.begin(),path.end(),currSegStats);
+    currSegStatIdx = std::find(path->begin(), path->end(), currSegStats) - path->begin();
 
 #ifndef NDEBUG
-    if(currSegStatIt == path.end())
+    if(isPathCompleted())
     {
         throw std::runtime_error("Current segment not found in new path");
     }
@@ -99,17 +109,12 @@ void MesoPathMover::setSegmentStatIterator(const SegmentStats* currSegStats)
 
 const SegmentStats* MesoPathMover::getNextSegStats(bool inSameLink) const
 {
-    if (currSegStatIt == path.end())
-    {
-        return nullptr;
-    }
-    Path::iterator nextStatIt = currSegStatIt + 1;
-    if (nextStatIt == path.end())
+    if (currSegStatIdx + 1 >= path->size())
     {
         return nullptr;
     }
-    const SegmentStats* nextSegStats = (*nextStatIt);
-    if (inSameLink && (nextSegStats->getRoadSegment()->getParentLink() != (*currSegStatIt)->getRoadSegment()->getParentLink()))
+    const SegmentStats* nextSegStats = (*path)[currSegStatIdx + 1];
+    if (inSameLink && (nextSegStats->getRoadSegment()->getParentLink() != (*path)[currSegStatIdx]->getRoadSegment()->getParentLink()))
     {
         return nullptr;
     }
@@ -118,32 +123,21 @@ const SegmentStats* MesoPathMover::getNextSegStats(bool inSameLink) const
 
 const SegmentStats* MesoPathMover::getSecondSegStatsAhead() const
 {
-    if (currSegStatIt == path.end())
-    {
-        return nullptr;
-    }
-    Path::iterator statIt = currSegStatIt + 1;
-    if (statIt == path.end())
-    {
-        return nullptr;
-    }
-    statIt++; // currSegStatIt + 2
-    if (statIt == path.end())
+    if (currSegStatIdx + 2 >= path->size())
     {
         return nullptr;
     }
-    return (*statIt);
+    return (*path)[currSegStatIdx + 2];
 }
 
 const SegmentStats* MesoPathMover::getPrevSegStats(bool inSameLink) const
 {
-    if (currSegStatIt == path.begin())
+    if (currSegStatIdx == 0)
     {
         return nullptr;
     }
-    Path::iterator prevStatIt = currSegStatIt - 1;
-    const SegmentStats* prevSegStats = (*prevStatIt);
-    if (inSameLink && (prevSegStats->getRoadSegment()->getParentLink() != (*currSegStatIt)->getRoadSegment()->getParentLink()))
+    const SegmentStats* prevSegStats = (*path)[currSegStatIdx - 1];
+    if (inSameLink && (prevSegStats->getRoadSegment()->getParentLink() != (*path)[currSegStatIdx]->getRoadSegment()->getParentLink()))
     {
         return nullptr;
     }
@@ -155,24 +149,25 @@ void MesoPathMover::erasePathAfterCurrenrLink()
 {
     const SegmentStats* currSegStat = getCurrSegStats();
     const Link *currSegmentParentLink = currSegStat->getRoadSegment()->getParentLink();
-    std::vector<const SegmentStats*>::iterator itr = std::find(path.begin(),path.end(),currSegStat);
-    if(itr != path.end())
+    Path::const_iterator itr = std::find(path->begin(), path->end(), currSegStat);
+    if(itr != path->end())
     {
         itr++;
-        while(itr != path.end() && (*itr)->getRoadSegment()->getParentLink() == currSegmentParentLink)
+        while(itr != path->end() && (*itr)->getRoadSegment()->getParentLink() == currSegmentParentLink)
         {
             itr++;
         }
 
-        if(itr != path.end())
+        if(itr != path->end())
         {
-            path.erase(itr,path.end());
+            updatePath(Path(path->begin(), itr));
         }
     }
 }
 
 void MesoPathMover::appendRoute(std::vector<WayPoint> &routeToTaxiStand)
 {
+    Path modifiedPath(*path);
     std::vector<WayPoint>::iterator itr = routeToTaxiStand.begin();
     while(itr != routeToTaxiStand.end())
     {
@@ -184,19 +179,20 @@ void MesoPathMover::appendRoute(std::vector<WayPoint> &routeToTaxiStand)
         while(segItr != roadSegments.end())
         {
             const std::vector<SegmentStats*>&  segStats = conflux->findSegStats((*segItr));
-            path.insert(path.end(),segStats.begin(),segStats.end());
+            modifiedPath.insert(modifiedPath.end(),segStats.begin(),segStats.end());
             segItr++;
         }
         itr++;
     }
+    updatePath(modifiedPath);
 }
 
 void MesoPathMover::addPathFromCurrentSegmentToEndNodeOfLink()
 {
     const SegmentStats *currStats = getCurrSegStats();
     const RoadSegment *roadSegment = currStats->getRoadSegment();
-    std::vector<const SegmentStats*>::iterator itr = std::find(path.begin(),path.end(),currStats);
-    path.erase(itr+1,path.end());
+    Path::const_iterator itr = std::find(path->begin(), path->end(), currStats);
+    Path modifiedPath(path->begin(), itr + 1);
     const Link *parentLink = currStats->getRoadSegment()->getParentLink();
     const Node *toNode = parentLink->getToNode();
     Conflux * conflux = Conflux::getConfluxFromNode(toNode);
@@ -206,63 +202,58 @@ void MesoPathMover::addPathFromCurrentSegmentToEndNodeOfLink()
     while(segItr != roadSegments.end())
     {
         const std::vector<SegmentStats*> &segStats = conflux->findSegStats(*segItr);
-        path.insert(path.end(),segStats.begin(),segStats.end());
+        modifiedPath.insert(modifiedPath.end(),segStats.begin(),segStats.end());
         segItr++;
     }
+    updatePath(modifiedPath);
 }
 void MesoPathMover::appendSegmentStats(const std::vector<RoadSegment*>& roadSegments,Conflux *conflux)
 {
+    Path modifiedPath(*path);
     std::vector<RoadSegment*>::const_iterator itr = roadSegments.begin();
     while(itr != roadSegments.end())
     {
         const std::vector<SegmentStats*>& segStats = conflux->findSegStats(*itr);
-        path.insert(path.end(),segStats.begin(),segStats.end());
+        modifiedPath.insert(modifiedPath.end(),segStats.begin(),segStats.end());
         itr++;
     }
+    updatePath(modifiedPath);
 }
 
 void MesoPathMover::eraseFullPath()
 {
-    path.erase(path.begin(),path.end());
+    path = MesoPathPool::getInstance().getEmptyPath();
+    currSegStatIdx = 0;
 }
 
 const SegmentStats* MesoPathMover::getFirstSegStatsInNextLink(const SegmentStats* segStats) const
 {
-    if (!segStats || currSegStatIt == path.end())
+    if (!segStats || isPathCompleted())
     {
         return nullptr;
     }
 
-    Path::iterator it = currSegStatIt;
-    int x =0 ;
-    for (; it != path.end(); it++) // locate segStats in downstream path
+    Path::const_iterator it = path->begin() + currSegStatIdx;
+    for (; it != path->end(); it++) // locate segStats in downstream path
     {
         if ((*it) == segStats)
         {
             break;
         }
-        x++;
     }
-    if (it == path.end())
+    if (it == path->end())
     {
         return nullptr;
     }
     const Link* currLink = (*it)->getRoadSegment()->getParentLink(); //note segStats's link
-    const SegmentStats *sStatFound = *(it);
-    const RoadSegment *rdFound = sStatFound->getRoadSegment();
     it++; //start looking from stats after segStats
-    int count =0;
 
-    for (; it != path.end(); it++)
+    for (; it != path->end(); it++)
     {
-        const SegmentStats *segStat = (*it);
-        const RoadSegment *rd = segStat->getRoadSegment();
-        const Link *link = rd->getParentLink();
         if ((*it)->getRoadSegment()->getParentLink() != currLink)
         {
             return (*it);
         } //return if different link is found
-        count++;
     }
     return nullptr;
 }
@@ -270,18 +261,19 @@ const SegmentStats* MesoPathMover::getFirstSegStatsInNextLink(const SegmentStats
 bool MesoPathMover::hasNextSegStats(bool inSameLink) const
 {
 
-    if (currSegStatIt == path.end() || (currSegStatIt + 1) == path.end())
+    if (currSegStatIdx + 1 >= path->size())
     {
         return false;
     }
-    Path::iterator nextStatIt = currSegStatIt + 1;
+    const SegmentStats* currSegStats = (*path)[currSegStatIdx];
+    const SegmentStats* nextSegStats = (*path)[currSegStatIdx + 1];
     if (inSameLink)
     {
-        return ((*currSegStatIt)->getRoadSegment()->getParentLink() == (*nextStatIt)->getRoadSegment()->getParentLink());
+        return (currSegStats->getRoadSegment()->getParentLink() == nextSegStats->getRoadSegment()->getParentLink());
     }
     else
     {
-        return ((*currSegStatIt)->getRoadSegment()->getParentLink() != (*nextStatIt)->getRoadSegment()->getParentLink());
+        return (currSegStats->getRoadSegment()->getParentLink() != nextSegStats->getRoadSegment()->getParentLink());
     }
 }
 
@@ -289,7 +281,7 @@ bool MesoPathMover::isEndOfPath()
 {
     bool retVal = false;
 
-    if (currSegStatIt == path.end()-1)
+    if (currSegStatIdx + 1 == path->size())
     {
         retVal = true;
     }
@@ -299,23 +291,23 @@ bool MesoPathMover::isEndOfPath()
 
 void MesoPathMover::advanceInPath()
 {
-    if (currSegStatIt == path.end())
+    if (isPathCompleted())
     {
         throw std::runtime_error("Error: Attempt to advance in path which is already complete.");
     }
 
     //Move
-    currSegStatIt++;
+    currSegStatIdx++;
 }
 
 bool MesoPathMover::isPathCompleted() const
 {
-    return (currSegStatIt == path.end());
+    return (currSegStatIdx >= path->size());
 }
 
 void MesoPathMover::moveFwdInSegStats(double fwdDisplacement)
 {
-    if (currSegStatIt == path.end())
+    if (isPathCompleted())
     {
         throw std::runtime_error("Error: Attempt to advance in path which is already complete.");
     }
@@ -330,7 +322,7 @@ std::string MesoPathMover::printPath() const
 {
     std::stringstream pathStream;
     pathStream << "SegmentStats path: ";
-    for (Path::const_iterator i = path.begin(); i != path.end(); i++)
+    for (Path::const_iterator i = path->begin(); i != path->end(); i++)
     {
         pathStream << (*i)->getRoadSegment()->getRoadSegmentId() << "-" << (*i)->getStatsNumberInSegment() << "|";
     }
@@ -359,91 +351,29 @@ std::string MesoPathMover::getPathString(const Path &path, const Node *node)
 
 void MesoPathMover::initDriverPathTracking()
 {
-       driverPathTracker.setStartSegmentIterator(currSegStatIt);
+       driverPathTracker.setStartSegmentIndex(currSegStatIdx);
        driverPathTracker.startDistToEndSegment = distToSegmentEnd;
-
-
-//#ifndef NDEBUG
-//		consistencyChecks();
-//#endif
-
-
-//#ifndef NDEBUG
-//       //aa: just to see if he pointer we set is wrong
-//       std::cout<<(*currSegStatIt)->getLength();
-//#endif
 }
 
 void MesoPathMover::finalizeDriverPathTracking()
 {
-       driverPathTracker.setEndSegmentIterator(currSegStatIt);
+       driverPathTracker.setEndSegmentIndex(currSegStatIdx);
        driverPathTracker.endDistToEndSegment = distToSegmentEnd;
-
-//#ifndef NDEBUG
-//		consistencyChecks();
-//#endif
-
-
-
 }
 
-//double MesoPathMover::getDistanceCovered() const
-//{
-//       double distance = 0.0;
-//
-//       if (driverPathTracker.getStartSegmentIterator() == driverPathTracker.getEndSegmentIterator())
-//       {
-//               distance = std::max(driverPathTracker.startDistToEndSegment - driverPathTracker.endDistToEndSegment,0.0);
-//       }
-//       else
-//       {
-//               for (Path::iterator iter = driverPathTracker.getStartSegmentIterator(); (iter != path.end() && iter != driverPathTracker.getEndSegmentIterator()+1 ); ++iter)
-//               {
-//                       if (iter == driverPathTracker.getStartSegmentIterator())
-//                       {
-//                               distance += driverPathTracker.startDistToEndSegment;
-//                       }
-//                       else if (iter == driverPathTracker.getEndSegmentIterator())
-//                       {
-//                               distance += std::max(std::abs( (*iter)->getLength()) - driverPathTracker.endDistToEndSegment,0.0);
-//                       }
-//                       else
-//                       {
-//                    	   if (*(iter) == NULL )
-//                    	   {
-//                    		   std::stringstream ss;
-//                    		   ss << "*iter is null"; throw std::runtime_error(ss.str() );
-//                    	   }
-//                    	   else
-//                    	   {
-//                               distance += std::abs((*iter)->getLength());
-//                    	   }
-//                       }
-//               }
-//       }
-//#ifndef NDEBUG
-//		consistencyChecks();
-//#endif
-//
-//
-//
-//       return distance;
-//}
-
-
 double MesoPathMover::getDistanceCovered() const
 {
 	double distance = 0.0;
 
-	if (driverPathTracker.getStartSegmentIterator() == driverPathTracker.getEndSegmentIterator())
+	if (driverPathTracker.getStartSegmentIndex() == driverPathTracker.getEndSegmentIndex())
 	{
 		distance = std::max(driverPathTracker.startDistToEndSegment - driverPathTracker.endDistToEndSegment,0.0);
 	}
 	else
 	{
-		for (Path::iterator iter = driverPathTracker.getStartSegmentIterator(); iter != driverPathTracker.getEndSegmentIterator(); ++iter)
+		for (size_t idx = driverPathTracker.getStartSegmentIndex(); idx != driverPathTracker.getEndSegmentIndex(); ++idx)
 		{
-			if((iter+1 != path.end())|| iter!=path.end())
+			if((idx+1 != path->size())|| idx!=path->size())
 			{
 				distance += 0.0;
 				break;
@@ -451,17 +381,17 @@ double MesoPathMover::getDistanceCovered() const
 			else
 			{
 
-				if (iter == driverPathTracker.getStartSegmentIterator())
+				if (idx == driverPathTracker.getStartSegmentIndex())
 				{
 					distance += driverPathTracker.startDistToEndSegment;
 				}
-				else if (iter == driverPathTracker.getEndSegmentIterator())
+				else if (idx == driverPathTracker.getEndSegmentIndex())
 				{
-					distance += std::max(std::abs( (*iter)->getLength()) - driverPathTracker.endDistToEndSegment,0.0);
+					distance += std::max(std::abs( (*path)[idx]->getLength()) - driverPathTracker.endDistToEndSegment,0.0);
 				}
 				else
 				{
-					distance += std::abs((*iter)->getLength());
+					distance += std::abs((*path)[idx]->getLength());
 				}
 			}
 
@@ -6,6 +6,7 @@
 #include <vector>
 #include "entities/conflux/SegmentStats.hpp"
 #include "entities/conflux/Conflux.hpp"
+#include "MesoPathPool.hpp"
 
 namespace sim_mob
 {
@@ -15,14 +16,16 @@ class MesoReroute;
 class MesoPathMover
 {
 protected:
-	//Note: Be careful if you want to change the container type of Path.
-	//The functions in this class assume that Path is a container with random
-	//access iterators. They perform operations like it+n where n is an integer.
-	//If random access iterators are not available for Path, this class will
-	//not work as expected.
-	typedef std::vector<const SegmentStats*> Path;
-	Path path;
-	Path::iterator currSegStatIt;
+	typedef MesoPathPool::Path Path;
+
+	//The path is interned in the MesoPathPool and shared with the other drivers
+	//driving the same route. It must not be modified: a changed path is interned
+	//again (see updatePath()).
+	MesoPathPool::PathPtr path;
+
+	//index of the current SegmentStats in path. Equal to the size of the path
+	//when the path is completed
+	size_t currSegStatIdx;
 
 	//representation of position within segment stats
 	double distToSegmentEnd;
@@ -31,10 +34,7 @@ protected:
 
 public:
 	MesoPathMover() :
-			distToSegmentEnd(0)
-//aa{
-	, currSegStatIt(NULL)
-//aa}
+			path(MesoPathPool::getInstance().getEmptyPath()), currSegStatIdx(0), distToSegmentEnd(0)
 	{
 	}
 
@@ -42,33 +42,27 @@ public:
 	struct DriverPathTracker
 	{
 	private:
-		   Path::iterator startSegment;
-		   Path::iterator endSegment;
-#ifndef NDEBUG
-		   double dummyVariable;
-#endif
-
+		   size_t startSegment;
+		   size_t endSegment;
 
 	public:
+		   DriverPathTracker() : startSegment(0), endSegment(0), startDistToEndSegment(0), endDistToEndSegment(0)
+		   {
+		   }
+
 		   double startDistToEndSegment;
 		   double endDistToEndSegment;
-		   Path::iterator getStartSegmentIterator() const {return  startSegment;};
-		   Path::iterator getEndSegmentIterator() const {return  endSegment;};
+		   size_t getStartSegmentIndex() const {return  startSegment;};
+		   size_t getEndSegmentIndex() const {return  endSegment;};
 
-		   void setStartSegmentIterator( Path::iterator  it)
+		   void setStartSegmentIndex(size_t idx)
 		   {
-#ifndef NDEBUG
-			   dummyVariable = (*it)->getLength();
-#endif
-			   startSegment=it;
+			   startSegment=idx;
 		   };
 
-		   void setEndSegmentIterator( Path::iterator  it )
+		   void setEndSegmentIndex(size_t idx)
 		   {
-//#ifndef NDEBUG //jo
-//			  // dummyVariable = (*it)->getLength();
-//#endif
-			   endSegment=it;
+			   endSegment=idx;
 		   }
 
 	};
@@ -92,7 +86,7 @@ public:
 
 	bool isDrivingPathSet() const
 	{
-		return (!path.empty());
+		return (!path->empty());
 	}
 
 	/**
@@ -100,11 +94,26 @@ public:
 	 * @param path the path to be set
 	 */
 	void setPath(const std::vector<const SegmentStats*>& path);
-	const std::vector<const SegmentStats*>  getPath() const;
+
+	/**
+	 * gets the path. The path is shared with the other drivers of the same route
+	 * and stays valid until the path of this MesoPathMover changes
+	 * @return the path
+	 */
+	const std::vector<const SegmentStats*>& getPath() const
+	{
+		return *path;
+	}
+
+	/**
+	 * gets the part of the path from the current SegmentStats to the end of the path
+	 * @return the remaining SegmentStats* of the path; empty if the path is completed
+	 */
+	std::vector<const SegmentStats*> getRemainingPath() const;
 
 	/**
 	 * resets the path. used when the path changes enroute.
-	 * This function changes the path and sets the currSegStatIt to the same
+	 * This function changes the path and sets the current SegmentStats to the same
 	 * SegmentStats* in the new path.
 	 *
 	 * @param newPath the new path to be set
@@ -120,38 +129,38 @@ public:
 	void buildSegStatsPath(const std::vector<WayPoint>& pathWayPts, std::vector<const SegmentStats*>& pathSegStats);
 
 	/**
-	 * gets the SegmentStats* pointed by currSegStatIt in the path
-	 * @return constant pointer to SegmentStats corresponding to currSegStatIt
-	 * 		or nullptr if currSegStatIt points to the end of the path
+	 * gets the SegmentStats* pointed by currSegStatIdx in the path
+	 * @return constant pointer to SegmentStats corresponding to currSegStatIdx
+	 * 		or nullptr if currSegStatIdx points to the end of the path
 	 */
 	const SegmentStats* getCurrSegStats() const;
 
 	void setSegmentStatIterator(const SegmentStats* currSegStats);
 
 	/**
-	 * gets the SegmentStats* corresponding to the element in path next to currSegStatIt
+	 * gets the SegmentStats* corresponding to the element in path next to currSegStatIdx
 	 * @param inSameLink indicates whether the next SegmentStats* is requested
 	 * 		in the same link or adjacent link.
-	 * @return constant pointer to SegmentStats corresponding to currSegStatIt+1
-	 * 		if currSegStatIt and currSegStatIt+1 are not end of path and
+	 * @return constant pointer to SegmentStats corresponding to currSegStatIdx+1
+	 * 		if currSegStatIdx and currSegStatIdx+1 are not end of path and
 	 * 		inSameLink condition is satisfied; nullptr otherwise.
 	 */
 	const SegmentStats* getNextSegStats(bool inSameLink = true) const;
 
 	/**
-	 * gets the SegmentStats* corresponding to the element in path at currSegStatIt+2
-	 * @return constant pointer to SegmentStats corresponding to currSegStatIt+1
-	 * 		if currSegStatIt, currSegStatIt+1 and currSegStatIt+2 are not end of path;
+	 * gets the SegmentStats* corresponding to the element in path at currSegStatIdx+2
+	 * @return constant pointer to SegmentStats corresponding to currSegStatIdx+1
+	 * 		if currSegStatIdx, currSegStatIdx+1 and currSegStatIdx+2 are not end of path;
 	 * 		nullptr otherwise.
 	 */
 	const SegmentStats* getSecondSegStatsAhead() const;
 
 	/**
-	 * gets the SegmentStats* corresponding to the element in path before currSegStatIt
+	 * gets the SegmentStats* corresponding to the element in path before currSegStatIdx
 	 * @param inSameLink indicates whether the previous SegmentStats* is requested
 	 * 		in the same link or adjacent link.
-	 * @return constant pointer to SegmentStats corresponding to currSegStatIt-1
-	 * 		if currSegStatIt is not the first element in path and
+	 * @return constant pointer to SegmentStats corresponding to currSegStatIdx-1
+	 * 		if currSegStatIdx is not the first element in path and
 	 * 		inSameLink condition is satisfied; nullptr otherwise.
 	 */
 	const SegmentStats* getPrevSegStats(bool inSameLink = true) const;
@@ -167,13 +176,13 @@ public:
 	bool isEndOfPath();
 
 	/**
-	 * increments the currSegStatIt
+	 * increments the currSegStatIdx
 	 */
 	void advanceInPath();
 
 	/**
-	 * checks if currSegStatIt has reached the end of path
-	 * @return (currSegStatIt == path.end())
+	 * checks if currSegStatIdx has reached the end of path
+	 * @return (currSegStatIdx == path size)
 	 */
 	bool isPathCompleted() const;
 
@@ -204,20 +213,13 @@ public:
 	///return string of path by aimsun section id
 	static std::string getPathString(const MesoPathMover::Path &path, const Node *node = 0);
 
-
-#ifndef NDEBUG
-	void consistencyChecks() const
-	{
-		if (*currSegStatIt != NULL && ( (currSegStatIt+1) != path.end() || currSegStatIt != path.end() ) )
-		{
-			std::cout<< (*currSegStatIt)->getLength();
-		}
-		//std::cout << "Consistency check for getLength called here; uncomment in MesoPathMover.cpp @ consistencyChecks()" << std::endl;
-	}
-#endif
-
-
-
+private:
+	/**
+	 * replaces the path by the interned copy of a modified path. The index of
+	 * the current SegmentStats is kept
+	 * @param modifiedPath the modified path
+	 */
+	void updatePath(const Path& modifiedPath);
 };
 }
 }
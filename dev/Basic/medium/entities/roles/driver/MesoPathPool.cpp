@@ -0,0 +1,86 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "MesoPathPool.hpp"
+
+#include <vector>
+#include <boost/functional/hash.hpp>
+
+using namespace sim_mob;
+using namespace sim_mob::medium;
+
+MesoPathPool::MesoPathPool() : emptyPath(new Path())
+{
+}
+
+MesoPathPool& MesoPathPool::getInstance()
+{
+	//The pool is never destroyed, as the drivers may release their paths after the static objects are destroyed
+	static MesoPathPool* instance = new MesoPathPool();
+	return *instance;
+}
+
+MesoPathPool::PathPtr MesoPathPool::intern(const Path& path)
+{
+	if (path.empty())
+	{
+		return emptyPath;
+	}
+
+	size_t hash = boost::hash_range(path.begin(), path.end());
+
+	//the paths compared with the given one are held until the pool is unlocked: if their last holder releases them
+	//meanwhile, they are removed from the pool, which locks it
+	std::vector<PathPtr> candidates;
+	boost::mutex::scoped_lock lock(mutex);
+
+	auto range = paths.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		//the last holder of a path may be releasing it. It is then replaced by a new copy
+		PathPtr shared = it->second.ref.lock();
+		if (shared)
+		{
+			if (*shared == path)
+			{
+				return shared;
+			}
+			candidates.push_back(shared);
+		}
+	}
+
+	const Path* copy = new Path(path);
+	PathPtr shared(copy, [this, hash](const Path* released)
+	{
+		release(released, hash);
+		delete released;
+	});
+
+	Entry entry;
+	entry.path = copy;
+	entry.ref = shared;
+	paths.insert(std::make_pair(hash, entry));
+	return shared;
+}
+
+void MesoPathPool::release(const Path* path, size_t hash)
+{
+	boost::mutex::scoped_lock lock(mutex);
+
+	auto range = paths.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second.path == path)
+		{
+			paths.erase(it);
+			return;
+		}
+	}
+}
+
+size_t MesoPathPool::getNumPaths() const
+{
+	boost::mutex::scoped_lock lock(mutex);
+	return paths.size();
+}
@@ -0,0 +1,82 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+
+namespace sim_mob
+{
+namespace medium
+{
+
+class SegmentStats;
+
+/**
+ * Pool of the segment stats paths driven in the mid-term.
+ *
+ * Many drivers are assigned the same route by the path set, so the paths are interned: a path is stored once and
+ * shared by all the drivers driving it. A shared path is never modified; a driver whose path changes interns the new
+ * path. A path is removed from the pool when the last driver holding it releases it.
+ */
+class MesoPathPool : private boost::noncopyable
+{
+public:
+	typedef std::vector<const SegmentStats*> Path;
+	typedef std::shared_ptr<const Path> PathPtr;
+
+	static MesoPathPool& getInstance();
+
+	/**
+	 * Gets the shared copy of a path, adding it to the pool if it is not there
+	 * @param path the path
+	 * @return the shared path, holding the same segment stats as path
+	 */
+	PathPtr intern(const Path& path);
+
+	/**
+	 * @return the empty path
+	 */
+	const PathPtr& getEmptyPath() const
+	{
+		return emptyPath;
+	}
+
+	/**
+	 * @return the number of distinct paths in the pool
+	 */
+	size_t getNumPaths() const;
+
+private:
+	MesoPathPool();
+
+	/**
+	 * Removes a path whose last holder released it
+	 * @param path the path
+	 * @param hash the hash of the path
+	 */
+	void release(const Path* path, size_t hash);
+
+	struct Entry
+	{
+		const Path* path;
+		std::weak_ptr<const Path> ref;
+	};
+
+	/**the paths in the pool, by hash of their segment stats*/
+	std::unordered_multimap<size_t, Entry> paths;
+
+	/**the empty path, shared by the drivers without path*/
+	PathPtr emptyPath;
+
+	/**lock for the pool. paths are interned by the drivers of all the workers*/
+	mutable boost::mutex mutex;
+};
+
+}
+}
@@ -851,7 +851,7 @@ const Node * OnCallDriverBehaviour::chooseDownstreamNode(const Node *fromNode) c
 	//from the current lane
 	if(pathMover.isDrivingPathSet() && currLane)
 	{
-		auto mapTurningsVsLanes = rdNetwork->getTurningPathsFromLanes();
+		const auto &mapTurningsVsLanes = rdNetwork->getTurningPathsFromLanes();
 		auto itTurningsFromCurrLane = mapTurningsVsLanes.find(currLane);
 
 #ifndef NDEBUG
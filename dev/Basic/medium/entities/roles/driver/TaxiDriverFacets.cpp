@@ -667,7 +667,7 @@ void TaxiDriverMovement::selectNextLinkWhileCruising()
 	int minNumOfVisits = -1;
 	const Lane *currLane = getCurrentlane();
 
-	auto turningPathsFromLanes = rdNetwork->getTurningPathsFromLanes();
+	const auto &turningPathsFromLanes = rdNetwork->getTurningPathsFromLanes();
 	auto turningPathsLaneitr = turningPathsFromLanes.find(currLane);
 
 	if (!currLane || turningPathsLaneitr != turningPathsFromLanes.end())
@@ -682,7 +682,6 @@ void TaxiDriverMovement::selectNextLinkWhileCruising()
 			}
 			if (currLane)
 			{
-				std::map<const Lane *, const TurningPath *> mapOfLaneTurningPath = turningPathsLaneitr->second;
 				const std::vector<RoadSegment *> &rdSegments = link->getRoadSegments();
 				const RoadSegment *rdSegment = rdSegments.front();
 				const std::vector<const sim_mob::Lane *> &segLanes = rdSegment->getLanes();
@@ -690,7 +689,7 @@ void TaxiDriverMovement::selectNextLinkWhileCruising()
 				for (std::vector<const sim_mob::Lane *>::const_iterator laneItr = segLanes.begin(); laneItr != segLanes.end();
 				     laneItr++)
 				{
-					if (mapOfLaneTurningPath.find(*laneItr) != mapOfLaneTurningPath.end())
+					if (rdNetwork->getTurningPath(currLane, *laneItr))
 					{
 						foundTurningPath = true;
 						break;
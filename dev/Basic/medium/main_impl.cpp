@@ -35,6 +35,7 @@
 #include "entities/BusStopAgent.hpp"
 #include "entities/TrainStationAgent.hpp"
 #include "entities/ClosedLoopRunManager.hpp"
+#include "entities/MT_Checkpoint.hpp"
 #include "entities/MT_PersonLoader.hpp"
 #include "entities/profile/ProfileBuilder.hpp"
 #include "entities/PT_Statistics.hpp"
@@ -54,6 +55,7 @@
 #include "logging/ControllerLog.hpp"
 #include "partitions/PartitionManager.hpp"
 #include "path/PathSetManager.hpp"
+#include "path/PathSetPrefetcher.hpp"
 #include "path/PathSetParam.hpp"
 #include "path/PT_PathSetManager.hpp"
 #include "path/PT_RouteChoiceLuaModel.hpp"
@@ -326,6 +328,26 @@ bool performMainSupply(const std::string& configFileName, std::list<std::string>
 		Print() << "Energy Model Enabled" << std::endl;
 	}
 
+	//The persons are tracked from their creation when a checkpoint is to be written
+	const CheckpointParams& checkpointParams = mtConfig.checkpointParams;
+	unsigned int checkpointTick = config.totalRuntimeTicks;
+	if (!checkpointParams.fileName.empty())
+	{
+		const DailyTime& simStart = config.simStartTime();
+		if (!checkpointParams.time.isAfter(simStart))
+		{
+			throw std::runtime_error("checkpoint time must be after the start time of the simulation");
+		}
+
+		//the checkpoint is written at the end of the tick ending at the checkpoint time
+		checkpointTick = checkpointParams.time.offsetMS_From(simStart) / config.baseGranMS() - 1;
+		if (checkpointTick >= config.totalRuntimeTicks)
+		{
+			throw std::runtime_error("checkpoint time must be within the simulation run");
+		}
+		MT_Checkpoint::enableTracking();
+	}
+
 	PeriodicPersonLoader *periodicPersonLoader = new MT_PersonLoader(Agent::all_agents, Agent::pending_agents);
 
 	//ScreenLineCounter initialization before Worker creation
@@ -354,6 +376,12 @@ bool performMainSupply(const std::string& configFileName, std::list<std::string>
 	//Load persons for 0th tick
 	periodicPersonLoader->loadPersonDemand();
 
+	//Restore the persons of the checkpoint from which the simulation restarts
+	if (!checkpointParams.restartFileName.empty())
+	{
+		MT_Checkpoint::restore(checkpointParams.restartFileName, Agent::all_agents, Agent::pending_agents);
+	}
+
 	//Initialize each work group individually
 	personWorkers->initWorkers(&entLoader);
 
@@ -404,6 +432,10 @@ bool performMainSupply(const std::string& configFileName, std::list<std::string>
 	//before starting the groups, initialize the time interval for one of the pathset manager's helpers
 	PathSetManager::initTimeInterval();
 
+	//start loading in background the pathsets of the trips about to start
+	PathSetPrefetcher& pathSetPrefetcher = PathSetPrefetcher::getInstance();
+	pathSetPrefetcher.start();
+
 	Print() << "\nDay activity schedule source (store procedure): "
 	        << config.getDatabaseProcMappings().procedureMappings["day_activity_schedule"] << std::endl;
 	Print() << "\nSimulating...\n";
@@ -428,6 +460,7 @@ bool performMainSupply(const std::string& configFileName, std::list<std::string>
 	for (unsigned int currTick = 0; currTick < config.totalRuntimeTicks; currTick++)
 	{
 		const DailyTime dailyTime=ConfigManager::GetInstance().FullConfig().simStartTime()+DailyTime(currTick*5000);
+		pathSetPrefetcher.advance(dailyTime);
 
 		//Output. We show every 10% change. (just to give some indication of progress)
 		int currTickPercent = (currTick * 100) / config.totalRuntimeTicks;
@@ -464,6 +497,12 @@ bool performMainSupply(const std::string& configFileName, std::list<std::string>
 			//removing the trains from the simulation which are to be removed after the finish of frame tick barrier and flip buffer barrier for thread safety
 			TrainRemoval *trainRemovalInstance=TrainRemoval::getInstance();
 			trainRemovalInstance->removeTrainsBeforeNextFrameTick();
+
+			//the workers wait at the barriers, so the persons can be written safely
+			if (currTick == checkpointTick)
+			{
+				MT_Checkpoint::write(checkpointParams.fileName, checkpointParams.time, removedEntities);
+			}
 			TrainServiceControllerLuaProvider::getTrainControllerModel()->useServiceController((dailyTime+DailyTime(5000)).getStrRepr());
 			wgMgr.waitAllGroups_DistributeMessages(removedEntities);
 			wgMgr.waitAllGroups_MacroTimeTick();
@@ -494,6 +533,7 @@ bool performMainSupply(const std::string& configFileName, std::list<std::string>
 	        << DailyTime((uint32_t) loop_time).getStrRepr() << std::endl;
 
 	BusStopAgent::removeAllBusStopAgents();
+	pathSetPrefetcher.stop();
 	sim_mob::PathSetParam::resetInstance();
 
 	//finalize
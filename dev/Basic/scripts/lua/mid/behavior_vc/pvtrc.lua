@@ -76,6 +76,33 @@ end
 --scale
 local scale= 1 --for all choices
 
+-- function to call from C++ to compute the probability of each path
+-- used to check that the native implementation of this model gives the same probabilities
+function compute_PVT_path_probabilities(params, N_choice)
+	computeUtilities(params, N_choice)
+	return calculate_probability("mnl", choice, utility, availability, scale)
+end
+
+-- function to call from C++ to get the coefficients of this model
+-- used by the native implementation of this model (see PrivateRouteChoiceLogit.cpp)
+function get_PVT_path_coefficients()
+	return {
+		bTTVOT = beta_bTTVOT,
+		bCommonFactor = beta_bCommonFactor,
+		bLength = beta_bLength,
+		bHighway = beta_bHighway,
+		bCost = beta_bCost,
+		bSigInter = beta_bSigInter,
+		bLeftTurns = beta_bLeftTurns,
+		bWork = beta_bWork,
+		bLeisure = beta_bLeisure,
+		highwayBias = beta_highwayBias,
+		minDistanceParam = beta_minDistanceParam,
+		minSignalParam = beta_minSignalParam,
+		maxHighwayParam = beta_maxHighwayParam
+	}
+end
+
 -- function to call from C++ preday simulator
 -- params and dbparams tables contain data passed from C++
 -- to check variable bindings in params or dbparams, refer PredayLuaModel::mapClasses() function in dev/Basic/medium/behavioral/lua/PredayLuaModel.cpp
@@ -5,7 +5,6 @@
 #include "BufferedDataManager.hpp"
 
 #include <cassert>
-#include <algorithm>
 
 using namespace sim_mob;
 using std::vector;
@@ -19,8 +18,8 @@ sim_mob::BufferedBase::~BufferedBase() {
 sim_mob::BufferedDataManager::~BufferedDataManager()
 {
     //Stop managing all items
-    while (managedData.begin() != managedData.end()) {
-        stopManaging(*managedData.begin());
+    while (!managedData.empty()) {
+        stopManaging(managedData.back());
     }
 }
 
@@ -28,49 +27,69 @@ sim_mob::BufferedDataManager::~BufferedDataManager()
 
 void sim_mob::BufferedDataManager::beginManaging(BufferedBase* datum)
 {
-    //Only add if we're not managing it already.
-    std::set<BufferedBase*>::iterator it = managedData.find(datum);
-    if (it==managedData.end()) {
-        managedData.insert(datum);
+    //Only add if we're not managing it already. Only the thread handing the datum over changes its manager.
+    BufferedDataManager* previous = datum->manager;
+    if (previous == this) {
+        return;
+    }
 
-        //Helps with debugging.
-        datum->refCount++;
+    //Take it over from its previous manager, which may belong to another worker.
+    if (previous) {
+        previous->stopManaging(datum);
     }
+
+    boost::mutex::scoped_lock lock(managedDataMutex);
+    assert(!datum->manager);   //Error if two managers take over the datum at the same time.
+
+    datum->manager = this;
+    datum->managerIndex = managedData.size();
+    managedData.push_back(datum);
+
+    //Helps with debugging.
+    datum->refCount++;
 }
 
 void sim_mob::BufferedDataManager::stopManaging(BufferedBase* datum)
 {
-    //Only remove if we are actually managing it.
-    std::set<BufferedBase*>::iterator it = managedData.find(datum);
-    if (it!=managedData.end()) {
-        managedData.erase(it);
+    boost::mutex::scoped_lock lock(managedDataMutex);
 
-        //Helps with debugging.
-        datum->refCount--;
+    //Only remove if we are actually managing it.
+    if (datum->manager != this) {
+        return;
     }
+
+    //Move the last item to the position of the removed one.
+    BufferedBase* last = managedData.back();
+    managedData[datum->managerIndex] = last;
+    last->managerIndex = datum->managerIndex;
+    managedData.pop_back();
+
+    //The datum is not flipped until it is managed again, but keeps its next value.
+    datum->manager = nullptr;
+    datum->managerIndex = 0;
+
+    //Helps with debugging.
+    datum->refCount--;
 }
 
-void sim_mob::BufferedDataManager::beginManaging(vector<BufferedBase*> data)
+void sim_mob::BufferedDataManager::beginManaging(const vector<BufferedBase*>& data)
 {
-    for (vector<sim_mob::BufferedBase*>::iterator it=data.begin(); it!=data.end(); it++) {
+    for (vector<sim_mob::BufferedBase*>::const_iterator it=data.begin(); it!=data.end(); it++) {
         beginManaging(*it);
     }
 }
 
-void sim_mob::BufferedDataManager::stopManaging(vector<BufferedBase*> data)
+void sim_mob::BufferedDataManager::stopManaging(const vector<BufferedBase*>& data)
 {
-    for (vector<sim_mob::BufferedBase*>::iterator it=data.begin(); it!=data.end(); it++) {
+    for (vector<sim_mob::BufferedBase*>::const_iterator it=data.begin(); it!=data.end(); it++) {
         stopManaging(*it);
     }
 }
 
-
 void sim_mob::BufferedDataManager::flip()
 {
-    for (std::set<BufferedBase*>::iterator it=managedData.begin(); it!=managedData.end(); it++) {
+    boost::mutex::scoped_lock lock(managedDataMutex);
+    for (vector<BufferedBase*>::iterator it=managedData.begin(); it!=managedData.end(); it++) {
         (*it)->flip();
     }
 }
-
-
-
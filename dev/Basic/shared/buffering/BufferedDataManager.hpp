@@ -7,6 +7,7 @@
 #include <set>
 #include <vector>
 #include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
 
 namespace sim_mob
 {
@@ -41,7 +42,7 @@ class BufferedDataManager;
 class BufferedBase : private boost::noncopyable
 {
 protected:
-    BufferedBase() : refCount(0) {}
+    BufferedBase() : manager(nullptr), managerIndex(0), refCount(0) {}
     virtual ~BufferedBase();
 
     /**
@@ -55,6 +56,10 @@ protected:
     friend class BufferedDataManager;
 
 private:
+    ///The BufferedDataManager of this datum and its position in the managed data of the manager.
+    BufferedDataManager* manager;
+    size_t managerIndex;
+
     ///Count of BufferedDataManagers accessing this Buffered type.
     ///Helps catch harder-to-debug errors further down the line.
     unsigned int refCount;
@@ -66,6 +71,10 @@ private:
  * updates their current values each time flip() is called. Calling flip() multiple times
  * in a row (without calling each datum's "set()" method in between) has undefined behavior.
  *
+ * A datum is managed by one manager at a time: beginManaging() takes it over from its previous
+ * manager, keeping its current and next values. Workers hand data over to each other during the
+ * update phase, so the managed data of each manager are guarded by a mutex.
+ *
  * \todo
  * It seems sensible to have beginManaging() add the datum to a static array of raw "data", using
  * the "size" of the buffered type. The next_ and current_ values can then be represented by two
@@ -89,15 +98,20 @@ public:
     void stopManaging(BufferedBase* datum);
 
     //For multiple items
-    void beginManaging(std::vector<BufferedBase*> data);
-    void stopManaging(std::vector<BufferedBase*> data);
+    void beginManaging(const std::vector<BufferedBase*>& data);
+    void stopManaging(const std::vector<BufferedBase*>& data);
 
     ///Flip (update the current value of) all buffered data items under your control.
     void flip();
 
 
 protected:
-    std::set<BufferedBase*> managedData;
+    ///Managed data items. Each item holds its index in this vector, so it can be removed without searching.
+    std::vector<BufferedBase*> managedData;
+
+private:
+    ///Guards managedData, and the manager and index of the managed data.
+    boost::mutex managedDataMutex;
 };
 
 
@@ -317,10 +317,18 @@ void ParseConfigFile::processLongTermParamsNode(xercesc::DOMElement *node)
 			ParseUnsignedInt(GetNamedAttributeValue(GetSingleElementByName(
 					node, "opSchemaloadingInterval"), "value"), (unsigned int) 0);
 
+	cfg.ltParams.opSchemaWriters =
+			ParseUnsignedInt(GetNamedAttributeValue(GetSingleElementByName(
+					node, "opSchemaloadingInterval"), "writers", false), (unsigned int) 1);
+
 	cfg.ltParams.initialLoading =
 			ParseBoolean(GetNamedAttributeValue(GetSingleElementByName(
 					node, "initialLoading"), "value"), false);
 
+	cfg.ltParams.startupLoaders =
+			ParseUnsignedInt(GetNamedAttributeValue(GetSingleElementByName(
+					node, "initialLoading"), "loaders", false), (unsigned int) 1);
+
 	cfg.ltParams.launchBTO =
 				ParseBoolean(GetNamedAttributeValue(GetSingleElementByName(
 						node, "launchBTO"), "value"), false);
@@ -332,6 +340,17 @@ void ParseConfigFile::processLongTermParamsNode(xercesc::DOMElement *node)
 	processDeveloperModelNode(GetSingleElementByName(node, "developerModel"));
 	processHousingModelNode(GetSingleElementByName(node, "housingModel"));
 	processHouseHoldLogsumsNode(GetSingleElementByName(node, "outputHouseholdLogsums"));
+
+	LongTermParams::LogsumCache logsumCache;
+
+	logsumCache.enabled =
+			ParseBoolean(GetNamedAttributeValue(GetSingleElementByName(node, "logsumCache"), "enabled", false), true);
+
+	logsumCache.file =
+			ParseString(GetNamedAttributeValue(GetSingleElementByName(node, "logsumCache"), "file", false), "");
+
+	cfg.ltParams.logsumCache = logsumCache;
+
 	processVehicleOwnershipModelNode(GetSingleElementByName(node, "vehicleOwnershipModel"));
 
 	LongTermParams::TaxiAccessModel taxiAccessModel;
@@ -354,6 +373,9 @@ void ParseConfigFile::processOutputFilesNode(xercesc::DOMElement *output)
 	outputFiles.enabled =
 			ParseBoolean(GetNamedAttributeValue(output, "enabled"), false);
 
+	outputFiles.compress =
+			ParseBoolean(GetNamedAttributeValue(output, "compress", false), false);
+
 	outputFiles.bids =
 			ParseBoolean(GetNamedAttributeValue(GetSingleElementByName(
 					output, "bids"), "value"), false);
@@ -972,6 +994,14 @@ void sim_mob::ParseConfigFile::processMobilityServiceControllerNode(DOMElement *
                         ParseUnsignedInt(GetNamedAttributeValue(*it, "maxWaitingTime"));
                 bool parkingEnabled =
                         ParseBoolean(GetNamedAttributeValue(*it, "parkingEnabled"));
+                unsigned int threadPoolSize =
+                        ParseUnsignedInt(GetNamedAttributeValue(*it, "threadPoolSize", false), 1u);
+                bool waitingTimePruning =
+                        ParseBoolean(GetNamedAttributeValue(*it, "waitingTimePruning", false), false);
+                bool ilpAssignment =
+                        ParseBoolean(GetNamedAttributeValue(*it, "ilpAssignment", false), false);
+                unsigned int ilpTimeLimit =
+                        ParseUnsignedInt(GetNamedAttributeValue(*it, "ilpTimeLimit", false), 0u);
 
 
                 if (cfg.mobilityServiceController.enabledControllers.count(key) > 0)
@@ -994,6 +1024,10 @@ void sim_mob::ParseConfigFile::processMobilityServiceControllerNode(DOMElement *
                     vcc.toleratedExtraTime = toleratedExtraTime;
                     vcc.maxWaitingTime = maxWaitingTime;
                     vcc.parkingEnabled = parkingEnabled;
+                    vcc.threadPoolSize = (threadPoolSize > 0) ? threadPoolSize : 1;
+                    vcc.waitingTimePruning = waitingTimePruning;
+                    vcc.ilpAssignment = ilpAssignment;
+                    vcc.ilpTimeLimit = ilpTimeLimit;
                     cfg.mobilityServiceController.enabledControllers[key] = vcc;
                 }
             }
@@ -17,8 +17,8 @@ sim_mob::SimulationParams::SimulationParams() :
 {}
 
 
-sim_mob::LongTermParams::LongTermParams(): enabled(false), workers(0), days(0), tickStep(0), maxIterations(0),year(0),resume(false),currentOutputSchema(std::string()),mainSchemaVersion(std::string()),configSchemaVersion(std::string()),calibrationSchemaVersion(std::string()),geometrySchemaVersion(std::string()),opSchemaloadingInterval(0)
-                                           ,initialLoading(false), launchBTO(false), launchPrivatePresale(false){}
+sim_mob::LongTermParams::LongTermParams(): enabled(false), workers(0), days(0), tickStep(0), maxIterations(0),year(0),resume(false),currentOutputSchema(std::string()),mainSchemaVersion(std::string()),configSchemaVersion(std::string()),calibrationSchemaVersion(std::string()),geometrySchemaVersion(std::string()),opSchemaloadingInterval(0),opSchemaWriters(1)
+                                           ,initialLoading(false), startupLoaders(1), launchBTO(false), launchPrivatePresale(false){}
 sim_mob::LongTermParams::DeveloperModel::DeveloperModel(): enabled(false), timeInterval(0), initialPostcode(0),initialUnitId(0),initialBuildingId(0),
                                                             initialProjectId(0),minLotSize(0), constructionStartDay(0), saleFromDay(0),occupancyFromDay(0), constructionCompletedDay(0) {}
 sim_mob::LongTermParams::HousingModel::HousingModel(): enabled(false), timeInterval(0), timeOnMarket(0), timeOffMarket(0), wtpOffsetEnabled(false),unitsFiltering(false),vacantUnitActivationProbability(0),
@@ -39,6 +39,8 @@ sim_mob::LongTermParams::HousingModel::HedonicPriceModel::HedonicPriceModel(): a
 
 sim_mob::LongTermParams::OutputHouseholdLogsums::OutputHouseholdLogsums():enabled(false), fixedHomeVariableWork(false), fixedWorkVariableHome(false), vehicleOwnership(false), hitsRun(false), maxcCost(false), maxTime(false){}
 
+sim_mob::LongTermParams::LogsumCache::LogsumCache():enabled(true), file(){}
+
 sim_mob::LongTermParams::VehicleOwnershipModel::VehicleOwnershipModel():enabled(false), vehicleBuyingWaitingTimeInDays(0){}
 sim_mob::LongTermParams::TaxiAccessModel::TaxiAccessModel():enabled(false){}
 sim_mob::LongTermParams::SchoolAssignmentModel::SchoolAssignmentModel():enabled(false), schoolChangeWaitingTimeInDays(0){}
@@ -69,7 +71,8 @@ sim_mob::LongTermParams::OutputFiles::OutputFiles(): bids(false),
                                                      log_dev_roi(false),
                                                      log_household_statistics(false),
                                                      log_out_xx_files(true),
-                                                     enabled(false){}
+                                                     enabled(false),
+                                                     compress(false){}
 
 
 sim_mob::LongTermParams::Scenario::Scenario():  enabled(false),scenarioName(""),parcelsTable(""),scenarioSchema(""),hedonicModel(false),willingnessToPayModel(false){}
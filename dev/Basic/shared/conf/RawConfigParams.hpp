@@ -52,7 +52,9 @@ struct LongTermParams
 	std::string calibrationSchemaVersion;
 	std::string geometrySchemaVersion;
 	unsigned int opSchemaloadingInterval;
+	unsigned int opSchemaWriters; ///number of tables written in parallel to the output schema
 	bool initialLoading;
+	unsigned int startupLoaders; ///number of tables loaded in parallel when the models start
 	bool launchBTO;
 	bool launchPrivatePresale;
 
@@ -134,6 +136,15 @@ struct LongTermParams
 		bool maxTime;
 	} outputHouseholdLogsums;
 
+	struct LogsumCache
+	{
+		LogsumCache();
+		bool enabled;
+
+		/** file the cached logsums are loaded from at startup and saved to at the end of the run (none if empty)*/
+		std::string file;
+	} logsumCache;
+
 	struct VehicleOwnershipModel{
 		VehicleOwnershipModel();
 		bool enabled;
@@ -188,6 +199,9 @@ struct LongTermParams
         bool log_out_xx_files;
         bool enabled;
 
+        /** if true, the output files are compressed with gzip*/
+        bool compress;
+
 	}outputFiles;
 
 	struct Scenario
@@ -471,9 +485,11 @@ struct PathSetConf
      * Constructor
      */
 	PathSetConf() : enabled(false), supplyLinkFile(""), RTTT_Conf(""), DTT_Conf(""), psRetrievalWithoutBannedRegion(""), interval(0), recPS(false), reroute(false),
-			perturbationRange(std::pair<unsigned short,unsigned short>(0,0)), kspLevel(0),
+			perturbationRange(std::pair<unsigned short,unsigned short>(0,0)), kspLevel(0), kspThreads(1),
 			perturbationIteration(0), threadPoolSize(0), maxSegSpeed(0), publickShortestPathLevel(10), simulationApproachIterations(10),
-			publicPathSetEnabled(true), privatePathSetEnabled(true)
+			publicPathSetEnabled(true), privatePathSetEnabled(true), privateRouteChoiceEvaluator("lua"),
+			prefetchEnabled(false), prefetchLookahead(0), prefetchThreads(1), publicRoundBasedRouting(false),
+			publicRoundBasedBagSize(3)
 	{}
 
     /// Whether pathset enabled
@@ -485,6 +501,20 @@ struct PathSetConf
     /// pathset operation mode "normal" , "generation"(for bulk pathset generation)
     std::string privatePathSetMode;
 
+    /// private route choice evaluator: "lua" (choose_PVT_path in pvtrc.lua), "native" (C++ implementation of the same
+    /// model) or "parity" (both, checking that they give the same probabilities and choices)
+    std::string privateRouteChoiceEvaluator;
+
+    /// Whether the private pathsets of the trips departing within the next prefetchLookahead seconds are loaded
+    /// in background, before the drivers request their paths
+    bool prefetchEnabled;
+
+    /// prefetch lookahead, in seconds
+    unsigned int prefetchLookahead;
+
+    /// number of threads loading the prefetched pathsets
+    unsigned int prefetchThreads;
+
     /// Whether public pathset enabled
 	bool publicPathSetEnabled;
 
@@ -504,6 +534,13 @@ struct PathSetConf
     /// Num of simulation approach iterations
 	int simulationApproachIterations;
 
+    /// Whether the public pathsets are generated by the round-based router (PT_RoundBasedRouter) instead of the
+    /// k-shortest path, labelling, link elimination and simulation approaches
+    bool publicRoundBasedRouting;
+
+    /// Number of labels kept at each vertex by the round-based router
+    unsigned int publicRoundBasedBagSize;
+
     /// thread pool size for pathset generation
 	int threadPoolSize;
 
@@ -546,6 +583,9 @@ struct PathSetConf
     ///k-shortest path level
 	int kspLevel;
 
+    /// number of threads computing the spur paths of a k-shortest path search
+	unsigned int kspThreads;
+
     /// Link Elimination types
 	std::vector<std::string> LE;
 
@@ -705,7 +745,21 @@ struct MobilityServiceControllerConfig
     unsigned int maxWaitingTime;
     bool parkingEnabled;
 
-	MobilityServiceControllerConfig() : type(SERVICE_CONTROLLER_UNKNOWN), scheduleComputationPeriod(0), tripSupportMode(""),maxAggregatedRequests(0),studyAreaEnabledController(false),toleratedExtraTime(0),maxWaitingTime(0),parkingEnabled(false) {}
+    /// Number of threads used by the controller to compute the schedules (only supported by the Frazzoli controller)
+    unsigned int threadPoolSize;
+
+    /// Whether the graphs of the Frazzoli controller are pruned with maxWaitingTime. This tightens the sharing
+    /// constraints: the pairs of requests whose pick ups are further apart than the remaining waiting time, and the
+    /// drivers further than maxWaitingTime from a pick up, are not considered any more
+    bool waitingTimePruning;
+
+    /// Whether the assignment is computed by solving an integer linear program (only supported by the Frazzoli controller)
+    bool ilpAssignment;
+
+    /// Time limit of the integer linear program, in milliseconds. If 0, the schedule computation period is used
+    unsigned int ilpTimeLimit;
+
+	MobilityServiceControllerConfig() : type(SERVICE_CONTROLLER_UNKNOWN), scheduleComputationPeriod(0), tripSupportMode(""),maxAggregatedRequests(0),studyAreaEnabledController(false),toleratedExtraTime(0),maxWaitingTime(0),parkingEnabled(false),threadPoolSize(1),waitingTimePruning(false),ilpAssignment(false),ilpTimeLimit(0) {}
 };
 
 /**
@@ -140,4 +140,13 @@ std::string DB_Connection::getConnectionStr()
     return this->connectionStr;
 }
 
+pg_conn* DB_Connection::getPostgresConnection()
+{
+    if (!connected || type != POSTGRES)
+    {
+        return nullptr;
+    }
+    return static_cast<soci::postgresql_session_backend*>(getSession<soci::session>().get_backend())->conn_;
+}
+
 template soci::session& DB_Connection::getSession<soci::session>();
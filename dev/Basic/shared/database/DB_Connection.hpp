@@ -6,6 +6,8 @@
 
 #include "DB_Config.hpp"
 
+struct pg_conn;
+
 namespace sim_mob
 {
 
@@ -61,6 +63,12 @@ public:
     void setSchema(std::string _schema);
     std::string getSchema();
 
+    /**
+     * Gets the libpq connection of the current session.
+     * @return the connection, or nullptr if not connected to a POSTGRES database.
+     */
+    pg_conn* getPostgresConnection();
+
 private:
     void* currentSession;
     std::string connectionStr;
@@ -1,10 +1,309 @@
 #include "PG_BulkInserter.hpp"
 
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <stdint.h>
+#include <boost/lexical_cast.hpp>
 #include "logging/Log.hpp"
 
 using namespace sim_mob;
 
-PG_BulkInserter::PG_BulkInserter(const int numInsertsPerQuery) : numInsertsPerQuery(numInsertsPerQuery), query("")
+namespace
+{
+/// oids of the column types supported by the binary format (see pg_type.h)
+const Oid BOOL_OID = 16;
+const Oid INT8_OID = 20;
+const Oid INT2_OID = 21;
+const Oid INT4_OID = 23;
+const Oid TEXT_OID = 25;
+const Oid FLOAT4_OID = 700;
+const Oid FLOAT8_OID = 701;
+const Oid BPCHAR_OID = 1042;
+const Oid VARCHAR_OID = 1043;
+const Oid DATE_OID = 1082;
+const Oid TIMESTAMP_OID = 1114;
+
+/// the buffered rows are sent to the server when the buffer exceeds this size
+const size_t COPY_BUFFER_SIZE = 1 << 20;
+
+/// binary COPY header: signature, flags and header extension length
+const char BINARY_COPY_HEADER[] = "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0";
+const size_t BINARY_COPY_HEADER_SIZE = 19;
+
+/// days from 1970-01-01 to 2000-01-01, the epoch of the binary date and timestamp types
+const long POSTGRES_EPOCH_DAYS = 10957;
+const int64_t MICROSECONDS_IN_DAY = 86400000000LL;
+
+void appendInt16(std::string& buffer, int16_t value)
+{
+    uint16_t bits = static_cast<uint16_t>(value);
+    buffer.push_back(static_cast<char>(bits >> 8));
+    buffer.push_back(static_cast<char>(bits));
+}
+
+void appendInt32(std::string& buffer, int32_t value)
+{
+    uint32_t bits = static_cast<uint32_t>(value);
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        buffer.push_back(static_cast<char>(bits >> shift));
+    }
+}
+
+void appendInt64(std::string& buffer, int64_t value)
+{
+    uint64_t bits = static_cast<uint64_t>(value);
+    for (int shift = 56; shift >= 0; shift -= 8)
+    {
+        buffer.push_back(static_cast<char>(bits >> shift));
+    }
+}
+
+/**
+ * number of days from 1970-01-01 to the given date of the proleptic gregorian calendar
+ */
+long daysFromCivil(long year, unsigned month, unsigned day)
+{
+    year -= (month <= 2);
+    const long era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+    const unsigned dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<long>(dayOfEra) - 719468;
+}
+
+/**
+ * number of days from 2000-01-01 to the date of the given time
+ */
+long toPostgresDays(const std::tm& time)
+{
+    return daysFromCivil(time.tm_year + 1900, time.tm_mon + 1, time.tm_mday) - POSTGRES_EPOCH_DAYS;
+}
+
+/**
+ * time formatted the way soci binds it in a statement
+ */
+std::string formatTime(const std::tm& time)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d", time.tm_year + 1900, time.tm_mon + 1, time.tm_mday,
+                  time.tm_hour, time.tm_min, time.tm_sec);
+    return buffer;
+}
+
+bool isTextType(Oid type)
+{
+    return type == TEXT_OID || type == VARCHAR_OID || type == BPCHAR_OID;
+}
+
+bool isNumericType(Oid type)
+{
+    return type == BOOL_OID || type == INT2_OID || type == INT4_OID || type == INT8_OID || type == FLOAT4_OID
+            || type == FLOAT8_OID;
+}
+
+/**
+ * Visitor telling whether a value can be written in binary format to a column of the given type
+ */
+class BinaryTypeChecker : public boost::static_visitor<bool>
+{
+public:
+    BinaryTypeChecker(Oid type) : type(type)
+    {
+    }
+
+    template<typename T>
+    bool operator()(const T& value) const
+    {
+        return isNumericType(type) || isTextType(type);
+    }
+
+    bool operator()(const std::string& value) const
+    {
+        return isTextType(type);
+    }
+
+    bool operator()(const std::tm& value) const
+    {
+        return type == DATE_OID || type == TIMESTAMP_OID || isTextType(type);
+    }
+
+private:
+    Oid type;
+};
+
+/**
+ * Visitor formatting a value for the text format of COPY
+ */
+class TextFormatter : public boost::static_visitor<std::string>
+{
+public:
+    template<typename T>
+    std::string operator()(const T& value) const
+    {
+        return boost::lexical_cast<std::string>(value);
+    }
+
+    std::string operator()(const std::string& value) const
+    {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (std::string::const_iterator it = value.begin(); it != value.end(); ++it)
+        {
+            switch (*it)
+            {
+            case '\\': escaped.append("\\\\"); break;
+            case '\t': escaped.append("\\t"); break;
+            case '\n': escaped.append("\\n"); break;
+            case '\r': escaped.append("\\r"); break;
+            default: escaped.push_back(*it); break;
+            }
+        }
+        return escaped;
+    }
+
+    std::string operator()(const std::tm& value) const
+    {
+        return formatTime(value);
+    }
+};
+
+/**
+ * Visitor appending a value in binary format, converted to the type of its column.
+ * The value must have been accepted by BinaryTypeChecker
+ */
+class BinaryWriter : public boost::static_visitor<>
+{
+public:
+    BinaryWriter(std::string& buffer, Oid type) : buffer(buffer), type(type)
+    {
+    }
+
+    void operator()(int value) const
+    {
+        appendInteger(value);
+    }
+
+    void operator()(long long value) const
+    {
+        appendInteger(value);
+    }
+
+    void operator()(unsigned long value) const
+    {
+        appendInteger(static_cast<long long>(value));
+    }
+
+    void operator()(double value) const
+    {
+        switch (type)
+        {
+        case FLOAT4_OID:
+        case FLOAT8_OID:
+            appendReal(value);
+            break;
+        case BOOL_OID:
+        case INT2_OID:
+        case INT4_OID:
+        case INT8_OID:
+            appendInteger(static_cast<long long>(value));
+            break;
+        default:
+            appendText(boost::lexical_cast<std::string>(value));
+            break;
+        }
+    }
+
+    void operator()(const std::string& value) const
+    {
+        appendText(value);
+    }
+
+    void operator()(const std::tm& value) const
+    {
+        switch (type)
+        {
+        case DATE_OID:
+            appendInt32(buffer, 4);
+            appendInt32(buffer, static_cast<int32_t>(toPostgresDays(value)));
+            break;
+        case TIMESTAMP_OID:
+        {
+            const int64_t seconds = value.tm_hour * 3600 + value.tm_min * 60 + value.tm_sec;
+            appendInt32(buffer, 8);
+            appendInt64(buffer, toPostgresDays(value) * MICROSECONDS_IN_DAY + seconds * 1000000);
+            break;
+        }
+        default:
+            appendText(formatTime(value));
+            break;
+        }
+    }
+
+private:
+    void appendInteger(long long value) const
+    {
+        switch (type)
+        {
+        case BOOL_OID:
+            appendInt32(buffer, 1);
+            buffer.push_back(value != 0 ? 1 : 0);
+            break;
+        case INT2_OID:
+            appendInt32(buffer, 2);
+            appendInt16(buffer, static_cast<int16_t>(value));
+            break;
+        case INT4_OID:
+            appendInt32(buffer, 4);
+            appendInt32(buffer, static_cast<int32_t>(value));
+            break;
+        case INT8_OID:
+            appendInt32(buffer, 8);
+            appendInt64(buffer, value);
+            break;
+        case FLOAT4_OID:
+        case FLOAT8_OID:
+            appendReal(static_cast<double>(value));
+            break;
+        default:
+            appendText(boost::lexical_cast<std::string>(value));
+            break;
+        }
+    }
+
+    void appendReal(double value) const
+    {
+        if (type == FLOAT4_OID)
+        {
+            float single = static_cast<float>(value);
+            uint32_t bits;
+            std::memcpy(&bits, &single, sizeof(bits));
+            appendInt32(buffer, 4);
+            appendInt32(buffer, static_cast<int32_t>(bits));
+        }
+        else
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            appendInt32(buffer, 8);
+            appendInt64(buffer, static_cast<int64_t>(bits));
+        }
+    }
+
+    void appendText(const std::string& value) const
+    {
+        appendInt32(buffer, static_cast<int32_t>(value.size()));
+        buffer.append(value);
+    }
+
+    std::string& buffer;
+    Oid type;
+};
+}
+
+PG_BulkInserter::PG_BulkInserter(const int numInsertsPerQuery) : inputFile(nullptr), query(""), connection(nullptr),
+        numInsertsPerQuery(numInsertsPerQuery), binaryFormat(false)
 {
 
 }
@@ -12,6 +311,11 @@ PG_BulkInserter::PG_BulkInserter(const int numInsertsPerQuery) : numInsertsPerQu
 PG_BulkInserter::~PG_BulkInserter()
 {
     delete inputFile;
+
+    if (connection)
+    {
+        PQfinish(connection);
+    }
 }
 
 bool PG_BulkInserter::connect(const std::string &connectionStr)
@@ -73,7 +377,7 @@ bool PG_BulkInserter::bulkInsert()
         }
     }
 
-    copyToDB(streamBuf);
+    return copyToDB(streamBuf);
 }
 
 bool PG_BulkInserter::copyToDB(const std::string& buffer)
@@ -111,3 +415,138 @@ bool PG_BulkInserter::copyToDB(const std::string& buffer)
 
     return retVal;
 }
+
+bool PG_BulkInserter::beginCopy(const std::string& tableName, const std::vector<std::string>& columnNames)
+{
+    if (!connection || tableName.empty() || columnNames.empty())
+    {
+        return false;
+    }
+
+    std::string columns;
+    for (std::vector<std::string>::const_iterator it = columnNames.begin(); it != columnNames.end(); ++it)
+    {
+        columns += (it == columnNames.begin() ? "" : ",") + *it;
+    }
+
+    //the types of the columns decide whether the binary format can be used
+    PGresult* res = PQexec(connection, ("SELECT " + columns + " FROM " + tableName + " LIMIT 0").c_str());
+    if (PQresultStatus(res) != PGRES_TUPLES_OK)
+    {
+        Print() << "PG_BulkInserter: " << PQerrorMessage(connection);
+        PQclear(res);
+        return false;
+    }
+
+    columnTypes.clear();
+    binaryFormat = true;
+    for (int i = 0; i < PQnfields(res); ++i)
+    {
+        columnTypes.push_back(PQftype(res, i));
+        binaryFormat = binaryFormat && (isNumericType(columnTypes.back()) || isTextType(columnTypes.back())
+                || columnTypes.back() == DATE_OID || columnTypes.back() == TIMESTAMP_OID);
+    }
+    PQclear(res);
+
+    query = "COPY " + tableName + "(" + columns + ") FROM STDIN" + (binaryFormat ? " WITH (FORMAT binary)" : "");
+    res = PQexec(connection, query.c_str());
+    const bool started = (PQresultStatus(res) == PGRES_COPY_IN);
+    PQclear(res);
+
+    if (!started)
+    {
+        Print() << "PG_BulkInserter: Copy Failed " << PQerrorMessage(connection);
+        return false;
+    }
+
+    copyBuffer.clear();
+    if (binaryFormat)
+    {
+        copyBuffer.append(BINARY_COPY_HEADER, BINARY_COPY_HEADER_SIZE);
+    }
+    return true;
+}
+
+bool PG_BulkInserter::putRow(const db::Parameters& row)
+{
+    if (row.size() != columnTypes.size())
+    {
+        Print() << "PG_BulkInserter: row has " << row.size() << " values for " << columnTypes.size() << " columns\n";
+        return false;
+    }
+
+    if (binaryFormat)
+    {
+        for (size_t i = 0; i < row.size(); ++i)
+        {
+            if (!boost::apply_visitor(BinaryTypeChecker(columnTypes[i]), row[i]))
+            {
+                Print() << "PG_BulkInserter: value " << (i + 1) << " does not match the type of its column\n";
+                return false;
+            }
+        }
+
+        appendInt16(copyBuffer, static_cast<int16_t>(row.size()));
+        for (size_t i = 0; i < row.size(); ++i)
+        {
+            boost::apply_visitor(BinaryWriter(copyBuffer, columnTypes[i]), row[i]);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < row.size(); ++i)
+        {
+            if (i > 0)
+            {
+                copyBuffer.push_back('\t');
+            }
+            copyBuffer.append(boost::apply_visitor(TextFormatter(), row[i]));
+        }
+        copyBuffer.push_back('\n');
+    }
+
+    return copyBuffer.size() < COPY_BUFFER_SIZE || flushCopyBuffer();
+}
+
+bool PG_BulkInserter::endCopy()
+{
+    if (binaryFormat)
+    {
+        appendInt16(copyBuffer, -1);
+    }
+
+    bool retVal = flushCopyBuffer();
+    if (PQputCopyEnd(connection, retVal ? nullptr : "PG_BulkInserter: copy aborted") != 1)
+    {
+        Print() << "PG_BulkInserter: " << PQerrorMessage(connection);
+        retVal = false;
+    }
+
+    PGresult* res;
+    while ((res = PQgetResult(connection)) != nullptr)
+    {
+        if (PQresultStatus(res) != PGRES_COMMAND_OK)
+        {
+            Print() << "PG_BulkInserter: " << PQerrorMessage(connection);
+            retVal = false;
+        }
+        PQclear(res);
+    }
+
+    columnTypes.clear();
+    return retVal;
+}
+
+bool PG_BulkInserter::flushCopyBuffer()
+{
+    bool retVal = true;
+
+    if (!copyBuffer.empty() && PQputCopyData(connection, copyBuffer.data(), static_cast<int>(copyBuffer.size())) != 1)
+    {
+        Print() << "PG_BulkInserter: " << PQerrorMessage(connection);
+        retVal = false;
+    }
+
+    copyBuffer.clear();
+    return retVal;
+}
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <libpq-fe.h>
+#include "database/dao/I_Dao.hpp"
 
 namespace sim_mob
 {
@@ -22,6 +23,29 @@ public:
     bool setInputFile(const std::string& inputFile);
 
     bool bulkInsert();
+
+    /**
+     * Starts a COPY of the rows supplied through putRow() into the given columns of a table.
+     * The rows are sent in binary format if the types of all the columns are supported, in text format otherwise.
+     * @param tableName name of the table, including its schema
+     * @param columnNames columns to fill, in the order of the row values
+     * @return true if the copy could be started
+     */
+    bool beginCopy(const std::string& tableName, const std::vector<std::string>& columnNames);
+
+    /**
+     * Adds a row to the current COPY. The values are converted to the types of the columns
+     * @param row values of the row, in the order of the columns
+     * @return true if the row was accepted
+     */
+    bool putRow(const db::Parameters& row);
+
+    /**
+     * Completes the current COPY
+     * @return true if all the rows were written
+     */
+    bool endCopy();
+
 private:
     std::ifstream* inputFile;
 
@@ -31,7 +55,21 @@ private:
 
     int numInsertsPerQuery;
 
+    /** types (oids) of the columns of the current COPY*/
+    std::vector<Oid> columnTypes;
+
+    /** true if the current COPY is in binary format*/
+    bool binaryFormat;
+
+    /** rows of the current COPY which are not yet sent to the server*/
+    std::string copyBuffer;
+
     bool copyToDB(const std::string& buffer);
+
+    /**
+     * Sends the buffered rows of the current COPY to the server
+     */
+    bool flushCopyBuffer();
 };
 
 }
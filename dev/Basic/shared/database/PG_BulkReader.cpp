@@ -0,0 +1,570 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "PG_BulkReader.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <stdint.h>
+#include <boost/lexical_cast.hpp>
+
+using namespace sim_mob;
+
+namespace
+{
+/// oids of the column types read in binary format (see pg_type.h)
+const Oid BOOL_OID = 16;
+const Oid CHAR_OID = 18;
+const Oid INT8_OID = 20;
+const Oid INT2_OID = 21;
+const Oid INT4_OID = 23;
+const Oid TEXT_OID = 25;
+const Oid JSON_OID = 114;
+const Oid FLOAT4_OID = 700;
+const Oid FLOAT8_OID = 701;
+const Oid BPCHAR_OID = 1042;
+const Oid VARCHAR_OID = 1043;
+const Oid DATE_OID = 1082;
+const Oid TIMESTAMP_OID = 1114;
+const Oid NUMERIC_OID = 1700;
+
+const char CURSOR_NAME[] = "sim_mob_bulk_reader";
+
+/// before version 12, the server writes floating point values with fewer digits than needed to read them back
+const int SHORTEST_FLOAT_OUTPUT_VERSION = 120000;
+
+/// days from 1970-01-01 to 2000-01-01, the epoch of the binary date and timestamp types
+const long POSTGRES_EPOCH_DAYS = 10957;
+const int64_t MICROSECONDS_IN_DAY = 86400000000LL;
+
+/// signs of the binary numeric type
+const uint16_t NUMERIC_NEGATIVE = 0x4000;
+const uint16_t NUMERIC_NAN = 0xC000;
+const uint16_t NUMERIC_POSITIVE_INFINITY = 0xD000;
+const uint16_t NUMERIC_NEGATIVE_INFINITY = 0xF000;
+
+int16_t readInt16(const char* value)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(value);
+    return static_cast<int16_t>((bytes[0] << 8) | bytes[1]);
+}
+
+int32_t readInt32(const char* value)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(value);
+    return static_cast<int32_t>((static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16)
+                                | (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3]);
+}
+
+int64_t readInt64(const char* value)
+{
+    return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(readInt32(value))) << 32)
+                                | static_cast<uint32_t>(readInt32(value + 4)));
+}
+
+/**
+ * The value read by soci from the text of a float4, which is the shortest decimal giving back the same float.
+ */
+double readFloat4(const char* value)
+{
+    int32_t bits = readInt32(value);
+    float number;
+    std::memcpy(&number, &bits, sizeof(number));
+
+    char text[32];
+    for (int digits = 6; digits < 9; ++digits)
+    {
+        std::snprintf(text, sizeof(text), "%.*g", digits, number);
+        if (std::strtof(text, nullptr) == number)
+        {
+            return std::strtod(text, nullptr);
+        }
+    }
+    std::snprintf(text, sizeof(text), "%.9g", number);
+    return std::strtod(text, nullptr);
+}
+
+double readFloat8(const char* value)
+{
+    int64_t bits = readInt64(value);
+    double number;
+    std::memcpy(&number, &bits, sizeof(number));
+    return number;
+}
+
+/**
+ * The value read by soci from the text of a numeric. The decimal digits are rebuilt, so the double is the same
+ */
+double readNumeric(const char* value, std::string& text)
+{
+    const int numDigits = readInt16(value);
+    const int weight = readInt16(value + 2);
+    const uint16_t sign = static_cast<uint16_t>(readInt16(value + 4));
+    const char* digits = value + 8;
+
+    switch (sign)
+    {
+    case NUMERIC_NAN:
+        return std::strtod("NaN", nullptr);
+    case NUMERIC_POSITIVE_INFINITY:
+        return std::strtod("Infinity", nullptr);
+    case NUMERIC_NEGATIVE_INFINITY:
+        return std::strtod("-Infinity", nullptr);
+    default:
+        break;
+    }
+
+    //each digit holds 4 decimal digits, the first one multiplied by 10000^weight
+    text.clear();
+    if (sign == NUMERIC_NEGATIVE)
+    {
+        text.push_back('-');
+    }
+
+    char group[8];
+    if (weight < 0)
+    {
+        text.push_back('0');
+    }
+    for (int i = 0; i <= weight; ++i)
+    {
+        int digit = (i < numDigits) ? readInt16(digits + 2 * i) : 0;
+        std::snprintf(group, sizeof(group), (i == 0) ? "%d" : "%04d", digit);
+        text += group;
+    }
+    if (numDigits > weight + 1)
+    {
+        text.push_back('.');
+        for (int i = weight + 1; i < numDigits; ++i)
+        {
+            int digit = (i < 0) ? 0 : readInt16(digits + 2 * i);
+            std::snprintf(group, sizeof(group), "%04d", digit);
+            text += group;
+        }
+    }
+    return std::strtod(text.c_str(), nullptr);
+}
+
+/**
+ * Fills the given time with a date of the proleptic gregorian calendar, as soci does when it parses a date.
+ * @param days number of days from 1970-01-01
+ * @param seconds seconds from the start of the day
+ */
+void toTime(long days, long seconds, std::tm& time)
+{
+    days += 719468;
+    const long era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+    const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned monthIndex = (5 * dayOfYear + 2) / 153;
+    const unsigned month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    const long year = static_cast<long>(yearOfEra) + era * 400 + (month <= 2);
+
+    std::memset(&time, 0, sizeof(time));
+    time.tm_isdst = -1;
+    time.tm_year = static_cast<int>(year - 1900);
+    time.tm_mon = static_cast<int>(month) - 1;
+    time.tm_mday = static_cast<int>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    time.tm_hour = static_cast<int>(seconds / 3600);
+    time.tm_min = static_cast<int>((seconds / 60) % 60);
+    time.tm_sec = static_cast<int>(seconds % 60);
+    std::mktime(&time);
+}
+
+/**
+ * Type of the soci row value of a column, as given by the soci postgresql backend
+ * @return false if the column type is not read in binary format
+ */
+bool getDataType(Oid type, bool shortestFloatOutput, soci::data_type& dataType)
+{
+    switch (type)
+    {
+    case BOOL_OID:
+    case INT2_OID:
+    case INT4_OID:
+        dataType = soci::dt_integer;
+        return true;
+    case INT8_OID:
+        dataType = soci::dt_long_long;
+        return true;
+    case FLOAT4_OID:
+    case FLOAT8_OID:
+        dataType = soci::dt_double;
+        return shortestFloatOutput;
+    case NUMERIC_OID:
+        dataType = soci::dt_double;
+        return true;
+    case CHAR_OID:
+    case TEXT_OID:
+    case JSON_OID:
+    case BPCHAR_OID:
+    case VARCHAR_OID:
+        dataType = soci::dt_string;
+        return true;
+    case DATE_OID:
+    case TIMESTAMP_OID:
+        dataType = soci::dt_date;
+        return true;
+    default:
+        return false;
+    }
+}
+}
+
+PG_BulkReader::PG_BulkReader(PGconn* connection, int batchSize) :
+        connection(connection), batchSize(std::max(batchSize, 1)), inTransaction(false), endOfRows(true), batchRows(0),
+        nextRow(0)
+{
+}
+
+PG_BulkReader::~PG_BulkReader()
+{
+    close(true);
+}
+
+bool PG_BulkReader::open(const std::string& query)
+{
+    close(true);
+
+    if (!connection || PQstatus(connection) != CONNECTION_OK || PQtransactionStatus(connection) != PQTRANS_IDLE)
+    {
+        return false;
+    }
+
+    //the binary timestamps are integers since version 10, and by default before
+    const char* integerDatetimes = PQparameterStatus(connection, "integer_datetimes");
+    if (!integerDatetimes || std::strcmp(integerDatetimes, "on") != 0)
+    {
+        return false;
+    }
+
+    PGresult* res = PQexec(connection, "BEGIN");
+    inTransaction = (PQresultStatus(res) == PGRES_COMMAND_OK);
+    PQclear(res);
+    if (!inTransaction)
+    {
+        return false;
+    }
+
+    std::string selectQuery = query;
+    size_t end = selectQuery.find_last_not_of(" \t\r\n;");
+    selectQuery.erase(end == std::string::npos ? 0 : end + 1);
+
+    res = PQexec(connection, (std::string("DECLARE ") + CURSOR_NAME + " BINARY NO SCROLL CURSOR FOR " + selectQuery).c_str());
+    const bool declared = (PQresultStatus(res) == PGRES_COMMAND_OK);
+    PQclear(res);
+    if (!declared)
+    {
+        close(false);
+        return false;
+    }
+
+    res = PQexec(connection, ("FETCH FORWARD " + boost::lexical_cast<std::string>(batchSize) + " FROM " + CURSOR_NAME).c_str());
+    if (PQresultStatus(res) != PGRES_TUPLES_OK || !createColumns(res))
+    {
+        PQclear(res);
+        close(false);
+        return false;
+    }
+
+    convertBatch(res);
+    PQclear(res);
+    return true;
+}
+
+bool PG_BulkReader::next()
+{
+    if (nextRow == batchRows)
+    {
+        if (endOfRows)
+        {
+            close(true);
+            return false;
+        }
+
+        fetchBatch();
+        if (batchRows == 0)
+        {
+            close(true);
+            return false;
+        }
+    }
+
+    for (std::vector<Column>::iterator it = columns.begin(); it != columns.end(); ++it)
+    {
+        Column& column = *it;
+        *column.indicator = column.indicators[nextRow];
+        switch (column.dataType)
+        {
+        case soci::dt_integer:
+            *static_cast<int*>(column.value) = column.ints[nextRow];
+            break;
+        case soci::dt_long_long:
+            *static_cast<long long*>(column.value) = column.longs[nextRow];
+            break;
+        case soci::dt_double:
+            *static_cast<double*>(column.value) = column.doubles[nextRow];
+            break;
+        case soci::dt_string:
+            static_cast<std::string*>(column.value)->swap(column.strings[nextRow]);
+            break;
+        case soci::dt_date:
+            *static_cast<std::tm*>(column.value) = column.times[nextRow];
+            break;
+        default:
+            break;
+        }
+    }
+    nextRow++;
+    return true;
+}
+
+soci::row& PG_BulkReader::getRow()
+{
+    return *row;
+}
+
+void PG_BulkReader::fetchBatch()
+{
+    PGresult* res = PQexec(connection, ("FETCH FORWARD " + boost::lexical_cast<std::string>(batchSize) + " FROM " + CURSOR_NAME).c_str());
+    if (PQresultStatus(res) != PGRES_TUPLES_OK)
+    {
+        std::string error = PQresultErrorMessage(res);
+        PQclear(res);
+        close(false);
+        throw std::runtime_error("PG_BulkReader: could not fetch the rows. " + error);
+    }
+    convertBatch(res);
+    PQclear(res);
+}
+
+bool PG_BulkReader::createColumns(const PGresult* result)
+{
+    const bool shortestFloatOutput = (PQserverVersion(connection) >= SHORTEST_FLOAT_OUTPUT_VERSION);
+
+    columns.clear();
+    columns.resize(PQnfields(result));
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        columns[i].type = PQftype(result, static_cast<int>(i));
+        if (!getDataType(columns[i].type, shortestFloatOutput, columns[i].dataType))
+        {
+            columns.clear();
+            return false;
+        }
+    }
+
+    //the row owns its values, which are overwritten by each call to next()
+    row.reset(new soci::row());
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        Column& column = columns[i];
+        soci::column_properties properties;
+        properties.set_name(PQfname(result, static_cast<int>(i)));
+        properties.set_data_type(column.dataType);
+        row->add_properties(properties);
+
+        column.indicator = new soci::indicator(soci::i_ok);
+        switch (column.dataType)
+        {
+        case soci::dt_integer:
+        {
+            int* value = new int(0);
+            row->add_holder(value, column.indicator);
+            column.value = value;
+            break;
+        }
+        case soci::dt_long_long:
+        {
+            long long* value = new long long(0);
+            row->add_holder(value, column.indicator);
+            column.value = value;
+            break;
+        }
+        case soci::dt_double:
+        {
+            double* value = new double(0);
+            row->add_holder(value, column.indicator);
+            column.value = value;
+            break;
+        }
+        case soci::dt_string:
+        {
+            std::string* value = new std::string();
+            row->add_holder(value, column.indicator);
+            column.value = value;
+            break;
+        }
+        default:
+        {
+            std::tm* value = new std::tm();
+            row->add_holder(value, column.indicator);
+            column.value = value;
+            break;
+        }
+        }
+    }
+    return true;
+}
+
+void PG_BulkReader::convertBatch(const PGresult* result)
+{
+    const int numRows = PQntuples(result);
+    batchRows = static_cast<size_t>(numRows);
+    nextRow = 0;
+    endOfRows = (numRows < batchSize);
+
+    std::string numericText;
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        Column& column = columns[i];
+        const int field = static_cast<int>(i);
+        column.indicators.assign(batchRows, soci::i_ok);
+        for (int r = 0; r < numRows; ++r)
+        {
+            if (PQgetisnull(result, r, field))
+            {
+                column.indicators[r] = soci::i_null;
+            }
+        }
+
+        switch (column.type)
+        {
+        case BOOL_OID:
+            column.ints.assign(batchRows, 0);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.ints[r] = (*PQgetvalue(result, r, field) != 0);
+                }
+            }
+            break;
+        case INT2_OID:
+            column.ints.assign(batchRows, 0);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.ints[r] = readInt16(PQgetvalue(result, r, field));
+                }
+            }
+            break;
+        case INT4_OID:
+            column.ints.assign(batchRows, 0);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.ints[r] = readInt32(PQgetvalue(result, r, field));
+                }
+            }
+            break;
+        case INT8_OID:
+            column.longs.assign(batchRows, 0);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.longs[r] = readInt64(PQgetvalue(result, r, field));
+                }
+            }
+            break;
+        case FLOAT4_OID:
+            column.doubles.assign(batchRows, 0);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.doubles[r] = readFloat4(PQgetvalue(result, r, field));
+                }
+            }
+            break;
+        case FLOAT8_OID:
+            column.doubles.assign(batchRows, 0);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.doubles[r] = readFloat8(PQgetvalue(result, r, field));
+                }
+            }
+            break;
+        case NUMERIC_OID:
+            column.doubles.assign(batchRows, 0);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.doubles[r] = readNumeric(PQgetvalue(result, r, field), numericText);
+                }
+            }
+            break;
+        case DATE_OID:
+        case TIMESTAMP_OID:
+            column.times.resize(batchRows);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] != soci::i_ok)
+                {
+                    continue;
+                }
+
+                const char* value = PQgetvalue(result, r, field);
+                if (column.type == DATE_OID)
+                {
+                    toTime(readInt32(value) + POSTGRES_EPOCH_DAYS, 0, column.times[r]);
+                }
+                else
+                {
+                    //soci ignores the fraction of the seconds
+                    int64_t microseconds = readInt64(value);
+                    int64_t days = microseconds / MICROSECONDS_IN_DAY;
+                    int64_t timeOfDay = microseconds % MICROSECONDS_IN_DAY;
+                    if (timeOfDay < 0)
+                    {
+                        days--;
+                        timeOfDay += MICROSECONDS_IN_DAY;
+                    }
+                    toTime(static_cast<long>(days) + POSTGRES_EPOCH_DAYS, static_cast<long>(timeOfDay / 1000000), column.times[r]);
+                }
+            }
+            break;
+        default:
+            column.strings.resize(batchRows);
+            for (int r = 0; r < numRows; ++r)
+            {
+                if (column.indicators[r] == soci::i_ok)
+                {
+                    column.strings[r].assign(PQgetvalue(result, r, field), PQgetlength(result, r, field));
+                }
+                else
+                {
+                    column.strings[r].clear();
+                }
+            }
+            break;
+        }
+    }
+}
+
+void PG_BulkReader::close(bool commit)
+{
+    if (!inTransaction)
+    {
+        return;
+    }
+
+    //ending the transaction closes the cursor
+    PGresult* res = PQexec(connection, commit ? "COMMIT" : "ROLLBACK");
+    PQclear(res);
+    inTransaction = false;
+    endOfRows = true;
+    batchRows = 0;
+    nextRow = 0;
+}
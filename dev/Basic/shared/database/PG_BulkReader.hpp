@@ -0,0 +1,110 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <ctime>
+#include <string>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <libpq-fe.h>
+#include "soci/soci.h"
+
+namespace sim_mob
+{
+
+/**
+ * Reads the rows of a query through a binary cursor, in batches.
+ *
+ * The rows are given one at a time as a soci::row, holding the same types and values as the rows of a soci rowset
+ * for the same query, so they can be converted by the fromRow() method of the daos (see SqlAbstractDao).
+ * Each batch is fetched in binary format and converted column by column, which avoids parsing the text of the
+ * values and keeps only one batch of the result in memory.
+ *
+ * The query is read in a transaction of its own, so the connection must not be in a transaction. If it is, or if
+ * the query can not be started, or one of its columns has a type whose binary format is not supported, open()
+ * returns false without reading any row and the query should be run through soci instead.
+ */
+class PG_BulkReader : private boost::noncopyable
+{
+public:
+    /**
+     * @param connection connection of the query. It is not managed by the reader
+     * @param batchSize number of rows fetched at a time
+     */
+    explicit PG_BulkReader(PGconn* connection, int batchSize = 10000);
+
+    ~PG_BulkReader();
+
+    /**
+     * Starts reading the rows of a query
+     * @param query select query, without parameters
+     * @return true if the rows can be read with next()
+     */
+    bool open(const std::string& query);
+
+    /**
+     * Moves to the next row of the query.
+     * Throws std::runtime_error if the rows could not be fetched
+     * @return true if there is a row, false once all the rows are read
+     */
+    bool next();
+
+    /**
+     * Current row. Valid until the next call to next()
+     */
+    soci::row& getRow();
+
+private:
+    struct Column
+    {
+        Oid type;
+        soci::data_type dataType;
+
+        /** values of the current batch, in the vector of the data type*/
+        std::vector<int> ints;
+        std::vector<long long> longs;
+        std::vector<double> doubles;
+        std::vector<std::string> strings;
+        std::vector<std::tm> times;
+        std::vector<soci::indicator> indicators;
+
+        /** values of the row, owned by the row*/
+        void* value;
+        soci::indicator* indicator;
+    };
+
+    /**
+     * Fetches and converts the next batch of rows. Throws std::runtime_error on failure
+     */
+    void fetchBatch();
+
+    /**
+     * Creates the columns and the row of the result of the query
+     * @return false if the type of a column is not supported
+     */
+    bool createColumns(const PGresult* result);
+
+    void convertBatch(const PGresult* result);
+
+    /**
+     * Closes the cursor and ends the transaction
+     * @param commit true to commit the transaction, false to roll it back
+     */
+    void close(bool commit);
+
+    PGconn* connection;
+    int batchSize;
+    bool inTransaction;
+    bool endOfRows;
+    std::vector<Column> columns;
+    boost::scoped_ptr<soci::row> row;
+
+    /** number of rows of the current batch and index of the next one*/
+    size_t batchRows;
+    size_t nextRow;
+};
+
+}
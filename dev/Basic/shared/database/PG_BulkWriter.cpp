@@ -0,0 +1,79 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "PG_BulkWriter.hpp"
+
+#include <algorithm>
+#include <boost/thread/thread.hpp>
+#include "logging/Log.hpp"
+
+using namespace sim_mob;
+
+PG_BulkWriter::PG_BulkWriter(const std::string& connectionStr, unsigned int numWriters) :
+        connectionStr(connectionStr), numWriters(std::max(numWriters, 1u)), nextTable(0)
+{
+}
+
+bool PG_BulkWriter::write()
+{
+    nextTable = 0;
+    const size_t nThreads = std::min<size_t>(numWriters, tables.size());
+
+    if (nThreads == 1)
+    {
+        runWriter();
+    }
+    else
+    {
+        boost::thread_group writers;
+        for (size_t i = 0; i < nThreads; ++i)
+        {
+            writers.create_thread(boost::bind(&PG_BulkWriter::runWriter, this));
+        }
+        writers.join_all();
+    }
+
+    bool retVal = true;
+    for (std::vector<Table>::const_iterator it = tables.begin(); it != tables.end(); ++it)
+    {
+        if (!it->written)
+        {
+            Warn() << "PG_BulkWriter: failed to write " << it->tableName << std::endl;
+            retVal = false;
+        }
+    }
+    return retVal;
+}
+
+void PG_BulkWriter::runWriter()
+{
+    //each writer has its own connection, opened when it gets its first table
+    PG_BulkInserter inserter(0);
+    bool connected = false;
+
+    while (true)
+    {
+        Table* table = nullptr;
+        {
+            boost::unique_lock<boost::mutex> lock(tablesMutex);
+            if (nextTable == tables.size())
+            {
+                return;
+            }
+            table = &tables[nextTable++];
+        }
+
+        if (!connected && !(connected = inserter.connect(connectionStr)))
+        {
+            continue;
+        }
+
+        if (inserter.beginCopy(table->tableName, table->columnNames))
+        {
+            //the COPY is always ended, so that a failed table does not prevent the writer from writing the next ones
+            const bool copied = table->copy(inserter);
+            table->written = inserter.endCopy() && copied;
+        }
+    }
+}
@@ -0,0 +1,111 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/mutex.hpp>
+#include "database/PG_BulkInserter.hpp"
+#include "database/dao/I_Dao.hpp"
+
+namespace sim_mob
+{
+
+/**
+ * Writes the entities of several tables with COPY (see PG_BulkInserter).
+ *
+ * The tables are written by up to numWriters threads, each on its own connection. A table is written by a single
+ * thread, in one COPY, so the rows of a table are either all written or none of them. Tables added by several
+ * calls to addTable() are written independently of each other, and in no particular order if numWriters > 1.
+ *
+ * The rows are built by the getInsertParams() method of the dao of the entities (see SqlAbstractDao).
+ * The dao and the entities must stay valid until write() returns.
+ */
+class PG_BulkWriter : private boost::noncopyable
+{
+public:
+    /**
+     * @param connectionStr libpq connection string of the database
+     * @param numWriters maximum number of tables written at the same time
+     */
+    PG_BulkWriter(const std::string& connectionStr, unsigned int numWriters);
+
+    /**
+     * Adds a table to write
+     * @param dao dao of the entities
+     * @param tableName name of the table, including its schema
+     * @param columnNames columns of the table, in the order of the parameters filled by the dao
+     * @param begin iterator to the first entity. Dereferencing it must give a pointer (or smart pointer) to an entity
+     * @param end iterator past the last entity
+     */
+    template<typename DaoType, typename Iterator>
+    void addTable(DaoType& dao, const std::string& tableName, const std::vector<std::string>& columnNames, Iterator begin,
+                  Iterator end)
+    {
+        tables.push_back(Table(tableName, columnNames,
+                               boost::bind(&PG_BulkWriter::copyRows<DaoType, Iterator>, boost::ref(dao), begin, end, _1)));
+    }
+
+    /**
+     * Writes all the tables
+     * @return true if all the tables were written
+     */
+    bool write();
+
+private:
+    struct Table
+    {
+        Table(const std::string& tableName, const std::vector<std::string>& columnNames,
+              const boost::function<bool (PG_BulkInserter&)>& copy) :
+                tableName(tableName), columnNames(columnNames), copy(copy), written(false)
+        {
+        }
+
+        std::string tableName;
+        std::vector<std::string> columnNames;
+
+        /** puts the rows of the table in the COPY*/
+        boost::function<bool (PG_BulkInserter&)> copy;
+
+        bool written;
+    };
+
+    template<typename DaoType, typename Iterator>
+    static bool copyRows(DaoType& dao, Iterator begin, Iterator end, PG_BulkInserter& inserter)
+    {
+        db::Parameters row;
+        for (Iterator it = begin; it != end; ++it)
+        {
+            row.clear();
+            dao.getInsertParams(*(*it), row);
+            if (!inserter.putRow(row))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Writes tables until none is left. Executed by each writer thread
+     */
+    void runWriter();
+
+    std::string connectionStr;
+    unsigned int numWriters;
+    std::vector<Table> tables;
+
+    /** index of the next table to write*/
+    size_t nextTable;
+
+    /** protects nextTable*/
+    boost::mutex tablesMutex;
+};
+
+}
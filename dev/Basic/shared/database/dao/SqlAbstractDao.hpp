@@ -3,11 +3,13 @@
 //   license.txt   (http://opensource.org/licenses/MIT)
 
 #pragma once
+#include <string>
 #include <vector>
 #include <boost/algorithm/string.hpp>
 #include <boost/unordered_map.hpp>
 #include "soci/soci.h"
 #include "database/DB_Connection.hpp"
+#include "database/PG_BulkReader.hpp"
 #include "util/LangHelpers.hpp"
 #include "I_Dao.hpp"
 
@@ -77,6 +79,9 @@ typedef soci::rowset<Row> ResultSet;
  *       "field = :myfield"
  *
  *
+ * Queries without parameters are read through a PG_BulkReader when the types of their columns
+ * allow it, and through a soci rowset otherwise. fromRow() gets the same row in both cases.
+ *
  * Attention: The given connection is not managed by DAO implementation.
  * This implementation is not thread-safe.
  *
@@ -314,6 +319,17 @@ public:
         return getByValues(query, ids, outList);
     }
 
+    /**
+     * Converts the given entity into the parameters of an insert, in the order of toRow().
+     * Used to stream entities into a bulk writer (see PG_BulkWriter).
+     * @param entity to convert.
+     * @param outParams Parameter list that will receive the data.
+     */
+    void getInsertParams(T& entity, Parameters& outParams)
+    {
+        toRow(entity, outParams, false);
+    }
+
     bool executeQuery(std::string queryStr)
     {
         if (isConnected())
@@ -391,6 +407,21 @@ protected:
         bool hasValues = false;
         if (isConnected())
         {
+            //queries without parameters are read in binary batches when their column types allow it
+            if (params.empty())
+            {
+                PG_BulkReader reader(connection.getPostgresConnection());
+                if (reader.open(queryStr))
+                {
+                    while (reader.next())
+                    {
+                        appendRow(reader.getRow(), outParam, getter);
+                        hasValues = true;
+                    }
+                    return hasValues;
+                }
+            }
+
             Statement query(connection.getSession<soci::session>());
             prepareStatement(queryStr, params, query);
             ResultSet rs(query);
@@ -419,6 +450,21 @@ protected:
         bool hasValues = false;
         if (isConnected())
         {
+            //queries without parameters are read in binary batches when their column types allow it
+            if (params.empty())
+            {
+                PG_BulkReader reader(connection.getPostgresConnection());
+                if (reader.open(queryStr))
+                {
+                    while (reader.next())
+                    {
+                        appendRow(reader.getRow(), outParam);
+                        hasValues = true;
+                    }
+                    return hasValues;
+                }
+            }
+
             Statement query(connection.getSession<soci::session>());
             prepareStatement(queryStr, params, query);
             ResultSet rs(query);
@@ -432,6 +478,24 @@ protected:
         return hasValues;
     }
 
+    /**
+     * Builds an insert query with one parameter per column.
+     * @param table name of the table, including its schema.
+     * @param columns names of the columns, in the order of the parameters.
+     * @return the insert query.
+     */
+    static std::string buildInsertQuery(const std::string& table, const std::vector<std::string>& columns)
+    {
+        std::string columnList;
+        std::string valueList;
+        for (size_t i = 0; i < columns.size(); ++i)
+        {
+            columnList += (i > 0 ? ", " : "") + columns[i];
+            valueList += (i > 0 ? ", :v" : ":v") + std::to_string(i + 1);
+        }
+        return "INSERT INTO " + table + " (" + columnList + ") VALUES (" + valueList + ")";
+    }
+
     /**
      * Helper function to prepare the given statement.
      * @param queryStr query string.
@@ -480,9 +544,8 @@ private:
      */
     void appendRow(Row& row, std::vector<T>& list)
     {
-        T model;
-        fromRow(row, model);
-        list.push_back(model);
+        list.push_back(T());
+        fromRow(row, list.back());
     }
 
     /**
@@ -7,6 +7,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <boost/lexical_cast.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "conf/ConfigManager.hpp"
 #include "conf/ConfigParams.hpp"
@@ -47,8 +48,16 @@ std::set<Entity*> sim_mob::Agent::all_agents;
 std::vector<Entity*>sim_mob::Agent::activeAgents;
 unsigned int sim_mob::Agent::nextAgentId = 0;
 
+namespace
+{
+/// agents may be constructed by the person loader threads while the simulation runs
+boost::mutex agentIdMutex;
+}
+
 unsigned int sim_mob::Agent::getAndIncrementID(int preferredID)
 {
+    boost::unique_lock<boost::mutex> lock(agentIdMutex);
+
     //If the ID is valid, modify next_agent_id;
     if (preferredID > static_cast<int> (nextAgentId))
     {
@@ -0,0 +1,236 @@
+/*
+ * DriverGridIndex.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "DriverGridIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "geospatial/network/Node.hpp"
+
+using namespace sim_mob;
+
+DriverGridIndex::DriverGridIndex(double cellSize) : cellSize(cellSize),
+        minCellX(std::numeric_limits<int>::max()), minCellY(std::numeric_limits<int>::max()),
+        maxCellX(std::numeric_limits<int>::min()), maxCellY(std::numeric_limits<int>::min())
+{
+    if (cellSize <= 0)
+    {
+        throw std::runtime_error("DriverGridIndex: the cell size must be positive");
+    }
+}
+
+int DriverGridIndex::toCellCoordinate(double coordinate) const
+{
+    return static_cast<int>(std::floor(coordinate / cellSize));
+}
+
+DriverGridIndex::CellKey DriverGridIndex::toCellKey(int cellX, int cellY)
+{
+    return (static_cast<CellKey>(cellX) << 32) | static_cast<std::uint32_t>(cellY);
+}
+
+void DriverGridIndex::update(const Person *driver, const Node *node)
+{
+    if (!node)
+    {
+        remove(driver);
+        return;
+    }
+
+    const double x = node->getLocation().getX();
+    const double y = node->getLocation().getY();
+    const int cellX = toCellCoordinate(x);
+    const int cellY = toCellCoordinate(y);
+    const CellKey cell = toCellKey(cellX, cellY);
+
+    auto itLocation = locations.find(driver);
+    if (itLocation != locations.end())
+    {
+        Location &location = itLocation->second;
+        if (location.cell == cell)
+        {
+            location.node = node;
+            location.x = x;
+            location.y = y;
+            return;
+        }
+        remove(driver);
+    }
+
+    Location location = { node, x, y, cell };
+    locations.emplace(driver, location);
+    cells[cell].push_back(driver);
+
+    minCellX = std::min(minCellX, cellX);
+    minCellY = std::min(minCellY, cellY);
+    maxCellX = std::max(maxCellX, cellX);
+    maxCellY = std::max(maxCellY, cellY);
+}
+
+void DriverGridIndex::remove(const Person *driver)
+{
+    auto itLocation = locations.find(driver);
+    if (itLocation == locations.end())
+    {
+        return;
+    }
+
+    auto itCell = cells.find(itLocation->second.cell);
+#ifndef NDEBUG
+    if (itCell == cells.end())
+    {
+        throw std::runtime_error("DriverGridIndex: an indexed driver is not present in her cell");
+    }
+#endif
+    std::vector<const Person *> &drivers = itCell->second;
+    auto itDriver = std::find(drivers.begin(), drivers.end(), driver);
+    *itDriver = drivers.back();
+    drivers.pop_back();
+
+    if (drivers.empty())
+    {
+        cells.erase(itCell);
+    }
+    locations.erase(itLocation);
+}
+
+void DriverGridIndex::clear()
+{
+    cells.clear();
+    locations.clear();
+    minCellX = minCellY = std::numeric_limits<int>::max();
+    maxCellX = maxCellY = std::numeric_limits<int>::min();
+}
+
+bool DriverGridIndex::contains(const Person *driver) const
+{
+    return locations.find(driver) != locations.end();
+}
+
+const Node *DriverGridIndex::getIndexedNode(const Person *driver) const
+{
+    auto itLocation = locations.find(driver);
+    return (itLocation != locations.end()) ? itLocation->second.node : nullptr;
+}
+
+int DriverGridIndex::maxRing(int cellX, int cellY) const
+{
+    if (locations.empty())
+    {
+        return -1;
+    }
+
+    return std::max(std::max(cellX - minCellX, maxCellX - cellX), std::max(cellY - minCellY, maxCellY - cellY));
+}
+
+void DriverGridIndex::collectRing(int cellX, int cellY, int ring, double x, double y,
+                                  std::vector<Candidate> &candidates) const
+{
+    for (int i = cellX - ring; i <= cellX + ring; ++i)
+    {
+        // On the top and bottom rows of the ring we visit every cell, otherwise only the left and right ones
+        const bool isBorderRow = (i == cellX - ring || i == cellX + ring);
+        const int step = (isBorderRow || ring == 0) ? 1 : 2 * ring;
+
+        for (int j = cellY - ring; j <= cellY + ring; j += step)
+        {
+            auto itCell = cells.find(toCellKey(i, j));
+            if (itCell == cells.end())
+            {
+                continue;
+            }
+
+            for (const Person *driver : itCell->second)
+            {
+                const Location &location = locations.at(driver);
+                const double distance = std::sqrt((location.x - x) * (location.x - x) + (location.y - y) * (location.y - y));
+                candidates.push_back(Candidate { driver, distance });
+            }
+        }
+    }
+}
+
+const Person *DriverGridIndex::findNearest(const Node *node) const
+{
+    std::vector<const Person *> nearest = findKNearest(node, 1);
+    return nearest.empty() ? nullptr : nearest.front();
+}
+
+std::vector<const Person *> DriverGridIndex::findKNearest(const Node *node, size_t k) const
+{
+    std::vector<const Person *> result;
+    if (k == 0 || locations.empty())
+    {
+        return result;
+    }
+
+    const double x = node->getLocation().getX();
+    const double y = node->getLocation().getY();
+    const int cellX = toCellCoordinate(x);
+    const int cellY = toCellCoordinate(y);
+    const int lastRing = maxRing(cellX, cellY);
+
+    std::vector<Candidate> candidates;
+    for (int ring = 0; ring <= lastRing; ++ring)
+    {
+        collectRing(cellX, cellY, ring, x, y, candidates);
+
+        // Every driver beyond this ring is at least ring * cellSize away from the query point. Once we have k
+        // candidates strictly closer than that, no unexplored driver can enter the result
+        if (candidates.size() >= k)
+        {
+            std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end());
+            if (candidates[k - 1].distance < ring * cellSize)
+            {
+                break;
+            }
+        }
+    }
+
+    const size_t found = std::min(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + found, candidates.end());
+
+    result.reserve(found);
+    for (size_t i = 0; i < found; ++i)
+    {
+        result.push_back(candidates[i].driver);
+    }
+    return result;
+}
+
+std::vector<const Person *> DriverGridIndex::findWithinRadius(const Node *node, double radius) const
+{
+    std::vector<const Person *> result;
+    if (radius < 0 || locations.empty())
+    {
+        return result;
+    }
+
+    const double x = node->getLocation().getX();
+    const double y = node->getLocation().getY();
+    const int cellX = toCellCoordinate(x);
+    const int cellY = toCellCoordinate(y);
+    const int lastRing = std::min(maxRing(cellX, cellY), static_cast<int>(std::ceil(radius / cellSize)));
+
+    std::vector<Candidate> candidates;
+    for (int ring = 0; ring <= lastRing; ++ring)
+    {
+        collectRing(cellX, cellY, ring, x, y, candidates);
+    }
+
+    auto itEnd = std::remove_if(candidates.begin(), candidates.end(),
+                                [radius](const Candidate &candidate) { return candidate.distance > radius; });
+    std::sort(candidates.begin(), itEnd);
+
+    for (auto it = candidates.begin(); it != itEnd; ++it)
+    {
+        result.push_back(it->driver);
+    }
+    return result;
+}
@@ -0,0 +1,134 @@
+/*
+ * DriverGridIndex.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace sim_mob
+{
+
+class Node;
+class Person;
+
+/**
+ * Uniform grid index over the available drivers of an on-call controller.
+ *
+ * Each indexed driver is bucketed into the square cell containing her current node. Nearest, k-nearest and
+ * radius queries only visit the cells around the query point, spiralling outwards ring by ring, so that the
+ * cost of a query depends on the local density of drivers rather than on the size of the fleet.
+ *
+ * Ties between drivers at the same distance are broken by pointer value, which gives the same answer as
+ * a linear scan over a std::set<const Person*> keeping the first strictly better driver.
+ */
+class DriverGridIndex
+{
+public:
+    /**
+     * @param cellSize side of a grid cell, in meters
+     */
+    explicit DriverGridIndex(double cellSize = 1000.0);
+
+    /**
+     * Adds the driver at the given node or, if she is already indexed, moves her there.
+     * Drivers without a current node are removed from the index
+     */
+    void update(const Person *driver, const Node *node);
+
+    /**
+     * Removes the driver from the index. Does nothing if she is not indexed
+     */
+    void remove(const Person *driver);
+
+    /** Removes all drivers */
+    void clear();
+
+    bool contains(const Person *driver) const;
+
+    size_t size() const
+    {
+        return locations.size();
+    }
+
+    /**
+     * Returns the node at which the driver has been last indexed, nullptr if she is not indexed
+     */
+    const Node *getIndexedNode(const Person *driver) const;
+
+    /**
+     * Returns the indexed driver closest to the node, or nullptr if the index is empty
+     */
+    const Person *findNearest(const Node *node) const;
+
+    /**
+     * Returns up to k indexed drivers closest to the node, sorted by increasing distance
+     */
+    std::vector<const Person *> findKNearest(const Node *node, size_t k) const;
+
+    /**
+     * Returns all indexed drivers whose euclidean distance from the node is at most radius (meters),
+     * sorted by increasing distance
+     */
+    std::vector<const Person *> findWithinRadius(const Node *node, double radius) const;
+
+private:
+    typedef std::int64_t CellKey;
+
+    struct Location
+    {
+        const Node *node;
+        double x;
+        double y;
+        CellKey cell;
+    };
+
+    struct Candidate
+    {
+        const Person *driver;
+        double distance;
+
+        bool operator<(const Candidate &other) const
+        {
+            if (distance != other.distance)
+            {
+                return distance < other.distance;
+            }
+            return std::less<const Person *>()(driver, other.driver);
+        }
+    };
+
+    int toCellCoordinate(double coordinate) const;
+
+    static CellKey toCellKey(int cellX, int cellY);
+
+    /**
+     * Collects into candidates all the drivers in the cells at Chebyshev distance exactly ring from (cellX, cellY)
+     */
+    void collectRing(int cellX, int cellY, int ring, double x, double y, std::vector<Candidate> &candidates) const;
+
+    /**
+     * Number of rings to explore around (cellX, cellY) before the whole occupied area has been covered
+     */
+    int maxRing(int cellX, int cellY) const;
+
+    /** Side of a grid cell (meters) */
+    double cellSize;
+
+    /** Drivers in each non-empty cell */
+    std::unordered_map<CellKey, std::vector<const Person *> > cells;
+
+    /** Where each indexed driver is */
+    std::unordered_map<const Person *, Location> locations;
+
+    /** Bounding box of the cells that have ever been occupied, in cell coordinates */
+    int minCellX, minCellY, maxCellX, maxCellY;
+};
+
+}
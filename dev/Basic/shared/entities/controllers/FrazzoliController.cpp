@@ -12,67 +12,299 @@
 #include "message/MobilityServiceControllerMessage.hpp"
 #include "path/PathSetManager.hpp"
 #include "entities/controllers/OnCallController.hpp"
+#include "conf/ConfigManager.hpp"
+#include "conf/ConfigParams.hpp"
+#include "util/Profiler.hpp"
+#include "util/threadpool/Threadpool.hpp"
 #include <algorithm>
+#include <limits>
 #include <sstream>
+#include "glpk.h"
 
 namespace sim_mob {
 
+FrazzoliController::FrazzoliController(const MutexStrategy& mtxStrat, unsigned int computationPeriod, unsigned id,
+                                       std::string tripSupportMode_, TT_EstimateType ttEstimateType,
+                                       unsigned maxAggregatedRequests_, bool studyAreaEnabledController_,
+                                       unsigned int tolerateExtraTime_, unsigned int maxWaitingTime_, bool parkingEnabled) :
+    OnCallController(mtxStrat, computationPeriod, MobilityServiceControllerType::SERVICE_CONTROLLER_FRAZZOLI, id, tripSupportMode_,
+                     ttEstimateType,maxAggregatedRequests_,studyAreaEnabledController_,tolerateExtraTime_,maxWaitingTime_,parkingEnabled),
+    threadPoolSize(1), waitingTimePruningEnabled(false), ilpAssignmentEnabled(false),
+    ilpTimeLimit(computationPeriod * ConfigManager::GetInstance().FullConfig().baseGranMS())
+{
+    const std::map<unsigned int, MobilityServiceControllerConfig>& enabledControllers =
+            ConfigManager::GetInstance().FullConfig().mobilityServiceController.enabledControllers;
+    std::map<unsigned int, MobilityServiceControllerConfig>::const_iterator it = enabledControllers.find(id);
+    if (it != enabledControllers.end())
+    {
+        waitingTimePruningEnabled = it->second.waitingTimePruning;
+        ilpAssignmentEnabled = it->second.ilpAssignment;
+        if (it->second.ilpTimeLimit > 0)
+        {
+            ilpTimeLimit = it->second.ilpTimeLimit;
+        }
+    }
+
+    if (it != enabledControllers.end() && it->second.threadPoolSize > 1)
+    {
+        // The OD and shortest path estimates go through the route choice caches, which are not meant to be
+        // queried by several threads at the same time
+        if (ttEstimateType == EUCLIDEAN_ESTIMATION)
+        {
+            threadPoolSize = it->second.threadPoolSize;
+            threadPool.reset(new batched::ThreadPool(threadPoolSize));
+        }
+        else
+        {
+            Warn() << "FrazzoliController " << id << ": threadPoolSize=" << it->second.threadPoolSize
+                   << " ignored, parallel graph construction requires the euclidean travel time estimation" << std::endl;
+        }
+    }
+}
+
+FrazzoliController::~FrazzoliController()
+{
+}
 
+void FrazzoliController::runTasks(size_t nTasks, const std::function<void(size_t)>& task)
+{
+    if (!threadPool)
+    {
+        for (size_t i = 0; i < nTasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
 
+    // Exceptions must not escape the pool threads: we keep the first one and re-throw it here
+    boost::mutex errorMutex;
+    std::string error;
+    for (size_t i = 0; i < nTasks; i++)
+    {
+        threadPool->enqueue([i, &task, &errorMutex, &error]()
+        {
+            try
+            {
+                task(i);
+            }
+            catch (const std::exception& e)
+            {
+                boost::unique_lock<boost::mutex> lock(errorMutex);
+                if (error.empty())
+                {
+                    error = e.what();
+                }
+            }
+        });
+    }
+    threadPool->wait();
+
+    if (!error.empty())
+    {
+        throw std::runtime_error(error);
+    }
+}
+
+bool FrazzoliController::isWaitingTimePruningEnabled() const
+{
+    // The bounds below are euclidean travel times: they are only valid if the schedules are evaluated the same way
+    return waitingTimePruningEnabled && maxWaitingTime > 0 && ttEstimateType == EUCLIDEAN_ESTIMATION;
+}
+
+double FrazzoliController::getPickupTravelTimeBound() const
+{
+    if (ttEstimateType != EUCLIDEAN_ESTIMATION)
+    {
+        return std::numeric_limits<double>::max();
+    }
+
+    double bound = waitingTimeThreshold;
+    if (isWaitingTimePruningEnabled())
+    {
+        bound = std::min(bound, (double) maxWaitingTime);
+    }
+    return bound;
+}
+
+bool FrazzoliController::isSharingCandidate(const TripRequestMessage& r1, const TripRequestMessage& r2) const
+{
+    if (!isWaitingTimePruningEnabled())
+    {
+        return true;
+    }
+
+    // What is left of the waiting time budget of each request. If the budget is over, the request can still be
+    // picked up first, together with another request at the same node
+    const double now = currTick.getSeconds();
+    const double budget1 = std::max(0.0, maxWaitingTime - (now - r1.timeOfRequest.getSeconds()));
+    const double budget2 = std::max(0.0, maxWaitingTime - (now - r2.timeOfRequest.getSeconds()));
+    const double pickupToPickup = getTT(r1.startNode->getLocation(), r2.startNode->getLocation());
+
+    return pickupToPickup <= budget2 || pickupToPickup <= budget1;
+}
+
+bool FrazzoliController::isPickupReachable(const Node* driverNode, const TripRequestMessage& request) const
+{
+    return getTT(driverNode->getLocation(), request.startNode->getLocation()) <= getPickupTravelTimeBound();
+}
 
 RD_Graph FrazzoliController::generateRD_Graph()
 {
     RD_Graph rdGraph;
+    const std::vector<TripRequestMessage> requests(requestQueue.begin(), requestQueue.end());
 
-    // https://stackoverflow.com/a/1824900/2110769
-    // We check the shareability of every possible pair of requests
-    for (std::list<TripRequestMessage>::const_iterator r1 = requestQueue.begin(); r1!=requestQueue.end(); r1++)
-    for (std::list<TripRequestMessage>::const_iterator r2 = r1; ++r2 != requestQueue.end(); )
+    // Requests sorted by the x coordinate of their pick up. The travel time along x alone is a lower bound of the
+    // euclidean travel time, so, sweeping in this order, we can stop as soon as it exceeds the pruning bound, without
+    // looking at the O(R^2) pairs or O(R*D) request-driver combinations
+    std::vector<size_t> requestsByX(requests.size());
+    for (size_t i = 0; i < requestsByX.size(); i++)
     {
-        if (canBeShared(*r1,*r2, additionalDelayThreshold, waitingTimeThreshold) )
-            rdGraph.addEdge(*r1,*r2);
+        requestsByX[i] = i;
     }
+    std::sort(requestsByX.begin(), requestsByX.end(), [&requests](size_t a, size_t b)
+    {
+        return requests[a].startNode->getPosX() < requests[b].startNode->getPosX();
+    });
+    const double requestsBound = isWaitingTimePruningEnabled() ? maxWaitingTime : std::numeric_limits<double>::max();
+    const double driversBound = getPickupTravelTimeBound();
+    auto isBeyondSweep = [this](double x1, double x2, double bound)
+    {
+        return bound < std::numeric_limits<double>::max() && getTT(Point(x1, 0), Point(x2, 0)) > bound;
+    };
 
+    // Request-request edges. Each task takes a slice of the sorted requests and pairs them with the following ones
+    const size_t nTasks = std::min(requests.size(), (size_t) threadPoolSize * 4);
+    std::vector< std::vector< std::pair<size_t, size_t> > > rrEdgesPerTask(nTasks);
+    runTasks(nTasks, [&](size_t task)
+    {
+        for (size_t p = task; p < requestsByX.size(); p += nTasks)
+        {
+            const TripRequestMessage& r1 = requests[requestsByX[p]];
+            for (size_t q = p + 1; q < requestsByX.size(); q++)
+            {
+                const TripRequestMessage& r2 = requests[requestsByX[q]];
+                if (isBeyondSweep(r1.startNode->getPosX(), r2.startNode->getPosX(), requestsBound))
+                {
+                    break;
+                }
 
+                if (isSharingCandidate(r1, r2) && canBeShared(r1, r2, additionalDelayThreshold, waitingTimeThreshold))
+                {
+                    // As in the request queue, the edge goes from the older request to the newer one
+                    rrEdgesPerTask[task].push_back(std::make_pair(std::min(requestsByX[p], requestsByX[q]),
+                                                                  std::max(requestsByX[p], requestsByX[q])));
+                }
+            }
+        }
+    });
 
-    for (const TripRequestMessage& request : requestQueue)
+    for (const std::vector< std::pair<size_t, size_t> >& rrEdges : rrEdgesPerTask)
     {
-        for (const std::pair<const Person*, const Schedule>& p : driverSchedules )
+        for (const std::pair<size_t, size_t>& rrEdge : rrEdges)
         {
-            const Person* driver = p.first;
-            const Schedule& currentSchedule = p.second;
-            const Node *driverNode = getCurrentNode(driver);
-            Group<TripRequestMessage> additionalRequests;
-            try{
-             additionalRequests.insert(request);
-            }catch(const std::exception& e)
+            rdGraph.addEdge(requests[rrEdge.first], requests[rrEdge.second]);
+        }
+    }
+
+    // Request-driver edges. Each task takes a driver and checks the requests whose pick up is not too far
+    std::vector<const Person*> drivers;
+    std::vector<const Node*> driverNodes;
+    for (const std::pair<const Person*, const Schedule>& p : driverSchedules)
+    {
+        drivers.push_back(p.first);
+        driverNodes.push_back(getCurrentNode(p.first));
+    }
+
+    std::vector< std::vector<size_t> > feasibleRequestsPerDriver(drivers.size());
+    runTasks(drivers.size(), [&](size_t d)
+    {
+        const Person* driver = drivers[d];
+        const Node* driverNode = driverNodes[d];
+        const Schedule& currentSchedule = driverSchedules.at(driver);
+        const double driverX = driverNode->getPosX();
+
+        // Candidates around the driver position along x, then back in request queue order
+        std::vector<size_t> candidates;
+        const size_t middle = std::lower_bound(requestsByX.begin(), requestsByX.end(), driverX, [&requests](size_t r, double x)
+        {
+            return requests[r].startNode->getPosX() < x;
+        }) - requestsByX.begin();
+        for (size_t p = middle; p < requestsByX.size() && !isBeyondSweep(driverX, requests[requestsByX[p]].startNode->getPosX(), driversBound); p++)
+        {
+            candidates.push_back(requestsByX[p]);
+        }
+        for (size_t p = middle; p > 0 && !isBeyondSweep(driverX, requests[requestsByX[p - 1]].startNode->getPosX(), driversBound); p--)
+        {
+            candidates.push_back(requestsByX[p - 1]);
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (size_t r : candidates)
+        {
+            const TripRequestMessage& request = requests[r];
+            if (!isPickupReachable(driverNode, request))
             {
-                Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                throw std::runtime_error(e.what() );
+                continue;
             }
+
+            Group<TripRequestMessage> additionalRequests;
+            additionalRequests.insert(request);
             Schedule newSchedule;
             bool optimalityRequired = false;
             double travelTime = computeSchedule(driverNode, currentSchedule, additionalRequests, newSchedule, optimalityRequired);
             if (travelTime>=0)
             {
-                rdGraph.addEdge(request,driver );
+                feasibleRequestsPerDriver[d].push_back(r);
             }
         }
+    });
 
+    for (size_t d = 0; d < drivers.size(); d++)
+    {
+        for (size_t r : feasibleRequestsPerDriver[d])
+        {
+            rdGraph.addEdge(requests[r], drivers[d]);
+        }
     }
+
     return rdGraph;
 }
 
+namespace
+{
+/**
+ * A request group that a driver can serve, with the corresponding travel time and schedule
+ */
+struct FeasibleGroup
+{
+    Group<TripRequestMessage> requestGroup;
+    double travelTime;
+    Schedule schedule;
+};
+}
+
 RGD_Graph FrazzoliController::generateRGD_Graph(const RD_Graph& rdGraph)
 {
     RGD_Graph rgdGraph;
-    Group< Group<TripRequestMessage> > overallRequestGroups;
     bool optimalityRequired = true;
+
+    std::vector<const Person*> drivers;
+    std::vector<const Node*> driverNodes;
     for (const std::pair<const Person*, const Schedule>& p : driverSchedules)
     {
-        const Person* driver = p.first;
-        const Node* driverNode = driver->exportServiceDriver()->getCurrentNode();
-        const Schedule& currentSchedule = driverSchedules.at(p.first);
+        drivers.push_back(p.first);
+        driverNodes.push_back(p.first->exportServiceDriver()->getCurrentNode());
+    }
+
+    // Each driver is independent of the others: every task enumerates the request groups of one driver
+    std::vector< std::vector<FeasibleGroup> > feasibleGroupsPerDriver(drivers.size());
+    runTasks(drivers.size(), [&](size_t d)
+    {
+        const Person* driver = drivers[d];
+        const Node* driverNode = driverNodes[d];
+        const Schedule& currentSchedule = driverSchedules.at(driver);
+        std::vector<FeasibleGroup>& feasibleGroups = feasibleGroupsPerDriver[d];
 
 #ifndef NDEBUG
         if (!currentSchedule.empty())
@@ -82,132 +314,324 @@ RGD_Graph FrazzoliController::generateRGD_Graph(const RD_Graph& rdGraph)
         }
 #endif
 
-
         // Add request groups of size one
-        unsigned occupancy = 1;
-        for ( const RD_Edge& rdEdge : rdGraph.getRD_Edges(driver) )
+        const std::vector<RD_Edge> rdEdges = rdGraph.getRD_Edges(driver);
+        std::vector<const TripRequestMessage*> feasibleRequests;
+        for ( const RD_Edge& rdEdge : rdEdges )
         {
-
             const TripRequestMessage& request = rdEdge.first;
-            Group<TripRequestMessage> requestGroup;
-            try{
-            requestGroup.insert(request);
-            }catch(const std::exception& e)
+            FeasibleGroup feasibleGroup;
+            feasibleGroup.requestGroup.insert(request);
+            feasibleGroup.travelTime = computeSchedule(driverNode, currentSchedule, feasibleGroup.requestGroup,
+                                                       feasibleGroup.schedule, optimalityRequired);
+            if (feasibleGroup.travelTime>=0)
             {
-                Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                throw std::runtime_error(e.what() );
-            }
-            Schedule newSchedule;
-            double travelTime = computeSchedule(driverNode, currentSchedule, requestGroup, newSchedule, optimalityRequired);
-            if (travelTime>=0)
-            {
-                try{
-                requestGroupsPerOccupancy[occupancy-1].insert(requestGroup);
-                }catch(const std::exception& e)
-                {
-                    Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                    throw std::runtime_error(e.what() );
-                }
-                rgdGraph.addEdge(request, requestGroup);
-                rgdGraph.addEdge(requestGroup, driver, travelTime, newSchedule);
+                feasibleRequests.push_back(&request);
+                feasibleGroups.push_back(feasibleGroup);
             }
         }
 
-        // Add request groups of size 2
-
-        occupancy++;
-        auto requestGroupsIterator1 = requestGroupsPerOccupancy[occupancy-1].getElements().begin();
-        auto end_ = requestGroupsPerOccupancy[occupancy-1].getElements().end();
-        for ( ; requestGroupsIterator1 != end_; requestGroupsIterator1++)
-        for (   auto requestGroupsIterator2 = requestGroupsIterator1;
-                ++requestGroupsIterator2 != end_;
-        ){
-#ifndef NDEBUG
-            if (requestGroupsIterator1->size()!=1 || requestGroupsIterator2->size()!=1)
-            {
-                std::stringstream msg; msg<<"rg1 and rg2 must have both size 1. Instead they are "<<
-                     "requestGroupsIterator1:"<<*requestGroupsIterator1<<", requestGroupsIterator2:"<<*requestGroupsIterator2;
-                throw std::runtime_error(msg.str() );
-            }
-#endif
-            const TripRequestMessage& r1 = requestGroupsIterator1->front();
-            const TripRequestMessage& r2 = requestGroupsIterator2->front();
+        // Add request groups of size 2, made of two requests that the driver can serve alone and that can be shared
+        for (size_t i = 0; i < feasibleRequests.size(); i++)
+        for (size_t j = i + 1; j < feasibleRequests.size(); j++)
+        {
+            const TripRequestMessage& r1 = *feasibleRequests[i];
+            const TripRequestMessage& r2 = *feasibleRequests[j];
             if (rdGraph.doesEdgeExist(r1,r2 ) )
             {
-                bool optimalityRequired = true;
-                Group<TripRequestMessage> requestGroup;
-                try{
-                requestGroup.insert(r1);
-                }catch(const std::exception& e)
-                {
-                    Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                    throw std::runtime_error(e.what() );
-                }
-                try{
-                requestGroup.insert(r2);
-                }catch(const std::exception& e)
-                {
-                    Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                    throw std::runtime_error(e.what() );
-                }
-                Schedule newSchedule;
-                double travelTime = computeSchedule(driverNode, currentSchedule, requestGroup, newSchedule, optimalityRequired);
-                if (travelTime >= 0)
+                FeasibleGroup feasibleGroup;
+                feasibleGroup.requestGroup.insert(r1);
+                feasibleGroup.requestGroup.insert(r2);
+                feasibleGroup.travelTime = computeSchedule(driverNode, currentSchedule, feasibleGroup.requestGroup,
+                                                           feasibleGroup.schedule, optimalityRequired);
+                if (feasibleGroup.travelTime >= 0)
                 {
                     // It is feasible that the driver serves this requestGroup
-                    try{
-                    requestGroupsPerOccupancy[occupancy-1].insert(requestGroup);
-                    }catch(const std::exception& e)
-                    {
-                        Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                        throw std::runtime_error(e.what() );
-                    }
-                    rgdGraph.addEdge(r1,requestGroup);
-                    rgdGraph.addEdge(r2,requestGroup);
-                    rgdGraph.addEdge(requestGroup,driver, travelTime, newSchedule);
+                    feasibleGroups.push_back(feasibleGroup);
                 }
             }
         }
+    });
 
+    for (size_t d = 0; d < drivers.size(); d++)
+    {
+        for (const FeasibleGroup& feasibleGroup : feasibleGroupsPerDriver[d])
+        {
+            for (const TripRequestMessage& request : feasibleGroup.requestGroup.getElements())
+            {
+                rgdGraph.addEdge(request, feasibleGroup.requestGroup);
+            }
+            rgdGraph.addEdge(feasibleGroup.requestGroup, drivers[d], feasibleGroup.travelTime, feasibleGroup.schedule);
+        }
     }
+
     return rgdGraph;
 }
 
-void FrazzoliController::greedyAssignment(RD_Graph& rdGraph, RGD_Graph& rgdGraph)
+namespace
+{
+/**
+ * Passed to the GLPK branch and bound callback, to provide the greedy assignment as initial integer solution
+ */
+struct IlpWarmStart
+{
+    /** Value of each column (1-based, as in GLPK) in the greedy assignment */
+    std::vector<double> columnValues;
+    bool isProvided;
+};
+
+void ilpCallback(glp_tree* tree, void* info)
+{
+    IlpWarmStart* warmStart = static_cast<IlpWarmStart*>(info);
+    if (glp_ios_reason(tree) == GLP_IHEUR && !warmStart->isProvided)
+    {
+        glp_ios_heur_sol(tree, warmStart->columnValues.data());
+        warmStart->isProvided = true;
+    }
+}
+}
+
+std::vector<size_t> FrazzoliController::greedyAssignment(const RGD_Graph& rgdGraph) const
 {
+    const std::vector<GD_Edge>& gdEdges = rgdGraph.getGD_Edges();
+    std::vector<size_t> sortedEdges(gdEdges.size());
+    for (size_t i = 0; i < sortedEdges.size(); i++)
+    {
+        sortedEdges[i] = i;
+    }
+    std::sort(sortedEdges.begin(), sortedEdges.end(), [&gdEdges](size_t e1, size_t e2)
+    {
+        const size_t size1 = gdEdges[e1].getRequestGroup().size();
+        const size_t size2 = gdEdges[e2].getRequestGroup().size();
+        if (size1 != size2)
+        {
+            return size1 > size2;
+        }
+        return gdEdges[e1] < gdEdges[e2];
+    });
+
+    std::vector<size_t> selectedEdges;
     std::set<TripRequestMessage> assignedRequests;
     std::set<const Person*> assignedDrivers;
+    for (size_t e : sortedEdges)
+    {
+        const GD_Edge& gdEdge = gdEdges[e];
+        if (assignedDrivers.find(gdEdge.getDriver()) != assignedDrivers.end())
+        {
+            continue;
+        }
+
+        const Group<TripRequestMessage> requestGroup = gdEdge.getRequestGroup();
+        bool isGroupFree = true;
+        for (const TripRequestMessage& request : requestGroup.getElements())
+        {
+            if (assignedRequests.find(request) != assignedRequests.end())
+            {
+                isGroupFree = false;
+                break;
+            }
+        }
+
+        if (isGroupFree)
+        {
+            assignedRequests.insert(requestGroup.getElements().begin(), requestGroup.getElements().end());
+            assignedDrivers.insert(gdEdge.getDriver());
+            selectedEdges.push_back(e);
+        }
+    }
+
+    return selectedEdges;
+}
 
-    for (unsigned occupancy = maxVehicleOccupancy; occupancy>0; occupancy--)
+bool FrazzoliController::ilpAssignment(const RGD_Graph& rgdGraph, const std::vector<size_t>& greedySolution,
+                                       std::vector<size_t>& solution) const
+{
+    const std::vector<GD_Edge>& gdEdges = rgdGraph.getGD_Edges();
+    if (gdEdges.empty())
+    {
+        solution.clear();
+        return true;
+    }
+
+    // Index the rows: one per driver and one per request appearing in the RGD graph
+    std::map<const Person*, int> driverRows;
+    std::map<TripRequestMessage, int> requestRows;
+    std::map<const Person*, double> maxCostPerDriver;
+    for (const GD_Edge& gdEdge : gdEdges)
     {
-        rgdGraph.sortGD_Edges();
-        while (rgdGraph.hasGD_Edges() )
+        driverRows.insert(std::make_pair(gdEdge.getDriver(), 0));
+        for (const TripRequestMessage& request : gdEdge.getRequestGroup().getElements())
         {
-            const GD_Edge gdEdge = rgdGraph.popGD_Edge();
-            for (const TripRequestMessage request : gdEdge.getRequestGroup().getElements() )
+            requestRows.insert(std::make_pair(request, 0));
+        }
+        double& maxCost = maxCostPerDriver[gdEdge.getDriver()];
+        maxCost = std::max(maxCost, gdEdge.getCost());
+    }
+
+    // The penalty of an unassigned request exceeds the cost of any assignment, so that the solver first maximizes
+    // the number of assigned requests and then minimizes the travel time
+    double unassignedPenalty = 1;
+    for (const std::pair<const Person*, double>& p : maxCostPerDriver)
+    {
+        unassignedPenalty += p.second;
+    }
+
+    const int nEdges = gdEdges.size();
+    const int nRequests = requestRows.size();
+    const int nDrivers = driverRows.size();
+
+    glp_prob* ilp = glp_create_prob();
+    glp_set_prob_name(ilp, "rgd_assignment");
+    glp_set_obj_dir(ilp, GLP_MIN);
+
+    // Columns 1..nEdges select the group-driver edges, columns nEdges+1..nEdges+nRequests mark the unassigned requests
+    glp_add_cols(ilp, nEdges + nRequests);
+    for (int j = 1; j <= nEdges + nRequests; j++)
+    {
+        glp_set_col_kind(ilp, j, GLP_BV);
+        glp_set_obj_coef(ilp, j, (j <= nEdges) ? gdEdges[j - 1].getCost() : unassignedPenalty);
+    }
+
+    // Rows 1..nDrivers: each driver serves at most one group.
+    // Rows nDrivers+1..nDrivers+nRequests: each request is either in exactly one selected group or unassigned
+    glp_add_rows(ilp, nDrivers + nRequests);
+    int row = 1;
+    for (std::pair<const Person* const, int>& p : driverRows)
+    {
+        p.second = row;
+        glp_set_row_bnds(ilp, row++, GLP_UP, 0.0, 1.0);
+    }
+    for (std::pair<const TripRequestMessage, int>& p : requestRows)
+    {
+        p.second = row;
+        glp_set_row_bnds(ilp, row++, GLP_FX, 1.0, 1.0);
+    }
+
+    // +1 because glpk starts indexing at 1
+    std::vector<int> ia(1), ja(1);
+    std::vector<double> ar(1);
+    for (int j = 1; j <= nEdges; j++)
+    {
+        const GD_Edge& gdEdge = gdEdges[j - 1];
+        ia.push_back(driverRows.at(gdEdge.getDriver()));
+        ja.push_back(j);
+        ar.push_back(1.0);
+        for (const TripRequestMessage& request : gdEdge.getRequestGroup().getElements())
+        {
+            ia.push_back(requestRows.at(request));
+            ja.push_back(j);
+            ar.push_back(1.0);
+        }
+    }
+    int k = nEdges;
+    for (const std::pair<const TripRequestMessage, int>& p : requestRows)
+    {
+        ia.push_back(p.second);
+        ja.push_back(++k);
+        ar.push_back(1.0);
+    }
+    glp_load_matrix(ilp, ia.size() - 1, ia.data(), ja.data(), ar.data());
+
+    // The greedy assignment, expressed in the columns of the ILP
+    IlpWarmStart warmStart;
+    warmStart.columnValues.assign(nEdges + nRequests + 1, 0.0);
+    warmStart.isProvided = false;
+    std::set<TripRequestMessage> greedyAssignedRequests;
+    for (size_t e : greedySolution)
+    {
+        warmStart.columnValues[e + 1] = 1.0;
+        const std::list<TripRequestMessage>& requests = gdEdges[e].getRequestGroup().getElements();
+        greedyAssignedRequests.insert(requests.begin(), requests.end());
+    }
+    k = nEdges;
+    for (const std::pair<const TripRequestMessage, int>& p : requestRows)
+    {
+        warmStart.columnValues[++k] = (greedyAssignedRequests.count(p.first) > 0) ? 0.0 : 1.0;
+    }
+
+    // The LP relaxation is solved explicitly, since the MIP presolver would prevent us from providing the
+    // warm start in terms of the original columns
+    Profiler profiler("FrazzoliController::ilpAssignment");
+    glp_smcp simplexParams;
+    glp_init_smcp(&simplexParams);
+    simplexParams.msg_lev = GLP_MSG_OFF;
+    simplexParams.tm_lim = ilpTimeLimit;
+    bool isSolved = false;
+    const int simplexRet = glp_simplex(ilp, &simplexParams);
+    if (simplexRet == 0)
+    {
+        const long elapsedMs = profiler.tick().first.count() / 1000;
+        glp_iocp ilpParams;
+        glp_init_iocp(&ilpParams);
+        ilpParams.msg_lev = GLP_MSG_OFF;
+        ilpParams.presolve = GLP_OFF;
+        ilpParams.tm_lim = std::max(1L, (long) ilpTimeLimit - elapsedMs);
+        ilpParams.cb_func = ilpCallback;
+        ilpParams.cb_info = &warmStart;
+
+        const int ret = glp_intopt(ilp, &ilpParams);
+        if (ret == 0 && glp_mip_status(ilp) == GLP_OPT)
+        {
+            solution.clear();
+            for (int j = 1; j <= nEdges; j++)
             {
-                if (    assignedRequests.find(request) != assignedRequests.end() &&
-                        assignedDrivers.find(gdEdge.getDriver()) != assignedDrivers.end()
-                ){
-                    try{
-                    assignedRequests.insert(request);
-                    }catch(const std::exception& e)
-                    {
-                        Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                        throw std::runtime_error(e.what() );
-                    }
-                    try{
-                    assignedDrivers.insert(gdEdge.getDriver() );
-                    }catch(const std::exception& e)
-                    {
-                        Print()<<"Exception "<<__FILE__<<":"<<__LINE__<<std::endl;
-                        throw std::runtime_error(e.what() );
-                    }
-                    assignSchedule(gdEdge.getDriver(),gdEdge.getSchedule());
-                } // else, if the request or the driver have been already assigned, we have nothing to do
+                if (glp_mip_col_val(ilp, j) > 0.5)
+                {
+                    solution.push_back(j - 1);
+                }
             }
+            isSolved = true;
+        }
+        else if (ret != GLP_ETMLIM)
+        {
+            Warn() << "FrazzoliController " << controllerId << ": glp_intopt returned " << ret << " with MIP status "
+                   << glp_mip_status(ilp) << ", falling back to the greedy assignment" << std::endl;
         }
+    }
+    else if (simplexRet != GLP_ETMLIM)
+    {
+        Warn() << "FrazzoliController " << controllerId << ": glp_simplex failed with code " << simplexRet
+               << ", falling back to the greedy assignment" << std::endl;
+    }
 
+    glp_delete_prob(ilp);
+    glp_free_env();
+    return isSolved;
+}
+
+double FrazzoliController::getAssignmentCost(const RGD_Graph& rgdGraph, const std::vector<size_t>& selectedEdges) const
+{
+    double cost = 0;
+    for (size_t e : selectedEdges)
+    {
+        cost += rgdGraph.getGD_Edges()[e].getCost();
+    }
+    return cost;
+}
+
+void FrazzoliController::assignGD_Edges(const RGD_Graph& rgdGraph, const std::vector<size_t>& selectedEdges)
+{
+    std::set<TripRequestMessage> assignedRequests;
+    for (size_t e : selectedEdges)
+    {
+        const GD_Edge& gdEdge = rgdGraph.getGD_Edges()[e];
+        assignSchedule(gdEdge.getDriver(), gdEdge.getSchedule());
+
+        const std::list<TripRequestMessage>& requests = gdEdge.getRequestGroup().getElements();
+        assignedRequests.insert(requests.begin(), requests.end());
+    }
+
+    // The requests left unassigned stay in the queue, we will process them again next time
+    for (std::list<TripRequestMessage>::iterator request = requestQueue.begin(); request != requestQueue.end(); )
+    {
+        if (assignedRequests.find(*request) != assignedRequests.end())
+        {
+            request = requestQueue.erase(request);
+        }
+        else
+        {
+            ++request;
+        }
     }
 }
 
@@ -219,9 +643,37 @@ void FrazzoliController::computeSchedules()
 
     ControllerLog() << "Computing schedule: " << requestQueue.size() << " requests are in the queue, available drivers "
             << availableDrivers.size() << std::endl;
+
+    // Wall clock time, since the graphs may be built by several threads
+    Profiler profiler("FrazzoliController");
     RD_Graph rdGraph = generateRD_Graph() ;
+    const boost::chrono::microseconds rdGraphTime = profiler.tick().second;
     RGD_Graph rgdGraph = generateRGD_Graph(rdGraph);
-    greedyAssignment(rdGraph, rgdGraph);
+    const boost::chrono::microseconds rgdGraphTime = profiler.tick().second;
+    std::vector<size_t> selectedEdges = greedyAssignment(rgdGraph);
+    const boost::chrono::microseconds greedyTime = profiler.tick().second;
+    std::stringstream ilpReport;
+    if (ilpAssignmentEnabled)
+    {
+        std::vector<size_t> ilpSolution;
+        const bool isIlpSolved = ilpAssignment(rgdGraph, selectedEdges, ilpSolution);
+        const boost::chrono::microseconds ilpTime = profiler.tick().second;
+        ilpReport << ", ilp=" << ilpTime.count() / 1000.0 << (isIlpSolved ? "" : " (not solved, greedy used)")
+                << ". Greedy assigned " << selectedEdges.size() << " groups with travel time "
+                << getAssignmentCost(rgdGraph, selectedEdges);
+        if (isIlpSolved)
+        {
+            ilpReport << ", ilp assigned " << ilpSolution.size() << " groups with travel time "
+                    << getAssignmentCost(rgdGraph, ilpSolution);
+            selectedEdges.swap(ilpSolution);
+        }
+    }
+    assignGD_Edges(rgdGraph, selectedEdges);
+
+    ControllerLog() << "FrazzoliController " << controllerId << " at " << currTick << ": " << rdGraph.getProperties()
+            << ". Performance (ms, " << threadPoolSize << " threads) rdGraph=" << rdGraphTime.count() / 1000.0
+            << ", rgdGraph=" << rgdGraphTime.count() / 1000.0 << ", greedy=" << greedyTime.count() / 1000.0
+            << ilpReport.str() << std::endl;
 
 #ifndef NDEBUG
     consistencyChecks("end of computeSchedules");
@@ -360,6 +812,11 @@ bool RGD_Graph::hasGD_Edges() const
     return !gdEdges.empty();
 }
 
+const std::vector<GD_Edge>& RGD_Graph::getGD_Edges() const
+{
+    return gdEdges;
+}
+
 void RGD_Graph::sortGD_Edges()
 {
     std::sort(gdEdges.rbegin(),gdEdges.rend() );
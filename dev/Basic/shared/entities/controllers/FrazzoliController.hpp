@@ -8,10 +8,18 @@
 #ifndef SHARED_ENTITIES_CONTROLLERS_FRAZZOLICONTROLLER_HPP_
 #define SHARED_ENTITIES_CONTROLLERS_FRAZZOLICONTROLLER_HPP_
 
+#include <functional>
+#include <boost/shared_ptr.hpp>
+
 #include "OnCallController.hpp"
 
 namespace sim_mob {
 
+namespace batched
+{
+class ThreadPool;
+}
+
 /**
  * This edge exists in the RV graph if the two requests can share the same ride
  */
@@ -38,7 +46,7 @@ class GD_Edge
 public:
     GD_Edge(const Group<TripRequestMessage>& requestGroup_, const Person* driver_, double cost_,
             const Schedule& schedule):
-        requestGroup(requestGroup_), driver(driver_),cost(cost_){};
+        requestGroup(requestGroup_), driver(driver_),cost(cost_), schedule(schedule){};
 
     GD_Edge(const GD_Edge& other):requestGroup(other.getRequestGroup()),driver(other.getDriver()),
             cost(other.getCost()), schedule(other.getSchedule() ){};
@@ -110,6 +118,11 @@ public:
 
     virtual GD_Edge popGD_Edge();
     virtual bool hasGD_Edges() const;
+
+    /**
+     * Returns the RequestGroup-to-Driver edges, in the order they have been added (or sorted)
+     */
+    const std::vector<GD_Edge>& getGD_Edges() const;
     void consistencyChecks() const;
 
 
@@ -134,14 +147,9 @@ class FrazzoliController: public OnCallController {
 public:
     FrazzoliController
         (const MutexStrategy& mtxStrat, unsigned int computationPeriod, unsigned id, std::string tripSupportMode_, TT_EstimateType ttEstimateType,
-         unsigned maxAggregatedRequests_, bool studyAreaEnabledController_, unsigned int tolerateExtraTime_,unsigned int maxWaitingTime_,bool parkingEnabled) :
-        OnCallController(mtxStrat, computationPeriod, MobilityServiceControllerType::SERVICE_CONTROLLER_FRAZZOLI, id, tripSupportMode_,
-                         ttEstimateType,maxAggregatedRequests_,studyAreaEnabledController_,tolerateExtraTime_,maxWaitingTime_,parkingEnabled),
-        requestGroupsPerOccupancy( std::vector< Group< Group<TripRequestMessage> > >(maxVehicleOccupancy)  )
-    {
-    }
-
+         unsigned maxAggregatedRequests_, bool studyAreaEnabledController_, unsigned int tolerateExtraTime_,unsigned int maxWaitingTime_,bool parkingEnabled);
 
+    virtual ~FrazzoliController();
 
 
 protected:
@@ -157,21 +165,96 @@ protected:
     virtual RGD_Graph generateRGD_Graph(const RD_Graph& rdGraph);
 
     /**
-     * This mimicks Algorithm 2 of Suppl.Material of [Frazzoli2017]
+     * This mimicks Algorithm 2 of Suppl.Material of [Frazzoli2017]: groups are taken from the largest to the
+     * smallest and, among groups of the same size, from the least to the most costly. A group-driver edge is
+     * selected if neither the driver nor any request of the group has been selected before.
+     * Returns the positions of the selected edges in rgdGraph.getGD_Edges()
+     */
+    virtual std::vector<size_t> greedyAssignment(const RGD_Graph& rgdGraph) const;
+
+    /**
+     * This mimicks Section 4 of Suppl.Material of [Frazzoli2017]: the assignment on the RGD graph is solved as an
+     * integer linear program with GLPK, minimizing the travel time of the selected group-driver edges plus a penalty
+     * for each request left unassigned. The greedy assignment is given to the solver as initial integer solution.
+     * Returns true and fills solution (positions in rgdGraph.getGD_Edges()) if the solver proves optimality within
+     * ilpTimeLimit. Returns false otherwise, in which case the greedy assignment has to be used
      */
-    virtual void greedyAssignment(RD_Graph& rdGraph, RGD_Graph& rgdGraph);
+    virtual bool ilpAssignment(const RGD_Graph& rgdGraph, const std::vector<size_t>& greedySolution,
+                               std::vector<size_t>& solution) const;
+
+    /**
+     * Sends the schedules of the selected group-driver edges and removes the assigned requests from the queue
+     */
+    void assignGD_Edges(const RGD_Graph& rgdGraph, const std::vector<size_t>& selectedEdges);
+
+    /**
+     * Travel time of the selected edges, i.e. the sum of their costs. Unlike the ILP objective, it does not include
+     * the penalties of the requests left unassigned
+     */
+    double getAssignmentCost(const RGD_Graph& rgdGraph, const std::vector<size_t>& selectedEdges) const;
 
     /**
      * Overrides the parent function
      */
     virtual void computeSchedules();
 
-    // requestGroupsPerOccupancy[i] will contain all the request groups of i+1 requests
-    std::vector< Group< Group<TripRequestMessage> > > requestGroupsPerOccupancy;
+    /**
+     * Whether the graphs are pruned with maxWaitingTime (controller attribute "waitingTimePruning"). This tightens
+     * the sharing constraints checked by canBeShared and computeSchedule, which do not use maxWaitingTime. Pruning
+     * relies on euclidean lower bounds of the travel times, hence it requires a positive maxWaitingTime and the
+     * euclidean travel time estimation
+     */
+    bool isWaitingTimePruningEnabled() const;
 
+    /**
+     * Upper bound of the euclidean travel time from a driver to the pick up of a request it can serve.
+     * computeSchedule rejects the schedules picking up a request more than waitingTimeThreshold after it was made
+     * and, as the euclidean travel times satisfy the triangle inequality, no schedule reaches the pick up faster than
+     * the direct travel from the driver. If isWaitingTimePruningEnabled(), the bound is at most maxWaitingTime.
+     * There is no bound (infinity) with the other travel time estimations
+     */
+    double getPickupTravelTimeBound() const;
 
+    /**
+     * Spatio-temporal pruning of request-request edges, applied before canBeShared. A vehicle serving both requests
+     * has to drive from one pick up to the other: the pair is discarded if, in both orders, the euclidean travel time
+     * between the pick ups exceeds what is left of maxWaitingTime for the request picked up second.
+     * No pruning is done if isWaitingTimePruningEnabled() is false, as canBeShared accepts any pair of requests
+     */
+    bool isSharingCandidate(const TripRequestMessage& r1, const TripRequestMessage& r2) const;
 
+    /**
+     * Spatial pruning of request-driver edges, applied before computeSchedule: the driver is discarded if the
+     * euclidean travel time to the pick up exceeds getPickupTravelTimeBound()
+     */
+    bool isPickupReachable(const Node* driverNode, const TripRequestMessage& request) const;
+
+    /**
+     * Runs task(0), ..., task(nTasks-1) on the thread pool (sequentially if the pool is disabled) and waits for
+     * all of them. The tasks must only read the controller state. If any task throws, the first error is re-thrown
+     * as std::runtime_error after all the tasks have completed
+     */
+    void runTasks(size_t nTasks, const std::function<void(size_t)>& task);
 
+    /**
+     * Pool used to build the RV and RTV graphs in parallel. Null if threadPoolSize is 1
+     */
+    boost::shared_ptr<batched::ThreadPool> threadPool;
+
+    /** Number of threads used to build the graphs (controller attribute "threadPoolSize") */
+    unsigned int threadPoolSize;
+
+    /** Whether the graphs are pruned with maxWaitingTime (controller attribute "waitingTimePruning") */
+    bool waitingTimePruningEnabled;
+
+    /** Whether the assignment is computed by ilpAssignment rather than greedyAssignment (controller attribute "ilpAssignment") */
+    bool ilpAssignmentEnabled;
+
+    /**
+     * Time given to GLPK at each schedule computation, in milliseconds (controller attribute "ilpTimeLimit").
+     * By default, it is the duration of the schedule computation period
+     */
+    unsigned int ilpTimeLimit;
 };
 
 } /* namespace sim_mob */
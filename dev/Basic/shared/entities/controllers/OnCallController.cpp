@@ -44,6 +44,7 @@ void OnCallController::subscribeDriver(Person *driver)
 
     MobilityServiceController::subscribeDriver(driver);
     availableDrivers.insert(driver);
+    indexAvailableDriver(driver);
 
 #ifndef NDEBUG
     if (driverSchedules.find(driver) != driverSchedules.end() )
@@ -90,6 +91,7 @@ void OnCallController::unsubscribeDriver(Person *driver)
     }
 
     availableDrivers.erase(driver);
+    availableDriversIndex.remove(driver);
     partiallyAvailableDrivers.erase(driver);
     driversServingSharedReq.erase(driver);
     currentReq.erase(driver);
@@ -119,6 +121,7 @@ void OnCallController::driverAvailable(const Person *driver)
 #endif
 
     availableDrivers.insert(driver);
+    indexAvailableDriver(driver);
 
     // The driver has an empty schedule now
     driverSchedules[driver] = Schedule();
@@ -140,6 +143,7 @@ void OnCallController::driverUnavailable(Person *person)
 #endif
 
     availableDrivers.erase(person);
+    availableDriversIndex.remove(person);
 
 #ifndef NDEBUG
     consistencyChecks("driverUnavailable: end");
@@ -232,6 +236,7 @@ Entity::UpdateStatus OnCallController::frame_tick(timeslice now)
                             << ", driversServingSharedReq.size() = "<<driversServingSharedReq.size() <<" , "<< currTick
                             << std::endl;
 
+            refreshAvailableDriversIndex();
             computeSchedules();
             ControllerLog() << "Computation schedule done: now " << requestQueue.size() << " requests are in the queue, available drivers "
                             << availableDrivers.size() <<", partiallyAvailableDrivers.size()="<< partiallyAvailableDrivers.size()
@@ -465,6 +470,7 @@ void OnCallController::assignSchedule(const Person *driver, const Schedule &sche
         driverSchedules[driver] = controllersCopy;
         // The driver is not available anymore
         availableDrivers.erase(driver);
+        availableDriversIndex.remove(driver);
     }
     else
     {
@@ -623,49 +629,49 @@ const Node *OnCallController::getCurrentNode(const Person *driver) const
 }
 
 
-const Person *OnCallController::findClosestDriver(const Node *node) const
+bool OnCallController::indexAvailableDriver(const Person *driver)
 {
-    double bestDistance = std::numeric_limits<double>::max();
-    double bestX, bestY;
+    if (isCruising(driver) || isParked(driver) || isJustStated(driver) || isDrivingToPark(driver))
+    {
+        availableDriversIndex.update(driver, getCurrentNode(driver));
+    }
+    else
+    {
+        availableDriversIndex.remove(driver);
+    }
 
-    const Person *bestDriver = NULL;
-    auto driver = availableDrivers.begin();
+    return availableDriversIndex.contains(driver);
+}
 
+void OnCallController::refreshAvailableDriversIndex()
+{
 #ifndef NDEBUG
-    unsigned nonCruisingDrivers = 0;
+    if (availableDriversIndex.size() > availableDrivers.size())
+    {
+        std::stringstream msg;
+        msg << "availableDriversIndex contains " << availableDriversIndex.size() << " drivers, but only "
+            << availableDrivers.size() << " drivers are available";
+        throw std::runtime_error(msg.str());
+    }
 #endif
 
-    while (driver != availableDrivers.end())
+    for (const Person *driver : availableDrivers)
     {
 #ifndef NDEBUG
-        if ( driverSchedules.find(*driver) == driverSchedules.end()  )
+        if ( driverSchedules.find(driver) == driverSchedules.end()  )
         {
             std::stringstream msg;
-            msg << "Driver " << (*driver)->getDatabaseId() << " and pointer " << *driver
+            msg << "Driver " << driver->getDatabaseId() << " and pointer " << driver
                 << " exists in availableDrivers but not in driverSchedules";
             throw std::runtime_error(msg.str());
         }
 #endif
-        if (isCruising(*driver) || isParked(*driver) || isJustStated(*driver) || isDrivingToPark(*driver))
+        if (!indexAvailableDriver(driver))
         {
-            const Node *driverNode = getCurrentNode(*driver);
-            double currDistance = dist(node->getLocation(), driverNode->getLocation());
-
-            if (currDistance < bestDistance)
-            {
-                bestDriver = *driver;
-                bestDistance = currDistance;
-                bestX = driverNode->getPosX();
-                bestY = driverNode->getPosY();
-            }
-        }
 #ifndef NDEBUG
-        else{
-            nonCruisingDrivers++;
-
-            const MobilityServiceDriver* mobilityServiceDriver = (*driver)->exportServiceDriver();
+            const MobilityServiceDriver* mobilityServiceDriver = driver->exportServiceDriver();
             const std::string driverStatusStr = mobilityServiceDriver->getDriverStatusStr();
-            std::stringstream msg; msg<<"Error: "<<__FILE__<<":" <<__LINE__<< ":Driver " << (*driver)->getDatabaseId() <<
+            std::stringstream msg; msg<<"Error: "<<__FILE__<<":" <<__LINE__<< ":Driver " << driver->getDatabaseId() <<
                 " is among the available drivers of a controller of type "<<
                 sim_mob::toString(controllerServiceType) <<", but her state is "<<
                 driverStatusStr<<
@@ -674,22 +680,25 @@ const Person *OnCallController::findClosestDriver(const Node *node) const
                     "ALL the available drivers MUST be cruising. If it is not the case, there is a bug. If you are running a more complex scenario, where a driver can be "
                     <<"subscribed to different services at the same time, please remove this exception, compile and run again";
             throw std::runtime_error(msg.str() );
-        }
 #endif
-        driver++;
+        }
     }
+}
+
+const Person *OnCallController::findClosestDriver(const Node *node) const
+{
+    const Person *bestDriver = availableDriversIndex.findNearest(node);
 
     std::stringstream msg;
     if (bestDriver != NULL)
     {
-        msg << "Closest vehicle is at (" << bestX << ", " << bestY << ")" << std::endl;
+        const Node *driverNode = availableDriversIndex.getIndexedNode(bestDriver);
+        msg << "Closest vehicle is at (" << driverNode->getPosX() << ", " << driverNode->getPosY() << ")" << std::endl;
     }
     else
     {
-        msg << "No available driver, availableDrivers.size()=" << availableDrivers.size();
-#ifndef NDEBUG
-        msg <<", cruisingDrivers="<<nonCruisingDrivers;
-#endif
+        msg << "No available driver, availableDrivers.size()=" << availableDrivers.size()
+            << ", indexedDrivers=" << availableDriversIndex.size();
         ControllerLog() << msg.str() << std::endl;
 #ifndef NDEBUG
         if (! availableDrivers.empty() )
@@ -705,6 +714,16 @@ const Person *OnCallController::findClosestDriver(const Node *node) const
     return bestDriver;
 }
 
+std::vector<const Person *> OnCallController::findKClosestDrivers(const Node *node, size_t k) const
+{
+    return availableDriversIndex.findKNearest(node, k);
+}
+
+std::vector<const Person *> OnCallController::findDriversWithinRadius(const Node *node, double radius) const
+{
+    return availableDriversIndex.findWithinRadius(node, radius);
+}
+
 
 double OnCallController::evaluateSchedule(const Node *initialPosition, const Schedule &schedule,
                                           double additionalDelayThreshold, double waitingTimeThreshold) const
@@ -12,6 +12,7 @@
 #include <unordered_map>
 
 #include "entities/Agent.hpp"
+#include "entities/controllers/DriverGridIndex.hpp"
 #include "entities/controllers/Rebalancer.hpp"
 #include "message/Message.hpp"
 #include "message/MobilityServiceControllerMessage.hpp"
@@ -137,6 +138,16 @@ public:
      */
     virtual const Person* findClosestDriver(const Node* node) const;
 
+    /**
+     * Returns up to k available drivers closest to the node, sorted by increasing distance
+     */
+    std::vector<const Person*> findKClosestDrivers(const Node* node, size_t k) const;
+
+    /**
+     * Returns the available drivers within radius meters (euclidean) of the node, sorted by increasing distance
+     */
+    std::vector<const Person*> findDriversWithinRadius(const Node* node, double radius) const;
+
     virtual const std::string getRequestQueueStr() const;
 
     virtual void sendCruiseCommand(const Person* driver, const Node* nodeToCruiseTo, const timeslice currTick ) const;
@@ -187,6 +198,13 @@ protected:
     /** Store list of available drivers */
     std::set<const Person *> availableDrivers;
 
+    /**
+     * Spatial index of the available drivers that can be dispatched (cruising, parked, just started or driving
+     * to park), bucketed by their current node. It is kept in sync with availableDrivers and the positions are
+     * refreshed at the beginning of each schedule computation
+     */
+    DriverGridIndex availableDriversIndex;
+
     /** Store queue of requests */
     std::list<TripRequestMessage> requestQueue;
 
@@ -273,6 +291,20 @@ protected:
      */
     virtual void computeSchedules() = 0;
 
+    /**
+     * Inserts the driver in availableDriversIndex at her current node if she can be dispatched, removes her otherwise
+     * @param driver an available driver
+     * @return true if the driver is indexed
+     */
+    bool indexAvailableDriver(const Person* driver);
+
+    /**
+     * Re-reads the status and current node of all the available drivers and updates availableDriversIndex
+     * accordingly. This is done once per schedule computation, so that the nearest driver queries do not need
+     * to look at the whole fleet
+     */
+    void refreshAvailableDriversIndex();
+
     /**
      * Computes a hypothetical schedule such that a driver located at a certain position can serve her current schedule
      * as well as additional requests. The hypothetical schedule is written in newSchedule.
@@ -0,0 +1,169 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace sim_mob
+{
+
+/**
+ * Vector-backed lookup of the elements of an id map of the road network.
+ *
+ * The elements are stored in a vector, in the order of their ids, and each id is remapped to the compact index of
+ * its element. When the ids are dense, the index of an id is read from a table covering the range of the ids;
+ * otherwise it is found by a binary search of the sorted ids.
+ *
+ * The index is a snapshot of the map it is built from. The owner of the map keeps a generation counter, which it
+ * increments whenever it modifies the map, and the index is only used while the generation is the one it was built
+ * for (see isIndexOf()).
+ */
+template<class T>
+class IdIndex
+{
+private:
+    /**Marks the ids of the range that are not in the map*/
+    static const unsigned int NO_INDEX = std::numeric_limits<unsigned int>::max();
+
+    /**The ranges of ids up to this many times the number of elements are remapped through a table*/
+    static const size_t MAX_TABLE_FACTOR = 4;
+
+    /**The map from which the index was built*/
+    const std::map<unsigned int, T *> *source;
+
+    /**Generation of the map when the index was built*/
+    unsigned int sourceGeneration;
+
+    /**Number of elements of the map when the index was built*/
+    size_t sourceSize;
+
+    /**The elements, by compact index*/
+    std::vector<T *> elements;
+
+    /**The ids of the elements, by compact index. Only used when the ids are sparse*/
+    std::vector<unsigned int> ids;
+
+    /**The compact index of each id of the range [minId, minId + table.size()). Empty when the ids are sparse*/
+    std::vector<unsigned int> table;
+
+    /**Smallest id of the map*/
+    unsigned int minId;
+
+public:
+    IdIndex() : source(nullptr), sourceGeneration(0), sourceSize(0), minId(0)
+    {
+    }
+
+    /**
+     * Builds the index of the elements of a map
+     *
+     * @param map the map to index
+     * @param generation the current generation of the map
+     */
+    void build(const std::map<unsigned int, T *> &map, unsigned int generation)
+    {
+        source = &map;
+        sourceGeneration = generation;
+        sourceSize = map.size();
+        elements.clear();
+        ids.clear();
+        table.clear();
+        minId = 0;
+
+        if (map.empty())
+        {
+            return;
+        }
+
+        elements.reserve(map.size());
+        for (typename std::map<unsigned int, T *>::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            elements.push_back(it->second);
+        }
+
+        minId = map.begin()->first;
+        size_t range = static_cast<size_t>(map.rbegin()->first - minId) + 1;
+
+        if (range <= MAX_TABLE_FACTOR * map.size())
+        {
+            table.assign(range, NO_INDEX);
+            unsigned int index = 0;
+            for (typename std::map<unsigned int, T *>::const_iterator it = map.begin(); it != map.end(); ++it, ++index)
+            {
+                table[it->first - minId] = index;
+            }
+        }
+        else
+        {
+            ids.reserve(map.size());
+            for (typename std::map<unsigned int, T *>::const_iterator it = map.begin(); it != map.end(); ++it)
+            {
+                ids.push_back(it->first);
+            }
+        }
+    }
+
+    /**
+     * Checks whether the index holds the elements of a map
+     *
+     * @param map the map
+     * @param generation the current generation of the map
+     * @return true if the index was built from the map, and the map has not been modified since
+     */
+    bool isIndexOf(const std::map<unsigned int, T *> &map, unsigned int generation) const
+    {
+        return source == &map && sourceGeneration == generation && sourceSize == map.size();
+    }
+
+    /**
+     * Looks up the element with the given id
+     *
+     * @param id the id to look-up
+     * @return the element with the id, if found; NULL otherwise
+     */
+    T* get(unsigned int id) const
+    {
+        if (!table.empty())
+        {
+            if (id < minId || id - minId >= table.size())
+            {
+                return nullptr;
+            }
+
+            unsigned int index = table[id - minId];
+            return (index != NO_INDEX) ? elements[index] : nullptr;
+        }
+
+        std::vector<unsigned int>::const_iterator itIds = std::lower_bound(ids.begin(), ids.end(), id);
+
+        if (itIds != ids.end() && *itIds == id)
+        {
+            return elements[itIds - ids.begin()];
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    /**
+     * @return the elements, by compact index
+     */
+    const std::vector<T *>& getElements() const
+    {
+        return elements;
+    }
+};
+
+template<class T>
+const unsigned int IdIndex<T>::NO_INDEX;
+
+template<class T>
+const size_t IdIndex<T>::MAX_TABLE_FACTOR;
+
+}
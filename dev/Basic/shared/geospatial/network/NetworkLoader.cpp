@@ -4,6 +4,7 @@
 
 #include "NetworkLoader.hpp"
 
+#include <cctype>
 #include <stdexcept>
 #include "logging/Log.hpp"
 #include "SOCI_Converters.hpp"
@@ -65,9 +66,133 @@ string getStoredProcedure(const map<string, string>& storedProcs, const string&
         throw std::runtime_error("Stored-procedure '" + procedureName + "' not found in the configuration file");
     }
 }
+
+/**Returns the file of the network snapshot, given by the generic property 'network_snapshot' (none if empty)*/
+string getNetworkSnapshotFile()
+{
+    const ConfigParams &config = ConfigManager::GetInstance().FullConfig();
+    map<string, string>::const_iterator itProperty = config.genericProps.find("network_snapshot");
+
+    if (itProperty != config.genericProps.end())
+    {
+        return itProperty->second;
+    }
+    else
+    {
+        return "";
+    }
+}
+
+/**
+ * Returns the version of the network given by the generic property 'network_snapshot_version' (none if empty).
+ * A snapshot saved for another version is ignored
+ */
+string getNetworkSnapshotVersion()
+{
+    const ConfigParams &config = ConfigManager::GetInstance().FullConfig();
+    map<string, string>::const_iterator itProperty = config.genericProps.find("network_snapshot_version");
+
+    if (itProperty != config.genericProps.end())
+    {
+        return itProperty->second;
+    }
+    else
+    {
+        return "";
+    }
+}
+
+/**
+ * Returns the host, port, database and user of a libpq connection string ("key=value" or "key='value'" parameters),
+ * which identify the database of the network snapshot. The other parameters, such as the password, are left out
+ */
+string getDatabaseSource(const string &connectionStr)
+{
+    static const char *const SOURCE_KEYS[] = {"host", "hostaddr", "port", "dbname", "user"};
+    map<string, string> values;
+    size_t pos = 0;
+
+    while (pos < connectionStr.size())
+    {
+        if (isspace(static_cast<unsigned char>(connectionStr[pos])))
+        {
+            pos++;
+            continue;
+        }
+
+        size_t keyEnd = pos;
+        while (keyEnd < connectionStr.size() && connectionStr[keyEnd] != '='
+               && !isspace(static_cast<unsigned char>(connectionStr[keyEnd])))
+        {
+            keyEnd++;
+        }
+        const string key = connectionStr.substr(pos, keyEnd - pos);
+
+        pos = keyEnd;
+        while (pos < connectionStr.size() && isspace(static_cast<unsigned char>(connectionStr[pos])))
+        {
+            pos++;
+        }
+
+        //A word without value, e.g. the rest of an unquoted password containing spaces
+        if (pos == connectionStr.size() || connectionStr[pos] != '=')
+        {
+            continue;
+        }
+
+        pos++;
+        while (pos < connectionStr.size() && isspace(static_cast<unsigned char>(connectionStr[pos])))
+        {
+            pos++;
+        }
+
+        string value;
+        if (pos < connectionStr.size() && connectionStr[pos] == '\'')
+        {
+            for (pos++; pos < connectionStr.size() && connectionStr[pos] != '\''; pos++)
+            {
+                if (connectionStr[pos] == '\\' && pos + 1 < connectionStr.size())
+                {
+                    pos++;
+                }
+                value.push_back(connectionStr[pos]);
+            }
+            pos++;
+        }
+        else
+        {
+            while (pos < connectionStr.size() && !isspace(static_cast<unsigned char>(connectionStr[pos])))
+            {
+                value.push_back(connectionStr[pos++]);
+            }
+        }
+
+        values[key] = value;
+    }
+
+    string source;
+    for (const char *key : SOURCE_KEYS)
+    {
+        map<string, string>::const_iterator itValue = values.find(key);
+        if (itValue != values.end())
+        {
+            source += (source.empty() ? "" : " ") + itValue->first + "=" + itValue->second;
+        }
+    }
+    return source;
 }
 
-NetworkLoader::NetworkLoader() : roadNetwork(RoadNetwork::getWritableInstance()), isNetworkLoaded(false)
+/**Converts a row of a network table to a network element*/
+template<class T>
+void fromRow(const soci::row &row, T &element)
+{
+    soci::indicator ind = soci::i_ok;
+    soci::type_conversion<T>::from_base(row, ind, element);
+}
+}
+
+NetworkLoader::NetworkLoader() : roadNetwork(RoadNetwork::getWritableInstance()), isConnected(false), isReadFromDatabase(false),
+                                 isNetworkLoaded(false)
 {
 }
 
@@ -79,12 +204,15 @@ NetworkLoader::~NetworkLoader()
 void NetworkLoader::loadLanes(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<Lane> lanes = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> lanes(readTable("lanes", "select * from " + storedProc));
 
-    for (soci::rowset<Lane>::const_iterator itLanes = lanes.begin(); itLanes != lanes.end(); ++itLanes)
+    while (lanes->next())
     {
+        Lane laneRow;
+        fromRow(lanes->getRow(), laneRow);
+
         //Create new lane and add it to the segment to which it belongs
-        Lane *lane = new Lane(*itLanes);
+        Lane *lane = new Lane(laneRow);
 
         try
         {
@@ -116,13 +244,16 @@ void NetworkLoader::loadLanes(const std::string& storedProc)
 void NetworkLoader::loadLaneConnectors(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<LaneConnector> connectors = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> connectors(readTable("lane_connectors", "select * from " + storedProc));
     unsigned long connectorsLoaded = 0;
 
-    for (soci::rowset<LaneConnector>::const_iterator itConnectors = connectors.begin(); itConnectors != connectors.end(); ++itConnectors)
+    while (connectors->next())
     {
+        LaneConnector laneConnectorRow;
+        fromRow(connectors->getRow(), laneConnectorRow);
+
         //Create new lane connector and add it to the lane to which it belongs
-        LaneConnector *connector = new LaneConnector(*itConnectors);
+        LaneConnector *connector = new LaneConnector(laneConnectorRow);
 
         try
         {
@@ -153,13 +284,14 @@ void NetworkLoader::loadLaneConnectors(const std::string& storedProc)
 void NetworkLoader::loadLanePolyLines(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<PolyPoint> points = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> points(readTable("lane_polylines", "select * from " + storedProc));
     unsigned int prevLineId = 0, linesLoaded = 0;
 
-    for (soci::rowset<PolyPoint>::const_iterator itPoints = points.begin(); itPoints != points.end(); ++itPoints)
+    while (points->next())
     {
         //Create new point and add it to the poly-line, to which it belongs
-        PolyPoint point(*itPoints);
+        PolyPoint point;
+        fromRow(points->getRow(), point);
 
         try
         {
@@ -195,12 +327,15 @@ void NetworkLoader::loadLanePolyLines(const std::string& storedProc)
 void NetworkLoader::loadLinks(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<Link> links = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> links(readTable("links", "select * from " + storedProc));
 
-    for (soci::rowset<Link>::const_iterator itLinks = links.begin(); itLinks != links.end(); ++itLinks)
+    while (links->next())
     {
+        Link linkRow;
+        fromRow(links->getRow(), linkRow);
+
         //Create new node and add it in the map of nodes
-        Link* link = new Link(*itLinks);
+        Link* link = new Link(linkRow);
 
         try
         {
@@ -232,12 +367,15 @@ void NetworkLoader::loadLinks(const std::string& storedProc)
 void NetworkLoader::loadNodes(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<Node> nodes = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> nodes(readTable("nodes", "select * from " + storedProc));
     std::set<sim_mob::Node*> nodesSet;
-    for (soci::rowset<Node>::const_iterator itNodes = nodes.begin(); itNodes != nodes.end(); ++itNodes)
+    while (nodes->next())
     {
+        Node nodeRow;
+        fromRow(nodes->getRow(), nodeRow);
+
         //Create new node and add it in the map of nodes
-        Node* node = new Node(*itNodes);
+        Node* node = new Node(nodeRow);
         roadNetwork->addNode(node);
         nodesSet.insert(node);
     }
@@ -262,12 +400,15 @@ void NetworkLoader::loadNodes(const std::string& storedProc)
 void NetworkLoader::loadRoadSegments(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<RoadSegment> segments = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> segments(readTable("road_segments", "select * from " + storedProc));
 
-    for (soci::rowset<RoadSegment>::const_iterator itSegments = segments.begin(); itSegments != segments.end(); ++itSegments)
+    while (segments->next())
     {
+        RoadSegment roadSegmentRow;
+        fromRow(segments->getRow(), roadSegmentRow);
+
         //Create new road segment and add it to the link to which it belongs
-        RoadSegment *segment = new RoadSegment(*itSegments);
+        RoadSegment *segment = new RoadSegment(roadSegmentRow);
 
         try
         {
@@ -299,13 +440,14 @@ void NetworkLoader::loadRoadSegments(const std::string& storedProc)
 void NetworkLoader::loadSegmentPolyLines(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<PolyPoint> points = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> points(readTable("segment_polylines", "select * from " + storedProc));
     unsigned int prevLineId = 0, linesLoaded = 0;
 
-    for (soci::rowset<PolyPoint>::const_iterator itPoints = points.begin(); itPoints != points.end(); ++itPoints)
+    while (points->next())
     {
         //Create new point and add it to the poly-line, to which it belongs
-        PolyPoint point(*itPoints);
+        PolyPoint point;
+        fromRow(points->getRow(), point);
 
         try
         {
@@ -341,12 +483,15 @@ void NetworkLoader::loadSegmentPolyLines(const std::string& storedProc)
 void NetworkLoader::loadTurningConflicts(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<TurningConflict> turningConflicts = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> turningConflicts(readTable("turning_conflicts", "select * from " + storedProc));
 
-    for (soci::rowset<TurningConflict>::const_iterator itTurningConflicts = turningConflicts.begin(); itTurningConflicts != turningConflicts.end(); ++itTurningConflicts)
+    while (turningConflicts->next())
     {
+        TurningConflict turningConflictRow;
+        fromRow(turningConflicts->getRow(), turningConflictRow);
+
         //Create new turning conflict and add it to the turning paths to which it belongs
-        TurningConflict* turningConflict = new TurningConflict(*itTurningConflicts);
+        TurningConflict* turningConflict = new TurningConflict(turningConflictRow);
 
         try
         {
@@ -369,12 +514,15 @@ void NetworkLoader::loadTurningConflicts(const std::string& storedProc)
 void NetworkLoader::loadTurningGroups(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<TurningGroup> turningGroups = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> turningGroups(readTable("turning_groups", "select * from " + storedProc));
 
-    for (soci::rowset<TurningGroup>::const_iterator itTurningGroups = turningGroups.begin(); itTurningGroups != turningGroups.end(); ++itTurningGroups)
+    while (turningGroups->next())
     {
+        TurningGroup turningGroupRow;
+        fromRow(turningGroups->getRow(), turningGroupRow);
+
         //Create new turning group and add it in the map of turning groups
-        TurningGroup* turningGroup = new TurningGroup(*itTurningGroups);
+        TurningGroup* turningGroup = new TurningGroup(turningGroupRow);
 
         try
         {
@@ -406,12 +554,15 @@ void NetworkLoader::loadTurningGroups(const std::string& storedProc)
 void NetworkLoader::loadTurningPaths(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<TurningPath> turningPaths = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> turningPaths(readTable("turning_paths", "select * from " + storedProc));
 
-    for (soci::rowset<TurningPath>::const_iterator itTurningPaths = turningPaths.begin(); itTurningPaths != turningPaths.end(); ++itTurningPaths)
+    while (turningPaths->next())
     {
+        TurningPath turningPathRow;
+        fromRow(turningPaths->getRow(), turningPathRow);
+
         //Create new turning path and add it in the map of turning paths
-        TurningPath* turningPath = new TurningPath(*itTurningPaths);
+        TurningPath* turningPath = new TurningPath(turningPathRow);
 
         try
         {
@@ -443,13 +594,14 @@ void NetworkLoader::loadTurningPaths(const std::string& storedProc)
 void NetworkLoader::loadTurningPolyLines(const std::string& storedProc)
 {
     //SQL statement
-    soci::rowset<PolyPoint> points = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> points(readTable("turning_polylines", "select * from " + storedProc));
     unsigned int prevLineId = 0, linesLoaded = 0;
 
-    for (soci::rowset<PolyPoint>::const_iterator itPoints = points.begin(); itPoints != points.end(); ++itPoints)
+    while (points->next())
     {
         //Create new point and add it to the poly-line, to which it belongs
-        PolyPoint point(*itPoints);
+        PolyPoint point;
+        fromRow(points->getRow(), point);
 
         try
         {
@@ -495,14 +647,17 @@ void NetworkLoader::loadTaxiStands(const std::string& storedProc)
     }
 
     //SQL statement
-    soci::rowset<sim_mob::TaxiStand> stands = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> stands(readTable("taxi_stands", "select * from " + storedProc));
     std::set<sim_mob::TaxiStand*> standSet;
-    for (soci::rowset<TaxiStand>::const_iterator itStand = stands.begin(); itStand != stands.end(); ++itStand)
+    while (stands->next())
     {
+        TaxiStand taxiStandRow;
+        fromRow(stands->getRow(), taxiStandRow);
+
         try
         {
             //Create new taxi stand and add it to road network
-            TaxiStand* stand = new TaxiStand(*itStand);
+            TaxiStand* stand = new TaxiStand(taxiStandRow);
             roadNetwork->addTaxiStand(stand);
             standSet.insert(stand);
             TaxiStand::allTaxiStandMap.update(standSet);
@@ -535,20 +690,21 @@ void NetworkLoader::loadSurveillanceStns(const string &storedProc)
     if(!storedProc.empty())
     {
         //SQL statement
-        soci::rowset<soci::row> surveillanceStns = (sql.prepare << "select * from " + storedProc);
+        boost::scoped_ptr<NetworkSnapshot::Rows> surveillanceStns(readTable("traffic_sensors", "select * from " + storedProc));
 
         unsigned int id, type, code, segmentId, trafficLight;
         double zone, offset;
 
-        for(soci::rowset<soci::row>::const_iterator itStn = surveillanceStns.begin(); itStn != surveillanceStns.end(); ++itStn)
+        while (surveillanceStns->next())
         {
-            id = (*itStn).get<unsigned int>(0);
-            type = (*itStn).get<unsigned int>(1);
-            code = (*itStn).get<unsigned int>(2);
-            zone = (*itStn).get<double>(3);
-            offset = (*itStn).get<double>(4);
-            segmentId = (*itStn).get<unsigned int>(5);
-            trafficLight = (*itStn).get<unsigned int>(6);
+            const soci::row &stn = surveillanceStns->getRow();
+            id = stn.get<unsigned int>(0);
+            type = stn.get<unsigned int>(1);
+            code = stn.get<unsigned int>(2);
+            zone = stn.get<double>(3);
+            offset = stn.get<double>(4);
+            segmentId = stn.get<unsigned int>(5);
+            trafficLight = stn.get<unsigned int>(6);
 
             //Create a new surveillance station and add it to the network
             SurveillanceStation *station = new SurveillanceStation(id, type, code, zone, offset, segmentId, trafficLight);
@@ -604,22 +760,25 @@ void NetworkLoader::loadBusStops(const std::string& storedProc)
     }
 
     //SQL statement
-    soci::rowset<sim_mob::BusStop> stops = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> stops(readTable("bus_stops", "select * from " + storedProc));
 
-    for (soci::rowset<BusStop>::const_iterator itStop = stops.begin(); itStop != stops.end(); ++itStop)
+    while (stops->next())
     {
-        if (!sim_mob::ConfigManager::GetInstance().FullConfig().isGenerateBusRoutes() && itStop->getStopName().find("Virtual Bus Stop") != std::string::npos)
+        BusStop busStopRow;
+        fromRow(stops->getRow(), busStopRow);
+
+        if (!sim_mob::ConfigManager::GetInstance().FullConfig().isGenerateBusRoutes() && busStopRow.getStopName().find("Virtual Bus Stop") != std::string::npos)
         {
             continue;
         }
         
-        if (!itStop->getStopStatus().compare("NOP"))
+        if (!busStopRow.getStopStatus().compare("NOP"))
         {
             continue;
         }
 
         //Create new bus stop and add it to road network
-        BusStop* stop = new BusStop(*itStop);
+        BusStop* stop = new BusStop(busStopRow);
 
         //hackish data validation to evade errors
         if(stop->getLength() < sim_mob::BUS_LENGTH)
@@ -707,12 +866,15 @@ void NetworkLoader::loadParkingSlots(const std::string& storedProc)
     }
 
     //SQL statement
-    soci::rowset<ParkingSlot> pkSlots = (sql.prepare << "select * from " + storedProc);
+    boost::scoped_ptr<NetworkSnapshot::Rows> pkSlots(readTable("parking_slots", "select * from " + storedProc));
 
-    for (soci::rowset<ParkingSlot>::const_iterator itPkSlots = pkSlots.begin(); itPkSlots != pkSlots.end(); ++itPkSlots)
+    while (pkSlots->next())
     {
+        ParkingSlot parkingSlotRow;
+        fromRow(pkSlots->getRow(), parkingSlotRow);
+
         //Create new parking slot and add it to the netowrk
-        ParkingSlot *parkingSlot = new ParkingSlot(*itPkSlots);
+        ParkingSlot *parkingSlot = new ParkingSlot(parkingSlotRow);
 
         try
         {
@@ -761,28 +923,29 @@ void NetworkLoader::loadSMSVehicleParking(const std::string &storedProc)
     }
 
     //SQL statement
-    soci::session sql_(soci::postgresql,config.getDatabaseConnectionString(false));
     std::stringstream query;
 
     const SimulationParams &simParams = ConfigManager::GetInstance().FullConfig().simulation;
 
     query << "select * from " << storedProc << "('" << simParams.simStartTime.getStrRepr().substr(0, 5)
           << "','" << (DailyTime(simParams.totalRuntimeMS) + simParams.simStartTime).getStrRepr().substr(0, 5) << "')";
-    soci::rowset<soci::row> rs = (sql_.prepare << query.str());
+    boost::scoped_ptr<NetworkSnapshot::Rows> rs(readTable("sms_parking", query.str()));
 
     std::set<SMSVehicleParking*> allParkingLocations;
 
-    for (soci::rowset<soci::row>::const_iterator itParking = rs.begin(); itParking != rs.end(); ++itParking)
+    while (rs->next())
     {
+        const soci::row &parking = rs->getRow();
+
         //Create new parking detail  and add it to the netowrk
         SMSVehicleParking *smsVehicleParking = new SMSVehicleParking();
-        smsVehicleParking->setParkingId((*itParking).get<std::string>(PARKING_ID));
-        smsVehicleParking->setParkingType((*itParking).get<int>(PARKING_TYPE));
-        smsVehicleParking->setVehicleType((*itParking).get<int>(VEH_TYPE_ID));
-        smsVehicleParking->setCapacityPCU((*itParking).get<int>(CAPACITY_PCU));
-        smsVehicleParking->setSegmentId((*itParking).get<unsigned int>(SEGMENT_ID));
-        smsVehicleParking->setStartTime(getSecondFrmTimeString((*itParking).get<std::string>(START_TIME)));
-        smsVehicleParking->setEndTime(getSecondFrmTimeString((*itParking).get<std::string>(END_TIME)));
+        smsVehicleParking->setParkingId(parking.get<std::string>(PARKING_ID));
+        smsVehicleParking->setParkingType(parking.get<int>(PARKING_TYPE));
+        smsVehicleParking->setVehicleType(parking.get<int>(VEH_TYPE_ID));
+        smsVehicleParking->setCapacityPCU(parking.get<int>(CAPACITY_PCU));
+        smsVehicleParking->setSegmentId(parking.get<unsigned int>(SEGMENT_ID));
+        smsVehicleParking->setStartTime(getSecondFrmTimeString(parking.get<std::string>(START_TIME)));
+        smsVehicleParking->setEndTime(getSecondFrmTimeString(parking.get<std::string>(END_TIME)));
 
         try
         {
@@ -816,12 +979,69 @@ void NetworkLoader::loadSMSVehicleParking(const std::string &storedProc)
 }
 
 
+void NetworkLoader::loadLoopNodes(const std::string &storedProc)
+{
+    if (storedProc.empty())
+    {
+        return;
+    }
+
+    //SQL statement
+    boost::scoped_ptr<NetworkSnapshot::Rows> loopNodes(readTable("loop_nodes", "select * from " + storedProc));
+
+    while (loopNodes->next())
+    {
+        roadNetwork->addLoopNode(loopNodes->getRow().get<unsigned int>(0));
+    }
+}
+
+soci::session& NetworkLoader::getSession()
+{
+    if (!isConnected)
+    {
+        sql.open(soci::postgresql, connectionString);
+        isConnected = true;
+    }
+
+    return sql;
+}
+
+NetworkSnapshot::Rows* NetworkLoader::readTable(const std::string &name, const std::string &query)
+{
+    if (snapshot)
+    {
+        const NetworkSnapshot::Table *table = snapshot->getTable(name, query);
+
+        if (table)
+        {
+            return new NetworkSnapshot::Rows(*table);
+        }
+
+        //Record the rows read from the database in the snapshot
+        isReadFromDatabase = true;
+        return new NetworkSnapshot::Rows(getSession(), query, &snapshot->recordTable(name, query));
+    }
+
+    isReadFromDatabase = true;
+    return new NetworkSnapshot::Rows(getSession(), query, nullptr);
+}
+
 void NetworkLoader::loadNetwork(const string& connectionStr, const map<string, string>& storedProcs)
 {
     try
     {
-        //Open the connection to the database
-        sql.open(soci::postgresql, connectionStr);
+        //The connection to the database is only opened if a table is not read from the network snapshot
+        connectionString = connectionStr;
+        isReadFromDatabase = false;
+
+        const std::string snapshotFile = getNetworkSnapshotFile();
+
+        if (!snapshotFile.empty())
+        {
+            snapshot.reset(new NetworkSnapshot(snapshotFile, getDatabaseSource(connectionStr),
+                                               getNetworkSnapshotVersion()));
+            snapshot->load();
+        }
 
         //Load the components of the network
 
@@ -862,14 +1082,32 @@ void NetworkLoader::loadNetwork(const string& connectionStr, const map<string, s
         loadTaxiStands(getStoredProcedure(storedProcs, "taxi_stands", false));
         loadSMSVehicleParking(getStoredProcedure(storedProcs, "sms_parking", false));
 
+        loadLoopNodes(getStoredProcedure(storedProcs, "loop_nodes", false));
+
         //Close the connection
-        sql.close();
+        if (isConnected)
+        {
+            sql.close();
+            isConnected = false;
+        }
 
-        roadNetwork->loadLoopNodesOfNetwork();
+        //Save the tables read from the database to the snapshot
+        if (snapshot)
+        {
+            snapshot->save();
+            snapshot.reset();
+        }
 
         isNetworkLoaded = true;
 
-        Print() << "\nSimMobility Road Network loaded from database\n";
+        if (isReadFromDatabase)
+        {
+            Print() << "\nSimMobility Road Network loaded from database\n";
+        }
+        else
+        {
+            Print() << "\nSimMobility Road Network loaded from network snapshot " << snapshotFile << "\n";
+        }
     }
     catch (soci::soci_error const &err)
     {
@@ -894,6 +1132,9 @@ void NetworkLoader::processNetwork()
         itLinks->second->calculateLength();
         ++itLinks;
     }
+
+    //Remap the ids of the network elements to their vector-backed lookups
+    roadNetwork->buildIdIndices();
 }
 
 NetworkLoader* NetworkLoader::getInstance()
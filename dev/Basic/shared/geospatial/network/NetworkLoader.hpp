@@ -6,8 +6,10 @@
 
 #include <map>
 #include <string>
+#include <boost/scoped_ptr.hpp>
 #include <soci/soci.h>
 #include <soci/postgresql/soci-postgresql.h>
+#include "NetworkSnapshot.hpp"
 #include "RoadNetwork.hpp"
 
 using namespace std;
@@ -33,12 +35,39 @@ private:
     /**The database connection session*/
     soci::session sql;
 
+    /**The database connection string*/
+    std::string connectionString;
+
+    /**Indicates whether the database connection session is open*/
+    bool isConnected;
+
+    /**Indicates whether the rows of a table were read from the database, rather than from the snapshot*/
+    bool isReadFromDatabase;
+
+    /**The snapshot of the network tables, if the generic property 'network_snapshot' gives its file*/
+    boost::scoped_ptr<NetworkSnapshot> snapshot;
+
     /**Indicates whether the road network has been loaded successfully*/
     bool isNetworkLoaded;
 
     /**Private constructor as the class is a singleton*/
     NetworkLoader();
 
+    /**
+     * Returns the database connection session, opening it if required
+     */
+    soci::session& getSession();
+
+    /**
+     * Reads the rows of a network table from the snapshot, if it holds them for the given query, or else from the
+     * database. The rows read from the database are recorded in the snapshot, if any
+     *
+     * @param name - the name of the table in the snapshot
+     * @param query - the query that returns the rows
+     * @return the rows, to be deleted by the caller
+     */
+    NetworkSnapshot::Rows* readTable(const std::string& name, const std::string& query);
+
     /**
      * Loads the lanes using the given stored procedure
      *
@@ -151,6 +180,13 @@ private:
      */
     void loadSurveillanceStns(const std::string& storedProc);
 
+    /**
+     * Loads the nodes that are the start and end of loops in the network using the given stored procedure
+     *
+     * @param storedProc - the stored procedure to be executed in order to retrieve the data
+     */
+    void loadLoopNodes(const std::string& storedProc);
+
 public:
     virtual ~NetworkLoader();
 
@@ -159,7 +195,10 @@ public:
 
     /**
      * Connects to the database using the given connection string and then loads the components of the
-     * network from the database using the stored procedures specified in the given map of stored procedures
+     * network from the database using the stored procedures specified in the given map of stored procedures.
+     * If the generic property 'network_snapshot' is set, the rows of the stored procedures are read from the
+     * snapshot file it names, and the rows that are not in the snapshot are read from the database and saved to it.
+     * The snapshot is ignored if it was saved from another database or for another 'network_snapshot_version'
      *
      * @param connectionStr - the database connection string
      * @param storedProcs - the map of stored procedures
@@ -169,7 +208,7 @@ public:
     void populateStudyArea();
 
     /**
-     * This method does post processing on the road network
+     * This method does post processing on the road network, and builds the vector-backed lookups of its id maps
      */
     void processNetwork();
 };
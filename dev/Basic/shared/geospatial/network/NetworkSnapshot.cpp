@@ -0,0 +1,616 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "NetworkSnapshot.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <boost/cstdint.hpp>
+#include "logging/Log.hpp"
+
+using namespace sim_mob;
+
+namespace
+{
+const char FILE_MAGIC[8] = {'S', 'M', 'N', 'E', 'T', 'W', 'R', 'K'};
+const boost::uint32_t FILE_VERSION = 3;
+
+const char VALUE_OK = 0;
+const char VALUE_NULL = 1;
+
+template <typename T>
+void appendValue(std::string& data, const T& value)
+{
+    data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T extractValue(const std::string& data, size_t& offset)
+{
+    if (offset + sizeof(T) > data.size())
+    {
+        throw std::runtime_error("Network snapshot: the rows of a table are truncated");
+    }
+
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+template <typename T>
+void writeValue(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& in, T& value)
+{
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+void writeString(std::ostream& out, const std::string& value)
+{
+    writeValue(out, static_cast<boost::uint64_t>(value.size()));
+    out.write(value.data(), value.size());
+}
+
+/**
+ * Reads a string, which can not be longer than the given length (e.g. the size of the file)
+ */
+bool readString(std::istream& in, std::string& value, boost::uint64_t maxLength)
+{
+    boost::uint64_t length = 0;
+    if (!readValue(in, length) || length > maxLength)
+    {
+        return false;
+    }
+    value.resize(length);
+    return length == 0 || static_cast<bool>(in.read(&value[0], length));
+}
+
+bool isSupported(soci::data_type dataType)
+{
+    switch (dataType)
+    {
+    case soci::dt_integer:
+    case soci::dt_long_long:
+    case soci::dt_unsigned_long_long:
+    case soci::dt_double:
+    case soci::dt_string:
+    case soci::dt_date:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * Returns the size of a value of a column in the data of a table, or 0 for a string (which is preceded by its length)
+ */
+size_t getValueSize(soci::data_type dataType)
+{
+    switch (dataType)
+    {
+    case soci::dt_integer:
+        return sizeof(boost::int32_t);
+    case soci::dt_long_long:
+        return sizeof(boost::int64_t);
+    case soci::dt_unsigned_long_long:
+        return sizeof(boost::uint64_t);
+    case soci::dt_double:
+        return sizeof(double);
+    case soci::dt_string:
+        return 0;
+    default:
+        return 6 * sizeof(boost::int32_t);
+    }
+}
+}
+
+NetworkSnapshot::Table::Table() : numRows(0), valid(true)
+{
+}
+
+void NetworkSnapshot::Table::addRow(const soci::row& row)
+{
+    if (!valid)
+    {
+        return;
+    }
+
+    if (numRows == 0)
+    {
+        columns.clear();
+        for (size_t i = 0; i < row.size(); ++i)
+        {
+            Column column;
+            column.name = row.get_properties(i).get_name();
+            column.dataType = row.get_properties(i).get_data_type();
+
+            if (!isSupported(column.dataType))
+            {
+                Warn() << "Network snapshot: column " << column.name << " of the query " << query
+                       << " has a type that can not be recorded. The rows of the query are not saved." << std::endl;
+                valid = false;
+                data.clear();
+                return;
+            }
+            columns.push_back(column);
+        }
+    }
+
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        if (row.get_indicator(i) == soci::i_null)
+        {
+            data.push_back(VALUE_NULL);
+            continue;
+        }
+
+        data.push_back(VALUE_OK);
+        switch (columns[i].dataType)
+        {
+        case soci::dt_integer:
+            appendValue(data, static_cast<boost::int32_t>(row.get<int>(i)));
+            break;
+        case soci::dt_long_long:
+            appendValue(data, static_cast<boost::int64_t>(row.get<long long>(i)));
+            break;
+        case soci::dt_unsigned_long_long:
+            appendValue(data, static_cast<boost::uint64_t>(row.get<unsigned long long>(i)));
+            break;
+        case soci::dt_double:
+            appendValue(data, row.get<double>(i));
+            break;
+        case soci::dt_string:
+        {
+            const std::string value = row.get<std::string>(i);
+            appendValue(data, static_cast<boost::uint64_t>(value.size()));
+            data.append(value);
+            break;
+        }
+        default:
+        {
+            const std::tm value = row.get<std::tm>(i);
+            appendValue(data, static_cast<boost::int32_t>(value.tm_year));
+            appendValue(data, static_cast<boost::int32_t>(value.tm_mon));
+            appendValue(data, static_cast<boost::int32_t>(value.tm_mday));
+            appendValue(data, static_cast<boost::int32_t>(value.tm_hour));
+            appendValue(data, static_cast<boost::int32_t>(value.tm_min));
+            appendValue(data, static_cast<boost::int32_t>(value.tm_sec));
+            break;
+        }
+        }
+    }
+    numRows++;
+}
+
+size_t NetworkSnapshot::Table::getNumRows() const
+{
+    return numRows;
+}
+
+bool NetworkSnapshot::Table::isValid() const
+{
+    return valid;
+}
+
+bool NetworkSnapshot::Table::hasConsistentData() const
+{
+    if (columns.empty())
+    {
+        return numRows == 0 && data.empty();
+    }
+
+    size_t offset = 0;
+    for (size_t row = 0; row < numRows; ++row)
+    {
+        for (size_t i = 0; i < columns.size(); ++i)
+        {
+            if (offset >= data.size())
+            {
+                return false;
+            }
+
+            const char indicator = data[offset++];
+            if (indicator == VALUE_NULL)
+            {
+                continue;
+            }
+            else if (indicator != VALUE_OK)
+            {
+                return false;
+            }
+
+            size_t size = getValueSize(columns[i].dataType);
+            if (size == 0)
+            {
+                if (data.size() - offset < sizeof(boost::uint64_t))
+                {
+                    return false;
+                }
+
+                boost::uint64_t length = 0;
+                std::memcpy(&length, data.data() + offset, sizeof(length));
+                offset += sizeof(length);
+
+                if (length > data.size() - offset)
+                {
+                    return false;
+                }
+                size = static_cast<size_t>(length);
+            }
+
+            if (size > data.size() - offset)
+            {
+                return false;
+            }
+            offset += size;
+        }
+    }
+    return offset == data.size();
+}
+
+NetworkSnapshot::Rows::Rows(const Table& table) :
+        table(&table), nextRow(0), offset(0), started(false), recording(nullptr)
+{
+    createRow();
+}
+
+NetworkSnapshot::Rows::Rows(soci::session& sql, const std::string& query, Table* recording) :
+        table(nullptr), nextRow(0), offset(0), started(false), recording(recording)
+{
+    rowset.reset(new soci::rowset<soci::row>(sql.prepare << query));
+}
+
+bool NetworkSnapshot::Rows::next()
+{
+    if (table)
+    {
+        if (nextRow == table->numRows)
+        {
+            return false;
+        }
+
+        readRow();
+        nextRow++;
+        return true;
+    }
+
+    if (!started)
+    {
+        itRows = rowset->begin();
+        started = true;
+    }
+    else
+    {
+        ++itRows;
+    }
+
+    if (itRows == rowset->end())
+    {
+        return false;
+    }
+
+    if (recording)
+    {
+        recording->addRow(*itRows);
+    }
+    return true;
+}
+
+const soci::row& NetworkSnapshot::Rows::getRow() const
+{
+    if (table)
+    {
+        return *row;
+    }
+    return *itRows;
+}
+
+void NetworkSnapshot::Rows::createRow()
+{
+    //the row owns its values, which are overwritten by each call to next()
+    row.reset(new soci::row());
+    values.clear();
+    indicators.clear();
+
+    for (std::vector<Table::Column>::const_iterator it = table->columns.begin(); it != table->columns.end(); ++it)
+    {
+        soci::column_properties properties;
+        properties.set_name(it->name);
+        properties.set_data_type(it->dataType);
+        row->add_properties(properties);
+
+        soci::indicator* indicator = new soci::indicator(soci::i_ok);
+        void* value = nullptr;
+
+        switch (it->dataType)
+        {
+        case soci::dt_integer:
+        {
+            int* intValue = new int(0);
+            row->add_holder(intValue, indicator);
+            value = intValue;
+            break;
+        }
+        case soci::dt_long_long:
+        {
+            long long* longValue = new long long(0);
+            row->add_holder(longValue, indicator);
+            value = longValue;
+            break;
+        }
+        case soci::dt_unsigned_long_long:
+        {
+            unsigned long long* longValue = new unsigned long long(0);
+            row->add_holder(longValue, indicator);
+            value = longValue;
+            break;
+        }
+        case soci::dt_double:
+        {
+            double* doubleValue = new double(0);
+            row->add_holder(doubleValue, indicator);
+            value = doubleValue;
+            break;
+        }
+        case soci::dt_string:
+        {
+            std::string* stringValue = new std::string();
+            row->add_holder(stringValue, indicator);
+            value = stringValue;
+            break;
+        }
+        default:
+        {
+            std::tm* timeValue = new std::tm();
+            row->add_holder(timeValue, indicator);
+            value = timeValue;
+            break;
+        }
+        }
+
+        values.push_back(value);
+        indicators.push_back(indicator);
+    }
+}
+
+void NetworkSnapshot::Rows::readRow()
+{
+    const std::string& data = table->data;
+
+    for (size_t i = 0; i < table->columns.size(); ++i)
+    {
+        if (extractValue<char>(data, offset) == VALUE_NULL)
+        {
+            *indicators[i] = soci::i_null;
+            continue;
+        }
+
+        *indicators[i] = soci::i_ok;
+        switch (table->columns[i].dataType)
+        {
+        case soci::dt_integer:
+            *static_cast<int*>(values[i]) = extractValue<boost::int32_t>(data, offset);
+            break;
+        case soci::dt_long_long:
+            *static_cast<long long*>(values[i]) = extractValue<boost::int64_t>(data, offset);
+            break;
+        case soci::dt_unsigned_long_long:
+            *static_cast<unsigned long long*>(values[i]) = extractValue<boost::uint64_t>(data, offset);
+            break;
+        case soci::dt_double:
+            *static_cast<double*>(values[i]) = extractValue<double>(data, offset);
+            break;
+        case soci::dt_string:
+        {
+            size_t length = static_cast<size_t>(extractValue<boost::uint64_t>(data, offset));
+            if (offset + length > data.size())
+            {
+                throw std::runtime_error("Network snapshot: the rows of a table are truncated");
+            }
+            static_cast<std::string*>(values[i])->assign(data, offset, length);
+            offset += length;
+            break;
+        }
+        default:
+        {
+            std::tm* value = static_cast<std::tm*>(values[i]);
+            *value = std::tm();
+            value->tm_year = extractValue<boost::int32_t>(data, offset);
+            value->tm_mon = extractValue<boost::int32_t>(data, offset);
+            value->tm_mday = extractValue<boost::int32_t>(data, offset);
+            value->tm_hour = extractValue<boost::int32_t>(data, offset);
+            value->tm_min = extractValue<boost::int32_t>(data, offset);
+            value->tm_sec = extractValue<boost::int32_t>(data, offset);
+            break;
+        }
+        }
+    }
+}
+
+NetworkSnapshot::NetworkSnapshot(const std::string& fileName, const std::string& source, const std::string& version) :
+        fileName(fileName), source(source), version(version), modified(false)
+{
+}
+
+bool NetworkSnapshot::load()
+{
+    std::ifstream in(fileName.c_str(), std::ios::binary);
+    if (!in)
+    {
+        Print() << "Network snapshot " << fileName << " not found. The network is loaded from the database.\n";
+        return false;
+    }
+
+    //no string of the file is longer than the file
+    in.seekg(0, std::ios::end);
+    const boost::uint64_t fileSize = static_cast<boost::uint64_t>(in.tellg());
+    in.seekg(0, std::ios::beg);
+
+    char magic[sizeof(FILE_MAGIC)];
+    boost::uint32_t formatVersion = 0;
+    std::string fileSource;
+    std::string fileVersion;
+    boost::uint32_t numTables = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 ||
+        !readValue(in, formatVersion) || formatVersion != FILE_VERSION || !readString(in, fileSource, fileSize) ||
+        !readString(in, fileVersion, fileSize) || !readValue(in, numTables))
+    {
+        Warn() << "Network snapshot " << fileName << " has an unknown format. The network is loaded from the database."
+               << std::endl;
+        return false;
+    }
+
+    if (fileSource != source)
+    {
+        Print() << "Network snapshot " << fileName << " was read from another database (" << fileSource
+                << "). The network is loaded from the database.\n";
+        return false;
+    }
+
+    if (fileVersion != version)
+    {
+        Print() << "Network snapshot " << fileName << " was saved for network version '" << fileVersion
+                << "'. The network is loaded from the database.\n";
+        return false;
+    }
+
+    std::map<std::string, Table> loaded;
+    for (boost::uint32_t i = 0; i < numTables; ++i)
+    {
+        std::string name;
+        Table table;
+        boost::uint32_t numColumns = 0;
+        boost::uint64_t numRows = 0;
+
+        bool valid = readString(in, name, fileSize) && readString(in, table.query, fileSize) &&
+                     readValue(in, numColumns);
+        for (boost::uint32_t j = 0; j < numColumns && valid; ++j)
+        {
+            Table::Column column;
+            boost::uint32_t dataType = 0;
+            valid = readString(in, column.name, fileSize) && readValue(in, dataType);
+            column.dataType = static_cast<soci::data_type>(dataType);
+            valid = valid && isSupported(column.dataType);
+            table.columns.push_back(column);
+        }
+        valid = valid && readValue(in, numRows) && readString(in, table.data, fileSize);
+
+        //the rows are only read from the data when they are replayed, so their sizes are checked beforehand
+        table.numRows = static_cast<size_t>(numRows);
+        valid = valid && table.hasConsistentData();
+
+        if (!valid)
+        {
+            Warn() << "Network snapshot " << fileName << " is corrupted. The network is loaded from the database."
+                   << std::endl;
+            return false;
+        }
+
+        loaded[name] = std::move(table);
+    }
+
+    tables.swap(loaded);
+    modified = false;
+
+    Print() << "Network snapshot " << fileName << " loaded (" << tables.size() << " tables)\n";
+    return true;
+}
+
+bool NetworkSnapshot::save() const
+{
+    if (!modified)
+    {
+        return true;
+    }
+
+    //The snapshot is written to a temporary file, which replaces the previous snapshot once complete
+    const std::string tempFileName = fileName + ".tmp";
+    std::ofstream out(tempFileName.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        Warn() << "Network snapshot " << fileName << " could not be opened for writing." << std::endl;
+        return false;
+    }
+
+    boost::uint32_t numTables = 0;
+    for (std::map<std::string, Table>::const_iterator it = tables.begin(); it != tables.end(); ++it)
+    {
+        numTables += it->second.isValid() ? 1 : 0;
+    }
+
+    out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    writeValue(out, FILE_VERSION);
+    writeString(out, source);
+    writeString(out, version);
+    writeValue(out, numTables);
+
+    for (std::map<std::string, Table>::const_iterator it = tables.begin(); it != tables.end(); ++it)
+    {
+        const Table& table = it->second;
+        if (!table.isValid())
+        {
+            continue;
+        }
+
+        writeString(out, it->first);
+        writeString(out, table.query);
+        writeValue(out, static_cast<boost::uint32_t>(table.columns.size()));
+        for (std::vector<Table::Column>::const_iterator itColumns = table.columns.begin();
+             itColumns != table.columns.end(); ++itColumns)
+        {
+            writeString(out, itColumns->name);
+            writeValue(out, static_cast<boost::uint32_t>(itColumns->dataType));
+        }
+        writeValue(out, static_cast<boost::uint64_t>(table.numRows));
+        writeString(out, table.data);
+    }
+
+    out.close();
+    if (!out || std::rename(tempFileName.c_str(), fileName.c_str()) != 0)
+    {
+        Warn() << "Network snapshot " << fileName << " could not be written." << std::endl;
+        std::remove(tempFileName.c_str());
+        return false;
+    }
+
+    Print() << "Network snapshot " << fileName << " saved (" << numTables << " tables)\n";
+    return true;
+}
+
+const NetworkSnapshot::Table* NetworkSnapshot::getTable(const std::string& name, const std::string& query) const
+{
+    std::map<std::string, Table>::const_iterator itTables = tables.find(name);
+
+    if (itTables != tables.end() && itTables->second.query == query && itTables->second.isValid())
+    {
+        return &itTables->second;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+NetworkSnapshot::Table& NetworkSnapshot::recordTable(const std::string& name, const std::string& query)
+{
+    Table& table = tables[name];
+    table = Table();
+    table.query = query;
+    modified = true;
+    return table;
+}
+
+const std::string& NetworkSnapshot::getFileName() const
+{
+    return fileName;
+}
@@ -0,0 +1,192 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <soci/soci.h>
+
+namespace sim_mob
+{
+
+/**
+ * Binary snapshot of the rows of the network tables read by the NetworkLoader.
+ *
+ * The rows returned by each stored procedure are recorded with the query, and the names and types of the columns.
+ * Once saved, the file lets the following runs replay the rows through the same conversions and RoadNetwork::add*
+ * functions as the rows of the database, without connecting to it. A table is only replayed for the query it was
+ * recorded for; a table recorded for another query (e.g. another stored procedure) is read again from the database
+ * and the snapshot is saved again.
+ *
+ * The file records the database it was read from and a version of the network given by the configuration. A snapshot
+ * of another database or of another version is ignored, so the version must be changed (or the file deleted) when the
+ * network in the database changes.
+ *
+ * The file is read in one pass and is only valid on the platform on which it was written. A file whose tables are
+ * truncated or corrupted is ignored.
+ */
+class NetworkSnapshot : private boost::noncopyable
+{
+public:
+    class Rows;
+
+    /**
+     * The rows of a network table, in binary format
+     */
+    class Table
+    {
+    public:
+        Table();
+
+        /**
+         * Appends a row. The columns of the first row are the columns of the table.
+         * A table with a column of a type that can not be recorded is not saved
+         * @param row the row, as read from the database
+         */
+        void addRow(const soci::row& row);
+
+        size_t getNumRows() const;
+
+        /**
+         * @return false if a column of the table can not be recorded
+         */
+        bool isValid() const;
+
+    private:
+        friend class NetworkSnapshot;
+        friend class Rows;
+
+        /**
+         * @return true if the data holds exactly the values of numRows rows of the columns
+         */
+        bool hasConsistentData() const;
+
+        struct Column
+        {
+            std::string name;
+            soci::data_type dataType;
+        };
+
+        /**the query that returned the rows*/
+        std::string query;
+        std::vector<Column> columns;
+        size_t numRows;
+        bool valid;
+
+        /**the values of the rows, one column after the other*/
+        std::string data;
+    };
+
+    /**
+     * Reads the rows of a network table, from a table of the snapshot or from the database.
+     * The rows are given one at a time as a soci::row holding the same types and values as the rows of the database,
+     * so they can be converted by the soci type conversions of the network elements.
+     */
+    class Rows : private boost::noncopyable
+    {
+    public:
+        /**
+         * Reads the rows of a table of the snapshot
+         */
+        explicit Rows(const Table& table);
+
+        /**
+         * Reads the rows of a query from the database
+         * @param sql the database session
+         * @param query the query
+         * @param recording the table in which the rows are recorded, if not NULL
+         */
+        Rows(soci::session& sql, const std::string& query, Table* recording);
+
+        /**
+         * Moves to the next row
+         * @return true if there is a row, false once all the rows are read
+         */
+        bool next();
+
+        /**
+         * Current row. Valid until the next call to next()
+         */
+        const soci::row& getRow() const;
+
+    private:
+        /**Creates the row holding the values of the columns of the table*/
+        void createRow();
+
+        /**Reads the values of the next row of the table in the row*/
+        void readRow();
+
+        /**the table of the snapshot being read, or NULL if the rows are read from the database*/
+        const Table* table;
+        size_t nextRow;
+        size_t offset;
+
+        /**the row holding the values of the table. It owns the values and the indicators*/
+        boost::scoped_ptr<soci::row> row;
+        std::vector<void*> values;
+        std::vector<soci::indicator*> indicators;
+
+        /**the rows of the database*/
+        boost::scoped_ptr< soci::rowset<soci::row> > rowset;
+        soci::rowset<soci::row>::const_iterator itRows;
+        bool started;
+        Table* recording;
+    };
+
+    /**
+     * @param fileName the file of the snapshot
+     * @param source the database the network is read from (e.g. its connection string without the password)
+     * @param version the version of the network in the database
+     */
+    NetworkSnapshot(const std::string& fileName, const std::string& source, const std::string& version);
+
+    /**
+     * Reads the tables of the snapshot file, if it exists and was read from the same database and version
+     * @return true if the file was read
+     */
+    bool load();
+
+    /**
+     * Writes the tables to the snapshot file, if any of them was recorded since the snapshot was loaded
+     * @return true if the file was written
+     */
+    bool save() const;
+
+    /**
+     * Returns the table recorded for a query
+     * @param name the name of the table
+     * @param query the query
+     * @return the table, if it was recorded for the same query; NULL otherwise
+     */
+    const Table* getTable(const std::string& name, const std::string& query) const;
+
+    /**
+     * Starts the recording of the rows of a table, replacing the rows recorded previously
+     * @param name the name of the table
+     * @param query the query that returns the rows
+     * @return the table, to which the rows are to be added
+     */
+    Table& recordTable(const std::string& name, const std::string& query);
+
+    const std::string& getFileName() const;
+
+private:
+    std::string fileName;
+
+    /**the database the network is read from*/
+    std::string source;
+
+    /**the version of the network in the database*/
+    std::string version;
+    std::map<std::string, Table> tables;
+
+    /**Indicates whether a table was recorded since the snapshot was loaded*/
+    bool modified;
+};
+
+}
@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <sstream>
 #include <limits>
+#include <boost/functional/hash.hpp>
 #include <conf/ConfigManager.hpp>
 
 #include "Link.hpp"
@@ -27,7 +28,7 @@ using namespace sim_mob;
 
 RoadNetwork* RoadNetwork::roadNetwork = nullptr;
 
-RoadNetwork::RoadNetwork(): turningPathFromLanes(std::map<const Lane*,std::map<const Lane*,const TurningPath *>>())
+RoadNetwork::RoadNetwork(): idMapsGeneration(0), turningPathFromLanes(std::map<const Lane*,std::map<const Lane*,const TurningPath *>>())
 {
 }
 
@@ -44,6 +45,7 @@ RoadNetwork::~RoadNetwork()
     mapOfIdVsRoadSegments.clear();
     mapOfIdvsTurningGroups.clear();
     mapOfIdvsTurningPaths.clear();
+    mapOfLanesVsTurningPath.clear();
     mapOfIdvsBusStops.clear();
     mapOfIdVsParkingSlots.clear();
     mapOfIdVsSMSVehiclesParking.clear();
@@ -161,6 +163,7 @@ void RoadNetwork::addLane(Lane* lane)
 
         //Add the lane to the map of lanes
         mapOfIdVsLanes.insert(std::make_pair(lane->getLaneId(), lane));
+        ++idMapsGeneration;
     }
     else
     {
@@ -269,6 +272,7 @@ void RoadNetwork::addLink(Link *link)
 
         //Add link to the map of links
         mapOfIdVsLinks.insert(std::make_pair(link->getLinkId(), link));
+        ++idMapsGeneration;
     }
     else
     {
@@ -286,6 +290,7 @@ void RoadNetwork::addLink(Link *link)
 void RoadNetwork::addNode(Node *node)
 {
     mapOfIdvsNodes.insert(std::make_pair(node->getNodeId(), node));
+    ++idMapsGeneration;
 }
 
 bool RoadNetwork::checkSegmentCapacity() const
@@ -317,6 +322,7 @@ void RoadNetwork::addRoadSegment(RoadSegment* segment)
 
         //Add the road segment to the map of road segments
         mapOfIdVsRoadSegments.insert(std::make_pair(segment->getRoadSegmentId(), segment));
+        ++idMapsGeneration;
     }
     else
     {
@@ -415,6 +421,7 @@ void RoadNetwork::addTurningConflict(TurningConflict* turningConflict)
 
         //Add the conflict to the map of conflicts
         mapOfIdVsTurningConflicts.insert(std::make_pair(turningConflict->getConflictId(), turningConflict));
+        ++idMapsGeneration;
     }
     else
     {
@@ -441,6 +448,7 @@ void RoadNetwork::addTurningGroup(TurningGroup *turningGroup)
 
             //Add the turning group to the map of turning groups
             mapOfIdvsTurningGroups.insert(std::make_pair(turningGroup->getTurningGroupId(), turningGroup));
+            ++idMapsGeneration;
         }
         else
         {
@@ -486,6 +494,7 @@ void RoadNetwork::addTurningPath(TurningPath* turningPath)
 
             //Add the turning path to the map of turning paths
             mapOfIdvsTurningPaths.insert(std::make_pair(turningPath->getTurningPathId(), turningPath));
+            ++idMapsGeneration;
             const Lane *fromLane = turningPath->getFromLane();
             const Lane *toLane = turningPath->getToLane();
             if (turningPathFromLanes.find(fromLane) == turningPathFromLanes.end())
@@ -495,6 +504,7 @@ void RoadNetwork::addTurningPath(TurningPath* turningPath)
             }
             std::map<const Lane*,const TurningPath*> &mapOfLanetoTurningGroups = turningPathFromLanes[fromLane];
             mapOfLanetoTurningGroups[toLane] = turningPath;
+            mapOfLanesVsTurningPath[std::make_pair(fromLane, toLane)] = turningPath;
         }
         else
         {
@@ -519,6 +529,41 @@ const std::map<const Lane*,std::map<const Lane*,const TurningPath *>> & RoadNetw
     return turningPathFromLanes;
 }
 
+size_t RoadNetwork::LanePairHash::operator()(const std::pair<const Lane *, const Lane *> &lanes) const
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, lanes.first);
+    boost::hash_combine(seed, lanes.second);
+    return seed;
+}
+
+const TurningPath* RoadNetwork::getTurningPath(const Lane *fromLane, const Lane *toLane) const
+{
+    auto itTurning = mapOfLanesVsTurningPath.find(std::make_pair(fromLane, toLane));
+
+    if (itTurning != mapOfLanesVsTurningPath.end())
+    {
+        return itTurning->second;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+void RoadNetwork::buildIdIndices()
+{
+    linkIndex.build(mapOfIdVsLinks, idMapsGeneration);
+    nodeIndex.build(mapOfIdvsNodes, idMapsGeneration);
+    laneIndex.build(mapOfIdVsLanes, idMapsGeneration);
+    segmentIndex.build(mapOfIdVsRoadSegments, idMapsGeneration);
+    turningGroupIndex.build(mapOfIdvsTurningGroups, idMapsGeneration);
+    turningPathIndex.build(mapOfIdvsTurningPaths, idMapsGeneration);
+    turningConflictIndex.build(mapOfIdVsTurningConflicts, idMapsGeneration);
+    busStopIndex.build(mapOfIdvsBusStops, idMapsGeneration);
+    taxiStandIndex.build(mapOfIdvsTaxiStands, idMapsGeneration);
+}
+
 void RoadNetwork::addTurningPolyLine(PolyPoint point)
 {
     //Find the turning path to which the poly-line belongs
@@ -594,6 +639,7 @@ void RoadNetwork::addTaxiStand(TaxiStand* stand)
 
             //Insert the stand into the map
             mapOfIdvsTaxiStands.insert(std::make_pair(stand->getStandId(), stand));
+            ++idMapsGeneration;
         }
         else
         {
@@ -607,6 +653,11 @@ void RoadNetwork::addTaxiStand(TaxiStand* stand)
 
 const Node* RoadNetwork::getNodeById(int id) const
 {
+    if (nodeIndex.isIndexOf(mapOfIdvsNodes, idMapsGeneration))
+    {
+        return nodeIndex.get(id);
+    }
+
     return mapOfIdvsNodes.find(id)->second;
 }
 
@@ -681,6 +732,7 @@ void RoadNetwork::addBusStop(BusStop* stop)
             
             //Insert the stop into the map
             mapOfIdvsBusStops.insert(std::make_pair(stop->getStopId(), stop));
+            ++idMapsGeneration;
             BusStop::registerBusStop(stop);
         }
         else
@@ -898,22 +950,9 @@ void RoadNetwork::loadStudyAreaBlackListedNodes()
     }
 }
 
-void RoadNetwork::loadLoopNodesOfNetwork()
+void RoadNetwork::addLoopNode(unsigned int nodeId)
 {
-    ConfigParams &cfg = sim_mob::ConfigManager::GetInstanceRW().FullConfig();
-    soci::session sql_(soci::postgresql, cfg.getDatabaseConnectionString(false));
-    const std::map<std::string, std::string> &storedProcs = cfg.getDatabaseProcMappings().procedureMappings;
-    std::map<std::string, std::string>::const_iterator spIt = storedProcs.find("loop_nodes");
-
-    if (spIt == storedProcs.end()) {
-        return;
-    }
-    soci::rowset<soci::row> rs = (sql_.prepare << "select * from " + spIt->second);
-    for (soci::rowset<soci::row>::const_iterator it = rs.begin(); it != rs.end(); ++it) {
-        const soci::row &r = (*it);
-        unsigned int nodeID = r.get < unsigned int > (0);
-        setOfLoopNodesInNetwork.insert(nodeID);
-    }
+    setOfLoopNodesInNetwork.insert(nodeId);
 }
 
 
@@ -5,8 +5,11 @@
 #pragma once
 
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
+#include "IdIndex.hpp"
 #include "PT_Stop.hpp"
 #include "NetworkLoader.hpp"
 #include "SurveillanceStation.hpp"
@@ -79,6 +82,15 @@ private:
 
     std::map<const Lane*,std::map<const Lane*,const TurningPath *>> turningPathFromLanes;
 
+    /**Hashes a pair of lanes connected by a turning path*/
+    struct LanePairHash
+    {
+        size_t operator()(const std::pair<const Lane *, const Lane *> &lanes) const;
+    };
+
+    /**This map stores the turning path connecting each pair of lanes, with the from and to lanes as the key*/
+    std::unordered_map<std::pair<const Lane *, const Lane *>, const TurningPath *, LanePairHash> mapOfLanesVsTurningPath;
+
     /**This is a mapping between nodes and their downstream links*/
     std::map<unsigned int, std::vector<const Link *> > mapOfDownstreamLinks;
 
@@ -97,7 +109,47 @@ private:
     /***Set for loop Nodes in Network*/
     std::unordered_set<unsigned int> setOfLoopNodesInNetwork;
 
+    /**Incremented whenever elements are added to the id maps. The lookups are only used while it is unchanged*/
+    unsigned int idMapsGeneration;
+
+    /**Vector-backed lookups of the id maps, built once the network is loaded (see buildIdIndices())*/
+    IdIndex<Link> linkIndex;
+    IdIndex<Node> nodeIndex;
+    IdIndex<Lane> laneIndex;
+    IdIndex<RoadSegment> segmentIndex;
+    IdIndex<TurningGroup> turningGroupIndex;
+    IdIndex<TurningPath> turningPathIndex;
+    IdIndex<TurningConflict> turningConflictIndex;
+    IdIndex<BusStop> busStopIndex;
+    IdIndex<TaxiStand> taxiStandIndex;
+
+    /**
+     * Builds the vector-backed lookups of the id maps. Called by the NetworkLoader once all the elements
+     * of the network are added
+     */
+    void buildIdIndices();
+
+    /**
+     * Returns the vector-backed lookup built from the given map, if any
+     *
+     * @param lookup the id map
+     * @return the lookup of the elements of the map, if it is one of the indexed maps; NULL otherwise
+     */
+    const IdIndex<Link>* getIdIndex(const std::map<unsigned int, Link *> &lookup) const { return &linkIndex; }
+    const IdIndex<Node>* getIdIndex(const std::map<unsigned int, Node *> &lookup) const { return &nodeIndex; }
+    const IdIndex<Lane>* getIdIndex(const std::map<unsigned int, Lane *> &lookup) const { return &laneIndex; }
+    const IdIndex<RoadSegment>* getIdIndex(const std::map<unsigned int, RoadSegment *> &lookup) const { return &segmentIndex; }
+    const IdIndex<TurningGroup>* getIdIndex(const std::map<unsigned int, TurningGroup *> &lookup) const { return &turningGroupIndex; }
+    const IdIndex<TurningPath>* getIdIndex(const std::map<unsigned int, TurningPath *> &lookup) const { return &turningPathIndex; }
+    const IdIndex<TurningConflict>* getIdIndex(const std::map<unsigned int, TurningConflict *> &lookup) const { return &turningConflictIndex; }
+    const IdIndex<BusStop>* getIdIndex(const std::map<unsigned int, BusStop *> &lookup) const { return &busStopIndex; }
+    const IdIndex<TaxiStand>* getIdIndex(const std::map<unsigned int, TaxiStand *> &lookup) const { return &taxiStandIndex; }
 
+    template<class T>
+    const IdIndex<T>* getIdIndex(const std::map<unsigned int, T *> &lookup) const
+    {
+        return nullptr;
+    }
 
     /**Private constructor as the class is a singleton*/
     RoadNetwork();
@@ -140,6 +192,15 @@ public:
 
     const std::map<const Lane*,std::map<const Lane*,const TurningPath *>> &getTurningPathsFromLanes() const;
 
+    /**
+     * Looks up the turning path connecting two lanes
+     *
+     * @param fromLane the lane at the start of the turning
+     * @param toLane the lane at the end of the turning
+     * @return the turning path, if the lanes are connected; NULL otherwise
+     */
+    const TurningPath* getTurningPath(const Lane *fromLane, const Lane *toLane) const;
+
     const std::multimap<std::string, SMSVehicleParking *>& getMapOfIdvsSMSVehicleParking() const;
 
     const std::vector<const Link *>& getDownstreamLinks(unsigned int fromNodeId) const;
@@ -273,13 +334,24 @@ public:
     bool IsMovementInStudyArea(unsigned int sourceNodeId, unsigned int destinationNodeId ) const;
     /** function to load BlackListed nodes related with Study Area Only**/
     void loadStudyAreaBlackListedNodes();
-    /** function to load Looped Nodes for entire network**/
-    void loadLoopNodesOfNetwork();
+    /**
+     * Adds a node that is the start and end of a loop in the network
+     * @param nodeId - the id of the node
+     */
+    void addLoopNode(unsigned int nodeId);
 
     const Node *getNodeById(int id) const;
     template<class T>
     const T* getById(const std::map<unsigned int, T*>& lookup, unsigned int id) const
     {
+        //The id maps of the network are looked up through their vector-backed index
+        const IdIndex<T> *index = getIdIndex(lookup);
+
+        if (index && index->isIndexOf(lookup, idMapsGeneration))
+        {
+            return index->get(id);
+        }
+
         typename std::map<unsigned int, T*>::const_iterator lookupIt = lookup.find(id);
 
         if (lookupIt != lookup.end())
@@ -88,11 +88,14 @@ std::string ExtractTag(std::string strTags, std::string reqdTag)
 namespace soci
 {
 
+//The network elements are converted from rows, as the NetworkLoader reads the rows of the network tables
+//either from the database or from the network snapshot (see NetworkSnapshot)
+
 template<> struct type_conversion<sim_mob::Node>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::Node& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::Node& res)
     {
         res.setNodeId(vals.get<unsigned int>("id", 0));
         res.setNodeType((sim_mob::NodeType)vals.get<unsigned int>("node_type", 0));
@@ -109,9 +112,9 @@ template<> struct type_conversion<sim_mob::Node>
 
 template<> struct type_conversion<sim_mob::TurningGroup>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::TurningGroup& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::TurningGroup& res)
     {
         res.setTurningGroupId(vals.get<unsigned int>("id", 0));
         res.setFromLinkId(vals.get<unsigned int>("from_link", 0));
@@ -125,9 +128,9 @@ template<> struct type_conversion<sim_mob::TurningGroup>
 
 template<> struct type_conversion<sim_mob::TurningPath>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::TurningPath& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::TurningPath& res)
     {
         res.setTurningPathId((unsigned int) vals.get<int>("id", 0));
         res.setFromLaneId(vals.get<unsigned int>("from_lane", 0));
@@ -139,9 +142,9 @@ template<> struct type_conversion<sim_mob::TurningPath>
 
 template<> struct type_conversion<sim_mob::TurningConflict>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::TurningConflict& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::TurningConflict& res)
     {
         res.setConflictId(vals.get<unsigned int>("id", 0));
         res.setCriticalGap(vals.get<double>("gap_time", 0));
@@ -155,9 +158,9 @@ template<> struct type_conversion<sim_mob::TurningConflict>
 
 template<> struct type_conversion<sim_mob::Link>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::Link& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::Link& res)
     {
         res.setLinkId(vals.get<unsigned int>("id", 0));
         res.setFromNodeId(vals.get<unsigned int>("from_node", 0));
@@ -170,9 +173,9 @@ template<> struct type_conversion<sim_mob::Link>
 
 template<> struct type_conversion<sim_mob::RoadSegment>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::RoadSegment& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::RoadSegment& res)
     {
         res.setRoadSegmentId(vals.get<unsigned int>("id", 0));
         res.setCapacity(vals.get<unsigned int>("capacity", 0));
@@ -184,9 +187,9 @@ template<> struct type_conversion<sim_mob::RoadSegment>
 
 template<> struct type_conversion<sim_mob::Lane>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::Lane& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::Lane& res)
     {
         res.setLaneId(vals.get<unsigned int>("id", 0));
         res.setBusLaneRules((sim_mob::BusLaneRules)vals.get<unsigned int>("bus_lane", 0));
@@ -201,9 +204,9 @@ template<> struct type_conversion<sim_mob::Lane>
 
 template<> struct type_conversion<sim_mob::LaneConnector>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::LaneConnector& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::LaneConnector& res)
     {
         res.setLaneConnectionId(vals.get<unsigned int>("id", 0));
         res.setFromLaneId(vals.get<unsigned int>("from_lane", 0));
@@ -216,9 +219,9 @@ template<> struct type_conversion<sim_mob::LaneConnector>
 
 template<> struct type_conversion<sim_mob::PolyPoint>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::PolyPoint& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::PolyPoint& res)
     {
         res.setPolyLineId(vals.get<unsigned int>("polyline_id", 0));
         res.setSequenceNumber(vals.get<unsigned int>("sequence_no", 0));
@@ -230,9 +233,9 @@ template<> struct type_conversion<sim_mob::PolyPoint>
 
 template<> struct type_conversion<sim_mob::BusStop>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::BusStop& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::BusStop& res)
     {
         res.setStopId(vals.get<unsigned int>("id", 0));
         res.setRoadItemId(vals.get<unsigned int>("id", 0));
@@ -257,9 +260,9 @@ template<> struct type_conversion<sim_mob::BusStop>
 
 template<> struct type_conversion<sim_mob::TaxiStand>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::TaxiStand& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::TaxiStand& res)
     {
         res.setStandId(vals.get<unsigned int>("id", 0));
         res.setRoadItemId(vals.get<unsigned int>("id", 0));
@@ -277,9 +280,9 @@ template<> struct type_conversion<sim_mob::TaxiStand>
 
 template<> struct type_conversion<sim_mob::ParkingSlot>
 {
-    typedef values base_type;
+    typedef row base_type;
 
-    static void from_base(const soci::values& vals, soci::indicator& ind, sim_mob::ParkingSlot& res)
+    static void from_base(const soci::row& vals, soci::indicator& ind, sim_mob::ParkingSlot& res)
     {           
         res.setRoadItemId(vals.get<unsigned int>("id", 0));
         res.setAccessSegmentId(vals.get<unsigned int>("access_segment", 0));
@@ -2,210 +2,398 @@
 
 #include "KShortestPathImpl.hpp"
 
-#include <list>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <unordered_set>
 #include <utility>
+#include <boost/bind.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
 #include "geospatial/network/RoadNetwork.hpp"
 #include "geospatial/network/TurningGroup.hpp"
 #include "path/Path.hpp"
 #include "conf/ConfigParams.hpp"
 #include "conf/ConfigManager.hpp"
-#include "StreetDirectory.hpp"
+#include "util/threadpool/Threadpool.hpp"
 
 using namespace sim_mob;
 
 boost::shared_ptr<K_ShortestPathImpl> sim_mob::K_ShortestPathImpl::instance;
 
-sim_mob::K_ShortestPathImpl::K_ShortestPathImpl() : k(sim_mob::ConfigManager::GetInstance().FullConfig().getPathSetConf().kspLevel)
+namespace
 {
-    // build set of upstream links for each link in the network
-    const RoadNetwork* rn = RoadNetwork::getInstance();
-    const std::map<unsigned int, Link *>& linksMap = rn->getMapOfIdVsLinks();
-    for(std::map<unsigned int, Link *>::const_iterator lnkIt=linksMap.begin(); lnkIt!=linksMap.end(); lnkIt++)
+const std::uint32_t NO_LINK = std::numeric_limits<std::uint32_t>::max();
+const double INFINITE_DISTANCE = std::numeric_limits<double>::infinity();
+
+/// priority queue entry: (key, link index). Ties are broken by link index, so that searches are deterministic
+typedef std::pair<double, std::uint32_t> QueueEntry;
+typedef std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > LinkQueue;
+
+struct LinkSequenceHash
+{
+    size_t operator()(const std::vector<std::uint32_t> &sequence) const
     {
-        const Link* lnk = lnkIt->second;
-        upstreamLinksLookup[lnk->getToNode()].insert(lnk);
+        return boost::hash_range(sequence.begin(), sequence.end());
     }
-}
+};
 
-sim_mob::K_ShortestPathImpl::~K_ShortestPathImpl()
+/// builds a compressed adjacency list from (source, target) pairs
+void buildAdjacency(size_t nLinks, std::vector<std::pair<std::uint32_t, std::uint32_t> > &edges,
+                    std::vector<std::uint32_t> &offsets, std::vector<std::uint32_t> &targets)
 {
+    std::sort(edges.begin(), edges.end());
+    offsets.assign(nLinks + 1, 0);
+    targets.clear();
+    targets.reserve(edges.size());
+
+    for (const std::pair<std::uint32_t, std::uint32_t> &edge : edges)
+    {
+        ++offsets[edge.first + 1];
+        targets.push_back(edge.second);
+    }
+
+    for (size_t i = 0; i < nLinks; ++i)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+}
 }
 
-boost::shared_ptr<K_ShortestPathImpl> sim_mob::K_ShortestPathImpl::getInstance()
+/// a spur search of Yen's algorithm
+struct K_ShortestPathImpl::SpurSearch
 {
-    if(!instance)
+    SpurSearch() : spurNode(nullptr), destination(nullptr), rootLastLink(NO_LINK), found(false)
     {
-        instance.reset(new K_ShortestPathImpl());
     }
-    return instance;
-}
 
-/// a structure to store paths in order of their length
-class BType
+    const Node *spurNode;
+    const Node *destination;
+
+    /// last link of the root path, NO_LINK if the root path is empty
+    std::uint32_t rootLastLink;
+
+    /// links which the spur path must not use
+    std::vector<std::uint32_t> blocked;
+
+    /// the spur path (output)
+    LinkSequence spurPath;
+    bool found;
+};
+
+/// spur searches of an iteration, shared by the calling thread and the helper threads
+struct K_ShortestPathImpl::SpurSearchBatch
+{
+    SpurSearchBatch(const K_ShortestPathImpl *ksp, std::vector<SpurSearch> &searches, const TreeWorkspace &tree) :
+            ksp(ksp), searches(searches), nSearches(searches.size()), tree(tree), next(0), completed(0)
+    {
+    }
+
+    const K_ShortestPathImpl *ksp;
+
+    /// the searches and the tree belong to the calling thread, which waits for all the searches to complete. A helper
+    /// thread starting after that finds no search left and does not access them: the calling thread may already reuse
+    /// or destroy them, so their number is copied
+    std::vector<SpurSearch> &searches;
+    const size_t nSearches;
+    const TreeWorkspace &tree;
+
+    /// index of the next search to compute
+    std::atomic<size_t> next;
+
+    /// number of searches completed
+    size_t completed;
+    boost::mutex mutex;
+    boost::condition_variable done;
+};
+
+/// per thread state of the spur searches
+struct K_ShortestPathImpl::SearchWorkspace
 {
-private:
-    typedef std::list<std::vector<sim_mob::WayPoint> >::iterator PathIt;
-    typedef std::pair<double, PathIt> LengthPathIteratorPair;
+    SearchWorkspace() : generation(0)
+    {
+    }
 
-    struct comp
+    /// resizes the workspace for the network and invalidates the labels of the previous search
+    void prepare(size_t nLinks)
     {
-        bool operator()(const LengthPathIteratorPair& lhs, const LengthPathIteratorPair& rhs) const
+        if (stamps.size() != nLinks)
         {
-            return lhs.first < rhs.first;
+            costs.assign(nLinks, 0.0);
+            parents.assign(nLinks, NO_LINK);
+            stamps.assign(nLinks, 0);
+            settled.assign(nLinks, 0);
+            blockedMask.assign((nLinks + 63) / 64, 0);
+            generation = 0;
         }
-    };
-
-    std::list<std::vector<sim_mob::WayPoint> > paths;
-    std::vector<LengthPathIteratorPair> keys;
 
-public:
-    BType()
-    {
-        clear();
+        if (++generation == 0)
+        {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            std::fill(settled.begin(), settled.end(), 0);
+            generation = 1;
+        }
     }
 
-    bool insert(double length, std::vector<sim_mob::WayPoint> &path)
+    void setBlocked(const std::vector<std::uint32_t> &blocked, bool value)
     {
+        for (std::uint32_t link : blocked)
         {
-            //this block is a modification to Yen's algorithm to discard the duplicates in the candidate paths' list
-            //todo: optimize this duplicate search
-            PathIt it = std::find(paths.begin(), paths.end(), path);
-            if(it != paths.end())
+            if (value)
+            {
+                blockedMask[link >> 6] |= (std::uint64_t(1) << (link & 63));
+            }
+            else
             {
-                return false;
+                blockedMask[link >> 6] &= ~(std::uint64_t(1) << (link & 63));
             }
         }
-        PathIt it = paths.insert(paths.end(),path);
-        keys.push_back(std::make_pair(length, it));
-        return true;
     }
 
-    bool empty()
+    bool isBlocked(std::uint32_t link) const
     {
-        return keys.empty();
+        return (blockedMask[link >> 6] >> (link & 63)) & 1;
     }
 
-    int size()
-    {
-        return keys.size();
-    }
+    /// cost from the spur node to the end of each link, valid if stamps[link] == generation
+    std::vector<double> costs;
+    std::vector<std::uint32_t> parents;
+    std::vector<std::uint32_t> stamps;
+
+    /// settled[link] == generation if the link has been expanded
+    std::vector<std::uint32_t> settled;
+    std::uint32_t generation;
+
+    std::vector<std::uint64_t> blockedMask;
+    LinkQueue queue;
+};
 
-    void clear()
+/// reverse shortest path tree to a destination
+struct K_ShortestPathImpl::TreeWorkspace
+{
+    TreeWorkspace() : destination(nullptr)
     {
-        paths.clear();
-        keys.clear();
     }
 
-    void sort()
+    const Node *destination;
+
+    /// length of the shortest path from the start of each link (the link included) to the destination
+    std::vector<double> distances;
+
+    /// next link on that path, NO_LINK if the link ends at the destination
+    std::vector<std::uint32_t> nextLinks;
+};
+
+sim_mob::K_ShortestPathImpl::K_ShortestPathImpl() :
+        k(sim_mob::ConfigManager::GetInstance().FullConfig().getPathSetConf().kspLevel), nHelpers(0)
+{
+    const RoadNetwork* rn = RoadNetwork::getInstance();
+    const std::map<unsigned int, Link *>& linksMap = rn->getMapOfIdVsLinks();
+    std::unordered_map<unsigned int, std::uint32_t> indexById;
+
+    for (std::map<unsigned int, Link *>::const_iterator lnkIt = linksMap.begin(); lnkIt != linksMap.end(); lnkIt++)
     {
-        std::sort(keys.begin(), keys.end(),comp());
+        const Link* lnk = lnkIt->second;
+        const std::uint32_t index = links.size();
+        indexById[lnk->getLinkId()] = index;
+        links.push_back(lnk);
+        lengths.push_back(lnk->getLength());
+        downstreamLinksLookup[lnk->getFromNode()].push_back(index);
+        upstreamLinksLookup[lnk->getToNode()].push_back(index);
     }
 
-    const std::vector<sim_mob::WayPoint>& getBegin()
+    //the turning groups of the nodes connect the links, as in the driving graph of the street directory
+    std::vector<std::pair<std::uint32_t, std::uint32_t> > turns;
+    for (std::unordered_map<const Node*, std::vector<std::uint32_t> >::const_iterator itNode = upstreamLinksLookup.begin();
+            itNode != upstreamLinksLookup.end(); ++itNode)
     {
-        if(empty() || !size())
+        const std::map<unsigned int, std::map<unsigned int, TurningGroup *> >& turningGroups = itNode->first->getTurningGroups();
+        for (std::map<unsigned int, std::map<unsigned int, TurningGroup *> >::const_iterator itFrom = turningGroups.begin();
+                itFrom != turningGroups.end(); ++itFrom)
         {
-            throw std::runtime_error("Empty K-Shortest path intermediary collections, check before fetch");
+            std::unordered_map<unsigned int, std::uint32_t>::const_iterator from = indexById.find(itFrom->first);
+            if (from == indexById.end() || links[from->second]->getToNode() != itNode->first)
+            {
+                continue;
+            }
+
+            for (std::map<unsigned int, TurningGroup *>::const_iterator itTo = itFrom->second.begin(); itTo != itFrom->second.end(); ++itTo)
+            {
+                std::unordered_map<unsigned int, std::uint32_t>::const_iterator to = indexById.find(itTo->first);
+                if (to != indexById.end() && links[to->second]->getFromNode() == itNode->first)
+                {
+                    turns.push_back(std::make_pair(from->second, to->second));
+                }
+            }
         }
-        return *(keys.begin()->second);
     }
 
-    void eraseBegin()
+    std::sort(turns.begin(), turns.end());
+    turns.erase(std::unique(turns.begin(), turns.end()), turns.end());
+    buildAdjacency(links.size(), turns, successorOffsets, successors);
+
+    for (std::pair<std::uint32_t, std::uint32_t> &turn : turns)
+    {
+        std::swap(turn.first, turn.second);
+    }
+    buildAdjacency(links.size(), turns, predecessorOffsets, predecessors);
+
+    const unsigned int nThreads = sim_mob::ConfigManager::GetInstance().FullConfig().getPathSetConf().kspThreads;
+    if (nThreads > 1)
     {
-        paths.erase(keys.begin()->second);
-        keys.erase(keys.begin());
+        nHelpers = nThreads - 1;
+        threadPool.reset(new sim_mob::ThreadPool(nHelpers));
     }
-};
+}
 
-namespace
+sim_mob::K_ShortestPathImpl::~K_ShortestPathImpl()
+{
+}
+
+boost::shared_ptr<K_ShortestPathImpl> sim_mob::K_ShortestPathImpl::getInstance()
 {
-    std::vector<const sim_mob::Link*> BL_VECTOR(std::set<const sim_mob::Link*> &input)
+    if(!instance)
     {
-        std::vector<const sim_mob::Link*> output;
-        std::copy(input.begin(), input.end(), std::back_inserter(output));
-        return output;
+        instance.reset(new K_ShortestPathImpl());
     }
+    return instance;
 }
+
 /**
  * This method attempt follows He's pseudocode. For comfort of future readers, the namings are exactly same as the document
+ * Paths are handled as sequences of link indices, and are converted to waypoints when they are accepted.
  */
 int sim_mob::K_ShortestPathImpl::getKShortestPaths(const sim_mob::Node *from, const sim_mob::Node *to, std::vector< std::vector<sim_mob::WayPoint> > &res)
 {
-    StreetDirectory& stdir = StreetDirectory::Instance();
+    //the tree is kept by the thread: consecutive queries to the same destination (e.g. in bulk pathset generation)
+    //share it
+    static thread_local TreeWorkspace tree;
     std::vector< std::vector<sim_mob::WayPoint> > &A = res;//just renaming the variable
-    std::vector<const Link*> bl;//black list
-    std::set<const Link*> blSet;
+    std::vector<LinkSequence> A_Links;
+
     //  STEP 1: find path A1
     //          Apply any shortest path algorithm (e.g., Dijkstra's) to find the shortest path from O to D, given link weights W and network graph G.
-    std::vector<sim_mob::WayPoint> temp = stdir.SearchShortestDrivingPath<sim_mob::Node, sim_mob::Node>(*from, *to, bl);
-    std::vector<sim_mob::WayPoint> A0;//actually A1 (in the pseudo code)
-    sim_mob::SinglePath::filterOutNodes(temp, A0);
+    //          Here, it is read from the reverse shortest path tree to D
+    buildReverseTree(to, tree);
+
+    std::uint32_t first = NO_LINK;
+    for (std::uint32_t link : getLinks(downstreamLinksLookup, from))
+    {
+        if (tree.distances[link] < INFINITE_DISTANCE && (first == NO_LINK || tree.distances[link] < tree.distances[first]))
+        {
+            first = link;
+        }
+    }
+
     //sanity check
-    if(A0.empty())
+    if (first == NO_LINK)
     {
         return 0;
     }
 
+    LinkSequence A0;//actually A1 (in the pseudo code)
+    for (std::uint32_t link = first; link != NO_LINK; link = tree.nextLinks[link])
+    {
+        A0.push_back(link);
+    }
+
     // Store it in path list A as A1
-    A.push_back(A0);
+    A_Links.push_back(A0);
+    A.push_back(std::vector<sim_mob::WayPoint>());
+    for (std::uint32_t link : A0)
+    {
+        A.back().push_back(WayPoint(links[link]));
+    }
 
-    // Set path list B = []
-    BType B ;
+    // Set path list B = []. B is sorted by path weight, and by insertion order for equal weights.
+    // As a modification to Yen's algorithm, the duplicates in the candidate paths' list are discarded
+    std::map<std::pair<double, unsigned int>, LinkSequence> B;
+    std::unordered_set<LinkSequence, LinkSequenceHash> knownPaths;
+    knownPaths.insert(A0);
+    unsigned int insertions = 0;
+    std::vector<SpurSearch> searches;
 
     //STEP 2: find paths AK , where K = 2, 3, ..., k.
     int K = 1; //k = 2
     while(true)
     {
+        const LinkSequence &lastPath = A_Links[K-1];
+
         // Set path list C = A.
-        std::vector< std::vector<sim_mob::WayPoint> > C = A;
-        // Set RootPath = [].
-        std::vector<sim_mob::WayPoint> rootPath;
+        std::vector<size_t> C(A_Links.size());
+        for (size_t j = 0; j < C.size(); j++)
+        {
+            C[j] = j;
+        }
+
         // For i = 0 to size(A,k-1)-1:
-        for(int i = 0; i < A[K-1].size(); i++)
+        searches.assign(lastPath.size(), SpurSearch());
+        for (size_t i = 0; i < lastPath.size(); i++)
         {
             // nextRootPathLink = A,k-1 [i]
-            sim_mob::WayPoint nextRootPathLink = A[K-1][i];
-            const sim_mob::Node *spurNode = nextRootPathLink.link->getFromNode();
+            const std::uint32_t nextRootPathLink = lastPath[i];
+            SpurSearch &search = searches[i];
+            search.spurNode = links[nextRootPathLink]->getFromNode();
+            search.destination = to;
+            search.rootLastLink = (i > 0 ? lastPath[i - 1] : NO_LINK);
 
             // Find links whose EndNode = SpurNode, and block them.
-            blSet = getUpstreamLinks(spurNode); //find and store in the blacklist
-            //if(nextRootPathLink.roadSegment_->getStart() == nextRootPathLink.roadSegment_->getLink()->getStart())//this line('if' condition only, not the if block) is an optimization to HE's pseudo code to bypass uninodes
+            search.blocked = getLinks(upstreamLinksLookup, search.spurNode);
+
+            //  For each path Cj in path list C:
+            for (size_t j = 0; j < C.size(); j++)
             {
-                //  For each path Cj in path list C:
-                for(int j = 0; j < C.size(); j++)
+                //Block link Cj[i].
+                const LinkSequence &Cj = A_Links[C[j]];
+                if (i < Cj.size())
                 {
-                    //Block link Cj[i].
-                    blSet.insert(C[j][i].link);
+                    search.blocked.push_back(Cj[i]);
                 }
-                //Find shortest path from SpurNode to D, and store it as SpurPath.
-                temp.clear();
-                temp = stdir.SearchShortestDrivingPath<sim_mob::Node, sim_mob::Node>(*spurNode, *to, BL_VECTOR(blSet));
-                std::vector<sim_mob::WayPoint> spurPath;
-                sim_mob::SinglePath::filterOutNodes(temp, spurPath);
-                std::vector<sim_mob::WayPoint> fullPath;
-                if(validatePath(rootPath, spurPath))
+            }
+
+            //  For each path Cj in path list C:
+            //      If Cj[i] != nextRootPathLink: Delete Cj from C.
+            size_t kept = 0;
+            for (size_t j = 0; j < C.size(); j++)
+            {
+                const LinkSequence &Cj = A_Links[C[j]];
+                if (i < Cj.size() && Cj[i] == nextRootPathLink)
                 {
-                    //  Set TotalPath = RootPath + SpurPath.
-                    fullPath.insert(fullPath.end(), rootPath.begin(),rootPath.end());
-                    fullPath.insert(fullPath.end(), spurPath.begin(), spurPath.end());
-                    //  Add TotalPath to path list B.
-                    B.insert(sim_mob::generatePathLength(fullPath), fullPath);
+                    C[kept++] = C[j];
                 }
             }
-            //  For each path Cj in path list C:
-            for(int j = 0; j < C.size(); j++)
+            C.resize(kept);
+        }
+
+        //Find shortest path from each SpurNode to D, and store it as SpurPath.
+        computeSpurPaths(searches, tree);
+
+        for (size_t i = 0; i < searches.size(); i++)
+        {
+            if (!searches[i].found)
             {
-                // If Cj[i] != nextRootPathLink:
-                if(C[j][i] != nextRootPathLink)
+                continue;
+            }
+
+            //  Set TotalPath = RootPath + SpurPath.
+            LinkSequence fullPath(lastPath.begin(), lastPath.begin() + i);
+            fullPath.insert(fullPath.end(), searches[i].spurPath.begin(), searches[i].spurPath.end());
+
+            //  Add TotalPath to path list B.
+            if (knownPaths.insert(fullPath).second)
+            {
+                std::vector<sim_mob::WayPoint> wayPoints;
+                for (std::uint32_t link : fullPath)
                 {
-                    //Delete Cj from C.
-                    C.erase(C.begin() + j);
-                    j--;
+                    wayPoints.push_back(WayPoint(links[link]));
                 }
+                B[std::make_pair(sim_mob::generatePathLength(wayPoints), insertions++)].swap(fullPath);
             }
-            //  Add nextRootPathLink to RootPath
-            rootPath.push_back(nextRootPathLink);
-        }//for
+        }
 
         //  If B = []:
         if(B.empty())
@@ -213,15 +401,18 @@ int sim_mob::K_ShortestPathImpl::getKShortestPaths(const sim_mob::Node *from, co
             //break
             break;
         }
-        //  Sort path list B by path weight.
-        B.sort();
+
         //  Add B[0] to path list A, and delete it from path list B.
-        const std::vector<sim_mob::WayPoint> & B0 = B.getBegin();
+        A_Links.push_back(LinkSequence());
+        A_Links.back().swap(B.begin()->second);
+        B.erase(B.begin());
+
+        A.push_back(std::vector<sim_mob::WayPoint>());
+        for (std::uint32_t link : A_Links.back())
+        {
+            A.back().push_back(WayPoint(links[link]));
+        }
 
-        A.push_back(B0);
-        B.eraseBegin();
-        //  Restore blocked links.
-        blSet.clear();
         // If size(A) < k:
         if(A.size() < k)//mind the lower/upper case of K!
         {
@@ -239,36 +430,194 @@ int sim_mob::K_ShortestPathImpl::getKShortestPaths(const sim_mob::Node *from, co
     return A.size();
 }
 
-std::set<const Link*> sim_mob::K_ShortestPathImpl::getUpstreamLinks(const Node *spurNode) const
+void sim_mob::K_ShortestPathImpl::buildReverseTree(const Node *to, TreeWorkspace &tree) const
+{
+    if (tree.destination == to && tree.distances.size() == links.size())
+    {
+        return;
+    }
+
+    tree.destination = to;
+    tree.distances.assign(links.size(), INFINITE_DISTANCE);
+    tree.nextLinks.assign(links.size(), NO_LINK);
+
+    //plain Dijkstra on the reversed graph, starting from the links ending at the destination
+    LinkQueue queue;
+    for (std::uint32_t link : getLinks(upstreamLinksLookup, to))
+    {
+        tree.distances[link] = lengths[link];
+        queue.push(std::make_pair(lengths[link], link));
+    }
+
+    while (!queue.empty())
+    {
+        const QueueEntry entry = queue.top();
+        queue.pop();
+
+        if (entry.first > tree.distances[entry.second])
+        {
+            continue;
+        }
+
+        for (std::uint32_t i = predecessorOffsets[entry.second]; i < predecessorOffsets[entry.second + 1]; ++i)
+        {
+            const std::uint32_t predecessor = predecessors[i];
+            const double distance = lengths[predecessor] + entry.first;
+
+            if (distance < tree.distances[predecessor])
+            {
+                tree.distances[predecessor] = distance;
+                tree.nextLinks[predecessor] = entry.second;
+                queue.push(std::make_pair(distance, predecessor));
+            }
+        }
+    }
+}
+
+void sim_mob::K_ShortestPathImpl::searchSpurPath(SpurSearch &search, const TreeWorkspace &tree) const
 {
-    std::map<const Node *, std::set<const Link*> >::const_iterator itUpstreamLinks = upstreamLinksLookup.find(spurNode);
-    
-    if(itUpstreamLinks != upstreamLinksLookup.end())
+    static thread_local SearchWorkspace workspace;
+    workspace.prepare(links.size());
+    workspace.setBlocked(search.blocked, true);
+
+    LinkQueue &queue = workspace.queue;
+    while (!queue.empty())
+    {
+        queue.pop();
+    }
+
+    //A* search, with the distances of the reverse tree as heuristic. They are exact lower bounds of the remaining
+    //length (blocking links only makes paths longer), so the search only leaves the tree where it is blocked.
+    //The key of a link is the cost to its end + the remaining length from its end to the destination.
+    //The spur path must continue the root path: its first link must be reachable from the last link of the root path
+    const std::uint32_t *start;
+    const std::uint32_t *end;
+    const std::vector<std::uint32_t> &spurNodeLinks = getLinks(downstreamLinksLookup, search.spurNode);
+    if (search.rootLastLink == NO_LINK)
     {
-        return itUpstreamLinks->second;
+        start = spurNodeLinks.data();
+        end = start + spurNodeLinks.size();
     }
     else
     {
-        return std::set<const Link*>();
+        start = successors.data() + successorOffsets[search.rootLastLink];
+        end = successors.data() + successorOffsets[search.rootLastLink + 1];
+    }
+
+    for (const std::uint32_t *it = start; it != end; ++it)
+    {
+        if (!workspace.isBlocked(*it) && tree.distances[*it] < INFINITE_DISTANCE)
+        {
+            workspace.costs[*it] = lengths[*it];
+            workspace.parents[*it] = NO_LINK;
+            workspace.stamps[*it] = workspace.generation;
+            queue.push(std::make_pair(tree.distances[*it], *it));
+        }
+    }
+
+    std::uint32_t goal = NO_LINK;
+    while (!queue.empty())
+    {
+        const std::uint32_t link = queue.top().second;
+        queue.pop();
+
+        if (workspace.settled[link] == workspace.generation)
+        {
+            continue;
+        }
+        workspace.settled[link] = workspace.generation;
+
+        if (links[link]->getToNode() == search.destination)
+        {
+            goal = link;
+            break;
+        }
+
+        for (std::uint32_t i = successorOffsets[link]; i < successorOffsets[link + 1]; ++i)
+        {
+            const std::uint32_t successor = successors[i];
+            if (workspace.isBlocked(successor) || tree.distances[successor] == INFINITE_DISTANCE
+                    || workspace.settled[successor] == workspace.generation)
+            {
+                continue;
+            }
+
+            const double cost = workspace.costs[link] + lengths[successor];
+            if (workspace.stamps[successor] != workspace.generation || cost < workspace.costs[successor])
+            {
+                workspace.costs[successor] = cost;
+                workspace.parents[successor] = link;
+                workspace.stamps[successor] = workspace.generation;
+                queue.push(std::make_pair(cost - lengths[successor] + tree.distances[successor], successor));
+            }
+        }
+    }
+
+    workspace.setBlocked(search.blocked, false);
+
+    search.spurPath.clear();
+    search.found = (goal != NO_LINK);
+    for (std::uint32_t link = goal; link != NO_LINK; link = workspace.parents[link])
+    {
+        search.spurPath.push_back(link);
     }
+    std::reverse(search.spurPath.begin(), search.spurPath.end());
 }
 
-bool sim_mob::K_ShortestPathImpl::validatePath(const std::vector<sim_mob::WayPoint> &rootPath, const std::vector<sim_mob::WayPoint> &spurPath)
+void sim_mob::K_ShortestPathImpl::runSpurSearches(boost::shared_ptr<SpurSearchBatch> batch)
 {
-    if(spurPath.empty())
+    for (size_t i = batch->next++; i < batch->nSearches; i = batch->next++)
     {
-        return false;
+        batch->ksp->searchSpurPath(batch->searches[i], batch->tree);
+
+        boost::unique_lock<boost::mutex> lock(batch->mutex);
+        if (++batch->completed == batch->nSearches)
+        {
+            batch->done.notify_all();
+        }
     }
+}
 
-    if(!rootPath.empty())
+void sim_mob::K_ShortestPathImpl::computeSpurPaths(std::vector<SpurSearch> &searches, const TreeWorkspace &tree)
+{
+    if (!threadPool || searches.size() < 2)
     {
-        const Link *spurPathFirstLnk = spurPath.begin()->link;
-        const Link *rootPathLastLnk = rootPath.rbegin()->link;
-        const TurningGroup* connectingTurnGroup = spurPathFirstLnk->getFromNode()->getTurningGroup(rootPathLastLnk->getLinkId(), spurPathFirstLnk->getLinkId());
-        if(!connectingTurnGroup)
+        for (SpurSearch &search : searches)
         {
-            return false;
+            searchSpurPath(search, tree);
         }
+        return;
+    }
+
+    boost::shared_ptr<SpurSearchBatch> batch(new SpurSearchBatch(this, searches, tree));
+    const size_t nHelpersUsed = std::min<size_t>(nHelpers, searches.size() - 1);
+    for (size_t i = 0; i < nHelpersUsed; ++i)
+    {
+        threadPool->enqueue(boost::bind(&K_ShortestPathImpl::runSpurSearches, batch));
+    }
+
+    //the calling thread works too, so the searches complete even if the helpers are busy with other batches
+    runSpurSearches(batch);
+
+    boost::unique_lock<boost::mutex> lock(batch->mutex);
+    while (batch->completed < searches.size())
+    {
+        batch->done.wait(lock);
+    }
+}
+
+const std::vector<std::uint32_t>& sim_mob::K_ShortestPathImpl::getLinks(const std::unordered_map<const Node*, std::vector<std::uint32_t> > &lookup,
+                                                                      const Node *node) const
+{
+    static const std::vector<std::uint32_t> noLinks;
+    std::unordered_map<const Node*, std::vector<std::uint32_t> >::const_iterator itLinks = lookup.find(node);
+
+    if (itLinks != lookup.end())
+    {
+        return itLinks->second;
+    }
+    else
+    {
+        return noLinks;
     }
-    return true;
 }
@@ -2,9 +2,9 @@
 #pragma once
 
 #include <boost/shared_ptr.hpp>
-#include <map>
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
-#include <set>
 #include <string>
 #include "geospatial/network/Link.hpp"
 #include "geospatial/network/Node.hpp"
@@ -13,9 +13,19 @@
 namespace sim_mob
 {
 
+class ThreadPool;
+
 /**
  * Class encapsulating K-shortest path algorithm as documented by Dr. Huang He
  *
+ * The search runs on a compact copy of the driving network, in which the vertices are the links and the edges are
+ * the turning groups. Each query first computes the reverse shortest path tree to the destination. The tree gives the
+ * first path directly, and its distances are an exact A* heuristic for the spur searches, which therefore only
+ * expand the links that may improve on the shortest remaining path. Blocked links are kept in a bitset.
+ *
+ * The spur searches of one iteration are independent of each other, and may be computed by several threads (see
+ * PathSetConf::kspThreads). The calling thread always takes part in the searches.
+ *
  * \author Zhang Huai Peng
  * \author Vahid Saber Hamishagi
  * \author Harish Loganathan
@@ -49,22 +59,43 @@ public:
     }
 
 private:
+    struct SpurSearch;
+    struct SpurSearchBatch;
+    struct SearchWorkspace;
+    struct TreeWorkspace;
+
+    typedef std::vector<std::uint32_t> LinkSequence;
+
     K_ShortestPathImpl();
 
     /**
-     * Obtain the end segments of a given node, as per requirement of Yen's shortest path (mentioned in He's Algorithm)
-     * @param spurNode input node
-     * @param upLinks output
+     * Computes, for every link, the length of the shortest path from the start of the link to the destination
+     * @param to destination node
+     * @param tree output tree. Kept by the calling thread, and reused as long as the destination does not change
+     */
+    void buildReverseTree(const Node *to, TreeWorkspace &tree) const;
+
+    /**
+     * Finds the shortest path from the spur node to the destination which avoids the blocked links
+     * @param search the spur search (input and output)
+     * @param tree reverse shortest path tree to the destination
      */
-    std::set<const Link*> getUpstreamLinks(const Node *spurNode) const;
+    void searchSpurPath(SpurSearch &search, const TreeWorkspace &tree) const;
 
     /**
-     * Validates the intermediary results
-     * @param RootPath root path of the k-shortest path
-     * @param spurPath spur path of the k-shortest path
-     * @return true if all the validations are valid, false otherwise
+     * Executes spur searches of a batch until none is left. Run by the calling thread and by the helper threads
      */
-    bool validatePath(const std::vector<sim_mob::WayPoint> &rootPath, const std::vector<sim_mob::WayPoint> &spurPath);
+    static void runSpurSearches(boost::shared_ptr<SpurSearchBatch> batch);
+
+    /**
+     * Computes all the spur searches of an iteration
+     */
+    void computeSpurPaths(std::vector<SpurSearch> &searches, const TreeWorkspace &tree);
+
+    /**
+     * Links leaving (downstream) or arriving at (upstream) a node
+     */
+    const std::vector<std::uint32_t>& getLinks(const std::unordered_map<const Node*, std::vector<std::uint32_t> > &lookup, const Node *node) const;
 
     /**
      * number of shortest paths to generate when getKShortestPaths() function is called
@@ -72,14 +103,47 @@ private:
     int k;
 
     /**
-     * store all segments in A, key=id, value=road segment
+     * links of the network, by index
+     */
+    std::vector<const Link*> links;
+
+    /**
+     * lengths of the links, by index
+     */
+    std::vector<double> lengths;
+
+    /**
+     * successors of each link (links reachable through a turning group): the successors of link i are
+     * successors[successorOffsets[i] .. successorOffsets[i+1])
+     */
+    std::vector<std::uint32_t> successorOffsets;
+    std::vector<std::uint32_t> successors;
+
+    /**
+     * predecessors of each link, in the same format
+     */
+    std::vector<std::uint32_t> predecessorOffsets;
+    std::vector<std::uint32_t> predecessors;
+
+    /**
+     * store all downstream links for each node
      */
-    std::map<std::string, const sim_mob::RoadSegment*> A_Segments;
+    std::unordered_map<const Node*, std::vector<std::uint32_t> > downstreamLinksLookup;
 
     /**
      * store all upstream links for each node
      */
-    std::map<const Node *, std::set<const Link *> > upstreamLinksLookup;
+    std::unordered_map<const Node*, std::vector<std::uint32_t> > upstreamLinksLookup;
+
+    /**
+     * helper threads for the spur searches. Null if the searches are computed by the calling thread alone
+     */
+    boost::shared_ptr<sim_mob::ThreadPool> threadPool;
+
+    /**
+     * number of helper threads
+     */
+    unsigned int nHelpers;
 
     /**
      * static singleton instance
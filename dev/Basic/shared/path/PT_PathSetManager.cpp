@@ -20,6 +20,10 @@ const std::string LABELLING_APPROACH = "LBL";
 const std::string KSHORTEST_PATH = "KSH";
 const std::string LINK_ELIMINATION_APPROACH = "LEA";
 const std::string SIMULATION_APPROACH = "SNA";
+const std::string ROUND_BASED_APPROACH = "RBR";
+
+/** maximum number of rides of the journeys of the round-based router: one more than the transfers allowed */
+const unsigned int ROUND_BASED_MAX_RIDES = 5;
 
 class simpleOD {
 private:
@@ -115,13 +119,38 @@ void PT_PathSetManager::PT_BulkPathSetGenerator()
     Print() << "OD's for pathset generation: " << total_count << std::endl;
     const RoadNetwork* rn = RoadNetwork::getInstance();
     const std::map<unsigned int, Node *>& nodeLookup = rn->getMapOfIdvsNodes();
-    for(std::set<simpleOD>::const_iterator it=simpleOD_Set.begin();it!=simpleOD_Set.end();it++)
+    const PathSetConf& pathSetConf = ConfigManager::GetInstance().FullConfig().getPathSetConf();
+    if (pathSetConf.publicRoundBasedRouting)
     {
-        const sim_mob::Node* srcNode = rn->getById(nodeLookup, it->getStartNode());
-        const sim_mob::Node* destNode = rn->getById(nodeLookup, it->getDestNode());
-        threadpool->enqueue(boost::bind(&sim_mob::PT_PathSetManager::makePathset,this,srcNode,destNode));
+        //one search per origin gives the pathsets to all its destinations
+        std::map<const sim_mob::Node*, std::vector<const sim_mob::Node*> > destinationsByOrigin;
+        for(std::set<simpleOD>::const_iterator it=simpleOD_Set.begin();it!=simpleOD_Set.end();it++)
+        {
+            const sim_mob::Node* srcNode = rn->getById(nodeLookup, it->getStartNode());
+            const sim_mob::Node* destNode = rn->getById(nodeLookup, it->getDestNode());
+            destinationsByOrigin[srcNode].push_back(destNode);
+        }
+
+        PT_RoundBasedRouter router(PT_NetworkCreater::getInstance(), ROUND_BASED_MAX_RIDES, pathSetConf.publicRoundBasedBagSize);
+        Print() << "Round-based router: " << router.getNumVertices() << " vertices, "
+                << destinationsByOrigin.size() << " origins" << std::endl;
+        for (std::map<const sim_mob::Node*, std::vector<const sim_mob::Node*> >::const_iterator it = destinationsByOrigin.begin();
+             it != destinationsByOrigin.end(); it++)
+        {
+            threadpool->enqueue(boost::bind(&sim_mob::PT_PathSetManager::makeRoundBasedPathsets, this, &router, it->first, it->second));
+        }
+        threadpool->wait();
+    }
+    else
+    {
+        for(std::set<simpleOD>::const_iterator it=simpleOD_Set.begin();it!=simpleOD_Set.end();it++)
+        {
+            const sim_mob::Node* srcNode = rn->getById(nodeLookup, it->getStartNode());
+            const sim_mob::Node* destNode = rn->getById(nodeLookup, it->getDestNode());
+            threadpool->enqueue(boost::bind(&sim_mob::PT_PathSetManager::makePathset,this,srcNode,destNode));
+        }
+        threadpool->wait();
     }
-    threadpool->wait();
 
     conn.disconnect();
 }
@@ -151,6 +180,62 @@ PT_PathSet PT_PathSetManager::makePathset(const sim_mob::Node* from,const sim_mo
     return ptPathSet;
 }
 
+void PT_PathSetManager::makeRoundBasedPathsets(const PT_RoundBasedRouter* router, const sim_mob::Node* from,
+                                                std::vector<const sim_mob::Node*> to)
+{
+    std::vector<StreetDirectory::PT_VertexId> toIds;
+    for (const sim_mob::Node* node : to)
+    {
+        toIds.push_back(getVertexIdFromNode(node));
+    }
+
+    std::vector<std::vector<PT_RoundBasedRouter::Journey> > journeys;
+    router->route(getVertexIdFromNode(from), toIds, journeys);
+
+    for (size_t i = 0; i < to.size(); i++)
+    {
+        const std::vector<PT_RoundBasedRouter::Journey>& odJourneys = journeys[i];
+        PT_PathSet ptPathSet;
+
+        //the journeys are sorted by travel time: the first one is the shortest path
+        size_t minTransfers = 0, minWalking = 0, minInVehicle = 0;
+        for (size_t j = 1; j < odJourneys.size(); j++)
+        {
+            if (odJourneys[j].rides < odJourneys[minTransfers].rides) { minTransfers = j; }
+            if (odJourneys[j].walkingTime < odJourneys[minWalking].walkingTime) { minWalking = j; }
+            if (odJourneys[j].inVehicleTime < odJourneys[minInVehicle].inVehicleTime) { minInVehicle = j; }
+        }
+
+        for (size_t j = 0; j < odJourneys.size(); j++)
+        {
+            vector<PT_NetworkEdge> path;
+            for (const PT_NetworkEdge* edge : odJourneys[j].edges)
+            {
+                path.push_back(*edge);
+            }
+
+            PT_Path ptPath(path);
+            ptPath.setShortestPath(j == 0);
+            ptPath.setMinNumberOfTransfers(j == minTransfers);
+            ptPath.setMinWalkingDistance(j == minWalking);
+            ptPath.setMinInVehicleTravelTimeSecs(j == minInVehicle);
+            std::stringstream scenario;
+            scenario << ROUND_BASED_APPROACH << (j + 1);
+            ptPath.setScenario(scenario.str());
+            ptPathSet.pathSet.insert(ptPath);
+        }
+
+        //computing path size
+        ptPathSet.computeAndSetPathSize();
+        // Checking the feasibility of the paths in the pathset. Infeasible paths are removed.
+        ptPathSet.checkPathFeasibilty();
+        // Writing the pathSet to the CSV file.
+        writePathSetToFile(ptPathSet, from->getNodeId(), to[i]->getNodeId());
+
+        Print() << ptPathSet.pathSet.size() << " paths generated for [" << from->getNodeId() << "," << to[i]->getNodeId() << "]" <<  std::endl;
+    }
+}
+
 void PT_PathSetManager::writePathSetFileHeader()
 {
     this->ptPathSetWriter << "pathset_origin_node," << "pathset_dest_node," << "scenario,"
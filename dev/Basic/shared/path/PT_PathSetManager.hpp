@@ -7,6 +7,7 @@
 #include "geospatial/network/Node.hpp"
 #include "geospatial/streetdir/StreetDirectory.hpp"
 #include "path/Path.hpp"
+#include "path/PT_RoundBasedRouter.hpp"
 #include "util/threadpool/Threadpool.hpp"
 #include <fstream>
 
@@ -36,6 +37,14 @@ private:
      * @return path set between two nodes
      */
     PT_PathSet makePathset(const sim_mob::Node* from, const sim_mob::Node* to);
+    /**
+     * make the public path sets from one node to several nodes with a single search of the round-based router
+     * @param router the round-based router
+     * @param from is original node
+     * @param to are the destination nodes
+     */
+    void makeRoundBasedPathsets(const PT_RoundBasedRouter* router, const sim_mob::Node* from,
+                                std::vector<const sim_mob::Node*> to);
     /**
      * get corresponding vertex id from the node
      * @param node is a pointer to a node object
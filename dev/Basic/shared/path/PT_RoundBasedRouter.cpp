@@ -0,0 +1,551 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "PT_RoundBasedRouter.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "entities/params/PT_NetworkEntities.hpp"
+
+using namespace sim_mob;
+
+namespace
+{
+/** how a label reached its vertex */
+enum Phase
+{
+    /** by a bus or train edge (or the origin itself) */
+    RIDE_PHASE = 0,
+
+    /** by a walking or SMS edge following a ride (or leaving the origin) */
+    WALK_PHASE = 1,
+
+    NUM_PHASES = 2
+};
+
+/** travel time and walking time of a label, the criteria compared inside a bag */
+struct Criteria
+{
+    double travelTime;
+    double walkingTime;
+
+    bool dominates(double otherTravelTime, double otherWalkingTime) const
+    {
+        return travelTime <= otherTravelTime && walkingTime <= otherWalkingTime;
+    }
+};
+
+bool isRideEdge(const PT_NetworkEdge& edge)
+{
+    return edge.getType() == BUS_EDGE || edge.getType() == TRAIN_EDGE;
+}
+
+bool isWalkEdge(const PT_NetworkEdge& edge)
+{
+    return edge.getType() == WALK_EDGE || edge.getType() == SMS_EDGE;
+}
+
+/** candidate journey at the destination, before the pareto filter */
+struct Candidate
+{
+    std::uint32_t round;
+    std::uint8_t phase;
+    std::uint8_t slot;
+    double travelTime;
+    double walkingTime;
+
+    bool dominates(const Candidate& other) const
+    {
+        return travelTime <= other.travelTime && round <= other.round && walkingTime <= other.walkingTime
+               && (travelTime < other.travelTime || round < other.round || walkingTime < other.walkingTime);
+    }
+};
+}
+
+struct PT_RoundBasedRouter::Label
+{
+    double travelTime;
+    double walkingTime;
+    double inVehicleTime;
+
+    /** edge leading to the vertex of the label, null for the origin */
+    const PT_NetworkEdge* edge;
+
+    /** vertex, phase and bag slot of the label the edge leaves from */
+    std::uint32_t parentVertex;
+    std::uint8_t parentPhase;
+    std::uint8_t parentSlot;
+};
+
+/**
+ * Labels of a search. Bags are stored in flat arrays, one bag of bagCapacity labels for each round, phase and vertex.
+ * Only the bags touched by a search are cleared before the next one.
+ */
+struct PT_RoundBasedRouter::Workspace
+{
+    Workspace() : nVertices(0), nRounds(0), capacity(0)
+    {
+    }
+
+    void reset(size_t vertices, size_t rounds, size_t bagCapacity)
+    {
+        if (vertices != nVertices || rounds != nRounds || bagCapacity != capacity)
+        {
+            nVertices = vertices;
+            nRounds = rounds;
+            capacity = bagCapacity;
+            labels.assign(nRounds * NUM_PHASES * nVertices * capacity, Label());
+            counts.assign(nRounds * NUM_PHASES * nVertices, 0);
+
+            for (int phase = 0; phase < NUM_PHASES; ++phase)
+            {
+                best[phase].assign(nVertices * capacity, Criteria());
+                bestCounts[phase].assign(nVertices, 0);
+                markedFlags[phase].assign(nVertices, false);
+                marked[phase].clear();
+                previouslyMarked[phase].clear();
+            }
+
+            touchedBags.clear();
+            touchedVertices.clear();
+            return;
+        }
+
+        for (size_t bag : touchedBags)
+        {
+            counts[bag] = 0;
+        }
+
+        for (std::uint32_t vertex : touchedVertices)
+        {
+            bestCounts[RIDE_PHASE][vertex] = 0;
+            bestCounts[WALK_PHASE][vertex] = 0;
+        }
+
+        for (int phase = 0; phase < NUM_PHASES; ++phase)
+        {
+            for (std::uint32_t vertex : marked[phase])
+            {
+                markedFlags[phase][vertex] = false;
+            }
+            marked[phase].clear();
+            previouslyMarked[phase].clear();
+        }
+
+        touchedBags.clear();
+        touchedVertices.clear();
+    }
+
+    size_t getBag(size_t round, int phase, std::uint32_t vertex) const
+    {
+        return (round * NUM_PHASES + phase) * nVertices + vertex;
+    }
+
+    Label& getLabel(size_t bag, size_t slot)
+    {
+        return labels[bag * capacity + slot];
+    }
+
+    const Label& getLabel(size_t bag, size_t slot) const
+    {
+        return labels[bag * capacity + slot];
+    }
+
+    /**
+     * inserts a label in the bag of a vertex
+     * @return true if the label has been inserted, false if it is dominated
+     */
+    bool insert(size_t round, int phase, std::uint32_t vertex, const Label& label)
+    {
+        //a label that arrived by walking cannot be followed by another walk, so only the labels that arrived by
+        //a ride may discard a ride label. Any label may discard a walk label
+        const int bestPhase = (phase == RIDE_PHASE) ? RIDE_PHASE : WALK_PHASE;
+        const Criteria* bestBag = &best[bestPhase][vertex * capacity];
+        for (std::uint8_t i = 0; i < bestCounts[bestPhase][vertex]; ++i)
+        {
+            if (bestBag[i].dominates(label.travelTime, label.walkingTime))
+            {
+                return false;
+            }
+        }
+
+        const size_t bag = getBag(round, phase, vertex);
+        std::uint8_t& count = counts[bag];
+        if (count == 0)
+        {
+            touchedBags.push_back(bag);
+        }
+
+        //labels of this round dominated by the new label have no children yet: drop them
+        std::uint8_t kept = 0;
+        for (std::uint8_t i = 0; i < count; ++i)
+        {
+            const Label& other = getLabel(bag, i);
+            if (!(label.travelTime <= other.travelTime && label.walkingTime <= other.walkingTime))
+            {
+                getLabel(bag, kept++) = other;
+            }
+        }
+        count = kept;
+
+        if (count < capacity)
+        {
+            getLabel(bag, count++) = label;
+        }
+        else
+        {
+            std::uint8_t slowest = 0;
+            for (std::uint8_t i = 1; i < count; ++i)
+            {
+                if (getLabel(bag, i).travelTime > getLabel(bag, slowest).travelTime)
+                {
+                    slowest = i;
+                }
+            }
+
+            if (getLabel(bag, slowest).travelTime <= label.travelTime)
+            {
+                return false;
+            }
+            getLabel(bag, slowest) = label;
+        }
+
+        if (bestCounts[RIDE_PHASE][vertex] == 0 && bestCounts[WALK_PHASE][vertex] == 0)
+        {
+            touchedVertices.push_back(vertex);
+        }
+
+        //the walk phase best bag holds the labels of both phases
+        insertBest(WALK_PHASE, vertex, label);
+        if (phase == RIDE_PHASE)
+        {
+            insertBest(RIDE_PHASE, vertex, label);
+        }
+
+        if (!markedFlags[phase][vertex])
+        {
+            markedFlags[phase][vertex] = true;
+            marked[phase].push_back(vertex);
+        }
+        return true;
+    }
+
+    void insertBest(int phase, std::uint32_t vertex, const Label& label)
+    {
+        Criteria* bestBag = &best[phase][vertex * capacity];
+        std::uint8_t& count = bestCounts[phase][vertex];
+
+        std::uint8_t kept = 0;
+        for (std::uint8_t i = 0; i < count; ++i)
+        {
+            if (!(label.travelTime <= bestBag[i].travelTime && label.walkingTime <= bestBag[i].walkingTime))
+            {
+                bestBag[kept++] = bestBag[i];
+            }
+        }
+        count = kept;
+
+        const Criteria criteria = { label.travelTime, label.walkingTime };
+        if (count < capacity)
+        {
+            bestBag[count++] = criteria;
+            return;
+        }
+
+        std::uint8_t slowest = 0;
+        for (std::uint8_t i = 1; i < count; ++i)
+        {
+            if (bestBag[i].travelTime > bestBag[slowest].travelTime)
+            {
+                slowest = i;
+            }
+        }
+
+        if (bestBag[slowest].travelTime > criteria.travelTime)
+        {
+            bestBag[slowest] = criteria;
+        }
+    }
+
+    /** moves the vertices marked in the current round to the previous round */
+    void nextRound()
+    {
+        for (int phase = 0; phase < NUM_PHASES; ++phase)
+        {
+            for (std::uint32_t vertex : marked[phase])
+            {
+                markedFlags[phase][vertex] = false;
+            }
+            previouslyMarked[phase].swap(marked[phase]);
+            marked[phase].clear();
+        }
+    }
+
+    size_t nVertices;
+    size_t nRounds;
+    size_t capacity;
+
+    std::vector<Label> labels;
+    std::vector<std::uint8_t> counts;
+
+    /** labels not dominated so far at each vertex, over all the rounds */
+    std::vector<Criteria> best[NUM_PHASES];
+    std::vector<std::uint8_t> bestCounts[NUM_PHASES];
+
+    /** vertices whose bags have been improved in the current and in the previous round */
+    std::vector<std::uint32_t> marked[NUM_PHASES];
+    std::vector<std::uint32_t> previouslyMarked[NUM_PHASES];
+    std::vector<bool> markedFlags[NUM_PHASES];
+
+    std::vector<size_t> touchedBags;
+    std::vector<std::uint32_t> touchedVertices;
+};
+
+PT_RoundBasedRouter::PT_RoundBasedRouter(const PT_Network& network, unsigned int maxRides, unsigned int bagCapacity) :
+        maxRides(maxRides), bagCapacity(bagCapacity)
+{
+    if (bagCapacity == 0 || bagCapacity > 255)
+    {
+        throw std::runtime_error("PT_RoundBasedRouter: the bag capacity must be between 1 and 255");
+    }
+
+    for (std::map<std::string, PT_NetworkVertex>::const_iterator it = network.PT_NetworkVertexMap.begin();
+         it != network.PT_NetworkVertexMap.end(); ++it)
+    {
+        nodeVertices[getOrAddVertex(it->first)] = (it->second.getStopType() == 0);
+    }
+
+    std::vector<std::vector<std::pair<const PT_NetworkEdge*, std::uint32_t> > > rideEdges, walkEdges;
+    for (std::map<int, PT_NetworkEdge>::const_iterator it = network.PT_NetworkEdgeMap.begin();
+         it != network.PT_NetworkEdgeMap.end(); ++it)
+    {
+        const PT_NetworkEdge& edge = it->second;
+        if (!isRideEdge(edge) && !isWalkEdge(edge))
+        {
+            continue;
+        }
+
+        const std::uint32_t from = getOrAddVertex(edge.getStartStop());
+        const std::uint32_t to = getOrAddVertex(edge.getEndStop());
+        std::vector<std::vector<std::pair<const PT_NetworkEdge*, std::uint32_t> > >& edges =
+                isRideEdge(edge) ? rideEdges : walkEdges;
+
+        if (edges.size() <= from)
+        {
+            edges.resize(from + 1);
+        }
+        edges[from].push_back(std::make_pair(&edge, to));
+    }
+
+    rideEdges.resize(vertexIds.size());
+    walkEdges.resize(vertexIds.size());
+    buildAdjacency(rideEdges, rides);
+    buildAdjacency(walkEdges, walks);
+}
+
+std::uint32_t PT_RoundBasedRouter::getOrAddVertex(const std::string& id)
+{
+    std::pair<std::unordered_map<std::string, std::uint32_t>::iterator, bool> inserted =
+            vertexIndex.insert(std::make_pair(id, static_cast<std::uint32_t>(vertexIds.size())));
+
+    if (inserted.second)
+    {
+        vertexIds.push_back(id);
+        //vertices missing from the vertex table are recognised by the prefix of the SimMobility nodes
+        nodeVertices.push_back(id.compare(0, 2, "N_") == 0);
+    }
+    return inserted.first->second;
+}
+
+void PT_RoundBasedRouter::buildAdjacency(
+        std::vector<std::vector<std::pair<const PT_NetworkEdge*, std::uint32_t> > >& edgesByVertex, Adjacency& adjacency)
+{
+    adjacency.offsets.assign(1, 0);
+    adjacency.offsets.reserve(edgesByVertex.size() + 1);
+
+    for (const std::vector<std::pair<const PT_NetworkEdge*, std::uint32_t> >& edges : edgesByVertex)
+    {
+        for (const std::pair<const PT_NetworkEdge*, std::uint32_t>& edge : edges)
+        {
+            adjacency.edges.push_back(edge.first);
+            adjacency.targets.push_back(edge.second);
+        }
+        adjacency.offsets.push_back(adjacency.edges.size());
+    }
+
+    edgesByVertex.clear();
+}
+
+void PT_RoundBasedRouter::route(const std::string& origin, const std::vector<std::string>& destinations,
+                                std::vector<std::vector<Journey> >& journeys) const
+{
+    static thread_local Workspace workspace;
+
+    journeys.assign(destinations.size(), std::vector<Journey>());
+
+    std::unordered_map<std::string, std::uint32_t>::const_iterator itOrigin = vertexIndex.find(origin);
+    if (itOrigin == vertexIndex.end())
+    {
+        return;
+    }
+
+    search(itOrigin->second, workspace);
+
+    for (size_t i = 0; i < destinations.size(); ++i)
+    {
+        std::unordered_map<std::string, std::uint32_t>::const_iterator itDestination = vertexIndex.find(destinations[i]);
+        if (itDestination != vertexIndex.end() && itDestination->second != itOrigin->second)
+        {
+            collectJourneys(itDestination->second, workspace, journeys[i]);
+        }
+    }
+}
+
+void PT_RoundBasedRouter::search(std::uint32_t origin, Workspace& workspace) const
+{
+    workspace.reset(vertexIds.size(), maxRides + 1, bagCapacity);
+
+    Label originLabel = Label();
+    originLabel.edge = nullptr;
+    workspace.insert(0, RIDE_PHASE, origin, originLabel);
+
+    for (size_t round = 0; round <= maxRides; ++round)
+    {
+        if (round > 0)
+        {
+            //ride one more bus or train from the vertices improved in the previous round
+            for (int phase = 0; phase < NUM_PHASES; ++phase)
+            {
+                for (std::uint32_t vertex : workspace.previouslyMarked[phase])
+                {
+                    if (nodeVertices[vertex] && vertex != origin)
+                    {
+                        continue;
+                    }
+
+                    const size_t bag = workspace.getBag(round - 1, phase, vertex);
+                    for (std::uint8_t slot = 0; slot < workspace.counts[bag]; ++slot)
+                    {
+                        const Label parent = workspace.getLabel(bag, slot);
+                        for (std::uint32_t e = rides.offsets[vertex]; e < rides.offsets[vertex + 1]; ++e)
+                        {
+                            const PT_NetworkEdge* edge = rides.edges[e];
+                            Label label;
+                            label.travelTime = parent.travelTime + edge->getLinkTravelTimeSecs();
+                            label.walkingTime = parent.walkingTime + edge->getWalkTimeSecs();
+                            label.inVehicleTime = parent.inVehicleTime + edge->getDayTransitTimeSecs();
+                            label.edge = edge;
+                            label.parentVertex = vertex;
+                            label.parentPhase = phase;
+                            label.parentSlot = slot;
+                            workspace.insert(round, RIDE_PHASE, rides.targets[e], label);
+                        }
+                    }
+                }
+            }
+        }
+
+        //walk (or take an SMS) from the vertices reached by a ride in this round
+        const std::vector<std::uint32_t>& ridden = workspace.marked[RIDE_PHASE];
+        for (std::uint32_t vertex : ridden)
+        {
+            if (nodeVertices[vertex] && vertex != origin)
+            {
+                continue;
+            }
+
+            const size_t bag = workspace.getBag(round, RIDE_PHASE, vertex);
+            for (std::uint8_t slot = 0; slot < workspace.counts[bag]; ++slot)
+            {
+                const Label parent = workspace.getLabel(bag, slot);
+                for (std::uint32_t e = walks.offsets[vertex]; e < walks.offsets[vertex + 1]; ++e)
+                {
+                    const PT_NetworkEdge* edge = walks.edges[e];
+                    Label label;
+                    label.travelTime = parent.travelTime + edge->getLinkTravelTimeSecs();
+                    label.walkingTime = parent.walkingTime + edge->getWalkTimeSecs();
+                    label.inVehicleTime = parent.inVehicleTime + edge->getDayTransitTimeSecs();
+                    label.edge = edge;
+                    label.parentVertex = vertex;
+                    label.parentPhase = RIDE_PHASE;
+                    label.parentSlot = slot;
+                    workspace.insert(round, WALK_PHASE, walks.targets[e], label);
+                }
+            }
+        }
+
+        if (workspace.marked[RIDE_PHASE].empty() && workspace.marked[WALK_PHASE].empty())
+        {
+            break;
+        }
+        workspace.nextRound();
+    }
+}
+
+void PT_RoundBasedRouter::collectJourneys(std::uint32_t destination, const Workspace& workspace,
+                                          std::vector<Journey>& journeys) const
+{
+    std::vector<Candidate> candidates;
+    for (size_t round = 0; round < workspace.nRounds; ++round)
+    {
+        for (int phase = 0; phase < NUM_PHASES; ++phase)
+        {
+            const size_t bag = workspace.getBag(round, phase, destination);
+            for (std::uint8_t slot = 0; slot < workspace.counts[bag]; ++slot)
+            {
+                const Label& label = workspace.getLabel(bag, slot);
+                Candidate candidate = { static_cast<std::uint32_t>(round), static_cast<std::uint8_t>(phase), slot,
+                                        label.travelTime, label.walkingTime };
+                candidates.push_back(candidate);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        bool dominated = false;
+        for (size_t j = 0; j < candidates.size() && !dominated; ++j)
+        {
+            dominated = candidates[j].dominates(candidates[i]);
+        }
+        if (dominated)
+        {
+            continue;
+        }
+
+        Journey journey;
+        journey.rides = candidates[i].round;
+        journey.travelTime = candidates[i].travelTime;
+        journey.walkingTime = candidates[i].walkingTime;
+
+        size_t round = candidates[i].round;
+        int phase = candidates[i].phase;
+        std::uint32_t vertex = destination;
+        std::uint8_t slot = candidates[i].slot;
+        const Label* label = &workspace.getLabel(workspace.getBag(round, phase, vertex), slot);
+        journey.inVehicleTime = label->inVehicleTime;
+
+        while (label->edge)
+        {
+            journey.edges.push_back(label->edge);
+            if (phase == RIDE_PHASE)
+            {
+                --round;
+            }
+            phase = label->parentPhase;
+            vertex = label->parentVertex;
+            slot = label->parentSlot;
+            label = &workspace.getLabel(workspace.getBag(round, phase, vertex), slot);
+        }
+
+        std::reverse(journey.edges.begin(), journey.edges.end());
+        journeys.push_back(journey);
+    }
+
+    std::sort(journeys.begin(), journeys.end(), [](const Journey& lhs, const Journey& rhs)
+    {
+        return lhs.travelTime < rhs.travelTime;
+    });
+}
@@ -0,0 +1,127 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sim_mob
+{
+
+class PT_Network;
+class PT_NetworkEdge;
+
+/**
+ * Round-based public transit router.
+ *
+ * The PT network carries averaged waiting, in-vehicle and walking times on its edges, so a search does not depend
+ * on a departure time. Each bus or train edge is a ride from a boarding stop to an alighting stop. Walking and SMS
+ * edges are access, egress and transfer legs.
+ *
+ * Round k of the search computes the journeys made of k rides. Each ride may be followed by one walking (or SMS)
+ * edge, and the origin may be left by one. As in RAPTOR, the rounds give the trade off between travel time and
+ * number of transfers. Each vertex also keeps a small bag of labels that are pareto optimal in travel time and
+ * walking time. One search from an origin gives the pareto optimal journeys to every destination.
+ *
+ * A router is immutable once built, so any number of threads may search it concurrently. Each thread keeps its own
+ * search workspace.
+ */
+class PT_RoundBasedRouter
+{
+public:
+    /** journey found by the router */
+    struct Journey
+    {
+        Journey() : travelTime(0.0), walkingTime(0.0), inVehicleTime(0.0), rides(0)
+        {
+        }
+
+        /** edges of the journey, in travel order */
+        std::vector<const PT_NetworkEdge*> edges;
+
+        /** sum of the link travel times of the edges, in seconds */
+        double travelTime;
+
+        /** sum of the walking times of the edges, in seconds */
+        double walkingTime;
+
+        /** sum of the in-vehicle times of the edges, in seconds */
+        double inVehicleTime;
+
+        /** number of bus and train edges */
+        unsigned int rides;
+    };
+
+    /**
+     * builds the router over a PT network. The network must outlive the router
+     * @param network the PT network
+     * @param maxRides maximum number of rides in a journey
+     * @param bagCapacity maximum number of labels kept at each vertex in each round
+     */
+    explicit PT_RoundBasedRouter(const PT_Network& network, unsigned int maxRides = 5, unsigned int bagCapacity = 3);
+
+    /**
+     * computes, in a single search, the pareto optimal journeys (travel time, number of rides, walking time) from
+     * an origin vertex to each of the destination vertices
+     * @param origin id of the origin vertex
+     * @param destinations ids of the destination vertices
+     * @param journeys output journeys of each destination, sorted by travel time. Empty for unknown or unreachable
+     *        destinations
+     */
+    void route(const std::string& origin, const std::vector<std::string>& destinations,
+               std::vector<std::vector<Journey> >& journeys) const;
+
+    size_t getNumVertices() const
+    {
+        return vertexIds.size();
+    }
+
+    unsigned int getMaxRides() const
+    {
+        return maxRides;
+    }
+
+private:
+    struct Label;
+    struct Workspace;
+
+    /** adjacency of the vertices, one range of edges per vertex */
+    struct Adjacency
+    {
+        std::vector<std::uint32_t> offsets;
+        std::vector<const PT_NetworkEdge*> edges;
+        std::vector<std::uint32_t> targets;
+    };
+
+    std::uint32_t getOrAddVertex(const std::string& id);
+
+    static void buildAdjacency(std::vector<std::vector<std::pair<const PT_NetworkEdge*, std::uint32_t> > >& edgesByVertex,
+                               Adjacency& adjacency);
+
+    /** runs the rounds of a search from the given vertex */
+    void search(std::uint32_t origin, Workspace& workspace) const;
+
+    /** collects the pareto optimal journeys arriving at the given vertex */
+    void collectJourneys(std::uint32_t destination, const Workspace& workspace, std::vector<Journey>& journeys) const;
+
+    const unsigned int maxRides;
+    const unsigned int bagCapacity;
+
+    std::unordered_map<std::string, std::uint32_t> vertexIndex;
+    std::vector<std::string> vertexIds;
+
+    /** whether each vertex is a SimMobility node. Nodes are only origins and destinations, never transfer points */
+    std::vector<bool> nodeVertices;
+
+    /** bus and train edges */
+    Adjacency rides;
+
+    /** walking and SMS edges */
+    Adjacency walks;
+};
+
+}
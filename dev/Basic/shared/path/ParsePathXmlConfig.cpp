@@ -117,6 +117,18 @@ void sim_mob::ParsePathXmlConfig::processPublicPathsetNode(xercesc::DOMElement*
         cfg.simulationApproachIterations =
                 ParseInteger(GetNamedAttributeValue(GetSingleElementByName(
                         publicPathSetAlgoConf, "simulation_approach"), "iterations"), 10);
+
+        xercesc::DOMElement* roundBased = GetSingleElementByName(publicPathSetAlgoConf, "round_based");
+        cfg.publicRoundBasedRouting = ParseBoolean(GetNamedAttributeValue(roundBased, "enabled", false), false);
+        cfg.publicRoundBasedBagSize = ParseUnsignedInt(GetNamedAttributeValue(roundBased, "bag_size", false), 3u);
+
+        if (cfg.publicRoundBasedBagSize == 0 || cfg.publicRoundBasedBagSize > 255)
+        {
+            stringstream msg;
+            msg << "Invalid value for <round_based bag_size=\"" << cfg.publicRoundBasedBagSize
+                << "\">. Expected: value between 1 and 255";
+            throw runtime_error(msg.str());
+        }
     }
 }
 
@@ -228,6 +240,7 @@ void sim_mob::ParsePathXmlConfig::processPrivatePathsetNode(xercesc::DOMElement*
         if (ksp)
         {
             cfg.kspLevel = ParseInteger(GetNamedAttributeValue(ksp, "level"), 0);
+            cfg.kspThreads = ParseUnsignedInt(GetNamedAttributeValue(ksp, "threads", false), 1u);
         }
 
         //Link Elimination
@@ -249,4 +262,38 @@ void sim_mob::ParsePathXmlConfig::processPrivatePathsetNode(xercesc::DOMElement*
         cfg.params.highwayBias =
                 ParseFloat(GetNamedAttributeValue(GetSingleElementByName(utility, "highwayBias"), "value"), 0.5);
     }
+
+    //route choice evaluator
+    xercesc::DOMElement* routeChoice = GetSingleElementByName(pvtConfNode, "route_choice");
+
+    if (routeChoice)
+    {
+        cfg.privateRouteChoiceEvaluator = ParseString(GetNamedAttributeValue(routeChoice, "evaluator"), "lua");
+
+        if (!(cfg.privateRouteChoiceEvaluator == "lua" || cfg.privateRouteChoiceEvaluator == "native"
+              || cfg.privateRouteChoiceEvaluator == "parity"))
+        {
+            stringstream msg;
+            msg << "Invalid value for <route_choice evaluator=\""
+                << cfg.privateRouteChoiceEvaluator << "\">. Expected: \"lua\", \"native\" or \"parity\"";
+            throw runtime_error(msg.str());
+        }
+    }
+
+    //pathset prefetching
+    xercesc::DOMElement* prefetch = GetSingleElementByName(pvtConfNode, "prefetch");
+
+    if (prefetch && (cfg.prefetchEnabled = ParseBoolean(GetNamedAttributeValue(prefetch, "enabled"), false)))
+    {
+        cfg.prefetchLookahead = ParseUnsignedInt(GetNamedAttributeValue(prefetch, "lookahead_minutes", false), 15u) * 60;
+        cfg.prefetchThreads = ParseUnsignedInt(GetNamedAttributeValue(prefetch, "threads", false), 2u);
+
+        if (cfg.prefetchLookahead == 0 || cfg.prefetchThreads == 0)
+        {
+            stringstream msg;
+            msg << "Invalid value for <prefetch lookahead_minutes=\"" << cfg.prefetchLookahead / 60 << "\" threads=\""
+                << cfg.prefetchThreads << "\">. Expected: values greater than 0";
+            throw runtime_error(msg.str());
+        }
+    }
 }
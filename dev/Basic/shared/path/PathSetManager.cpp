@@ -33,6 +33,7 @@
 #include "geospatial/streetdir/KShortestPathImpl.hpp"
 #include "message/MessageBus.hpp"
 #include "Path.hpp"
+#include "path/PathSetPrefetcher.hpp"
 #include "path/PathSetThreadPool.hpp"
 #include "SOCI_Converters.hpp"
 #include "util/threadpool/Threadpool.hpp"
@@ -82,6 +83,7 @@ void ensureContext()
             modelCtx->pvtRouteChoiceModel->loadFile(scriptsPath + extScripts.getScriptFileName("logit"));
             modelCtx->pvtRouteChoiceModel->loadFile(scriptsPath + extScripts.getScriptFileName("pvtrc"));
             modelCtx->pvtRouteChoiceModel->initialize();
+            modelCtx->pvtRouteChoiceModel->initializeNativeRouteChoice();
             threadContext.reset(modelCtx);
         }
         catch (const std::runtime_error& ex)
@@ -323,6 +325,23 @@ std::string getFromToString(unsigned int fromNode, unsigned int toNode)
     std::sprintf(fromToStrBuf, "%u,%u", fromNode, toNode);
     return std::string(fromToStrBuf);
 }
+
+/**
+ * Reads a beta returned by get_PVT_path_coefficients. The coefficient keeps its default value if the beta is missing
+ */
+void readCoefficient(const LuaRef& betas, const char* name, double& coefficient)
+{
+    LuaRef beta = betas[name];
+    if (beta.isNumber())
+    {
+        coefficient = beta.cast<double>();
+    }
+    else
+    {
+        Warn() << "get_PVT_path_coefficients does not give " << name << ". The native route choice evaluator uses "
+               << "its default value " << coefficient << std::endl;
+    }
+}
 } //anonymous namespace
 
 PrivatePathsetGenerator* sim_mob::PrivatePathsetGenerator::pvtPathGeneratorInstance = nullptr;
@@ -647,7 +666,7 @@ double sim_mob::PrivateTrafficRouteChoice::getOD_TravelTime(unsigned int origin,
         sim_mob::PathSet* tmpPathset = new sim_mob::PathSet();
         pathset.reset(tmpPathset);
         pathset->id = fromToID;
-        pathsetRetrievalStatus = loadPathsetFromDB(*getSession(), fromToID, pathset->pathChoices, psRetrieval);
+        pathsetRetrievalStatus = loadPathset(fromToID, origin, destination, pathset->pathChoices, psRetrieval);
         if(pathsetRetrievalStatus == PSM_HASPATH)
         {
             for (sim_mob::SinglePath* sp : pathset->pathChoices)
@@ -755,6 +774,7 @@ double sim_mob::PrivateTrafficRouteChoice::getShortestPathTravelTime(const Node*
     if (noPathODs.find(fromToID)) { return 0.0; }
 
     sim_mob::SinglePath* shortestPath = nullptr;
+    sim_mob::SinglePath searchedPath;
     boost::shared_ptr<sim_mob::PathSet> pathset;
     bool pathsetFound = findCachedPathSet(fromToID, pathset);
     if(pathsetFound)
@@ -763,17 +783,26 @@ double sim_mob::PrivateTrafficRouteChoice::getShortestPathTravelTime(const Node*
     }
     else
     {
-        std::vector<WayPoint> wayPointSequence = StreetDirectory::Instance().SearchShortestDrivingPath<Node,Node>(*origin,*destination);
         std::vector<WayPoint> wayPointSequenceCleaned;
-        for (WayPoint wp:wayPointSequence)
+        boost::shared_ptr<const PathSetPrefetcher::PrefetchedPathSet> prefetched =
+                PathSetPrefetcher::getInstance().find(origin->getNodeId(), destination->getNodeId());
+        if (prefetched)
         {
-            if (wp.type == WayPoint::LINK)
-                wayPointSequenceCleaned.push_back(wp);
+            wayPointSequenceCleaned = prefetched->shortestPath;
+        }
+        else
+        {
+            std::vector<WayPoint> wayPointSequence = StreetDirectory::Instance().SearchShortestDrivingPath<Node,Node>(*origin,*destination);
+            for (WayPoint wp:wayPointSequence)
+            {
+                if (wp.type == WayPoint::LINK)
+                    wayPointSequenceCleaned.push_back(wp);
+            }
         }
 
         if ( !wayPointSequenceCleaned.empty() )
         {
-            shortestPath = new SinglePath();
+            shortestPath = &searchedPath;
             shortestPath->path =wayPointSequenceCleaned;
         }
     }
@@ -854,7 +883,8 @@ bool sim_mob::PrivateTrafficRouteChoice::getBestPath(std::vector<sim_mob::WayPoi
     }
     else
     {
-        hasPath = loadPathsetFromDB(*getSession(), fromToID, pathset->pathChoices, psRetrieval, blackListedLinks);
+        hasPath = loadPathset(fromToID, fromNode->getNodeId(), toNode->getNodeId(), pathset->pathChoices, psRetrieval,
+                              blackListedLinks);
     }
     switch (hasPath)
     {
@@ -1100,7 +1130,8 @@ bool sim_mob::PrivateTrafficRouteChoice::getBestPathToLink(std::vector<sim_mob::
     }
     else
     {
-        hasPath = loadPathsetFromDB(*getSession(), fromToID, pathset->pathChoices, psRetrieval, blackListedLinks);
+        hasPath = loadPathset(fromToID, fromNode->getNodeId(), toNode->getNodeId(), pathset->pathChoices, psRetrieval,
+                              blackListedLinks);
     }
     switch (hasPath)
     {
@@ -1970,21 +2001,21 @@ bool sim_mob::PrivateTrafficRouteChoice::getBestPathChoiceFromPathSet(boost::sha
     unsigned int sizeOfChoiceSet = pvtpathset.size();
     if (sizeOfChoiceSet > 0)
     {
-        // Call to the Lua function
-        LuaRef funcRef = getGlobal(state.get(), "choose_PVT_path");
-        LuaRef retVal = funcRef(this, sizeOfChoiceSet);
-        int index = -1;
-        if (retVal.isNumber())
+        unsigned int index = 0;
+        switch (routeChoiceEvaluator)
         {
-            index = retVal.cast<int>();
-        }
-        if (index > sizeOfChoiceSet || index <= 0)
-        {
-            std::stringstream errStrm;
-            errStrm << "invalid path index (" << index << ") returned from PT route choice for OD with " << sizeOfChoiceSet << "path choices" << std::endl;
-            throw std::runtime_error(errStrm.str());
+        case NATIVE_EVALUATOR:
+            index = choosePathNative();
+            break;
+        case PARITY_EVALUATOR:
+            index = choosePathWithParityCheck();
+            break;
+        default:
+            index = choosePathLua();
+            break;
         }
-        //Assigning the best path based on the index received from pvtrc lua
+
+        //Assigning the best path based on the index received from the route choice model
         ps->bestPath = &(pvtpathset[index - 1]->path);
         return true;
     }
@@ -1994,6 +2025,115 @@ bool sim_mob::PrivateTrafficRouteChoice::getBestPathChoiceFromPathSet(boost::sha
     }
 }
 
+unsigned int sim_mob::PrivateTrafficRouteChoice::choosePathLua()
+{
+    unsigned int sizeOfChoiceSet = pvtpathset.size();
+
+    // Call to the Lua function
+    LuaRef funcRef = getGlobal(state.get(), "choose_PVT_path");
+    LuaRef retVal = funcRef(this, sizeOfChoiceSet);
+    int index = -1;
+    if (retVal.isNumber())
+    {
+        index = retVal.cast<int>();
+    }
+    if (index > (int) sizeOfChoiceSet || index <= 0)
+    {
+        std::stringstream errStrm;
+        errStrm << "invalid path index (" << index << ") returned from PT route choice for OD with " << sizeOfChoiceSet << "path choices" << std::endl;
+        throw std::runtime_error(errStrm.str());
+    }
+    return index;
+}
+
+unsigned int sim_mob::PrivateTrafficRouteChoice::choosePathNative()
+{
+    pvtpathsetAttributes.clear();
+    pvtpathsetAttributes.reserve(pvtpathset.size());
+    for (const sim_mob::SinglePath* sp : pvtpathset)
+    {
+        pvtpathsetAttributes.addPath(*sp);
+    }
+    return nativeRouteChoice.choose(pvtpathsetAttributes);
+}
+
+unsigned int sim_mob::PrivateTrafficRouteChoice::choosePathWithParityCheck()
+{
+    const double tolerance = 1e-9;
+    unsigned int sizeOfChoiceSet = pvtpathset.size();
+
+    pvtpathsetAttributes.clear();
+    pvtpathsetAttributes.reserve(sizeOfChoiceSet);
+    for (const sim_mob::SinglePath* sp : pvtpathset)
+    {
+        pvtpathsetAttributes.addPath(*sp);
+    }
+    nativeRouteChoice.computeProbabilities(pvtpathsetAttributes, nativeProbabilities);
+
+    LuaRef funcRef = getGlobal(state.get(), "compute_PVT_path_probabilities");
+    LuaRef luaProbabilities = funcRef(this, sizeOfChoiceSet);
+    for (unsigned int i = 0; i < sizeOfChoiceSet; ++i)
+    {
+        LuaRef luaProbability = luaProbabilities[i + 1];
+        double probability = luaProbability.isNumber() ? luaProbability.cast<double>() : 0.0;
+        if (std::abs(probability - nativeProbabilities[i]) > tolerance)
+        {
+            std::stringstream errStrm;
+            errStrm << "route choice parity check failed for pathset " << pvtpathset[i]->pathSetId << ": path "
+                    << (i + 1) << " of " << sizeOfChoiceSet << " has probability " << probability << " in pvtrc.lua and "
+                    << nativeProbabilities[i] << " in the native evaluator";
+            throw std::runtime_error(errStrm.str());
+        }
+    }
+
+    //Both evaluators draw from the same random sequence, so they must also make the same choice
+    unsigned int luaIndex = choosePathLua();
+    unsigned int nativeIndex = nativeRouteChoice.makeChoice(nativeProbabilities);
+    if (luaIndex != nativeIndex)
+    {
+        std::stringstream errStrm;
+        errStrm << "route choice parity check failed for pathset " << pvtpathset.front()->pathSetId << ": pvtrc.lua chose path "
+                << luaIndex << " and the native evaluator chose path " << nativeIndex << " of " << sizeOfChoiceSet;
+        throw std::runtime_error(errStrm.str());
+    }
+    return luaIndex;
+}
+
+void sim_mob::PrivateTrafficRouteChoice::initializeNativeRouteChoice()
+{
+    if (routeChoiceEvaluator == LUA_EVALUATOR)
+    {
+        return;
+    }
+
+    //The betas that the script does not give keep their default values
+    PrivateRouteChoiceCoefficients coefficients;
+    LuaRef funcRef = getGlobal(state.get(), "get_PVT_path_coefficients");
+    if (!funcRef.isFunction())
+    {
+        Warn() << "get_PVT_path_coefficients is not defined in the private traffic route choice script. "
+               << "The native route choice evaluator uses the default coefficients" << std::endl;
+        nativeRouteChoice.setCoefficients(coefficients);
+        return;
+    }
+
+    LuaRef betas = funcRef();
+    readCoefficient(betas, "bTTVOT", coefficients.travelTime);
+    readCoefficient(betas, "bCommonFactor", coefficients.commonFactor);
+    readCoefficient(betas, "bLength", coefficients.length);
+    readCoefficient(betas, "bHighway", coefficients.highway);
+    readCoefficient(betas, "bCost", coefficients.cost);
+    readCoefficient(betas, "bSigInter", coefficients.signalIntersection);
+    readCoefficient(betas, "bLeftTurns", coefficients.leftTurns);
+    readCoefficient(betas, "bWork", coefficients.work);
+    readCoefficient(betas, "bLeisure", coefficients.leisure);
+    readCoefficient(betas, "highwayBias", coefficients.highwayBias);
+    readCoefficient(betas, "minDistanceParam", coefficients.minDistance);
+    readCoefficient(betas, "minSignalParam", coefficients.minSignal);
+    readCoefficient(betas, "maxHighwayParam", coefficients.maxHighway);
+    nativeRouteChoice.setCoefficients(coefficients);
+}
+
 sim_mob::SinglePath * sim_mob::PrivatePathsetGenerator::findShortestDrivingPath(const sim_mob::Node *fromNode, const sim_mob::Node *toNode, const std::set<const sim_mob::Link*> & excludedLinks)
 {
     std::vector<const sim_mob::Link*> blacklist;
@@ -2120,8 +2260,18 @@ sim_mob::PrivateTrafficRouteChoice::PrivateTrafficRouteChoice()
         : PathSetManager(),
           psRetrieval(sim_mob::ConfigManager::GetInstance().FullConfig().getDatabaseProcMappings().procedureMappings.find("pvt_pathset")->second),
           psRetrievalWithoutRestrictedRegion(sim_mob::ConfigManager::GetInstance().FullConfig().getPathSetConf().psRetrievalWithoutBannedRegion),
-          cacheLRU(2500), ttMgr(*(sim_mob::TravelTimeManager::getInstance())), regionRestrictonEnabled(false)
+          cacheLRU(2500), ttMgr(*(sim_mob::TravelTimeManager::getInstance())), regionRestrictonEnabled(false),
+          routeChoiceEvaluator(LUA_EVALUATOR)
 {
+    const std::string& evaluator = sim_mob::ConfigManager::GetInstance().FullConfig().getPathSetConf().privateRouteChoiceEvaluator;
+    if (evaluator == "native")
+    {
+        routeChoiceEvaluator = NATIVE_EVALUATOR;
+    }
+    else if (evaluator == "parity")
+    {
+        routeChoiceEvaluator = PARITY_EVALUATOR;
+    }
 }
 
 sim_mob::PrivateTrafficRouteChoice::~PrivateTrafficRouteChoice()
@@ -2166,8 +2316,34 @@ void sim_mob::PrivateTrafficRouteChoice::addPartialExclusion(const sim_mob::Road
     }
 }
 
+sim_mob::HasPath PrivateTrafficRouteChoice::loadPathset(std::string& pathsetId, unsigned int origin, unsigned int destination,
+        std::set<sim_mob::SinglePath*, sim_mob::SinglePath>& spPool, const std::string& functionName,
+        const std::set<const sim_mob::Link*>& excludedLnks)
+{
+    if (functionName == psRetrieval && excludedLnks.empty())
+    {
+        boost::shared_ptr<const PathSetPrefetcher::PrefetchedPathSet> prefetched =
+                PathSetPrefetcher::getInstance().find(origin, destination);
+
+        if (prefetched)
+        {
+            //the prefetched paths are shared by all threads, while the route choice updates the travel times and
+            //costs of the paths: work on copies
+            for (const sim_mob::SinglePath* sp : prefetched->pathChoices)
+            {
+                sim_mob::SinglePath* singlePath = new sim_mob::SinglePath(*sp);
+                singlePath->path = sp->path;
+                spPool.insert(singlePath);
+            }
+            return prefetched->status;
+        }
+    }
+
+    return loadPathsetFromDB(*getSession(), pathsetId, spPool, functionName, excludedLnks);
+}
+
 sim_mob::HasPath PrivateTrafficRouteChoice::loadPathsetFromDB(soci::session& sql, std::string& pathsetId, std::set<sim_mob::SinglePath*, sim_mob::SinglePath>& spPool, const std::string functionName,
-        const std::set<const sim_mob::Link*>& excludedLinks) const
+        const std::set<const sim_mob::Link*>& excludedLinks)
 {
     //prepare statement and execute query
     std::stringstream query;
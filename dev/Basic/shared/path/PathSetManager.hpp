@@ -11,6 +11,7 @@
 #include "util/Cache.hpp"
 #include "lua/LuaModel.hpp"
 #include "Path.hpp"
+#include "PrivateRouteChoiceLogit.hpp"
 #include "util/OneTimeFlag.hpp"
 
 
@@ -341,6 +342,44 @@ private:
 
     std::vector<sim_mob::SinglePath*> pvtpathset;
 
+    /** evaluators that can be used to choose a path in pvtpathset (see PathSetConf::privateRouteChoiceEvaluator) */
+    enum RouteChoiceEvaluator
+    {
+        LUA_EVALUATOR,
+        NATIVE_EVALUATOR,
+        PARITY_EVALUATOR
+    };
+
+    RouteChoiceEvaluator routeChoiceEvaluator;
+
+    /** native implementation of choose_PVT_path */
+    PrivateRouteChoiceLogit nativeRouteChoice;
+
+    /** attributes of the paths in pvtpathset, used by the native evaluator */
+    PrivateRouteChoiceAttributes pvtpathsetAttributes;
+
+    /** path choice probabilities computed by the native evaluator */
+    std::vector<double> nativeProbabilities;
+
+    /**
+     * chooses a path in pvtpathset by calling choose_PVT_path
+     * @return index of the chosen path, starting from 1
+     */
+    unsigned int choosePathLua();
+
+    /**
+     * chooses a path in pvtpathset with the native evaluator
+     * @return index of the chosen path, starting from 1
+     */
+    unsigned int choosePathNative();
+
+    /**
+     * chooses a path in pvtpathset with both the native evaluator and choose_PVT_path, and throws if the two
+     * evaluators give different probabilities or different choices
+     * @return index of the chosen path, starting from 1
+     */
+    unsigned int choosePathWithParityCheck();
+
     /**
      * cache the generated pathset
      * @param ps pathset general information
@@ -399,6 +438,25 @@ private:
 
     void mapClasses();
 
+    /**
+     * loads set of paths pre-generated for an OD. The pathsets of the standard pathset function, when no link is
+     * black listed, are copied from the prefetched pathsets if available (see PathSetPrefetcher)
+     *
+     * @param pathsetId <origin_node>,<destination_node> in string format
+     * @param origin origin node id
+     * @param destination destination node id
+     * @param spPool output set of SinglePaths
+     * @param functionName name of DB stored procedure to fetch pathset for an OD
+     * @param excludedLnks set of black listed links (if any)
+     *
+     * @return status of pathset retrieval as an enumerated value from sim_mob::HasPath
+     */
+    sim_mob::HasPath loadPathset(std::string& pathsetId, unsigned int origin, unsigned int destination,
+            std::set<sim_mob::SinglePath*, sim_mob::SinglePath>& spPool,
+            const std::string& functionName,
+            const std::set<const sim_mob::Link*>& excludedLnks = std::set<const sim_mob::Link*>());
+
+public:
     /**
      * loads set of paths pre-generated for an OD
      *
@@ -410,16 +468,21 @@ private:
      *
      * @return status of pathset retrieval as an enumerated value from sim_mob::HasPath
      */
-    sim_mob::HasPath loadPathsetFromDB(soci::session& sql,
+    static sim_mob::HasPath loadPathsetFromDB(soci::session& sql,
             std::string& pathsetId,
             std::set<sim_mob::SinglePath*, sim_mob::SinglePath>& spPool,
             const std::string functionName,
-            const std::set<const sim_mob::Link*>& excludedRS = std::set<const sim_mob::Link*>()) const;
+            const std::set<const sim_mob::Link*>& excludedRS = std::set<const sim_mob::Link*>());
 
-public:
     PrivateTrafficRouteChoice();
     virtual ~PrivateTrafficRouteChoice();
 
+    /**
+     * reads the coefficients of the native evaluator from get_PVT_path_coefficients in pvtrc.lua.
+     * Must be called after the scripts have been loaded.
+     */
+    void initializeNativeRouteChoice();
+
     double getTravelCost(unsigned int index);
     double getTravelTime(unsigned int index);
     double getPathSize(unsigned int index);
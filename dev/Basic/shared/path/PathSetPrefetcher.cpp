@@ -0,0 +1,267 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "PathSetPrefetcher.hpp"
+
+#include <memory>
+#include <boost/bind.hpp>
+#include <soci/postgresql/soci-postgresql.h>
+
+#include "conf/ConfigManager.hpp"
+#include "conf/ConfigParams.hpp"
+#include "geospatial/network/Node.hpp"
+#include "geospatial/streetdir/StreetDirectory.hpp"
+#include "logging/Log.hpp"
+#include "util/threadpool/Threadpool.hpp"
+#include "util/Utils.hpp"
+
+using namespace sim_mob;
+
+namespace
+{
+/** DB session of each prefetching thread */
+thread_local std::unique_ptr<soci::session> prefetchSession;
+
+soci::session& getPrefetchSession()
+{
+    if (!prefetchSession)
+    {
+        const std::string dbStr(ConfigManager::GetInstance().FullConfig().getDatabaseConnectionString(false));
+        prefetchSession.reset(new soci::session(soci::postgresql, dbStr));
+    }
+    return *prefetchSession;
+}
+}
+
+PathSetPrefetcher::PrefetchedPathSet::PrefetchedPathSet() : status(PSM_UNKNOWN)
+{
+}
+
+PathSetPrefetcher::PrefetchedPathSet::~PrefetchedPathSet()
+{
+    for (SinglePath* sp : pathChoices)
+    {
+        safe_delete_item(sp);
+    }
+}
+
+PathSetPrefetcher::PathSetPrefetcher() :
+        enabled(ConfigManager::GetInstance().FullConfig().getPathSetConf().prefetchEnabled),
+        lookahead(ConfigManager::GetInstance().FullConfig().getPathSetConf().prefetchLookahead * 1000),
+        nThreads(ConfigManager::GetInstance().FullConfig().getPathSetConf().prefetchThreads),
+        loader(boost::bind(&PathSetPrefetcher::loadPathSet, this, _1, _2)), nPrefetched(0), nHits(0)
+{
+}
+
+PathSetPrefetcher::~PathSetPrefetcher()
+{
+}
+
+PathSetPrefetcher& PathSetPrefetcher::getInstance()
+{
+    static PathSetPrefetcher instance;
+    return instance;
+}
+
+void PathSetPrefetcher::start()
+{
+    if (!enabled || threadPool)
+    {
+        return;
+    }
+
+    const StoredProcedureMap procedures = ConfigManager::GetInstance().FullConfig().getDatabaseProcMappings();
+    std::map<std::string, std::string>::const_iterator itProc = procedures.procedureMappings.find("pvt_pathset");
+
+    if (itProc == procedures.procedureMappings.end())
+    {
+        throw std::runtime_error("Pathset prefetching requires the stored procedure 'pvt_pathset'");
+    }
+
+    psRetrieval = itProc->second;
+    threadPool.reset(new batched::ThreadPool(nThreads));
+    boost::atomic_store(&cache, boost::shared_ptr<const Cache>(new Cache()));
+}
+
+void PathSetPrefetcher::stop()
+{
+    if (!threadPool)
+    {
+        return;
+    }
+
+    threadPool->wait();
+    threadPool.reset();
+
+    boost::atomic_store(&cache, boost::shared_ptr<const Cache>());
+    pendingDepartures.clear();
+    submitted.clear();
+    loaded.clear();
+
+    Print() << "Pathsets prefetched: " << nPrefetched << ", used: " << nHits << std::endl;
+}
+
+void PathSetPrefetcher::addDeparture(const DailyTime& departure, const Node* origin, const Node* destination)
+{
+    if (!enabled || !origin || !destination || origin == destination)
+    {
+        return;
+    }
+
+    boost::unique_lock<boost::mutex> lock(departuresMutex);
+    pendingDepartures.insert(std::make_pair(departure.getValue(), std::make_pair(origin, destination)));
+}
+
+void PathSetPrefetcher::advance(const DailyTime& now)
+{
+    if (!threadPool)
+    {
+        return;
+    }
+
+    const std::uint32_t nowMS = now.getValue();
+
+    //submit the ODs of the trips departing within the lookahead window. An OD is loaded only once, however many
+    //trips are departing
+    {
+        boost::unique_lock<boost::mutex> lock(departuresMutex);
+        std::multimap<std::uint32_t, std::pair<const Node*, const Node*> >::iterator itEnd =
+                pendingDepartures.upper_bound(nowMS + lookahead);
+
+        for (std::multimap<std::uint32_t, std::pair<const Node*, const Node*> >::iterator it = pendingDepartures.begin();
+             it != itEnd; ++it)
+        {
+            const Node* origin = it->second.first;
+            const Node* destination = it->second.second;
+            const ODKey key = toKey(origin->getNodeId(), destination->getNodeId());
+            std::pair<std::unordered_map<ODKey, std::uint32_t>::iterator, bool> inserted =
+                    submitted.insert(std::make_pair(key, it->first));
+
+            if (inserted.second)
+            {
+                threadPool->enqueue(boost::bind(&PathSetPrefetcher::prefetch, this, key, origin, destination));
+            }
+            else if (inserted.first->second < it->first)
+            {
+                inserted.first->second = it->first;
+            }
+        }
+
+        pendingDepartures.erase(pendingDepartures.begin(), itEnd);
+    }
+
+    std::vector<std::pair<ODKey, boost::shared_ptr<const PrefetchedPathSet> > > newPathSets;
+    {
+        boost::unique_lock<boost::mutex> lock(loadedMutex);
+        newPathSets.swap(loaded);
+    }
+
+    //the pathsets are kept for one lookahead window after the departure of the last trip of their OD, so that
+    //drivers starting late still find them
+    std::vector<ODKey> expired;
+    for (std::unordered_map<ODKey, std::uint32_t>::const_iterator it = submitted.begin(); it != submitted.end(); ++it)
+    {
+        if (it->second + lookahead < nowMS)
+        {
+            expired.push_back(it->first);
+        }
+    }
+
+    if (newPathSets.empty() && expired.empty())
+    {
+        return;
+    }
+
+    //copy on write: readers holding the current map keep using it until they release it
+    boost::shared_ptr<Cache> newCache(new Cache(*boost::atomic_load(&cache)));
+
+    for (ODKey key : expired)
+    {
+        submitted.erase(key);
+        newCache->erase(key);
+    }
+
+    for (const std::pair<ODKey, boost::shared_ptr<const PrefetchedPathSet> >& newPathSet : newPathSets)
+    {
+        //the OD may have expired while it was being loaded
+        if (submitted.find(newPathSet.first) != submitted.end())
+        {
+            (*newCache)[newPathSet.first] = newPathSet.second;
+        }
+    }
+
+    boost::atomic_store(&cache, boost::shared_ptr<const Cache>(newCache));
+}
+
+boost::shared_ptr<const PathSetPrefetcher::PrefetchedPathSet> PathSetPrefetcher::find(unsigned int origin,
+                                                                                      unsigned int destination) const
+{
+    boost::shared_ptr<const Cache> currentCache = boost::atomic_load(&cache);
+
+    if (currentCache)
+    {
+        Cache::const_iterator it = currentCache->find(toKey(origin, destination));
+
+        if (it != currentCache->end())
+        {
+            ++nHits;
+            return it->second;
+        }
+    }
+
+    return boost::shared_ptr<const PrefetchedPathSet>();
+}
+
+void PathSetPrefetcher::prefetch(ODKey key, const Node* origin, const Node* destination)
+{
+    //exceptions must not reach the thread pool. An OD which could not be loaded is simply not published, and the
+    //drivers load it themselves
+    try
+    {
+        boost::shared_ptr<PrefetchedPathSet> pathSet = loader(origin, destination);
+        ++nPrefetched;
+
+        boost::unique_lock<boost::mutex> lock(loadedMutex);
+        loaded.push_back(std::make_pair(key, boost::shared_ptr<const PrefetchedPathSet>(pathSet)));
+    }
+    catch (const std::exception& ex)
+    {
+        Warn() << "Prefetching of pathset " << origin->getNodeId() << "," << destination->getNodeId()
+               << " failed: " << ex.what() << std::endl;
+    }
+}
+
+boost::shared_ptr<PathSetPrefetcher::PrefetchedPathSet> PathSetPrefetcher::loadPathSet(const Node* origin,
+                                                                                       const Node* destination)
+{
+    boost::shared_ptr<PrefetchedPathSet> pathSet(new PrefetchedPathSet());
+    std::string pathSetId = std::to_string(origin->getNodeId()) + "," + std::to_string(destination->getNodeId());
+    pathSet->status = PrivateTrafficRouteChoice::loadPathsetFromDB(getPrefetchSession(), pathSetId,
+                                                                  pathSet->pathChoices, psRetrieval);
+
+    for (const SinglePath* sp : pathSet->pathChoices)
+    {
+        if (sp->shortestPath)
+        {
+            pathSet->shortestPath = sp->path;
+            break;
+        }
+    }
+
+    if (pathSet->shortestPath.empty())
+    {
+        std::vector<WayPoint> wayPoints =
+                StreetDirectory::Instance().SearchShortestDrivingPath<Node, Node>(*origin, *destination);
+
+        for (const WayPoint& wp : wayPoints)
+        {
+            if (wp.type == WayPoint::LINK)
+            {
+                pathSet->shortestPath.push_back(wp);
+            }
+        }
+    }
+
+    return pathSet;
+}
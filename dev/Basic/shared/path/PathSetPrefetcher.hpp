@@ -0,0 +1,180 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "geospatial/network/WayPoint.hpp"
+#include "util/DailyTime.hpp"
+#include "Path.hpp"
+#include "PathSetManager.hpp"
+
+namespace unit_tests
+{
+class PathSetPrefetcherUnitTests;
+}
+
+namespace sim_mob
+{
+
+class Node;
+
+namespace batched
+{
+class ThreadPool;
+}
+
+/**
+ * Loads in background the private traffic pathsets of the trips that are about to start.
+ *
+ * The person loader registers the departure time and the OD of every private traffic trip it loads. At every tick,
+ * the ODs of the trips departing within the lookahead window are submitted to a pool of threads, which load their
+ * pathsets from the DB (and the shortest driving path when no pathset is available) with their own DB sessions.
+ *
+ * The loaded pathsets are published in a read mostly cache: the cache is an immutable map which is replaced as a
+ * whole, once per tick, by the thread calling advance(). Readers only take a reference to the current map, so
+ * looking up a pathset never waits for the prefetching threads. Pathsets are evicted once all the trips they were
+ * prefetched for should have started.
+ *
+ * The prefetched pathsets are templates shared by all threads: the route choice must work on a copy of the paths,
+ * as it updates their travel times and costs.
+ */
+class PathSetPrefetcher : private boost::noncopyable
+{
+public:
+    /** pathset of an OD loaded in background. Immutable once published */
+    struct PrefetchedPathSet : private boost::noncopyable
+    {
+        PrefetchedPathSet();
+        ~PrefetchedPathSet();
+
+        /** outcome of the pathset retrieval */
+        sim_mob::HasPath status;
+
+        /** paths of the pathset */
+        std::set<sim_mob::SinglePath*, sim_mob::SinglePath> pathChoices;
+
+        /** links of the shortest path of the pathset or, if no pathset is available, of the shortest driving path */
+        std::vector<sim_mob::WayPoint> shortestPath;
+    };
+
+    static PathSetPrefetcher& getInstance();
+
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /**
+     * starts the prefetching threads. Does nothing if prefetching is not enabled
+     */
+    void start();
+
+    /**
+     * waits for the pending prefetches, stops the prefetching threads and clears the cache
+     */
+    void stop();
+
+    /**
+     * registers a private traffic trip
+     * @param departure departure time of the trip
+     * @param origin origin node
+     * @param destination destination node
+     */
+    void addDeparture(const DailyTime& departure, const Node* origin, const Node* destination);
+
+    /**
+     * submits the ODs of the trips departing before now + lookahead, publishes the pathsets loaded since the last
+     * call and evicts the pathsets that are no longer needed. Must be called by a single thread
+     * @param now current simulation time
+     */
+    void advance(const DailyTime& now);
+
+    /**
+     * finds the prefetched pathset of an OD
+     * @return the pathset, null if it has not been prefetched (yet)
+     */
+    boost::shared_ptr<const PrefetchedPathSet> find(unsigned int origin, unsigned int destination) const;
+
+private:
+    typedef std::uint64_t ODKey;
+    typedef std::unordered_map<ODKey, boost::shared_ptr<const PrefetchedPathSet> > Cache;
+
+    PathSetPrefetcher();
+    ~PathSetPrefetcher();
+
+    static ODKey toKey(unsigned int origin, unsigned int destination)
+    {
+        return (static_cast<ODKey>(origin) << 32) | destination;
+    }
+
+    /**
+     * loads the pathset of an OD and queues it for publication. Executed by the prefetching threads
+     */
+    void prefetch(ODKey key, const Node* origin, const Node* destination);
+
+    /**
+     * loads the pathset of an OD from the DB, with the DB session of the calling thread
+     * @return the pathset
+     */
+    boost::shared_ptr<PrefetchedPathSet> loadPathSet(const Node* origin, const Node* destination);
+
+    /** whether prefetching is enabled */
+    const bool enabled;
+
+    /** lookahead, in milliseconds */
+    const std::uint32_t lookahead;
+
+    /** number of prefetching threads */
+    const unsigned int nThreads;
+
+    /** name of the DB function returning the pathset of an OD */
+    std::string psRetrieval;
+
+    /** function loading the pathset of an OD. loadPathSet(), unless replaced by the unit tests */
+    boost::function<boost::shared_ptr<PrefetchedPathSet> (const Node*, const Node*)> loader;
+
+    /** threads loading the pathsets */
+    boost::shared_ptr<batched::ThreadPool> threadPool;
+
+    /** trips not yet submitted, by departure time (ms) */
+    std::multimap<std::uint32_t, std::pair<const Node*, const Node*> > pendingDepartures;
+
+    /** protects pendingDepartures */
+    boost::mutex departuresMutex;
+
+    /** departure time (ms) of the last trip of each submitted OD. Only accessed by the thread calling advance() */
+    std::unordered_map<ODKey, std::uint32_t> submitted;
+
+    /** pathsets loaded since the last call to advance() */
+    std::vector<std::pair<ODKey, boost::shared_ptr<const PrefetchedPathSet> > > loaded;
+
+    /** protects loaded */
+    boost::mutex loadedMutex;
+
+    /** published pathsets. Only accessed with boost::atomic_load and boost::atomic_store */
+    boost::shared_ptr<const Cache> cache;
+
+    /** number of pathsets prefetched */
+    std::atomic<unsigned int> nPrefetched;
+
+    /** number of lookups answered by the cache */
+    mutable std::atomic<unsigned int> nHits;
+
+    friend class unit_tests::PathSetPrefetcherUnitTests;
+};
+
+}
@@ -0,0 +1,167 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include "PrivateRouteChoiceLogit.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "path/Path.hpp"
+
+using namespace sim_mob;
+
+namespace
+{
+//Constants of the pseudo random number generator of logit.lua (5^17 = D20*A1 + A2)
+const std::uint64_t RANDOM_A1 = 1331;
+const std::uint64_t RANDOM_A2 = 798405;
+const std::uint64_t RANDOM_D20 = 1048576;
+const std::uint64_t RANDOM_D40 = 1099511627776;
+}
+
+void PrivateRouteChoiceAttributes::clear()
+{
+    travelTime.clear();
+    travelCost.clear();
+    partialUtility.clear();
+    pathSize.clear();
+    length.clear();
+    highwayDistance.clear();
+    signalNumber.clear();
+    rightTurnNumber.clear();
+    isMinDistance.clear();
+    isMinSignal.clear();
+    isMaxHighwayUsage.clear();
+    purpose.clear();
+}
+
+void PrivateRouteChoiceAttributes::reserve(size_t size)
+{
+    travelTime.reserve(size);
+    travelCost.reserve(size);
+    partialUtility.reserve(size);
+    pathSize.reserve(size);
+    length.reserve(size);
+    highwayDistance.reserve(size);
+    signalNumber.reserve(size);
+    rightTurnNumber.reserve(size);
+    isMinDistance.reserve(size);
+    isMinSignal.reserve(size);
+    isMaxHighwayUsage.reserve(size);
+    purpose.reserve(size);
+}
+
+void PrivateRouteChoiceAttributes::addPath(const SinglePath& path)
+{
+    travelTime.push_back(path.getTravelTime());
+    travelCost.push_back(path.getTravelCost());
+    partialUtility.push_back(path.getPartialUtility());
+    pathSize.push_back(path.getPathSize());
+    length.push_back(path.getLength());
+    highwayDistance.push_back(path.getHighWayDistance());
+    signalNumber.push_back(path.getSignalNumber());
+    rightTurnNumber.push_back(path.getRightTurnNumber());
+    isMinDistance.push_back(path.isMinDistance());
+    isMinSignal.push_back(path.isMinSignal());
+    isMaxHighwayUsage.push_back(path.isMaxHighWayUsage());
+    purpose.push_back(path.getPurpose());
+}
+
+PrivateRouteChoiceLogit::PrivateRouteChoiceLogit() : randomX1(0), randomX2(1)
+{
+}
+
+void PrivateRouteChoiceLogit::computeUtilities(const PrivateRouteChoiceAttributes& attributes,
+                                               std::vector<double>& utilities) const
+{
+    const size_t nPaths = attributes.size();
+    utilities.resize(nPaths);
+
+    //The attributes are read in the same order and combined with the same operations as in pvtrc.lua, so that the
+    //utilities are identical to the ones computed by the script
+    for (size_t i = 0; i < nPaths; ++i)
+    {
+        double pUtility = 0.0;
+        if (attributes.partialUtility[i] > 0.0)
+        {
+            pUtility = attributes.partialUtility[i];
+        }
+        else
+        {
+            pUtility = pUtility + attributes.pathSize[i] * coefficients.commonFactor;
+            pUtility = pUtility + attributes.length[i] * coefficients.length;
+            pUtility = pUtility + attributes.highwayDistance[i] * coefficients.highway;
+            pUtility = pUtility + ((attributes.highwayDistance[i] > 0) ? coefficients.highwayBias : 0.0);
+            pUtility = pUtility + attributes.signalNumber[i] * coefficients.signalIntersection;
+            pUtility = pUtility + attributes.rightTurnNumber[i] * coefficients.leftTurns;
+            pUtility = pUtility + ((attributes.isMinDistance[i] == 1) ? coefficients.minDistance : 0.0);
+            pUtility = pUtility + ((attributes.isMinSignal[i] == 1) ? coefficients.minSignal : 0.0);
+            pUtility = pUtility + ((attributes.isMaxHighwayUsage[i] == 1) ? coefficients.maxHighway : 0.0);
+            pUtility = pUtility + ((attributes.purpose[i] == 1) ? attributes.purpose[i] * coefficients.work : 0.0);
+            pUtility = pUtility + ((attributes.purpose[i] == 2) ? attributes.purpose[i] * coefficients.leisure : 0.0);
+        }
+
+        double utility = pUtility + attributes.travelTime[i] * coefficients.travelTime;
+        utilities[i] = utility + attributes.travelCost[i] * coefficients.cost;
+    }
+}
+
+void PrivateRouteChoiceLogit::computeProbabilities(const PrivateRouteChoiceAttributes& attributes,
+                                                   std::vector<double>& probabilities) const
+{
+    computeUtilities(attributes, probabilities);
+
+    double evSum = 0.0;
+    for (double& probability : probabilities)
+    {
+        //A utility that is not a number makes the path unavailable
+        probability = std::isnan(probability) ? 0.0 : std::exp(probability);
+        evSum += probability;
+    }
+
+    for (double& probability : probabilities)
+    {
+        if (probability != 0.0)
+        {
+            probability = probability / evSum;
+        }
+    }
+}
+
+double PrivateRouteChoiceLogit::nextRandom()
+{
+    const std::uint64_t u = randomX2 * RANDOM_A2;
+    std::uint64_t v = (randomX1 * RANDOM_A2 + randomX2 * RANDOM_A1) % RANDOM_D20;
+    v = (v * RANDOM_D20 + u) % RANDOM_D40;
+    randomX1 = v / RANDOM_D20;
+    randomX2 = v - randomX1 * RANDOM_D20;
+    return static_cast<double>(v) / static_cast<double>(RANDOM_D40);
+}
+
+unsigned int PrivateRouteChoiceLogit::makeChoice(const std::vector<double>& probabilities)
+{
+    cumulativeProbabilities.resize(probabilities.size());
+    double cumulativeProbability = 0.0;
+    for (size_t i = 0; i < probabilities.size(); ++i)
+    {
+        if (!std::isnan(probabilities[i]))
+        {
+            cumulativeProbability += probabilities[i];
+        }
+        cumulativeProbabilities[i] = cumulativeProbability;
+    }
+
+    //First path whose cumulative probability reaches the random number. Because of rounding, the last cumulative
+    //probability may be slightly less than one: in that case the last path is chosen, as binary_search in logit.lua does
+    const double random = nextRandom();
+    const size_t chosen = std::lower_bound(cumulativeProbabilities.begin(), cumulativeProbabilities.end(), random)
+            - cumulativeProbabilities.begin();
+    return std::min(chosen, probabilities.size() - 1) + 1;
+}
+
+unsigned int PrivateRouteChoiceLogit::choose(const PrivateRouteChoiceAttributes& attributes)
+{
+    computeProbabilities(attributes, probabilities);
+    return makeChoice(probabilities);
+}
@@ -0,0 +1,136 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sim_mob
+{
+
+class SinglePath;
+
+/**
+ * Coefficients of the private traffic route choice model. They mirror the betas of choose_PVT_path in pvtrc.lua.
+ * The defaults are the estimated values of pvtrc.lua, used for the betas that the script does not give
+ */
+struct PrivateRouteChoiceCoefficients
+{
+    double travelTime = -0.0013904847537047364;
+    double commonFactor = 1.542931900577706;
+    double length = -2.2760243196051997e-06;
+    double highway = 4.494847364656496e-05;
+    double cost = -2.0595;
+    double signalIntersection = -0.0020431164328690793;
+    double leftTurns = 0.0;
+    double work = 0.0;
+    double leisure = 0.0;
+    double highwayBias = 0.23998897032620298;
+    double minDistance = 0.08777962943862566;
+    double minSignal = 0.020236935452274854;
+    double maxHighway = 0.125971989288778;
+};
+
+/**
+ * Attributes of the paths in a choice set, stored as one array per attribute so that the utilities of all the
+ * paths can be computed in a single loop
+ */
+struct PrivateRouteChoiceAttributes
+{
+    std::vector<double> travelTime;
+    std::vector<double> travelCost;
+    std::vector<double> partialUtility;
+    std::vector<double> pathSize;
+    std::vector<double> length;
+    std::vector<double> highwayDistance;
+    std::vector<double> signalNumber;
+    std::vector<double> rightTurnNumber;
+    std::vector<int> isMinDistance;
+    std::vector<int> isMinSignal;
+    std::vector<int> isMaxHighwayUsage;
+    std::vector<int> purpose;
+
+    void clear();
+
+    void reserve(size_t size);
+
+    size_t size() const
+    {
+        return travelTime.size();
+    }
+
+    /** Appends the attributes of the given path */
+    void addPath(const SinglePath& path);
+};
+
+/**
+ * Native implementation of the private traffic route choice multinomial logit of pvtrc.lua.
+ *
+ * The utilities and the probabilities are computed as in computeUtilities and calculate_probability("mnl", ...).
+ * The choice is drawn as in make_final_choice of logit.lua, with the same pseudo random number generator and the
+ * same initial seed, so that a native evaluator and a Lua state fed with the same sequence of choice sets make the
+ * same choices.
+ *
+ * Not thread safe: each thread must use its own evaluator, as it does with its own Lua state.
+ */
+class PrivateRouteChoiceLogit
+{
+public:
+    PrivateRouteChoiceLogit();
+
+    const PrivateRouteChoiceCoefficients& getCoefficients() const
+    {
+        return coefficients;
+    }
+
+    void setCoefficients(const PrivateRouteChoiceCoefficients& coefficients)
+    {
+        this->coefficients = coefficients;
+    }
+
+    /**
+     * Computes the utility of each path
+     * @param attributes attributes of the paths
+     * @param utilities output utilities, one per path
+     */
+    void computeUtilities(const PrivateRouteChoiceAttributes& attributes, std::vector<double>& utilities) const;
+
+    /**
+     * Computes the choice probability of each path. Paths whose utility is not a number are not available
+     * @param attributes attributes of the paths
+     * @param probabilities output probabilities, one per path
+     */
+    void computeProbabilities(const PrivateRouteChoiceAttributes& attributes, std::vector<double>& probabilities) const;
+
+    /**
+     * Draws a choice according to the given probabilities
+     * @return index of the chosen path, starting from 1 as the index returned by choose_PVT_path
+     */
+    unsigned int makeChoice(const std::vector<double>& probabilities);
+
+    /**
+     * Computes the probabilities and draws a choice
+     * @return index of the chosen path, starting from 1 as the index returned by choose_PVT_path
+     */
+    unsigned int choose(const PrivateRouteChoiceAttributes& attributes);
+
+    /**
+     * Returns the next number of the pseudo random sequence (myRand in logit.lua), uniform in [0,1)
+     */
+    double nextRandom();
+
+private:
+    PrivateRouteChoiceCoefficients coefficients;
+
+    /** Pseudo random number generator state */
+    std::uint64_t randomX1, randomX2;
+
+    /** Scratch buffers, reused across choices */
+    std::vector<double> probabilities;
+    std::vector<double> cumulativeProbabilities;
+};
+
+}
@@ -2,8 +2,12 @@
 //Licensed under the terms of the MIT License, as described in the file:
 //   license.txt   (http://opensource.org/licenses/MIT)
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <boost/atomic.hpp>
+#include <boost/thread.hpp>
+#include <boost/thread/barrier.hpp>
 
 #include "buffering/Buffered.hpp"
 #include "buffering/Buffered_uint32.hpp"
@@ -239,6 +243,187 @@ void BufferedUnitTests::test_migrating_to_another_BufferedDataManager()
     CPPUNIT_ASSERT(0 == mgr2.managed_data_count());
 }
 
+void BufferedUnitTests::test_migrating_between_BufferedDataManagers_after_several_flips()
+{
+    sim_mob::Buffered_uint32 integer(42);
+
+    DataManager mgr1;
+    DataManager mgr2;
+    mgr1.beginManaging(&integer);
+
+    integer++;
+    mgr1.flip();
+    CPPUNIT_ASSERT(43 == integer);
+
+    // integer is not changed, so it keeps its value.
+    mgr1.flip();
+    mgr1.flip();
+    CPPUNIT_ASSERT(43 == integer);
+
+    // The next value is kept by the migration, even if mgr2 has flipped a different number of times.
+    integer += 2;
+    mgr1.stopManaging(&integer);
+    mgr2.flip();
+    mgr2.beginManaging(&integer);
+    CPPUNIT_ASSERT(43 == integer);
+
+    mgr2.flip();
+    CPPUNIT_ASSERT(45 == integer);
+    mgr2.flip();
+    CPPUNIT_ASSERT(45 == integer);
+
+    // Changes in two consecutive time ticks.
+    integer--;
+    mgr2.flip();
+    integer--;
+    CPPUNIT_ASSERT(44 == integer);
+    mgr2.flip();
+    CPPUNIT_ASSERT(43 == integer);
+
+    mgr2.stopManaging(&integer);
+    CPPUNIT_ASSERT(0 == mgr1.managed_data_count());
+    CPPUNIT_ASSERT(0 == mgr2.managed_data_count());
+}
+
+namespace
+{
+    //A value large enough for a reader to overlap the copy of a new value
+    struct Block
+    {
+        explicit Block(uint32_t value = 0) {
+            std::fill(values, values + 256, value);
+        }
+
+        bool operator==(uint32_t value) const {
+            return std::count(values, values + 256, value) == 256;
+        }
+
+        uint32_t values[256];
+    };
+
+    //Reads the values until the writer is done with each time tick, counting the reads that do not see the
+    //expected current values.
+    void readBufferedValues(const sim_mob::Buffered_uint32* integer, const sim_mob::Buffered<Block>* block,
+                            const uint32_t* expected, int ticks, boost::barrier* barrier,
+                            const boost::atomic<bool>* writerDone, boost::atomic<int>* mismatches)
+    {
+        for (int tick = 0; tick < ticks; tick++) {
+            barrier->wait();
+            bool done = false;
+            do {
+                done = writerDone->load(boost::memory_order_acquire);
+                if (integer->get() != *expected || !(block->get() == *expected)) {
+                    (*mismatches)++;
+                }
+            } while (!done);
+            barrier->wait();
+            barrier->wait();
+        }
+    }
+}
+
+void BufferedUnitTests::test_reading_Buffered_T_while_another_thread_sets_it()
+{
+    const int ticks = 2000;
+    sim_mob::Buffered_uint32 integer(0);
+    sim_mob::Buffered<Block> block;
+    uint32_t expected = 0;
+
+    DataManager mgr;
+    mgr.beginManaging(&integer);
+    mgr.beginManaging(&block);
+
+    boost::barrier barrier(2);
+    boost::atomic<bool> writerDone(false);
+    boost::atomic<int> mismatches(0);
+    boost::thread reader(readBufferedValues, &integer, &block, &expected, ticks, &barrier, &writerDone, &mismatches);
+
+    for (int tick = 0; tick < ticks; tick++) {
+        barrier.wait();
+
+        //Skip some time ticks, so the values are left unchanged over both odd and even numbers of flips.
+        uint32_t value = expected;
+        if (tick % 3 == 0 || tick % 7 == 0) {
+            value = tick + 1;
+            integer.set(value);
+            block.set(Block(value));
+        }
+        writerDone.store(true, boost::memory_order_release);
+
+        barrier.wait();
+        mgr.flip();
+        expected = value;
+        writerDone.store(false);
+        barrier.wait();
+    }
+
+    reader.join();
+    CPPUNIT_ASSERT(0 == mismatches);
+    CPPUNIT_ASSERT(expected == integer);
+    CPPUNIT_ASSERT(block.get() == expected);
+
+    mgr.stopManaging(&integer);
+    mgr.stopManaging(&block);
+}
+
+namespace
+{
+    //Repeatedly stops and begins managing the owned data, as a worker does for its own agents.
+    void churnManagedData(sim_mob::BufferedDataManager* mgr, const std::vector<sim_mob::BufferedBase*>* owned, int rounds)
+    {
+        for (int round = 0; round < rounds; round++) {
+            mgr->stopManaging(*owned);
+            mgr->beginManaging(*owned);
+        }
+    }
+}
+
+void BufferedUnitTests::test_taking_over_Buffered_T_from_a_manager_in_another_thread()
+{
+    const int count = 200;
+    std::vector<sim_mob::Buffered_uint32*> owned;
+    std::vector<sim_mob::Buffered_uint32*> handedOver;
+    for (int i = 0; i < count; i++) {
+        owned.push_back(new sim_mob::Buffered_uint32(i));
+        handedOver.push_back(new sim_mob::Buffered_uint32(i));
+    }
+
+    std::vector<sim_mob::BufferedBase*> ownedData(owned.begin(), owned.end());
+    std::vector<sim_mob::BufferedBase*> handedOverData(handedOver.begin(), handedOver.end());
+
+    DataManager mgr1;
+    DataManager mgr2;
+    mgr1.beginManaging(ownedData);
+    mgr1.beginManaging(handedOverData);
+
+    boost::thread owner(churnManagedData, &mgr1, &ownedData, 100);
+    for (int i = 0; i < count; i++) {
+        mgr2.beginManaging(handedOver[i]);
+    }
+    owner.join();
+
+    CPPUNIT_ASSERT(count == mgr1.managed_data_count());
+    CPPUNIT_ASSERT(count == mgr2.managed_data_count());
+
+    //Each datum is flipped by its own manager only.
+    for (int i = 0; i < count; i++) {
+        (*owned[i])++;
+        (*handedOver[i])++;
+    }
+    mgr2.flip();
+    for (int i = 0; i < count; i++) {
+        CPPUNIT_ASSERT(uint32_t(i) == *owned[i]);
+        CPPUNIT_ASSERT(uint32_t(i + 1) == *handedOver[i]);
+    }
+
+    mgr1.stopManaging(ownedData);
+    mgr2.stopManaging(handedOverData);
+    for (int i = 0; i < count; i++) {
+        delete owned[i];
+        delete handedOver[i];
+    }
+}
+
 namespace
 {
     class GlobalDataManager : public sim_mob::BufferedDataManager
@@ -114,6 +114,30 @@ public:
      */
     void test_migrating_to_another_BufferedDataManager();
 
+    /**
+     * Tests the migration of Buffered<T> objects between managers which have flipped a different number of times.
+     *
+     * This test confirms that a Buffered<T> object keeps its current and next values when it is migrated, and
+     * keeps its value over several flips without a call to set().
+     */
+    void test_migrating_between_BufferedDataManagers_after_several_flips();
+
+    /**
+     * Tests reading Buffered<T> objects in one thread while another thread sets them and flips their manager.
+     *
+     * This test confirms that a reader sees the same current value during a whole time tick, whether or
+     * not the value was set during the previous time ticks, and that the new value only appears after the flip.
+     */
+    void test_reading_Buffered_T_while_another_thread_sets_it();
+
+    /**
+     * Tests taking over Buffered<T> objects from a manager while its own thread begins and stops managing other data.
+     *
+     * This test confirms that each Buffered<T> object ends up managed by exactly one manager after workers
+     * hand data over to each other during the update phase.
+     */
+    void test_taking_over_Buffered_T_from_a_manager_in_another_thread();
+
     /**
      * Tests an Agent class with Buffered<T> objects that are managed by a BufferedDataManager.
      *
@@ -174,6 +198,9 @@ private:
         CPPUNIT_TEST(test_flipping_single_change_to_Buffered_enum);
         CPPUNIT_TEST(test_BufferedDataManager_with_several_Buffered_T_objects);
         CPPUNIT_TEST(test_migrating_to_another_BufferedDataManager);
+        CPPUNIT_TEST(test_migrating_between_BufferedDataManagers_after_several_flips);
+        CPPUNIT_TEST(test_reading_Buffered_T_while_another_thread_sets_it);
+        CPPUNIT_TEST(test_taking_over_Buffered_T_from_a_manager_in_another_thread);
         CPPUNIT_TEST(test_Agent_with_Buffered_T_objects);
         CPPUNIT_TEST(test_Buffered_T_reference_count);
         CPPUNIT_TEST(test_BufferedDataManager_doubleBeginManage);
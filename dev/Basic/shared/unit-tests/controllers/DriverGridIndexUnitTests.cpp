@@ -0,0 +1,191 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/random.hpp>
+
+#include "entities/controllers/DriverGridIndex.hpp"
+#include "geospatial/network/Node.hpp"
+#include "geospatial/network/Point.hpp"
+
+#include "DriverGridIndexUnitTests.hpp"
+
+using namespace sim_mob;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(unit_tests::DriverGridIndexUnitTests);
+
+namespace
+{
+//The index never dereferences the drivers, so we can use fake pointers
+const Person* fakeDriver(std::uintptr_t id)
+{
+    return reinterpret_cast<const Person*>((id + 1) * 16);
+}
+
+double distance(const Node* n1, const Node* n2)
+{
+    return std::sqrt(std::pow(n1->getLocation().getX() - n2->getLocation().getX(), 2) +
+                     std::pow(n1->getLocation().getY() - n2->getLocation().getY(), 2));
+}
+
+//Creates count nodes scattered over a 20km x 20km square. Some of them are duplicated, to have ties.
+std::vector<Node*> makeNodes(size_t count, unsigned seed)
+{
+    boost::mt19937 gen(seed);
+    boost::uniform_real<> coord(-10000.0, 10000.0);
+    std::vector<Node*> nodes;
+    for (size_t i = 0; i < count; i++)
+    {
+        Node* node = new Node();
+        node->setNodeId(i + 1);
+        if (i % 7 == 6)
+        {
+            node->setLocation(nodes[i - 3]->getLocation());
+        }
+        else
+        {
+            node->setLocation(Point(coord(gen), coord(gen)));
+        }
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
+//Drivers within maxDistance, sorted by distance from the query node and then by pointer, like the index does
+std::vector<const Person*> linearScan(const std::vector<Node*>& driverNodes, const Node* query,
+                                      double maxDistance = std::numeric_limits<double>::max())
+{
+    std::vector<std::pair<double, const Person*> > sorted;
+    for (size_t i = 0; i < driverNodes.size(); i++)
+    {
+        const double dist = distance(driverNodes[i], query);
+        if (dist <= maxDistance)
+        {
+            sorted.push_back(std::make_pair(dist, fakeDriver(i)));
+        }
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<const Person*> res;
+    for (size_t i = 0; i < sorted.size(); i++)
+    {
+        res.push_back(sorted[i].second);
+    }
+    return res;
+}
+
+void deleteNodes(std::vector<Node*>& nodes)
+{
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        delete nodes[i];
+    }
+    nodes.clear();
+}
+}
+
+void unit_tests::DriverGridIndexUnitTests::test_empty_index()
+{
+    DriverGridIndex index(500.0);
+    Node query;
+    query.setLocation(Point(0, 0));
+
+    CPPUNIT_ASSERT_MESSAGE("Empty index returned a driver.", index.findNearest(&query) == nullptr);
+    CPPUNIT_ASSERT_MESSAGE("Empty index returned k drivers.", index.findKNearest(&query, 3).empty());
+    CPPUNIT_ASSERT_MESSAGE("Empty index returned drivers in radius.", index.findWithinRadius(&query, 1e6).empty());
+}
+
+void unit_tests::DriverGridIndexUnitTests::test_nearest_matches_linear_scan()
+{
+    std::vector<Node*> driverNodes = makeNodes(300, 1);
+    std::vector<Node*> queries = makeNodes(100, 2);
+
+    DriverGridIndex index(750.0);
+    for (size_t i = 0; i < driverNodes.size(); i++)
+    {
+        index.update(fakeDriver(i), driverNodes[i]);
+    }
+    CPPUNIT_ASSERT_EQUAL(driverNodes.size(), index.size());
+
+    //Query from the drivers' own locations (ties) and from random locations
+    for (size_t i = 0; i < driverNodes.size(); i++)
+    {
+        CPPUNIT_ASSERT_MESSAGE("Nearest driver differs from linear scan.",
+                               index.findNearest(driverNodes[i]) == linearScan(driverNodes, driverNodes[i]).front());
+    }
+    for (size_t i = 0; i < queries.size(); i++)
+    {
+        CPPUNIT_ASSERT_MESSAGE("Nearest driver differs from linear scan.",
+                               index.findNearest(queries[i]) == linearScan(driverNodes, queries[i]).front());
+    }
+
+    deleteNodes(driverNodes);
+    deleteNodes(queries);
+}
+
+void unit_tests::DriverGridIndexUnitTests::test_knearest_and_radius_match_linear_scan()
+{
+    std::vector<Node*> driverNodes = makeNodes(200, 3);
+    std::vector<Node*> queries = makeNodes(50, 4);
+
+    DriverGridIndex index(1000.0);
+    for (size_t i = 0; i < driverNodes.size(); i++)
+    {
+        index.update(fakeDriver(i), driverNodes[i]);
+    }
+
+    const double radius = 2500.0;
+    for (size_t i = 0; i < queries.size(); i++)
+    {
+        std::vector<const Person*> expected = linearScan(driverNodes, queries[i]);
+
+        std::vector<const Person*> kNearest = index.findKNearest(queries[i], 10);
+        CPPUNIT_ASSERT_EQUAL((size_t) 10, kNearest.size());
+        CPPUNIT_ASSERT_MESSAGE("K-nearest drivers differ from linear scan.",
+                               std::equal(kNearest.begin(), kNearest.end(), expected.begin()));
+
+        CPPUNIT_ASSERT_EQUAL(driverNodes.size(), index.findKNearest(queries[i], 1000).size());
+
+        std::vector<const Person*> expectedInRadius = linearScan(driverNodes, queries[i], radius);
+        std::vector<const Person*> withinRadius = index.findWithinRadius(queries[i], radius);
+        CPPUNIT_ASSERT_MESSAGE("Drivers within radius differ from linear scan.", withinRadius == expectedInRadius);
+    }
+
+    deleteNodes(driverNodes);
+    deleteNodes(queries);
+}
+
+void unit_tests::DriverGridIndexUnitTests::test_update_and_remove()
+{
+    Node near, far, query;
+    near.setLocation(Point(100, 100));
+    far.setLocation(Point(9000, -9000));
+    query.setLocation(Point(0, 0));
+
+    DriverGridIndex index(1000.0);
+    index.update(fakeDriver(0), &far);
+    index.update(fakeDriver(1), &near);
+    CPPUNIT_ASSERT_MESSAGE("Wrong nearest driver.", index.findNearest(&query) == fakeDriver(1));
+
+    //Swap the two drivers
+    index.update(fakeDriver(0), &near);
+    index.update(fakeDriver(1), &far);
+    CPPUNIT_ASSERT_EQUAL((size_t) 2, index.size());
+    CPPUNIT_ASSERT_MESSAGE("Move not reflected in the index.", index.findNearest(&query) == fakeDriver(0));
+    CPPUNIT_ASSERT_MESSAGE("Wrong indexed node.", index.getIndexedNode(fakeDriver(1)) == &far);
+
+    index.remove(fakeDriver(0));
+    CPPUNIT_ASSERT_MESSAGE("Removal not reflected in the index.", index.findNearest(&query) == fakeDriver(1));
+
+    //A driver without a current node is not indexed
+    index.update(fakeDriver(1), nullptr);
+    CPPUNIT_ASSERT_MESSAGE("Driver without node is still indexed.", !index.contains(fakeDriver(1)));
+    CPPUNIT_ASSERT_MESSAGE("Index should be empty.", index.findNearest(&query) == nullptr);
+}
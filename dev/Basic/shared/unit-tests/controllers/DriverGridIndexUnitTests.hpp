@@ -0,0 +1,40 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace unit_tests
+{
+
+/**
+ * Unit Tests for the grid index of available drivers used by the on-call controllers
+ */
+class DriverGridIndexUnitTests : public CppUnit::TestFixture
+{
+public:
+    ///An empty index returns no driver.
+    void test_empty_index();
+
+    ///The nearest driver must be the same one a linear scan would return, ties included.
+    void test_nearest_matches_linear_scan();
+
+    ///K-nearest and radius queries must return the same drivers, in the same order, as a sorted linear scan.
+    void test_knearest_and_radius_match_linear_scan();
+
+    ///Moving and removing drivers must be reflected by subsequent queries.
+    void test_update_and_remove();
+
+private:
+    CPPUNIT_TEST_SUITE(DriverGridIndexUnitTests);
+        CPPUNIT_TEST(test_empty_index);
+        CPPUNIT_TEST(test_nearest_matches_linear_scan);
+        CPPUNIT_TEST(test_knearest_and_radius_match_linear_scan);
+        CPPUNIT_TEST(test_update_and_remove);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+}
@@ -0,0 +1,112 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <map>
+#include <vector>
+
+#include "geospatial/network/IdIndex.hpp"
+
+#include "IdIndexUnitTests.hpp"
+
+using namespace sim_mob;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(unit_tests::IdIndexUnitTests);
+
+namespace
+{
+//Checks that the index finds exactly the elements of the map, for all the ids from 0 to maxId
+void checkLookups(const IdIndex<int>& index, const std::map<unsigned int, int *>& map, unsigned int maxId)
+{
+    for (unsigned int id = 0; id <= maxId; ++id)
+    {
+        std::map<unsigned int, int *>::const_iterator it = map.find(id);
+        const int *expected = (it != map.end()) ? it->second : nullptr;
+        CPPUNIT_ASSERT_EQUAL(expected, static_cast<const int *>(index.get(id)));
+    }
+
+    //The elements are stored in the order of their ids
+    std::vector<int *> elements;
+    for (std::map<unsigned int, int *>::const_iterator it = map.begin(); it != map.end(); ++it)
+    {
+        elements.push_back(it->second);
+    }
+    CPPUNIT_ASSERT(elements == index.getElements());
+}
+}
+
+void unit_tests::IdIndexUnitTests::test_dense_ids()
+{
+    //Ids 10 to 20, with gaps
+    int values[6] = { 0, 1, 2, 3, 4, 5 };
+    std::map<unsigned int, int *> map;
+    map[10] = &values[0];
+    map[11] = &values[1];
+    map[13] = &values[2];
+    map[14] = &values[3];
+    map[17] = &values[4];
+    map[20] = &values[5];
+
+    IdIndex<int> index;
+    index.build(map, 0);
+    checkLookups(index, map, 25);
+    CPPUNIT_ASSERT(!index.get(0xFFFFFFFF));
+}
+
+void unit_tests::IdIndexUnitTests::test_sparse_ids()
+{
+    //The range of the ids is much larger than the number of elements
+    int values[4] = { 0, 1, 2, 3 };
+    std::map<unsigned int, int *> map;
+    map[5] = &values[0];
+    map[1000] = &values[1];
+    map[1001] = &values[2];
+    map[90000] = &values[3];
+
+    IdIndex<int> index;
+    index.build(map, 0);
+    checkLookups(index, map, 90010);
+    CPPUNIT_ASSERT(!index.get(0xFFFFFFFF));
+}
+
+void unit_tests::IdIndexUnitTests::test_empty_map()
+{
+    std::map<unsigned int, int *> map;
+    IdIndex<int> index;
+    CPPUNIT_ASSERT(!index.get(0));
+
+    index.build(map, 0);
+    CPPUNIT_ASSERT(index.getElements().empty());
+    CPPUNIT_ASSERT(!index.get(0));
+    CPPUNIT_ASSERT(!index.get(1));
+}
+
+void unit_tests::IdIndexUnitTests::test_is_index_of()
+{
+    int values[3] = { 0, 1, 2 };
+    std::map<unsigned int, int *> map;
+    map[1] = &values[0];
+    map[2] = &values[1];
+
+    //A default constructed index is not the index of any map
+    IdIndex<int> index;
+    CPPUNIT_ASSERT(!index.isIndexOf(map, 0));
+
+    index.build(map, 3);
+    CPPUNIT_ASSERT(index.isIndexOf(map, 3));
+
+    //Another map of the same size
+    std::map<unsigned int, int *> other(map);
+    CPPUNIT_ASSERT(!index.isIndexOf(other, 3));
+
+    //The map was modified, without changing its size
+    CPPUNIT_ASSERT(!index.isIndexOf(map, 4));
+
+    //The map grew, and the generation was not incremented
+    map[3] = &values[2];
+    CPPUNIT_ASSERT(!index.isIndexOf(map, 3));
+
+    index.build(map, 4);
+    CPPUNIT_ASSERT(index.isIndexOf(map, 4));
+    CPPUNIT_ASSERT_EQUAL(&values[2], index.get(3));
+}
@@ -0,0 +1,40 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace unit_tests
+{
+
+/**
+ * Unit Tests for the IdIndex class in shared/geospatial/network
+ */
+class IdIndexUnitTests : public CppUnit::TestFixture
+{
+public:
+    ///Check the look-up of dense ids, which are remapped through a table.
+    void test_dense_ids();
+
+    ///Check the look-up of sparse ids, which are found by a binary search.
+    void test_sparse_ids();
+
+    ///Check that nothing is found in the index of an empty map.
+    void test_empty_map();
+
+    ///Check that the index is only used for the map and the generation it was built for.
+    void test_is_index_of();
+
+private:
+    CPPUNIT_TEST_SUITE(IdIndexUnitTests);
+        CPPUNIT_TEST(test_dense_ids);
+        CPPUNIT_TEST(test_sparse_ids);
+        CPPUNIT_TEST(test_empty_map);
+        CPPUNIT_TEST(test_is_index_of);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+}
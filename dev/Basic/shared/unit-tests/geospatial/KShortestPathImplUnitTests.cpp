@@ -0,0 +1,209 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <vector>
+
+#include "conf/ConfigManager.hpp"
+#include "conf/ConfigParams.hpp"
+#include "geospatial/network/Link.hpp"
+#include "geospatial/network/Node.hpp"
+#include "geospatial/network/Point.hpp"
+#include "geospatial/network/RoadNetwork.hpp"
+#include "geospatial/network/RoadSegment.hpp"
+#include "geospatial/network/TurningGroup.hpp"
+#include "geospatial/network/WayPoint.hpp"
+#include "geospatial/streetdir/KShortestPathImpl.hpp"
+
+#include "KShortestPathImplUnitTests.hpp"
+
+using namespace sim_mob;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(unit_tests::KShortestPathImplUnitTests);
+
+namespace
+{
+    //Ids of the test network. They are high enough not to clash with the networks of other tests
+    const unsigned int ORIGIN = 9001;
+    const unsigned int NODE_2 = 9002;
+    const unsigned int NODE_3 = 9003;
+    const unsigned int DESTINATION = 9004;
+
+    //Links: A (origin -> 2, 10m), B (2 -> destination, 10m), C (origin -> 3, 13m), D (3 -> destination, 12m),
+    //E (2 -> 3, 1m), F (3 -> 2, 1m) and G (origin -> destination, 30m)
+    enum TestLink { LINK_A = 9101, LINK_B, LINK_C, LINK_D, LINK_E, LINK_F, LINK_G };
+
+    void addNode(RoadNetwork* network, unsigned int id)
+    {
+        Node* node = new Node();
+        node->setNodeId(id);
+        node->setLocation(Point(0, 0));
+        network->addNode(node);
+    }
+
+    void addLink(RoadNetwork* network, unsigned int id, unsigned int fromNode, unsigned int toNode, double length)
+    {
+        Link* link = new Link();
+        link->setLinkId(id);
+        link->setFromNodeId(fromNode);
+        link->setToNodeId(toNode);
+        network->addLink(link);
+
+        //All the nodes are at the origin of the coordinates. The single segment of the link goes out and back, so that
+        //the path lengths are the sums of the link lengths
+        RoadSegment* segment = new RoadSegment();
+        segment->setRoadSegmentId(id);
+        segment->setLinkId(id);
+        segment->setSequenceNumber(1);
+        network->addRoadSegment(segment);
+        network->addSegmentPolyLine(PolyPoint(id, 1, 0, 0, 0));
+        network->addSegmentPolyLine(PolyPoint(id, 2, length / 2, 0, 0));
+        network->addSegmentPolyLine(PolyPoint(id, 3, 0, 0, 0));
+        link->calculateLength();
+    }
+
+    void addTurningGroup(RoadNetwork* network, unsigned int id, unsigned int node, unsigned int fromLink, unsigned int toLink)
+    {
+        TurningGroup* group = new TurningGroup();
+        group->setTurningGroupId(id);
+        group->setNodeId(node);
+        group->setFromLinkId(fromLink);
+        group->setToLinkId(toLink);
+        network->addTurningGroup(group);
+    }
+
+    const Node* getNode(unsigned int id)
+    {
+        return RoadNetwork::getInstance()->getMapOfIdvsNodes().at(id);
+    }
+
+    std::vector<unsigned int> getLinkIds(const std::vector<WayPoint>& path)
+    {
+        std::vector<unsigned int> ids;
+        for (std::vector<WayPoint>::const_iterator it = path.begin(); it != path.end(); ++it)
+        {
+            ids.push_back(it->link->getLinkId());
+        }
+        return ids;
+    }
+
+    std::vector<unsigned int> makePath(unsigned int first, unsigned int second = 0, unsigned int third = 0)
+    {
+        std::vector<unsigned int> ids(1, first);
+        if (second)
+        {
+            ids.push_back(second);
+        }
+        if (third)
+        {
+            ids.push_back(third);
+        }
+        return ids;
+    }
+
+    //The paths from the origin to the destination, by length
+    std::vector< std::vector<unsigned int> > getExpectedPaths()
+    {
+        std::vector< std::vector<unsigned int> > paths;
+        paths.push_back(makePath(LINK_A, LINK_B));          //20m
+        paths.push_back(makePath(LINK_A, LINK_E, LINK_D));  //23m
+        paths.push_back(makePath(LINK_C, LINK_F, LINK_B));  //24m
+        paths.push_back(makePath(LINK_C, LINK_D));          //25m
+        paths.push_back(makePath(LINK_G));                  //30m
+        return paths;
+    }
+}
+
+void unit_tests::KShortestPathImplUnitTests::setUp()
+{
+    //The test builds its network in place of the NetworkLoader
+    RoadNetwork* network = const_cast<RoadNetwork*>(RoadNetwork::getInstance());
+    if (network->getMapOfIdvsNodes().count(ORIGIN))
+    {
+        return;
+    }
+
+    //The spur searches are shared with helper threads. The test network is built before the first use of the
+    //K_ShortestPathImpl, which reads the number of threads
+    ConfigManager::GetInstanceRW().FullConfig().getPathSetConf().kspThreads = 3;
+
+    addNode(network, ORIGIN);
+    addNode(network, NODE_2);
+    addNode(network, NODE_3);
+    addNode(network, DESTINATION);
+
+    addLink(network, LINK_A, ORIGIN, NODE_2, 10);
+    addLink(network, LINK_B, NODE_2, DESTINATION, 10);
+    addLink(network, LINK_C, ORIGIN, NODE_3, 13);
+    addLink(network, LINK_D, NODE_3, DESTINATION, 12);
+    addLink(network, LINK_E, NODE_2, NODE_3, 1);
+    addLink(network, LINK_F, NODE_3, NODE_2, 1);
+    addLink(network, LINK_G, ORIGIN, DESTINATION, 30);
+
+    //No turning group connects E and F, so the paths do not go back and forth between nodes 2 and 3
+    addTurningGroup(network, 9201, NODE_2, LINK_A, LINK_B);
+    addTurningGroup(network, 9202, NODE_2, LINK_A, LINK_E);
+    addTurningGroup(network, 9203, NODE_2, LINK_F, LINK_B);
+    addTurningGroup(network, 9204, NODE_3, LINK_C, LINK_D);
+    addTurningGroup(network, 9205, NODE_3, LINK_C, LINK_F);
+    addTurningGroup(network, 9206, NODE_3, LINK_E, LINK_D);
+}
+
+void unit_tests::KShortestPathImplUnitTests::test_k_shortest_paths_in_order()
+{
+    boost::shared_ptr<K_ShortestPathImpl> ksp = K_ShortestPathImpl::getInstance();
+    const std::vector< std::vector<unsigned int> > expected = getExpectedPaths();
+
+    //The first iteration always adds a second path, so k = 1 gives two paths, as before
+    ksp->setK(1);
+    std::vector< std::vector<WayPoint> > first;
+    CPPUNIT_ASSERT(2 == ksp->getKShortestPaths(getNode(ORIGIN), getNode(DESTINATION), first));
+    CPPUNIT_ASSERT(expected[0] == getLinkIds(first[0]));
+    CPPUNIT_ASSERT(expected[1] == getLinkIds(first[1]));
+
+    for (int k = 2; k <= 4; ++k)
+    {
+        ksp->setK(k);
+        std::vector< std::vector<WayPoint> > paths;
+        CPPUNIT_ASSERT(k == ksp->getKShortestPaths(getNode(ORIGIN), getNode(DESTINATION), paths));
+        CPPUNIT_ASSERT(k == paths.size());
+
+        for (int i = 0; i < k; ++i)
+        {
+            CPPUNIT_ASSERT(expected[i] == getLinkIds(paths[i]));
+        }
+    }
+}
+
+void unit_tests::KShortestPathImplUnitTests::test_fewer_paths_than_k()
+{
+    boost::shared_ptr<K_ShortestPathImpl> ksp = K_ShortestPathImpl::getInstance();
+    const std::vector< std::vector<unsigned int> > expected = getExpectedPaths();
+
+    ksp->setK(10);
+    std::vector< std::vector<WayPoint> > paths;
+    CPPUNIT_ASSERT(expected.size() == ksp->getKShortestPaths(getNode(ORIGIN), getNode(DESTINATION), paths));
+    CPPUNIT_ASSERT(expected.size() == paths.size());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        CPPUNIT_ASSERT(expected[i] == getLinkIds(paths[i]));
+    }
+
+    //From node 3, only the paths through F and B (11m) and through D (12m) remain
+    paths.clear();
+    CPPUNIT_ASSERT(2 == ksp->getKShortestPaths(getNode(NODE_3), getNode(DESTINATION), paths));
+    CPPUNIT_ASSERT(makePath(LINK_F, LINK_B) == getLinkIds(paths[0]));
+    CPPUNIT_ASSERT(makePath(LINK_D) == getLinkIds(paths[1]));
+}
+
+void unit_tests::KShortestPathImplUnitTests::test_unreachable_destination()
+{
+    boost::shared_ptr<K_ShortestPathImpl> ksp = K_ShortestPathImpl::getInstance();
+    ksp->setK(3);
+
+    //No link leaves the destination
+    std::vector< std::vector<WayPoint> > paths;
+    CPPUNIT_ASSERT(0 == ksp->getKShortestPaths(getNode(DESTINATION), getNode(ORIGIN), paths));
+    CPPUNIT_ASSERT(paths.empty());
+}
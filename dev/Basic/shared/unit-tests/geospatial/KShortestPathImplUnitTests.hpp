@@ -0,0 +1,43 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace unit_tests
+{
+
+/**
+ * Unit Tests for the K_ShortestPathImpl class in shared/geospatial/streetdir
+ *
+ * The tests run on a small network, in which all the paths between the origin and the destination have different
+ * lengths. Yen's algorithm, in the previous implementation on the driving graph of the street directory as well as in
+ * the current one, returns the k shortest of these paths in the order of their length.
+ */
+class KShortestPathImplUnitTests : public CppUnit::TestFixture
+{
+public:
+    ///Builds the test network, the first time it is called.
+    void setUp();
+
+    ///Check that the k shortest paths are found, in the order of their length.
+    void test_k_shortest_paths_in_order();
+
+    ///Check that all the paths are returned when there are fewer than k.
+    void test_fewer_paths_than_k();
+
+    ///Check that no path is returned if the destination is not reachable.
+    void test_unreachable_destination();
+
+private:
+    CPPUNIT_TEST_SUITE(KShortestPathImplUnitTests);
+        CPPUNIT_TEST(test_k_shortest_paths_in_order);
+        CPPUNIT_TEST(test_fewer_paths_than_k);
+        CPPUNIT_TEST(test_unreachable_destination);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+}
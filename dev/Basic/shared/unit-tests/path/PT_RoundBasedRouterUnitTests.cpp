@@ -0,0 +1,184 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <string>
+#include <vector>
+
+#include "entities/params/PT_NetworkEntities.hpp"
+#include "path/PT_RoundBasedRouter.hpp"
+
+#include "PT_RoundBasedRouterUnitTests.hpp"
+
+using namespace sim_mob;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(unit_tests::PT_RoundBasedRouterUnitTests);
+
+namespace
+{
+void addVertex(PT_Network& network, const std::string& id, int type)
+{
+    PT_NetworkVertex vertex;
+    vertex.setStopId(id);
+    vertex.setStopType(type);
+    network.PT_NetworkVertexMap[id] = vertex;
+}
+
+void addEdge(PT_Network& network, int id, const std::string& from, const std::string& to, const std::string& type,
+             double travelTime)
+{
+    PT_NetworkEdge edge;
+    edge.setEdgeId(id);
+    edge.setStartStop(from);
+    edge.setEndStop(to);
+    edge.setType(type);
+    edge.setLinkTravelTimeSecs(travelTime);
+
+    if (type == "Walk")
+    {
+        edge.setWalkTimeSecs(travelTime);
+    }
+    else
+    {
+        edge.setDayTransitTimeSecs(travelTime);
+    }
+
+    network.PT_NetworkEdgeMap[id] = edge;
+}
+
+/**
+ * From N_1 to N_2:
+ *  - walk to B, bus to C, walk: 900s, 1 ride, 400s walking
+ *  - walk to A, bus to D, bus to C, walk: 1000s, 2 rides, 200s walking
+ *  - walk to A, bus to C, walk: 1200s, 1 ride, 200s walking
+ */
+void makeNetwork(PT_Network& network)
+{
+    addVertex(network, "N_1", 0);
+    addVertex(network, "N_2", 0);
+    addVertex(network, "A", 1);
+    addVertex(network, "B", 1);
+    addVertex(network, "C", 1);
+    addVertex(network, "D", 2);
+
+    addEdge(network, 1, "N_1", "A", "Walk", 100);
+    addEdge(network, 2, "N_1", "B", "Walk", 300);
+    addEdge(network, 3, "A", "C", "Bus", 1000);
+    addEdge(network, 4, "A", "D", "Bus", 400);
+    addEdge(network, 5, "D", "C", "RTS", 400);
+    addEdge(network, 6, "C", "N_2", "Walk", 100);
+    addEdge(network, 7, "B", "C", "Bus", 500);
+}
+
+std::vector<int> getEdgeIds(const PT_RoundBasedRouter::Journey& journey)
+{
+    std::vector<int> ids;
+    for (const PT_NetworkEdge* edge : journey.edges)
+    {
+        ids.push_back(edge->getEdgeId());
+    }
+    return ids;
+}
+}
+
+void unit_tests::PT_RoundBasedRouterUnitTests::test_pareto_journeys()
+{
+    PT_Network network;
+    makeNetwork(network);
+    PT_RoundBasedRouter router(network);
+
+    std::vector<std::vector<PT_RoundBasedRouter::Journey> > journeys;
+    router.route("N_1", std::vector<std::string>(1, "N_2"), journeys);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(1), journeys.size());
+    CPPUNIT_ASSERT_EQUAL(size_t(3), journeys[0].size());
+
+    const PT_RoundBasedRouter::Journey& fastest = journeys[0][0];
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(900.0, fastest.travelTime, 1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(400.0, fastest.walkingTime, 1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(500.0, fastest.inVehicleTime, 1e-9);
+    CPPUNIT_ASSERT_EQUAL(1u, fastest.rides);
+    CPPUNIT_ASSERT(getEdgeIds(fastest) == std::vector<int>({ 2, 7, 6 }));
+
+    const PT_RoundBasedRouter::Journey& transfer = journeys[0][1];
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1000.0, transfer.travelTime, 1e-9);
+    CPPUNIT_ASSERT_EQUAL(2u, transfer.rides);
+    CPPUNIT_ASSERT(getEdgeIds(transfer) == std::vector<int>({ 1, 4, 5, 6 }));
+
+    const PT_RoundBasedRouter::Journey& lessWalking = journeys[0][2];
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1200.0, lessWalking.travelTime, 1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(200.0, lessWalking.walkingTime, 1e-9);
+    CPPUNIT_ASSERT_EQUAL(1u, lessWalking.rides);
+    CPPUNIT_ASSERT(getEdgeIds(lessWalking) == std::vector<int>({ 1, 3, 6 }));
+
+    //the same router, searched again, must give the same journeys
+    std::vector<std::vector<PT_RoundBasedRouter::Journey> > again;
+    router.route("N_1", std::vector<std::string>(1, "N_2"), again);
+    CPPUNIT_ASSERT_EQUAL(size_t(3), again[0].size());
+    CPPUNIT_ASSERT(getEdgeIds(again[0][1]) == std::vector<int>({ 1, 4, 5, 6 }));
+}
+
+void unit_tests::PT_RoundBasedRouterUnitTests::test_max_rides()
+{
+    PT_Network network;
+    makeNetwork(network);
+    PT_RoundBasedRouter router(network, 1);
+
+    std::vector<std::vector<PT_RoundBasedRouter::Journey> > journeys;
+    router.route("N_1", std::vector<std::string>(1, "N_2"), journeys);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(2), journeys[0].size());
+    CPPUNIT_ASSERT(getEdgeIds(journeys[0][0]) == std::vector<int>({ 2, 7, 6 }));
+    CPPUNIT_ASSERT(getEdgeIds(journeys[0][1]) == std::vector<int>({ 1, 3, 6 }));
+}
+
+void unit_tests::PT_RoundBasedRouterUnitTests::test_feasibility()
+{
+    PT_Network network;
+    addVertex(network, "N_1", 0);
+    addVertex(network, "N_2", 0);
+    addVertex(network, "N_3", 0);
+    addVertex(network, "A", 1);
+    addVertex(network, "B", 1);
+
+    //walk, walk: not a journey
+    addEdge(network, 1, "N_1", "A", "Walk", 100);
+    addEdge(network, 2, "A", "N_2", "Walk", 100);
+
+    //bus to a node, bus from the node: not a journey
+    addEdge(network, 3, "A", "N_3", "Bus", 100);
+    addEdge(network, 4, "N_3", "B", "Bus", 100);
+    addEdge(network, 5, "B", "N_2", "Walk", 100);
+
+    PT_RoundBasedRouter router(network);
+    std::vector<std::string> destinations;
+    destinations.push_back("N_2");
+    destinations.push_back("N_3");
+    destinations.push_back("B");
+
+    std::vector<std::vector<PT_RoundBasedRouter::Journey> > journeys;
+    router.route("N_1", destinations, journeys);
+
+    CPPUNIT_ASSERT(journeys[0].empty());
+    CPPUNIT_ASSERT_EQUAL(size_t(1), journeys[1].size());
+    CPPUNIT_ASSERT(getEdgeIds(journeys[1][0]) == std::vector<int>({ 1, 3 }));
+    CPPUNIT_ASSERT(journeys[2].empty());
+}
+
+void unit_tests::PT_RoundBasedRouterUnitTests::test_unknown_vertices()
+{
+    PT_Network network;
+    makeNetwork(network);
+    PT_RoundBasedRouter router(network);
+
+    std::vector<std::vector<PT_RoundBasedRouter::Journey> > journeys;
+    router.route("N_9", std::vector<std::string>(1, "N_2"), journeys);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), journeys.size());
+    CPPUNIT_ASSERT(journeys[0].empty());
+
+    router.route("N_1", std::vector<std::string>(1, "N_9"), journeys);
+    CPPUNIT_ASSERT(journeys[0].empty());
+
+    router.route("N_1", std::vector<std::string>(1, "N_1"), journeys);
+    CPPUNIT_ASSERT(journeys[0].empty());
+}
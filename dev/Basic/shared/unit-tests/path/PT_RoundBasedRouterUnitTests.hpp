@@ -0,0 +1,40 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace unit_tests
+{
+
+/**
+ * Unit Tests for the round-based public transit router
+ */
+class PT_RoundBasedRouterUnitTests : public CppUnit::TestFixture
+{
+public:
+    ///All the journeys pareto optimal in travel time, rides and walking time must be found, fastest first.
+    void test_pareto_journeys();
+
+    ///Journeys must not exceed the maximum number of rides.
+    void test_max_rides();
+
+    ///Journeys must not chain two walks, nor transfer at a SimMobility node.
+    void test_feasibility();
+
+    ///Unknown vertices must give no journey.
+    void test_unknown_vertices();
+
+private:
+    CPPUNIT_TEST_SUITE(PT_RoundBasedRouterUnitTests);
+        CPPUNIT_TEST(test_pareto_journeys);
+        CPPUNIT_TEST(test_max_rides);
+        CPPUNIT_TEST(test_feasibility);
+        CPPUNIT_TEST(test_unknown_vertices);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+}
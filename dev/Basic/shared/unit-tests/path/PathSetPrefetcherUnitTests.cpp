@@ -0,0 +1,225 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/bind.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "conf/ConfigManager.hpp"
+#include "conf/ConfigParams.hpp"
+#include "geospatial/network/Node.hpp"
+#include "path/PathSetPrefetcher.hpp"
+#include "util/threadpool/Threadpool.hpp"
+
+#include "PathSetPrefetcherUnitTests.hpp"
+
+using namespace sim_mob;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(unit_tests::PathSetPrefetcherUnitTests);
+
+namespace
+{
+/**
+ * Replaces the DB loader of the prefetcher. Records the ODs it is called for, and fails for the ODs starting at
+ * failingOrigin
+ */
+class TestLoader
+{
+public:
+    explicit TestLoader(unsigned int failingOrigin = 0) : failingOrigin(failingOrigin)
+    {
+    }
+
+    boost::shared_ptr<PathSetPrefetcher::PrefetchedPathSet> load(const Node* origin, const Node* destination)
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(callsMutex);
+            calls.push_back(std::make_pair(origin->getNodeId(), destination->getNodeId()));
+        }
+
+        if (origin->getNodeId() == failingOrigin)
+        {
+            throw std::runtime_error("no pathset");
+        }
+
+        boost::shared_ptr<PathSetPrefetcher::PrefetchedPathSet> pathSet(new PathSetPrefetcher::PrefetchedPathSet());
+        pathSet->status = PSM_HASPATH;
+        return pathSet;
+    }
+
+    std::vector<std::pair<unsigned int, unsigned int> > getCalls()
+    {
+        boost::unique_lock<boost::mutex> lock(callsMutex);
+        return calls;
+    }
+
+private:
+    const unsigned int failingOrigin;
+    boost::mutex callsMutex;
+    std::vector<std::pair<unsigned int, unsigned int> > calls;
+};
+
+void setPrefetchEnabled(bool enabled)
+{
+    PathSetConf& pathSetConf = ConfigManager::GetInstanceRW().FullConfig().getPathSetConf();
+    pathSetConf.prefetchEnabled = enabled;
+    pathSetConf.prefetchLookahead = 60;
+    pathSetConf.prefetchThreads = 2;
+}
+
+Node* makeNode(unsigned int id)
+{
+    Node* node = new Node();
+    node->setNodeId(id);
+    return node;
+}
+}
+
+void unit_tests::PathSetPrefetcherUnitTests::setUp()
+{
+    ConfigParams& config = ConfigManager::GetInstanceRW().FullConfig();
+    config.networkDatabase.procedures = "unit_tests";
+    config.procedureMaps["unit_tests"].procedureMappings["pvt_pathset"] = "get_pathset";
+    setPrefetchEnabled(true);
+}
+
+void unit_tests::PathSetPrefetcherUnitTests::test_pathsets_loaded_within_lookahead()
+{
+    Node* n1 = makeNode(1);
+    Node* n2 = makeNode(2);
+    Node* n3 = makeNode(3);
+    TestLoader testLoader;
+
+    PathSetPrefetcher prefetcher;
+    prefetcher.loader = boost::bind(&TestLoader::load, &testLoader, _1, _2);
+    CPPUNIT_ASSERT(prefetcher.isEnabled());
+    prefetcher.start();
+
+    prefetcher.addDeparture(DailyTime("08:00:30"), n1, n2);
+    prefetcher.addDeparture(DailyTime("08:00:50"), n1, n2);
+    prefetcher.addDeparture(DailyTime("08:05:00"), n2, n3);
+    prefetcher.addDeparture(DailyTime("08:00:10"), n3, n3);
+
+    //Only the OD 1,2 departs within the lookahead, and it is loaded once for both its trips
+    prefetcher.advance(DailyTime("08:00:00"));
+    prefetcher.threadPool->wait();
+    std::vector<std::pair<unsigned int, unsigned int> > calls = testLoader.getCalls();
+    CPPUNIT_ASSERT_EQUAL(size_t(1), calls.size());
+    CPPUNIT_ASSERT(calls[0] == std::make_pair(1u, 2u));
+
+    //The loaded pathset is published by the next advance, at the latest
+    prefetcher.advance(DailyTime("08:00:05"));
+    boost::shared_ptr<const PathSetPrefetcher::PrefetchedPathSet> pathSet = prefetcher.find(1, 2);
+    CPPUNIT_ASSERT(pathSet);
+    CPPUNIT_ASSERT_EQUAL(PSM_HASPATH, pathSet->status);
+    CPPUNIT_ASSERT(!prefetcher.find(2, 3));
+    CPPUNIT_ASSERT(!prefetcher.find(3, 3));
+
+    //The OD 2,3 enters the lookahead
+    prefetcher.advance(DailyTime("08:04:00"));
+    prefetcher.threadPool->wait();
+    prefetcher.advance(DailyTime("08:04:05"));
+    CPPUNIT_ASSERT(prefetcher.find(2, 3));
+    CPPUNIT_ASSERT_EQUAL(size_t(2), testLoader.getCalls().size());
+
+    prefetcher.stop();
+    CPPUNIT_ASSERT(!prefetcher.find(2, 3));
+
+    delete n1;
+    delete n2;
+    delete n3;
+}
+
+void unit_tests::PathSetPrefetcherUnitTests::test_pathsets_evicted_after_last_departure()
+{
+    Node* n1 = makeNode(1);
+    Node* n2 = makeNode(2);
+    TestLoader testLoader;
+
+    PathSetPrefetcher prefetcher;
+    prefetcher.loader = boost::bind(&TestLoader::load, &testLoader, _1, _2);
+    prefetcher.start();
+
+    prefetcher.addDeparture(DailyTime("08:00:30"), n1, n2);
+    prefetcher.advance(DailyTime("08:00:00"));
+    prefetcher.threadPool->wait();
+    prefetcher.advance(DailyTime("08:00:05"));
+    boost::shared_ptr<const PathSetPrefetcher::PrefetchedPathSet> pathSet = prefetcher.find(1, 2);
+    CPPUNIT_ASSERT(pathSet);
+
+    //A later trip of the same OD extends the life of the pathset without loading it again
+    prefetcher.addDeparture(DailyTime("08:01:00"), n1, n2);
+    prefetcher.advance(DailyTime("08:01:00"));
+    prefetcher.threadPool->wait();
+    CPPUNIT_ASSERT_EQUAL(size_t(1), testLoader.getCalls().size());
+
+    //The pathset is kept one lookahead after the last departure
+    prefetcher.advance(DailyTime("08:02:00"));
+    CPPUNIT_ASSERT(prefetcher.find(1, 2) == pathSet);
+    prefetcher.advance(DailyTime("08:02:01"));
+    CPPUNIT_ASSERT(!prefetcher.find(1, 2));
+
+    //A reader still holding the pathset can use it
+    CPPUNIT_ASSERT_EQUAL(PSM_HASPATH, pathSet->status);
+
+    prefetcher.stop();
+
+    delete n1;
+    delete n2;
+}
+
+void unit_tests::PathSetPrefetcherUnitTests::test_failed_load_not_published()
+{
+    Node* n1 = makeNode(1);
+    Node* n2 = makeNode(2);
+    Node* n4 = makeNode(4);
+    TestLoader testLoader(4);
+
+    PathSetPrefetcher prefetcher;
+    prefetcher.loader = boost::bind(&TestLoader::load, &testLoader, _1, _2);
+    prefetcher.start();
+
+    prefetcher.addDeparture(DailyTime("08:00:30"), n4, n2);
+    prefetcher.addDeparture(DailyTime("08:00:30"), n1, n2);
+    prefetcher.advance(DailyTime("08:00:00"));
+    prefetcher.threadPool->wait();
+    prefetcher.advance(DailyTime("08:00:05"));
+
+    CPPUNIT_ASSERT_EQUAL(size_t(2), testLoader.getCalls().size());
+    CPPUNIT_ASSERT(!prefetcher.find(4, 2));
+    CPPUNIT_ASSERT(prefetcher.find(1, 2));
+
+    prefetcher.stop();
+
+    delete n1;
+    delete n2;
+    delete n4;
+}
+
+void unit_tests::PathSetPrefetcherUnitTests::test_prefetching_disabled()
+{
+    setPrefetchEnabled(false);
+    Node* n1 = makeNode(1);
+    Node* n2 = makeNode(2);
+    TestLoader testLoader;
+
+    PathSetPrefetcher prefetcher;
+    prefetcher.loader = boost::bind(&TestLoader::load, &testLoader, _1, _2);
+    CPPUNIT_ASSERT(!prefetcher.isEnabled());
+    prefetcher.start();
+    CPPUNIT_ASSERT(!prefetcher.threadPool);
+
+    prefetcher.addDeparture(DailyTime("08:00:30"), n1, n2);
+    prefetcher.advance(DailyTime("08:00:00"));
+    prefetcher.advance(DailyTime("08:00:05"));
+    CPPUNIT_ASSERT(testLoader.getCalls().empty());
+    CPPUNIT_ASSERT(!prefetcher.find(1, 2));
+
+    prefetcher.stop();
+
+    delete n1;
+    delete n2;
+}
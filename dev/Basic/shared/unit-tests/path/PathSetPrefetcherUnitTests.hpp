@@ -0,0 +1,45 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace unit_tests
+{
+
+/**
+ * Unit Tests for the PathSetPrefetcher class in shared/path
+ *
+ * The pathsets are not loaded from the DB: the tests replace the loader of the prefetcher (they are friends of it).
+ */
+class PathSetPrefetcherUnitTests : public CppUnit::TestFixture
+{
+public:
+    ///Sets the pathset configuration and the stored procedures needed by the prefetcher.
+    void setUp();
+
+    ///Check that the ODs departing within the lookahead are loaded once, and published once loaded.
+    void test_pathsets_loaded_within_lookahead();
+
+    ///Check that a pathset is evicted one lookahead after the last departure of its OD.
+    void test_pathsets_evicted_after_last_departure();
+
+    ///Check that an OD whose pathset could not be loaded is not published.
+    void test_failed_load_not_published();
+
+    ///Check that nothing is loaded when prefetching is disabled.
+    void test_prefetching_disabled();
+
+private:
+    CPPUNIT_TEST_SUITE(PathSetPrefetcherUnitTests);
+        CPPUNIT_TEST(test_pathsets_loaded_within_lookahead);
+        CPPUNIT_TEST(test_pathsets_evicted_after_last_departure);
+        CPPUNIT_TEST(test_failed_load_not_published);
+        CPPUNIT_TEST(test_prefetching_disabled);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+}
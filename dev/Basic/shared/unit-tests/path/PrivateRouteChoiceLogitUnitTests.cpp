@@ -0,0 +1,123 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "path/PrivateRouteChoiceLogit.hpp"
+
+#include "PrivateRouteChoiceLogitUnitTests.hpp"
+
+using namespace sim_mob;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(unit_tests::PrivateRouteChoiceLogitUnitTests);
+
+namespace
+{
+void addPath(PrivateRouteChoiceAttributes& attributes, double travelTime, double travelCost, double partialUtility,
+             double pathSize, double length, double highwayDistance, double signalNumber, double rightTurnNumber,
+             int isMinDistance, int isMinSignal, int isMaxHighwayUsage, int purpose)
+{
+    attributes.travelTime.push_back(travelTime);
+    attributes.travelCost.push_back(travelCost);
+    attributes.partialUtility.push_back(partialUtility);
+    attributes.pathSize.push_back(pathSize);
+    attributes.length.push_back(length);
+    attributes.highwayDistance.push_back(highwayDistance);
+    attributes.signalNumber.push_back(signalNumber);
+    attributes.rightTurnNumber.push_back(rightTurnNumber);
+    attributes.isMinDistance.push_back(isMinDistance);
+    attributes.isMinSignal.push_back(isMinSignal);
+    attributes.isMaxHighwayUsage.push_back(isMaxHighwayUsage);
+    attributes.purpose.push_back(purpose);
+}
+
+//Three paths, the first two with the time independent part of the utility computed in the model
+PrivateRouteChoiceAttributes makeChoiceSet()
+{
+    PrivateRouteChoiceAttributes attributes;
+    addPath(attributes, 900, 2, 0.0, 0.5, 10000, 2000, 10, 3, 1, 0, 1, 1);
+    addPath(attributes, 1200, 0, 0.0, 0.8, 12000, 0, 4, 1, 0, 1, 0, 2);
+    addPath(attributes, 600, 0, 1.5, 0.2, 8000, 500, 7, 2, 0, 0, 0, 1);
+    return attributes;
+}
+}
+
+void unit_tests::PrivateRouteChoiceLogitUnitTests::test_utilities_match_script()
+{
+    //Expected values obtained by evaluating the expressions of pvtrc.lua with its default betas
+    PrivateRouteChoiceLogit logit;
+    std::vector<double> utilities;
+    logit.computeUtilities(makeChoiceSet(), utilities);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(3), utilities.size());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-4.098524199223416, utilities[0], 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.6657091477771582, utilities[2], 1e-12);
+}
+
+void unit_tests::PrivateRouteChoiceLogitUnitTests::test_probabilities()
+{
+    PrivateRouteChoiceLogit logit;
+    PrivateRouteChoiceAttributes attributes = makeChoiceSet();
+    std::vector<double> utilities, probabilities;
+    logit.computeUtilities(attributes, utilities);
+    logit.computeProbabilities(attributes, probabilities);
+
+    double sum = 0.0;
+    double expSum = std::exp(utilities[0]) + std::exp(utilities[1]) + std::exp(utilities[2]);
+    for (size_t i = 0; i < probabilities.size(); ++i)
+    {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(std::exp(utilities[i]) / expSum, probabilities[i], 1e-12);
+        sum += probabilities[i];
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, sum, 1e-12);
+
+    //An undefined travel time makes the utility undefined and the path unavailable
+    attributes.travelTime[1] = std::numeric_limits<double>::quiet_NaN();
+    logit.computeProbabilities(attributes, probabilities);
+    CPPUNIT_ASSERT_EQUAL(0.0, probabilities[1]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, probabilities[0] + probabilities[2], 1e-12);
+}
+
+void unit_tests::PrivateRouteChoiceLogitUnitTests::test_random_sequence_matches_script()
+{
+    //First numbers returned by myRand in a fresh Lua state
+    const double expected[] = { 0.0012700666602540878, 0.4753858678968754, 0.38073331926443643,
+                                0.11151252348008711, 0.7536020190354975 };
+    PrivateRouteChoiceLogit logit;
+    for (double value : expected)
+    {
+        CPPUNIT_ASSERT_EQUAL(value, logit.nextRandom());
+    }
+
+    //With these numbers, make_final_choice picks the first path, then the second twice, then the first and the third
+    std::vector<double> probabilities = { 0.2, 0.5, 0.3 };
+    PrivateRouteChoiceLogit other;
+    const unsigned int expectedChoices[] = { 1, 2, 2, 1, 3 };
+    for (unsigned int choice : expectedChoices)
+    {
+        CPPUNIT_ASSERT_EQUAL(choice, other.makeChoice(probabilities));
+    }
+}
+
+void unit_tests::PrivateRouteChoiceLogitUnitTests::test_choice_frequencies()
+{
+    PrivateRouteChoiceLogit logit;
+    PrivateRouteChoiceAttributes attributes = makeChoiceSet();
+    std::vector<double> probabilities;
+    logit.computeProbabilities(attributes, probabilities);
+
+    const unsigned int draws = 100000;
+    std::vector<unsigned int> counts(probabilities.size(), 0);
+    for (unsigned int i = 0; i < draws; ++i)
+    {
+        counts[logit.choose(attributes) - 1]++;
+    }
+
+    for (size_t i = 0; i < probabilities.size(); ++i)
+    {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(probabilities[i], double(counts[i]) / draws, 0.01);
+    }
+}
@@ -0,0 +1,40 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace unit_tests
+{
+
+/**
+ * Unit Tests for the native implementation of the private traffic route choice model (pvtrc.lua)
+ */
+class PrivateRouteChoiceLogitUnitTests : public CppUnit::TestFixture
+{
+public:
+    ///Utilities must be the ones computed by pvtrc.lua, with and without partial utility.
+    void test_utilities_match_script();
+
+    ///Probabilities must sum to one, paths with an undefined utility must not be available.
+    void test_probabilities();
+
+    ///The random sequence must be the one of myRand in logit.lua.
+    void test_random_sequence_matches_script();
+
+    ///The frequency of each choice must converge to its probability.
+    void test_choice_frequencies();
+
+private:
+    CPPUNIT_TEST_SUITE(PrivateRouteChoiceLogitUnitTests);
+        CPPUNIT_TEST(test_utilities_match_script);
+        CPPUNIT_TEST(test_probabilities);
+        CPPUNIT_TEST(test_random_sequence_matches_script);
+        CPPUNIT_TEST(test_choice_frequencies);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+}
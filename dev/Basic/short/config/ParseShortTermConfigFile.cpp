@@ -457,6 +457,14 @@ void ParseShortTermConfigFile::processCommSimNode(DOMElement *node)
 
         //Use ns-3 for routing?
         stCfg.commsim.useNs3 = processValueBoolean(GetSingleElementByName(node, "use_ns3", true));
+
+        //Send v2 (binary) bundles? Optional; clients must support the v2 format.
+        DOMElement* binaryNode = GetSingleElementByName(node, "binary_bundles");
+        stCfg.commsim.binaryBundles = binaryNode ? processValueBoolean(binaryNode) : false;
+
+        //Ticks the simulation may run ahead of its Android clients. Optional; 0 waits for every client on every tick.
+        DOMElement* lookaheadNode = GetSingleElementByName(node, "lookahead_ticks");
+        stCfg.commsim.lookaheadTicks = lookaheadNode ? ParseUnsignedInt(GetNamedAttributeValue(lookaheadNode, "value"), 0u) : 0;
     }
 }
 
@@ -111,8 +111,10 @@ struct Commsim
     int minClients; ///< The minimum number of simultaneous clients required to proceed with the simulation.
     int holdTick; ///< The simulation tick that we will pause on until minClients connections are made.
     bool useNs3; ///< If true, waits for the ns-3 simulator to connect.
+    bool binaryBundles; ///< If true, bundles are sent in the v2 format (binary ticks/locations, delta-encoded all_locations).
+    unsigned int lookaheadTicks; ///< How many ticks the simulation may run ahead of Android clients that have not sent ticked_client.
 
-    Commsim() : enabled(false), numIoThreads(1), minClients(1), holdTick(1), useNs3(false)
+    Commsim() : enabled(false), numIoThreads(1), minClients(1), holdTick(1), useNs3(false), binaryBundles(false), lookaheadTicks(0)
     {
     }
 };
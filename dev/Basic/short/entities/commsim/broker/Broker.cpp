@@ -4,6 +4,7 @@
 
 #include "Broker.hpp"
 
+#include <algorithm>
 #include <sstream>
 #include <boost/assign/list_of.hpp>
 #include <json/json.h>
@@ -52,7 +53,7 @@ const unsigned int sim_mob::Broker::EventNewAndroidClient = 95000;
 
 
 sim_mob::Broker::Broker(const MutexStrategy& mtxStrat, int id) :
-        Agent(mtxStrat, id), numAgents(0), connection(*this)
+        Agent(mtxStrat, id), numAgents(0), connection(*this), binaryBundles(false), lookaheadTicks(0)
 {
     //Various Initializations
     configure();
@@ -81,7 +82,7 @@ bool sim_mob::Broker::insertSendBuffer(boost::shared_ptr<sim_mob::ClientHandler>
     //Is this the first message received for this ClientHandler/destID pair?
     if (sendBuffer.find(client)==sendBuffer.end()) {
         OngoingSerialization& ongoing = sendBuffer[client];
-        CommsimSerializer::serialize_begin(ongoing, client->clientId);
+        CommsimSerializer::serialize_begin(ongoing, client->clientId, binaryBundles?BUNDLE_VERSION_2:BUNDLE_VERSION_1);
     }
 
     //Now just add it.
@@ -113,6 +114,10 @@ void sim_mob::Broker::configure()
     //We always wait for MIN_CLIENTS Android emulators and MIN_CLIENTS Agents (and optionally, 1 ns-3 client).
     waitAndroidBlocker.reset(ST_Config::getInstance().commsim.minClients);
     waitNs3Blocker.reset(useNs3?1:0);
+
+    //Bundle format and synchronization with the clients.
+    binaryBundles = ST_Config::getInstance().commsim.binaryBundles;
+    lookaheadTicks = ST_Config::getInstance().commsim.lookaheadTicks;
 }
 
 
@@ -649,13 +654,6 @@ void sim_mob::Broker::processPublishers(timeslice now)
     //Create a single Time message.
     //std::string timeMsg = CommsimSerializer::makeTimeData(now.frame(), ConfigManager::GetInstance().FullConfig().baseGranMS());
 
-    //Create a single AllLocations message.
-    std::map<unsigned int, Point> allLocs;
-    for (std::map<const Agent*, AgentInfo>::const_iterator it=registeredAgents.begin(); it!=registeredAgents.end(); it++) {
-        allLocs[it->first->getId()] = Point(it->first->xPos.get(), it->first->yPos.get());
-    }
-    std::string allLocMsg = CommsimSerializer::makeAllLocations(allLocs);
-
     //Process all clients for messages.
     for (ClientList::Type::const_iterator it=registeredAndroidClients.begin(); it!=registeredAndroidClients.end(); it++) {
         //Skip dead Agents.
@@ -673,7 +671,11 @@ void sim_mob::Broker::processPublishers(timeslice now)
                 loc = trans->transform(Point(cHandler->agent->xPos.get(), cHandler->agent->yPos.get()));
             }
 
-            insertSendBuffer(cHandler, CommsimSerializer::makeLocation(cHandler->agent->xPos.get(), cHandler->agent->yPos.get(), loc));
+            if (binaryBundles) {
+                insertSendBuffer(cHandler, CommsimSerializer::makeLocationBinary(cHandler->agent->xPos.get(), cHandler->agent->yPos.get(), loc));
+            } else {
+                insertSendBuffer(cHandler, CommsimSerializer::makeLocation(cHandler->agent->xPos.get(), cHandler->agent->yPos.get(), loc));
+            }
         }
         if (cHandler->regisRegionPath) {
             if (cHandler->agent->getRegionSupportStruct().isEnabled()) {
@@ -693,7 +695,20 @@ void sim_mob::Broker::processPublishers(timeslice now)
     if (registeredNs3Clients.size() == 1) {
         boost::shared_ptr<sim_mob::ClientHandler> ns3Handler = registeredNs3Clients.begin()->second;
         if (ns3Handler->regisAllLocations) {
-            insertSendBuffer(ns3Handler, allLocMsg);
+            //Create a single AllLocations message.
+            std::map<unsigned int, Point> allLocs;
+            for (std::map<const Agent*, AgentInfo>::const_iterator it=registeredAgents.begin(); it!=registeredAgents.end(); it++) {
+                allLocs[it->first->getId()] = Point(it->first->xPos.get(), it->first->yPos.get());
+            }
+
+            //v2 bundles only carry the changes since the last AllLocations message received by the client.
+            if (binaryBundles) {
+                if (insertSendBuffer(ns3Handler, CommsimSerializer::makeAllLocationsDelta(allLocs, lastAllLocations))) {
+                    lastAllLocations.swap(allLocs);
+                }
+            } else {
+                insertSendBuffer(ns3Handler, CommsimSerializer::makeAllLocations(allLocs));
+            }
         }
 
         //Create a single "new agents" message, if appropriate.
@@ -718,9 +733,12 @@ void sim_mob::Broker::sendReadyToReceive(timeslice now)
     //NOTE: This is slightly different than how the previous code did it, but it *should* work.
     //It will at least fail predictably: if the simulator freezes in the first time tick for a new agent, this is where to look.
     //TODO: We need a better way of tracking <client,destAgentID> pairs anyway; that fix will likely simplify this function.
+    const unsigned int elapsedMs = ConfigManager::GetInstance().FullConfig().baseGranMS();
+    const std::string tickedMsg = binaryBundles ? CommsimSerializer::makeTickedSimMobBinary(now.frame(), elapsedMs)
+            : CommsimSerializer::makeTickedSimMob(now.frame(), elapsedMs);
     std::map<SendBuffer::Key, std::string> pendingMessages;
     for (std::map<SendBuffer::Key, OngoingSerialization>::const_iterator it=sendBuffer.begin(); it!=sendBuffer.end(); it++) {
-        pendingMessages[it->first] = CommsimSerializer::makeTickedSimMob(now.frame(), ConfigManager::GetInstance().FullConfig().baseGranMS());
+        pendingMessages[it->first] = tickedMsg;
     }
 
     for (std::map<SendBuffer::Key, std::string>::const_iterator it=pendingMessages.begin(); it!=pendingMessages.end(); it++) {
@@ -848,9 +866,12 @@ bool sim_mob::Broker::allClientsAreDone()
                 if (chkIt==clientDoneChecklist.end()) {
                     throw std::runtime_error("Client somehow registered without a valid connection handler.");
                 }
-                if (chkIt->second.done < chkIt->second.total) {
+                //With a lookahead, the connection may owe up to lookaheadTicks ticks of "done" messages.
+                const ConnClientStatus& status = chkIt->second;
+                if (status.owed + status.total - status.done > lookaheadTicks*status.total) {
                     if (EnableDebugOutput) {
-                        Print() << "connection [" <<&(*clnHandler->connHandle) << "] not done yet: " <<chkIt->second.done <<" of " <<chkIt->second.total <<"\n";
+                        Print() << "connection [" <<&(*clnHandler->connHandle) << "] not done yet: " <<status.done <<" of " <<status.total
+                                <<" (owing " <<status.owed <<")\n";
                     }
                     return false;
                 }
@@ -987,7 +1008,11 @@ void sim_mob::Broker::cleanup()
     boost::unique_lock<boost::mutex> lock(mutex_client_done_chk);
     std::map<boost::shared_ptr<sim_mob::ConnectionHandler>, ConnClientStatus>::iterator chkIt = clientDoneChecklist.begin();
     for (;chkIt!=clientDoneChecklist.end(); chkIt++) {
-        chkIt->second.done = 0;
+        //Carry over the "done" messages not yet received; late messages count towards the following ticks.
+        //The amount owed is capped, since clients that have left will never send theirs.
+        ConnClientStatus& status = chkIt->second;
+        status.owed = std::max(0, std::min(status.owed + status.total - status.done, lookaheadTicks*status.total));
+        status.done = 0;
     }
     }
 
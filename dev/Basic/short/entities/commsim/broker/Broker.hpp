@@ -161,10 +161,13 @@ protected:
     };
 
     ///Helper struct for checking if a Connection has received updates from all its Clients.
+    ///"owed" is the number of CLIENT_MESSAGES_DONE messages still expected from previous ticks; it stays at zero unless
+    ///the Broker is allowed to run ahead of its clients (see lookaheadTicks).
     struct ConnClientStatus {
         int total;
         int done;
-        ConnClientStatus() : total(0), done(0) {}
+        int owed;
+        ConnClientStatus() : total(0), done(0), owed(0) {}
     };
 
     ///A list of cloud connections by ConnectionHandler.
@@ -250,6 +253,15 @@ protected:
     std::vector<unsigned int> new_agents_message;
     boost::mutex mutex_new_agents_message;
 
+    ///If true, bundles sent to registered clients are v2 bundles, with binary messages.
+    bool binaryBundles;
+
+    ///The number of ticks the Broker may run ahead of Android clients that have not yet sent CLIENT_MESSAGES_DONE.
+    int lookaheadTicks;
+
+    ///The locations in the last "all_locations" sent to the ns-3 client. Only used with v2 bundles, which send deltas.
+    std::map<unsigned int, Point> lastAllLocations;
+
     //Broker singleton.
     //TODO: This is not really a singleton; we set/get it in various places. But we need a way of communicating the Broker to the
     //      Agents. For now, this is fine --we only need to clean this up once/if we have multiple Brokers in the system at once.
@@ -380,6 +392,7 @@ protected:
 
     /**
      *  wait for a message from all of the registered the client stating that they are done sending messages for this tick
+     *  (or, with lookaheadTicks, for the tick lookaheadTicks ticks ago)
      */
     bool allClientsAreDone();
 
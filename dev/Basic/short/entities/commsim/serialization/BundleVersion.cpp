@@ -32,7 +32,7 @@ std::string sim_mob::BundleParser::make_bundle_header_v1(const BundleHeader& hea
 {
     //TODO: We'll need a more streamlined approach for this eventually.
     unsigned char res[8];
-    res[0] = 1;
+    res[0] = header.version;
     res[1] = (unsigned char)header.sendIdLen;
     res[2] = (unsigned char)header.destIdLen;
     res[3] = (unsigned char)header.messageCount;
@@ -48,9 +48,11 @@ std::string sim_mob::BundleParser::make_bundle_header_v1(const BundleHeader& hea
 sim_mob::BundleHeader sim_mob::BundleParser::read_bundle_header_v1(const std::string& header)
 {
     //Failsafe
-    if (((unsigned char)header[0]) != 1) { throw std::runtime_error("Invalid header version."); }
+    const unsigned char version = (unsigned char)header[0];
+    if (version!=BUNDLE_VERSION_1 && version!=BUNDLE_VERSION_2) { throw std::runtime_error("Invalid header version."); }
 
     sim_mob::BundleHeader res;
+    res.version = version;
     res.sendIdLen = (unsigned char)header[1];
     res.destIdLen = (unsigned char)header[2];
     res.messageCount = (unsigned char)header[3];
@@ -22,17 +22,27 @@ const bool NEW_BUNDLES = true;
 const bool PREFER_BINARY_MESSAGES = false;
 
 ///The size of a fixed length header.
-///Fortunately, both v0 and v1 headers are 8 bytes.
+///Fortunately, v0, v1 and v2 headers are all 8 bytes.
 const unsigned int header_length = 8;
 
+///Version byte of a v1 bundle header.
+const unsigned char BUNDLE_VERSION_1 = 1;
+
+///Version byte of a v2 bundle header.
+///NOTE: v2 bundles have exactly the same layout as v1 bundles. The version only announces that the bundle's
+///      messages may be binary (see CommsimSerializer), and that "all_locations" messages are deltas against the
+///      previous "all_locations" sent to the same client. Clients must opt-in to v2 (see the "binary_bundles" setting).
+const unsigned char BUNDLE_VERSION_2 = 2;
+
 
 ///A bundle header. Some values not available in v0.
 struct BundleHeader {
-    int sendIdLen; ///<Length of the "senderID" field. (v1 only)
-    int destIdLen; ///<Length of the "destinationID" field. (v1 only)
-    int messageCount; ///<Number of messages. (v1 only)
-    unsigned int remLen; ///<Length of the remaining headers+data. (v0, v1)
-    BundleHeader() : sendIdLen(0), destIdLen(0), messageCount(0), remLen(0) {}
+    unsigned char version; ///<Version of the bundle, BUNDLE_VERSION_1 or BUNDLE_VERSION_2. (v1, v2)
+    int sendIdLen; ///<Length of the "senderID" field. (v1, v2)
+    int destIdLen; ///<Length of the "destinationID" field. (v1, v2)
+    int messageCount; ///<Number of messages. (v1, v2)
+    unsigned int remLen; ///<Length of the remaining headers+data. (v0, v1, v2)
+    BundleHeader() : version(BUNDLE_VERSION_1), sendIdLen(0), destIdLen(0), messageCount(0), remLen(0) {}
 };
 
 ///A varying-length header. Only used for v1 (follows the BundleHeader).
@@ -65,10 +75,10 @@ private:
     ///Read a "version 0" (old-style) header, returning the header struct (which only contains a valid length).
     static BundleHeader read_bundle_header_v0(const std::string& header);
 
-    ///Create a "version 1" (new-style) header.
+    ///Create a "version 1" (new-style) header. The same layout is used for "version 2" headers.
     static std::string make_bundle_header_v1(const BundleHeader& heade);
 
-    ///Read a "version 1" (new-style) header.
+    ///Read a "version 1" (new-style) or "version 2" header.
     static BundleHeader read_bundle_header_v1(const std::string& header);
 };
 
@@ -4,7 +4,9 @@
 
 #include "CommsimSerializer.hpp"
 
+#include <cstring>
 #include <sstream>
+#include <stdint.h>
 #include <boost/lexical_cast.hpp>
 
 #include "geospatial/coord/CoordinateTransform.hpp"
@@ -18,6 +20,54 @@ namespace {
 //Copies of nonary messages.
 const std::string IdAckMsg ="{\"msg_type\":\"id_ack\"}";
 
+//First byte of every binary message.
+const unsigned char BinaryMsgMarker = 0xBB;
+
+//Second byte of binary messages: the message type.
+enum BinaryMsgType {
+    BINARY_TICKED_SIMMOB = 1,
+    BINARY_LOCATION = 2,
+    BINARY_ALL_LOCATIONS = 3,
+};
+
+//Helpers for writing binary messages.
+void writeBinaryHeader(std::string& res, BinaryMsgType type)
+{
+    res.push_back(static_cast<char>(BinaryMsgMarker));
+    res.push_back(static_cast<char>(type));
+}
+
+void writeUInt32(std::string& res, uint32_t val)
+{
+    res.push_back(static_cast<char>((val>>24)&0xFF));
+    res.push_back(static_cast<char>((val>>16)&0xFF));
+    res.push_back(static_cast<char>((val>>8)&0xFF));
+    res.push_back(static_cast<char>(val&0xFF));
+}
+
+void writeDouble(std::string& res, double val)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    writeUInt32(res, static_cast<uint32_t>(bits>>32));
+    writeUInt32(res, static_cast<uint32_t>(bits&0xFFFFFFFF));
+}
+
+void writeVarUInt(std::string& res, uint64_t val)
+{
+    while (val >= 0x80) {
+        res.push_back(static_cast<char>((val&0x7F)|0x80));
+        val >>= 7;
+    }
+    res.push_back(static_cast<char>(val));
+}
+
+void writeVarInt(std::string& res, int64_t val)
+{
+    //Zig-zag encoding, so that small negative deltas are small too.
+    writeVarUInt(res, (static_cast<uint64_t>(val)<<1) ^ static_cast<uint64_t>(val>>63));
+}
+
 } //End un-named namespace
 
 
@@ -128,8 +178,9 @@ void sim_mob::MessageConglomerate::setSenderId(const std::string& id)
 }
 
 
-void sim_mob::CommsimSerializer::serialize_begin(OngoingSerialization& ongoing, const std::string& destAgId)
+void sim_mob::CommsimSerializer::serialize_begin(OngoingSerialization& ongoing, const std::string& destAgId, unsigned char version)
 {
+    ongoing.version = version;
     ongoing.vHead.sendId = "0"; //SimMobility is always ID 0.
     ongoing.vHead.destId = destAgId;
     ongoing.vHead.msgLengths.clear();
@@ -175,6 +226,7 @@ void sim_mob::CommsimSerializer::serialize_end_v1(const OngoingSerialization& on
     res = std::string(reinterpret_cast<char*>(vHead), varHeadSize) + ongoing.messages.str();
 
     //Reflect changes to the bundle header.
+    hRes.version = ongoing.version;
     hRes.sendIdLen = ongoing.vHead.sendId.size();
     hRes.destIdLen = ongoing.vHead.destId.size();
     hRes.messageCount = ongoing.vHead.msgLengths.size();
@@ -475,7 +527,7 @@ std::string sim_mob::CommsimSerializer::makeIdAck()
 std::string sim_mob::CommsimSerializer::makeTickedSimMob(unsigned int tick, unsigned int elapsedMs)
 {
     if (PREFER_BINARY_MESSAGES) {
-        throw std::runtime_error("addX() binary format not yet supported.");
+        return makeTickedSimMobBinary(tick, elapsedMs);
     } else {
         std::stringstream res;
         res <<"{\"msg_type\":\"ticked_simmob\",\"tick\":" <<tick <<",\"elapsed\":" <<elapsedMs <<"}";
@@ -485,10 +537,21 @@ std::string sim_mob::CommsimSerializer::makeTickedSimMob(unsigned int tick, unsi
 
 
 
+std::string sim_mob::CommsimSerializer::makeTickedSimMobBinary(unsigned int tick, unsigned int elapsedMs)
+{
+    std::string res;
+    res.reserve(10);
+    writeBinaryHeader(res, BINARY_TICKED_SIMMOB);
+    writeUInt32(res, tick);
+    writeUInt32(res, elapsedMs);
+    return res;
+}
+
+
 std::string sim_mob::CommsimSerializer::makeLocation(int x, int y, const LatLngLocation& projected)
 {
     if (PREFER_BINARY_MESSAGES) {
-        throw std::runtime_error("addX() binary format not yet supported.");
+        return makeLocationBinary(x, y, projected);
     } else {
         std::stringstream res;
         res <<"{\"msg_type\":\"location\",\"x\":" <<x <<",\"y\":" <<y
@@ -498,6 +561,19 @@ std::string sim_mob::CommsimSerializer::makeLocation(int x, int y, const LatLngL
 }
 
 
+std::string sim_mob::CommsimSerializer::makeLocationBinary(int x, int y, const LatLngLocation& projected)
+{
+    std::string res;
+    res.reserve(26);
+    writeBinaryHeader(res, BINARY_LOCATION);
+    writeUInt32(res, static_cast<uint32_t>(x));
+    writeUInt32(res, static_cast<uint32_t>(y));
+    writeDouble(res, projected.latitude);
+    writeDouble(res, projected.longitude);
+    return res;
+}
+
+
 
 std::string sim_mob::CommsimSerializer::makeRegionsAndPath(const std::vector<sim_mob::RoadRunnerRegion>& all_regions, const std::vector<sim_mob::RoadRunnerRegion>& region_path)
 {
@@ -561,7 +637,8 @@ std::string sim_mob::CommsimSerializer::makeNewAgents(const std::vector<unsigned
 std::string sim_mob::CommsimSerializer::makeAllLocations(const std::map<unsigned int, Point>& allLocations)
 {
     if (PREFER_BINARY_MESSAGES) {
-        throw std::runtime_error("addX() binary format not yet supported.");
+        //Without the previous locations, the delta is a full snapshot.
+        return makeAllLocationsDelta(allLocations, std::map<unsigned int, Point>());
     } else {
         std::stringstream res;
         res <<"{\"msg_type\":\"all_locations\",\"locations\":[";
@@ -581,6 +658,56 @@ std::string sim_mob::CommsimSerializer::makeAllLocations(const std::map<unsigned
 
 
 
+
+std::string sim_mob::CommsimSerializer::makeAllLocationsDelta(const std::map<unsigned int, Point>& allLocations, const std::map<unsigned int, Point>& prevLocations)
+{
+    //Both maps are sorted by ID, so they can be merged in a single pass.
+    std::string changed;
+    std::string removed;
+    size_t numChanged = 0;
+    size_t numRemoved = 0;
+    std::map<unsigned int, Point>::const_iterator prevIt = prevLocations.begin();
+    for (std::map<unsigned int, Point>::const_iterator it=allLocations.begin(); it!=allLocations.end(); it++) {
+        //Agents that are no longer registered.
+        for (; prevIt!=prevLocations.end() && prevIt->first<it->first; prevIt++) {
+            writeVarUInt(removed, prevIt->first);
+            numRemoved++;
+        }
+
+        int64_t dx = static_cast<int64_t>(it->second.getX());
+        int64_t dy = static_cast<int64_t>(it->second.getY());
+        if (prevIt!=prevLocations.end() && prevIt->first==it->first) {
+            dx -= static_cast<int64_t>(prevIt->second.getX());
+            dy -= static_cast<int64_t>(prevIt->second.getY());
+            prevIt++;
+
+            //Unchanged agents are not sent.
+            if (dx==0 && dy==0) {
+                continue;
+            }
+        }
+
+        writeVarUInt(changed, it->first);
+        writeVarInt(changed, dx);
+        writeVarInt(changed, dy);
+        numChanged++;
+    }
+    for (; prevIt!=prevLocations.end(); prevIt++) {
+        writeVarUInt(removed, prevIt->first);
+        numRemoved++;
+    }
+
+    //Combine.
+    std::string res;
+    res.reserve(2 + 10 + changed.size() + 10 + removed.size());
+    writeBinaryHeader(res, BINARY_ALL_LOCATIONS);
+    writeVarUInt(res, numChanged);
+    res += changed;
+    writeVarUInt(res, numRemoved);
+    res += removed;
+    return res;
+}
+
 std::string sim_mob::CommsimSerializer::makeOpaqueSend(const std::string& fromId, const std::vector<std::string>& toIds, const std::string& format, const std::string& tech, bool broadcast, const std::string& data)
 {
     if (PREFER_BINARY_MESSAGES) {
@@ -114,14 +114,15 @@ private:
  */
 class OngoingSerialization {
 public:
-    OngoingSerialization() {}
+    OngoingSerialization() : version(BUNDLE_VERSION_1) {}
 
     //Inefficient, but needed
-    OngoingSerialization(const OngoingSerialization& other) : vHead(other.vHead) {
+    OngoingSerialization(const OngoingSerialization& other) : version(other.version), vHead(other.vHead) {
         messages.str(other.messages.str());
     }
 
 private:
+    unsigned char version; ///<The bundle version (v1 or v2) written in the header by serialize_end().
     VaryHeader vHead;
     std::stringstream messages;  //For v1, it's just the messages one after another. For v0, it's, e.g., "{m1},{m2},{m3}".
 
@@ -136,6 +137,17 @@ private:
  * The former set of functions are named as "parseX()" and "makeX()".
  * The latter set of functions are named "serialize()" and "deserialize()", with variants for when a single message is expeted.
  *
+ * Binary messages (v2 bundles) start with the byte 0xBB, followed by a byte identifying the message type. The remaining
+ *   fields are big-endian; "varint" fields use 7 bits per byte (least significant group first, high bit set on all
+ *   bytes but the last), and signed varints are zig-zag encoded first. The binary messages are:
+ *   ticked_simmob (1): tick (4 bytes), elapsed (4 bytes)
+ *   location (2): x (4 bytes, signed), y (4 bytes, signed), lat (8 bytes, IEEE double), lng (8 bytes, IEEE double)
+ *   all_locations (3): count (varint), count*{id (varint), dx (signed varint), dy (signed varint)},
+ *                      removed count (varint), removed count*{id (varint)}
+ *   The all_locations message only lists the agents whose location changed since the previous all_locations sent to
+ *   the client; (dx,dy) is relative to that previous location, or to (0,0) for agents not sent before. Removed agents
+ *   were in the previous all_locations, but are no longer registered.
+ *
  * TODO: This class is almost entirely duplicated in our ns-3 module. We should extract it into a library and compile it in
  *       statically to Sim Mobility/ns-3 (and put it in a public repository) once it's stable.
  */
@@ -146,9 +158,10 @@ public:
     ///Begin serialization of a series of messages. Call this once, followed by several calls to makeX(), followed by serialize_end().
     ///\param ongoing The current OngoingSerialization object (created with the default constructor).
     ///\param destAgId The ID of the client receiving this message bundle.
+    ///\param version The bundle version; BUNDLE_VERSION_2 if the bundle may contain binary messages. Ignored for v0.
     ///TODO: We can improve efficiency by taking in the total message count, senderID, and destID, and partially building the varying header here.
     ///      We would need to add dummy characters for the message lengths, and then overwrite them later during serialize_end().
-    static void serialize_begin(OngoingSerialization& ongoing, const std::string& destAgId);
+    static void serialize_begin(OngoingSerialization& ongoing, const std::string& destAgId, unsigned char version=BUNDLE_VERSION_1);
 
     ///Finish serialization of a series of messages. See serialize_begin() for usage.
     ///\param ongoing The current OngoingSerialization object.
@@ -206,9 +219,15 @@ public:
     ///Serialize "ticked_simmob" to a string.
     static std::string makeTickedSimMob(unsigned int tick, unsigned int elapsedMs);
 
+    ///Serialize "ticked_simmob" to a binary string (v2 bundles only).
+    static std::string makeTickedSimMobBinary(unsigned int tick, unsigned int elapsedMs);
+
     ///Serialize "location" to a string.
     static std::string makeLocation(int x, int y, const LatLngLocation& projected);
 
+    ///Serialize "location" to a binary string (v2 bundles only).
+    static std::string makeLocationBinary(int x, int y, const LatLngLocation& projected);
+
     ///Serialize "regions_and_path" to a string.
     static std::string makeRegionsAndPath(const std::vector<sim_mob::RoadRunnerRegion>& all_regions, const std::vector<sim_mob::RoadRunnerRegion>& region_path);
 
@@ -218,6 +237,12 @@ public:
     ///Serialize "all_locations" to a string.
     static std::string makeAllLocations(const std::map<unsigned int, Point>& allLocations);
 
+    ///Serialize "all_locations" to a binary string (v2 bundles only), containing only the changes since the
+    ///  previous "all_locations" sent to the same client.
+    ///\param allLocations The current location of each agent, by agent ID.
+    ///\param prevLocations The locations in the previous "all_locations" sent to the client (empty if none was sent).
+    static std::string makeAllLocationsDelta(const std::map<unsigned int, Point>& allLocations, const std::map<unsigned int, Point>& prevLocations);
+
     ///Serialize "opaque_send" to a string.
     static std::string makeOpaqueSend(const std::string& fromId, const std::vector<std::string>& toIds, const std::string& format, const std::string& tech, bool broadcast, const std::string& data);
 
@@ -4,6 +4,7 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/thread/mutex.hpp>
 #include <cmath>
 #include <map>
 
@@ -49,8 +50,6 @@ double MITSIM_IntDriving_Model::getImpatienceFactor() const
 
 void MITSIM_IntDriving_Model::readDriverParameters(DriverUpdateParams &params)
 {
-    string modelName = "general_driver_model";
-    string critical_gap_addon;
     bool isAMOD = false;
 
     //Check if the vehicle is autonomous
@@ -59,15 +58,45 @@ void MITSIM_IntDriving_Model::readDriverParameters(DriverUpdateParams &params)
         isAMOD = true;
     }
 
-    //Get the parameter manager instance for the respective type of vehicle (normal or AMOD)
-    ParameterManager *parameterMgr = ParameterManager::Instance(isAMOD);
+    //Get the parameters for the respective type of vehicle (normal or AMOD)
+    boost::shared_ptr<const Parameters> parameters = getParameters(isAMOD);
+
+    intersectionAttentivenessFactorMin = parameters->intersectionAttentivenessFactorMin;
+    intersectionAttentivenessFactorMax = parameters->intersectionAttentivenessFactorMax;
+    minimumGap = parameters->minimumGap;
+    criticalGapAddOn[0] = parameters->criticalGapAddOn[0];
+    criticalGapAddOn[1] = parameters->criticalGapAddOn[1];
+    impatienceFactor = parameters->impatienceFactor;
+}
+
+boost::shared_ptr<const MITSIM_IntDriving_Model::Parameters> MITSIM_IntDriving_Model::getParameters(bool isAMOD)
+{
+    static boost::mutex parametersMutex;
+    static boost::shared_ptr<const Parameters> sharedParameters[2];
+
+    boost::mutex::scoped_lock lock(parametersMutex);
+    boost::shared_ptr<const Parameters> &result = sharedParameters[isAMOD ? 1 : 0];
+
+    if (!result)
+    {
+        result = readParameters(ParameterManager::Instance(isAMOD));
+    }
+
+    return result;
+}
+
+boost::shared_ptr<const MITSIM_IntDriving_Model::Parameters> MITSIM_IntDriving_Model::readParameters(ParameterManager *parameterMgr)
+{
+    boost::shared_ptr<Parameters> p(new Parameters());
+    string modelName = "general_driver_model";
+    string critical_gap_addon;
 
     //Read the parameter values
-    parameterMgr->param(modelName, "intersection_attentiveness_factor_min", intersectionAttentivenessFactorMin, 1.0);
-    parameterMgr->param(modelName, "intersection_attentiveness_factor_max", intersectionAttentivenessFactorMax, 3.0);
-    parameterMgr->param(modelName, "minimum_gap", minimumGap, 0.0);
+    parameterMgr->param(modelName, "intersection_attentiveness_factor_min", p->intersectionAttentivenessFactorMin, 1.0);
+    parameterMgr->param(modelName, "intersection_attentiveness_factor_max", p->intersectionAttentivenessFactorMax, 3.0);
+    parameterMgr->param(modelName, "minimum_gap", p->minimumGap, 0.0);
     parameterMgr->param(modelName, "critical_gap_addon", critical_gap_addon, string("0.0 2.5"));
-    parameterMgr->param(modelName, "impatience_factor", impatienceFactor, 0.2);
+    parameterMgr->param(modelName, "impatience_factor", p->impatienceFactor, 0.2);
 
     //Vector to store the tokenized parameters
     std::vector<string> gapAddonParams;
@@ -96,11 +125,13 @@ void MITSIM_IntDriving_Model::readDriverParameters(DriverUpdateParams &params)
             throw std::runtime_error(str.str());
         }
 
-        criticalGapAddOn[index] = res;
+        p->criticalGapAddOn[index] = res;
 
         ++index;
         ++itStr;
     }
+
+    return p;
 }
 
 double MITSIM_IntDriving_Model::calcBrakeToStopAcc(double distance, DriverUpdateParams &params)
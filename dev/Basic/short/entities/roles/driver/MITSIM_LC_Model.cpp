@@ -3,6 +3,7 @@
 //   license.txt   (http://opensource.org/licenses/MIT)
 
 #include <boost/random.hpp>
+#include <boost/thread/mutex.hpp>
 #include <limits>
 
 #include "Driver.hpp"
@@ -44,7 +45,6 @@ MITSIM_LC_Model::~MITSIM_LC_Model()
 
 void MITSIM_LC_Model::readDriverParameters(DriverUpdateParams &params)
 {
-    std::string str;
     bool isAMOD = false;
 
     if (params.driver->getParent()->amodId != "-1")
@@ -52,11 +52,42 @@ void MITSIM_LC_Model::readDriverParameters(DriverUpdateParams &params)
         isAMOD = true;
     }
 
-    ParameterManager *parameterMgr = ParameterManager::Instance(isAMOD);
+    parameters = getParameters(isAMOD);
+
+    params.LC_GAP_MODELS = parameters->LC_GAP_MODELS;
+    params.nosingParams = parameters->nosingParams;
+    params.lcMaxYieldingTime = parameters->lcMaxYieldingTime;
+    params.targetGapParams = parameters->targetGapParams;
+    params.stopVisibilityDistance = parameters->stopVisibilityDistance;
+
+    //Driver look ahead distance
+    lookAheadDistance = mlcDistance();
+}
+
+boost::shared_ptr<const MITSIM_LC_Model::Parameters> MITSIM_LC_Model::getParameters(bool isAMOD)
+{
+    static boost::mutex parametersMutex;
+    static boost::shared_ptr<const Parameters> sharedParameters[2];
+
+    boost::mutex::scoped_lock lock(parametersMutex);
+    boost::shared_ptr<const Parameters> &result = sharedParameters[isAMOD ? 1 : 0];
+
+    if (!result)
+    {
+        result = readParameters(ParameterManager::Instance(isAMOD));
+    }
+
+    return result;
+}
+
+boost::shared_ptr<const MITSIM_LC_Model::Parameters> MITSIM_LC_Model::readParameters(ParameterManager *parameterMgr)
+{
+    boost::shared_ptr<Parameters> p(new Parameters());
+    std::string str;
 
     //MLC_PARAMETERS
     parameterMgr->param(modelName, "MLC_PARAMETERS", str, string("1320.0  5280.0 0.5 1.0  1.0"));
-    makeMLCParam(str);
+    makeMLCParam(*p, str);
 
     //LC_GAP_MODELS
     std::vector< std::string > strArray;
@@ -76,7 +107,7 @@ void MITSIM_LC_Model::readDriverParameters(DriverUpdateParams &params)
     strArray.push_back(str);
     parameterMgr->param(modelName, "LC_GAP_MODELS_7", str, string("0.20, 0.0, 0.000, 0.587, 0.000, 0.000, 0.048, 0.356, 1.073"));
     strArray.push_back(str);
-    makeCriticalGapParams(params, strArray);
+    makeCriticalGapParams(*p, strArray);
 
     //GAP_PARAM
     strArray.clear();
@@ -86,50 +117,49 @@ void MITSIM_LC_Model::readDriverParameters(DriverUpdateParams &params)
     strArray.push_back(str);
     parameterMgr->param(modelName, "GAP_PARAM_2", str, string("-0.772, -0.482, 0.224, -0.0179, 2.10, 0.675"));
     strArray.push_back(str);
-    makeTargetGapPram(strArray);
+    makeTargetGapPram(*p, strArray);
 
     //Minimum speed
-    parameterMgr->param(modelName, "min_speed", minSpeed, 0.1);
-
-    //Driver look ahead distance
-    lookAheadDistance = mlcDistance();
+    parameterMgr->param(modelName, "min_speed", p->minSpeed, 0.1);
 
     //Lane Utility parameters
     parameterMgr->param(modelName, "lane_utility_model", str, string("3.9443 -0.3213  -1.1683  -1.1683 0.0 0.0633 -1.0 0.0058 -0.2664 -0.0088 -3.3754 10 19 -2.3400 -4.5084 -2.8257 -1.2597 -0.7239 -0.3269"));
-    makeLaneUtilityParams(str);
+    makeLaneUtilityParams(*p, str);
 
     //Critical gap parameters
     parameterMgr->param(modelName, "critical_gaps_param", str, string("0.5 -0.231  -2.700  1.112    0.5   0.000 0.2  0.742   6.0"));
-    makeCriticalGapParams(str);
+    makeCriticalGapParams(*p, str);
 
     //Nosing parameters
     parameterMgr->param(modelName, "nosing_param", str, string("1.0 0.5  0.6  0.1   0.2   1.0 300.0  180.0   600.0 40.0"));
-    makeNosingParams(params, str);
+    makeNosingParams(*p, str);
 
     parameterMgr->param(modelName, "MLC_Yielding_Probabilities", str, string("0.13 0.71  0.13  0.03"));
-    makeLC_YieldingProbabilities(str);
+    makeLC_YieldingProbabilities(*p, str);
 
     //Kazi Nosing parameters
     parameterMgr->param(modelName, "kazi_nosing_param", str, string("-3.159  0.313  -0.027  2.050  0.028  0.6"));
-    makeKaziNosingParams(str);
+    makeKaziNosingParams(*p, str);
 
     //CF_CRITICAL_TIMER_RATIO
-    parameterMgr->param(modelName, "CF_CRITICAL_TIMER_RATIO", CF_CRITICAL_TIMER_RATIO, 0.5);
+    parameterMgr->param(modelName, "CF_CRITICAL_TIMER_RATIO", p->CF_CRITICAL_TIMER_RATIO, 0.5);
 
     //LC Yielding Model
     parameterMgr->param(modelName, "LC_Yielding_Model", str, string("0.80 1.0"));
 
     //Minimum time in lane in same direction
-    parameterMgr->param(modelName, "LC_Discretionary_Lane_Change_Model_MinTimeInLaneSameDir", minTimeInLaneSameDir, 2.0);
+    parameterMgr->param(modelName, "LC_Discretionary_Lane_Change_Model_MinTimeInLaneSameDir", p->minTimeInLaneSameDir, 2.0);
 
     //Minimum time in lane in different direction
-    parameterMgr->param(modelName, "LC_Discretionary_Lane_Change_Model_MinTimeInLaneDiffDir", minTimeInLaneDiffDir, 2.0);
+    parameterMgr->param(modelName, "LC_Discretionary_Lane_Change_Model_MinTimeInLaneDiffDir", p->minTimeInLaneDiffDir, 2.0);
 
     //Target Gap Model
     parameterMgr->param(modelName, "Target_Gap_Model", str, string("-0.837   0.913  0.816  -1.218  -2.393  -1.662"));
-    Utils::convertStringToArray(str, params.targetGapParams);
+    Utils::convertStringToArray(str, p->targetGapParams);
 
-    parameterMgr->param(modelName, "check_stop_point_distance", params.stopVisibilityDistance, 100.0);
+    parameterMgr->param(modelName, "check_stop_point_distance", p->stopVisibilityDistance, 100.0);
+
+    return p;
 }
 
 double MITSIM_LC_Model::calcCriticalGapKaziModel(DriverUpdateParams &params, int type, double distance, double diffInSpeed)
@@ -438,62 +468,62 @@ double MITSIM_LC_Model::gapExpOfUtility(DriverUpdateParams &params, int n, float
     return exp(u);
 }
 
-void MITSIM_LC_Model::makeMLCParam(std::string &str)
+void MITSIM_LC_Model::makeMLCParam(Parameters &p, std::string &str)
 {
     std::vector<double> array;
     Utils::convertStringToArray(str, array);
-    MLC_PARAMETERS.lowbound = array[0];
-    MLC_PARAMETERS.delta = array[1];
-    MLC_PARAMETERS.lane_mintime = array[2];
+    p.MLC_PARAMETERS.lowbound = array[0];
+    p.MLC_PARAMETERS.delta = array[1];
+    p.MLC_PARAMETERS.lane_mintime = array[2];
 }
 
-void MITSIM_LC_Model::makeCriticalGapParams(DriverUpdateParams &params, std::vector<std::string> &strMatrix)
+void MITSIM_LC_Model::makeCriticalGapParams(Parameters &p, std::vector<std::string> &strMatrix)
 {
     for (int i = 0; i < strMatrix.size(); ++i)
     {
         std::vector<double> array;
         Utils::convertStringToArray(strMatrix[i], array);
-        params.LC_GAP_MODELS.push_back(array);
+        p.LC_GAP_MODELS.push_back(array);
     }
 }
 
-void MITSIM_LC_Model::makeTargetGapPram(std::vector<std::string> &strMatrix)
+void MITSIM_LC_Model::makeTargetGapPram(Parameters &p, std::vector<std::string> &strMatrix)
 {
     for (int i = 0; i < strMatrix.size(); ++i)
     {
         std::vector<double> array;
         Utils::convertStringToArray(strMatrix[i], array);
-        GAP_PARAM.push_back(array);
+        p.GAP_PARAM.push_back(array);
     }
 }
 
-void MITSIM_LC_Model::makeLaneUtilityParams(std::string &str)
+void MITSIM_LC_Model::makeLaneUtilityParams(Parameters &p, std::string &str)
 {
-    Utils::convertStringToArray(str, laneUtilityParams);
+    Utils::convertStringToArray(str, p.laneUtilityParams);
 }
 
-void MITSIM_LC_Model::makeNosingParams(DriverUpdateParams &params, string &str)
+void MITSIM_LC_Model::makeNosingParams(Parameters &p, string &str)
 {
-    Utils::convertStringToArray(str, params.nosingParams);
-    lcMaxNosingDis = params.nosingParams[8];
-    lcMaxStuckTime = params.nosingParams[7];
-    lcNosingConstStateTime = params.nosingParams[0];
-    params.lcMaxYieldingTime = params.nosingParams[6];
+    Utils::convertStringToArray(str, p.nosingParams);
+    p.lcMaxNosingDis = p.nosingParams[8];
+    p.lcMaxStuckTime = p.nosingParams[7];
+    p.lcNosingConstStateTime = p.nosingParams[0];
+    p.lcMaxYieldingTime = p.nosingParams[6];
 }
 
-void MITSIM_LC_Model::makeKaziNosingParams(string &str)
+void MITSIM_LC_Model::makeKaziNosingParams(Parameters &p, string &str)
 {
-    Utils::convertStringToArray(str, kaziNosingParams);
+    Utils::convertStringToArray(str, p.kaziNosingParams);
 }
 
-void MITSIM_LC_Model::makeLC_YieldingProbabilities(string &str)
+void MITSIM_LC_Model::makeLC_YieldingProbabilities(Parameters &p, string &str)
 {
-    Utils::convertStringToArray(str, lcYieldingProb);
+    Utils::convertStringToArray(str, p.lcYieldingProb);
 }
 
-void MITSIM_LC_Model::makeCriticalGapParams(std::string &str)
+void MITSIM_LC_Model::makeCriticalGapParams(Parameters &p, std::string &str)
 {
-    Utils::convertStringToArray(str, criticalGapParams);
+    Utils::convertStringToArray(str, p.criticalGapParams);
 }
 
 LaneChangeTo MITSIM_LC_Model::checkForLC_WithLookAhead(DriverUpdateParams &params)
@@ -631,12 +661,12 @@ int MITSIM_LC_Model::isReadyForNextDLC(DriverUpdateParams &params, int mode)
     {
     case 1: // request a change to the right
     {
-        if (params.flag(FLAG_PREV_LC_RIGHT) && sec > minTimeInLaneSameDir)
+        if (params.flag(FLAG_PREV_LC_RIGHT) && sec > parameters->minTimeInLaneSameDir)
         {
             params.lcDebugStr << ";1i0";
             return 1;
         }
-        else if (sec > minTimeInLaneDiffDir)
+        else if (sec > parameters->minTimeInLaneDiffDir)
         {
             params.lcDebugStr << ";1i1";
             return 1;
@@ -649,12 +679,12 @@ int MITSIM_LC_Model::isReadyForNextDLC(DriverUpdateParams &params, int mode)
     }
     case 2: // request a change to the left
     {
-        if (params.flag(FLAG_PREV_LC_LEFT) && sec > minTimeInLaneSameDir)
+        if (params.flag(FLAG_PREV_LC_LEFT) && sec > parameters->minTimeInLaneSameDir)
         {
             params.lcDebugStr << ";2i0";
             return 1;
         }
-        else if (sec > minTimeInLaneDiffDir)
+        else if (sec > parameters->minTimeInLaneDiffDir)
         {
             params.lcDebugStr << ";2i1";
             return 1;
@@ -666,7 +696,7 @@ int MITSIM_LC_Model::isReadyForNextDLC(DriverUpdateParams &params, int mode)
         }
     }
     }
-    return sec > minTimeInLaneSameDir;
+    return sec > parameters->minTimeInLaneSameDir;
 }
 
 int MITSIM_LC_Model::getNumberOfLCToEndOfLink(DriverUpdateParams &params, const Lane *currLane)
@@ -726,7 +756,7 @@ int MITSIM_LC_Model::getNumberOfLCToEndOfLink(DriverUpdateParams &params, const
 double MITSIM_LC_Model::lcUtilityCurrent(DriverUpdateParams &params)
 {
     // 1.0 lane utility parameters
-    vector<double> a = laneUtilityParams;
+    vector<double> a = parameters->laneUtilityParams;
 
     // 2.0 LEADING AND LAG VEHICLES
     const NearestVehicle * av = &params.nvFwd;
@@ -812,7 +842,7 @@ double MITSIM_LC_Model::lcUtilityCurrent(DriverUpdateParams &params)
 double MITSIM_LC_Model::lcUtilityRight(DriverUpdateParams &params)
 {
     // 1.0 lane utility parameters
-    vector<double> a = laneUtilityParams;
+    vector<double> a = parameters->laneUtilityParams;
 
     // 2.0 LEADING AND LAG VEHICLES
     const NearestVehicle * av = &params.nvRightFwd;
@@ -898,7 +928,7 @@ double MITSIM_LC_Model::lcUtilityRight(DriverUpdateParams &params)
 double MITSIM_LC_Model::lcUtilityLeft(DriverUpdateParams &params)
 {
     // 1.0 lane utility parameters
-    vector<double> a = laneUtilityParams;
+    vector<double> a = parameters->laneUtilityParams;
 
     // 2.0 LEADING AND LAG VEHICLES
     const NearestVehicle *leftFwdVeh = &params.nvLeftFwd;
@@ -972,7 +1002,7 @@ double MITSIM_LC_Model::lcUtilityLeft(DriverUpdateParams &params)
 
 double MITSIM_LC_Model::lcUtilityLookAheadLeft(DriverUpdateParams &params, int noOfChanges, float lcDistance)
 {
-    vector<double> a = laneUtilityParams;
+    vector<double> a = parameters->laneUtilityParams;
     double vld, mlc, density, spacing;
 
     density = 0;
@@ -1054,7 +1084,7 @@ double MITSIM_LC_Model::lcUtilityLookAheadLeft(DriverUpdateParams &params, int n
 
 double MITSIM_LC_Model::lcUtilityLookAheadRight(DriverUpdateParams &params, int noOfChanges, float lcDistance)
 {
-    vector<double> a = laneUtilityParams;
+    vector<double> a = parameters->laneUtilityParams;
     double vld, mlc, density, spacing;
 
     density = 0.0;
@@ -1146,7 +1176,7 @@ double MITSIM_LC_Model::lcUtilityLookAheadRight(DriverUpdateParams &params, int
 
 double MITSIM_LC_Model::lcUtilityLookAheadCurrent(DriverUpdateParams &params, int noOfChanges, float lcDistance)
 {
-    vector<double> a = laneUtilityParams;
+    vector<double> a = parameters->laneUtilityParams;
     double vld, mlc, density, spacing;
 
     density = params.density;
@@ -1245,7 +1275,7 @@ double MITSIM_LC_Model::lcUtilityLookAheadCurrent(DriverUpdateParams &params, in
 
 double MITSIM_LC_Model::lcCriticalGap(DriverUpdateParams &params, int type, double dv)
 {
-    vector<double> a = criticalGapParams;
+    vector<double> a = parameters->criticalGapParams;
 
     float dvNegative = (dv < 0) ? dv : 0.0;
     float dvPositive = (dv > 0) ? dv : 0.0;
@@ -1278,7 +1308,7 @@ double MITSIM_LC_Model::lcCriticalGap(DriverUpdateParams &params, int type, doub
 double MITSIM_LC_Model::mlcDistance()
 {
     double n = Utils::generateFloat(0, 1.0);
-    double dis = MLC_PARAMETERS.lowbound + n * (MLC_PARAMETERS.delta - MLC_PARAMETERS.lowbound);
+    double dis = parameters->MLC_PARAMETERS.lowbound + n * (parameters->MLC_PARAMETERS.delta - parameters->MLC_PARAMETERS.lowbound);
     return dis;
 }
 
@@ -1288,7 +1318,7 @@ LaneChangeTo MITSIM_LC_Model::makeLaneChangingDecision(DriverUpdateParams &param
     params.lcDebugStr << "makeD" << params.now.frame();
     params.noOfLC = 0;
     
-    if(params.desiredSpeed < minSpeed)
+    if(params.desiredSpeed < parameters->minSpeed)
     {
         params.lcDebugStr << ";samesm";
         return LANE_CHANGE_TO_NONE;
@@ -1466,7 +1496,7 @@ double MITSIM_LC_Model::executeLaneChanging(DriverUpdateParams &params)
 
         int nosing = params.flag(FLAG_NOSING);
         params.lcDebugStr << ";LCF" << nosing << ";ds" << params.distToStop;
-        if (!nosing && params.distToStop < lcMaxNosingDis)
+        if (!nosing && params.distToStop < parameters->lcMaxNosingDis)
         {
             params.lcDebugStr << ";NDis";
             int nlanes = params.noOfLC;
@@ -1503,7 +1533,7 @@ double MITSIM_LC_Model::executeLaneChanging(DriverUpdateParams &params)
             params.lcDebugStr << ";nig";
             
             // Since I am nosing, updating of acceleration rate sooner
-            params.reactionTimeCounter = CF_CRITICAL_TIMER_RATIO * params.nextStepSize;
+            params.reactionTimeCounter = parameters->CF_CRITICAL_TIMER_RATIO * params.nextStepSize;
             
             // Now I am going to nose in provided it is feasible and the
             // lag vehicle is willing to yield
@@ -1591,7 +1621,7 @@ int MITSIM_LC_Model::checkNosingFeasibility(DriverUpdateParams &params, const Ne
     if (params.flag(FLAG_STUCK_AT_END))
     {
         params.lcDebugStr << ";stuck";
-        if (timeSinceTagged(params) > lcMaxStuckTime)
+        if (timeSinceTagged(params) > parameters->lcMaxStuckTime)
         {
             //If stuck for a very long time, skip the feasibility check
             params.lcDebugStr << ";max";        
@@ -1633,7 +1663,7 @@ int MITSIM_LC_Model::checkNosingFeasibility(DriverUpdateParams &params, const Ne
             params.lcDebugStr << ";CF5";
 
             // Acceleration rate in order to be slower than the leader
-            upper = (fwdVehicle->driver->getFwdVelocity() - params.currSpeed) / lcNosingConstStateTime + fwdVehicle->driver->getFwdAcceleration();
+            upper = (fwdVehicle->driver->getFwdVelocity() - params.currSpeed) / parameters->lcNosingConstStateTime + fwdVehicle->driver->getFwdAcceleration();
             params.lcDebugStr << ";up" << upper;
 
             if (upper < params.maxDeceleration)
@@ -1666,7 +1696,7 @@ int MITSIM_LC_Model::checkNosingFeasibility(DriverUpdateParams &params, const Ne
             // Acceleration rate in order to be faster than the lag
             // vehicle and do not cause the lag vehicle to decelerate
             // harder than its normal deceleration rate
-            lower = (rearVehicle->driver->getFwdVelocity() - params.currSpeed) / lcNosingConstStateTime + params.normalDeceleration;
+            lower = (rearVehicle->driver->getFwdVelocity() - params.currSpeed) / parameters->lcNosingConstStateTime + params.normalDeceleration;
 
             if (lower > params.maxAcceleration)
             {
@@ -1694,7 +1724,7 @@ int MITSIM_LC_Model::checkNosingFeasibility(DriverUpdateParams &params, const Ne
             // Acceleration rate in order to be faster than the lag
             // vehicle and do not cause the lag vehicle to decelerate
             // harder than its normal deceleration rate
-            lower = (rearVehicle->driver->getFwdVelocity() - params.currSpeed) / lcNosingConstStateTime + params.normalDeceleration;
+            lower = (rearVehicle->driver->getFwdVelocity() - params.currSpeed) / parameters->lcNosingConstStateTime + params.normalDeceleration;
             params.lcDebugStr << ";low" << lower;
 
             if (lower > params.maxAcceleration)
@@ -1734,7 +1764,7 @@ float MITSIM_LC_Model::lcNosingProbability(float distance, float diffInSpeed, fl
         num = 1;
     }
 
-    std::vector<double> b = kaziNosingParams;
+    std::vector<double> b = parameters->kaziNosingParams;
     float rel_spd = (diffInSpeed > 0) ? 0 : diffInSpeed;
     float rm_dist_impact = 10 - 10 / (1.0 + exp(b[2] * distance));
 
@@ -1890,7 +1920,7 @@ int MITSIM_LC_Model::checkForEventsAhead(DriverUpdateParams& params)
     }
 
     // 3.0 MLC is required and not enough headway, set STATUS_MANDATORY
-    if (needMLC && params.distToStop < lookAheadDistance && timeSinceTagged(params) >= MLC_PARAMETERS.lane_mintime)
+    if (needMLC && params.distToStop < lookAheadDistance && timeSinceTagged(params) >= parameters->MLC_PARAMETERS.lane_mintime)
     {
         params.setStatus(STATUS_MANDATORY);
     }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <boost/random.hpp>
+#include <boost/shared_ptr.hpp>
 #include <map>
 #include <set>
 #include <string>
@@ -108,106 +109,143 @@ private:
         double stddev;
     };
 
-    /**The upper bound on the maximum acceleration*/
-    int maxAccUpperBound;
+    /**
+     * The car following model parameters read from the driver parameters XML file. They do not depend on the
+     * driver, so they are read once per parameter manager and shared by all the drivers (see getParameters())
+     */
+    struct Parameters
+    {
+        /**The upper bound on the maximum acceleration*/
+        int maxAccUpperBound;
 
-    /**The upper bound on the normal deceleration*/
-    int normalDecelerationUpperBound;
+        /**The upper bound on the normal deceleration*/
+        int normalDecelerationUpperBound;
 
-    /**The upper bound on the maximum deceleration*/
-    int maxDecelerationUpperBound;
+        /**The upper bound on the maximum deceleration*/
+        int maxDecelerationUpperBound;
 
-    /**This parameter is used to compute the desired speed based on the posted speed limit*/
-    double speedFactor;
+        /**This parameter is used to compute the desired speed based on the posted speed limit*/
+        double speedFactor;
 
-    /**The visibility distance of the traffic signal*/
-    double signalVisibilityDist;
+        /**The visibility distance of the traffic signal*/
+        double signalVisibilityDist;
 
-    /**The maximum value of headway a driver can have to pass a yellow light.*/
-    double maxYellowLightHeadway;
+        /**The maximum value of headway a driver can have to pass a yellow light.*/
+        double maxYellowLightHeadway;
 
-    /**The minimum speed for approaching a yellow light*/
-    double minYellowLightSpeed;
+        /**The minimum speed for approaching a yellow light*/
+        double minYellowLightSpeed;
 
-    /**The road slope*/
-    double allGrades;
+        /**The road slope*/
+        double allGrades;
 
-    /**
-     * This is the minimum space headway between the lead and following vehicles for which the following
-     * vehicle must apply some acceleration (or deceleration)
-     */
-    double minResponseDistance;
+        /**
+         * This is the minimum space headway between the lead and following vehicles for which the following
+         * vehicle must apply some acceleration (or deceleration)
+         */
+        double minResponseDistance;
 
-    /**Upper bound for the headway buffer*/
-    double hBufferUpper;
+        /**Lower bound for the headway buffer*/
+        double hBufferLower;
 
-    /**Lower bound for the headway buffer*/
-    double hBufferLower;
+        /**Defines how close the lead vehicle needs to be in order for the following vehicle to brake (in meter)*/
+        double visibilityDistance;
 
-    /**Defines how close the lead vehicle needs to be in order for the following vehicle to brake (in meter)*/
-    double visibilityDistance;
+        /**The car following parameters*/
+        CarFollowingParams CF_parameters[2];
 
-    /**Random number generator for calculating update step sizes*/
-    boost::mt19937 updateSizeRNG;
+        /**Update step size while deceleration*/
+        UpdateStepSizeParam decUpdateStepSize;
 
-    /**The car following parameters*/
-    CarFollowingParams CF_parameters[2];
+        /**Update step size while acceleration*/
+        UpdateStepSizeParam accUpdateStepSize;
 
-    /**Merging parameters*/
-    vector<double> mergingParams;
+        /**Update step size when the speed is constant*/
+        UpdateStepSizeParam uniformSpeedUpdateStepSize;
+
+        /**Update step size when the vehicle has stopped*/
+        UpdateStepSizeParam stoppedUpdateStepSize;
+
+        /**Parameters to calculate the target gap acceleration*/
+        vector<double> targetGapAccParm;
 
-    /**Update step size while deceleration*/
-    UpdateStepSizeParam decUpdateStepSize;
+        /**The maximum acceleration scale*/
+        vector<double> maxAccelerationScale;
 
-    /**Update step size while acceleration*/
-    UpdateStepSizeParam accUpdateStepSize;
+        /**The normal deceleration scale*/
+        vector<double> normalDecelerationScale;
 
-    /**Update step size when the speed is constant*/
-    UpdateStepSizeParam uniformSpeedUpdateStepSize;
+        /**The maximum deceleration scale*/
+        vector<double> maxDecelerationScale;
 
-    /**Update step size when the vehicle has stopped*/
-    UpdateStepSizeParam stoppedUpdateStepSize;
+        /**The speed limit add-on distribution*/
+        vector<double> speedLimitAddon;
 
-    /**Parameters to calculate the target gap acceleration*/
-    vector<double> targetGapAccParm;
+        /**The car following acceleration add-on distribution*/
+        vector<double> accelerationAddon;
 
-    /**The maximum acceleration scale*/
-    vector<double> maxAccelerationScale;
+        /**The car following deceleration add-on distribution*/
+        vector<double> decelerationAddon;
 
-    /**The normal deceleration scale*/
-    vector<double> normalDecelerationScale;
+        /**The distribution for the headway upperbound*/
+        vector<double> hBufferUpperScale;
 
-    /**The maximum deceleration scale*/
-    vector<double> maxDecelerationScale;
+        /**The maximum acceleration indices. Key: Vehicle type, Value: Map with Key: Speed, Value: Max. Acceleration*/
+        map< VehicleBase::VehicleType, map<int, double> > maxAccelerationIndex;
 
-    /**The speed limit add-on distribution*/
-    vector<double> speedLimitAddon;
+        /**The normal deceleration indices. Key: Vehicle type, Value: Map with Key: Speed, Value: Normal deceleration*/
+        map< VehicleBase::VehicleType, map<int, double> > normalDecelerationIndex;
 
-    /**The car following acceleration add-on distribution*/
-    vector<double> accelerationAddon;
+        /**The maximum deceleration indices. Key: Vehicle type, Value: Map with Key: Speed, Value: Normal deceleration*/
+        map< VehicleBase::VehicleType, map<int, double> > maxDecelerationIndex;
 
-    /**The car following deceleration add-on distribution*/
-    vector<double> decelerationAddon;
+        /**The acceleration grade factor*/
+        double accGradeFactor;
 
-    /**The distribution for the headway upperbound*/
-    vector<double> hBufferUpperScale;
+        /**Minimum speed*/
+        double minSpeed;
 
-    /**The maximum acceleration indices. Key: Vehicle type, Value: Map with Key: Speed, Value: Max. Acceleration*/
-    map< VehicleBase::VehicleType, map<int, double> > maxAccelerationIndex;
+        /**The free flow acceleration parameter*/
+        double FFAccParamsBeta;
+    };
+
+    /**The shared car following model parameters*/
+    boost::shared_ptr<const Parameters> parameters;
+
+    /**Upper bound for the headway buffer*/
+    double hBufferUpper;
 
-    /**The normal deceleration indices. Key: Vehicle type, Value: Map with Key: Speed, Value: Normal deceleration*/
-    map< VehicleBase::VehicleType, map<int, double> > normalDecelerationIndex;
+    /**Random number generator for calculating update step sizes*/
+    boost::mt19937 updateSizeRNG;
 
-    /**The maximum deceleration indices. Key: Vehicle type, Value: Map with Key: Speed, Value: Normal deceleration*/
-    map< VehicleBase::VehicleType, map<int, double> > maxDecelerationIndex;
+    /**Merging parameters*/
+    vector<double> mergingParams;
 
     /**
-     * Reads the car following model parameters from the driver parameters XML file
+     * Gets the shared car following model parameters and draws the parameters of this driver
      *
      * @param params the drivers parameters
      */
     void readDriverParameters(DriverUpdateParams &params);
 
+    /**
+     * Returns the car following model parameters of the given parameter manager, reading them on the first call
+     *
+     * @param isAMOD true for the parameters of the AMOD drivers
+     *
+     * @return the shared parameters
+     */
+    boost::shared_ptr<const Parameters> getParameters(bool isAMOD);
+
+    /**
+     * Reads the car following model parameters from the driver parameters XML file
+     *
+     * @param parameterMgr the parameter manager
+     *
+     * @return the parameters read
+     */
+    boost::shared_ptr<const Parameters> readParameters(ParameterManager *parameterMgr);
+
     /**
      * Creates the car following parameters from the given parameter values in string format
      *
@@ -250,7 +288,7 @@ private:
      *
      * @return sampled value from the distribution
      */
-    double sampleFromNormalDistribution(UpdateStepSizeParam &stepSizeParams);
+    double sampleFromNormalDistribution(const UpdateStepSizeParam &stepSizeParams);
 
     /**
      * Returns the maximum acceleration for the given vehicle type
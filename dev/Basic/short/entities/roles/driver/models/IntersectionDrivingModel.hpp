@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <boost/shared_ptr.hpp>
+
 #include "config/params/ParameterManager.hpp"
 #include "conf/settings/DisableMPI.h"
 #include "entities/roles/driver/DriverUpdateParams.hpp"
@@ -93,6 +95,19 @@ public:
 class MITSIM_IntDriving_Model : public IntersectionDrivingModel
 {
 private:
+    /**
+     * The intersection driving parameters read from the driver parameter XML file. They do not depend on the driver,
+     * so they are read once per parameter manager and copied to the drivers (see getParameters())
+     */
+    struct Parameters
+    {
+        double intersectionAttentivenessFactorMin;
+        double intersectionAttentivenessFactorMax;
+        double minimumGap;
+        double criticalGapAddOn[2];
+        double impatienceFactor;
+    };
+
     /**The minimum value of the attentiveness factor within an intersection. The factor is a random value between the given min and max*/
     double intersectionAttentivenessFactorMin;
 
@@ -115,6 +130,24 @@ private:
      */
     void readDriverParameters(DriverUpdateParams &params);
 
+    /**
+     * Returns the intersection driving parameters of the given parameter manager, reading them on the first call
+     *
+     * @param isAMOD true for the parameters of the AMOD drivers
+     *
+     * @return the shared parameters
+     */
+    static boost::shared_ptr<const Parameters> getParameters(bool isAMOD);
+
+    /**
+     * Reads the intersection driving parameters from the driver parameter XML file
+     *
+     * @param parameterMgr the parameter manager
+     *
+     * @return the parameters read
+     */
+    static boost::shared_ptr<const Parameters> readParameters(ParameterManager *parameterMgr);
+
     /**
      * Calculate the acceleration needed to crawl
      *
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <set>
+#include <boost/shared_ptr.hpp>
 
 #include "config/params/ParameterManager.hpp"
 #include "geospatial/network/Lane.hpp"
@@ -72,112 +73,161 @@ private:
         double lane_mintime;
     };
 
-    /**Minimum time require in lane before doing a lane change in the same direction as the previous lane change*/
-    double minTimeInLaneSameDir;
+    /**
+     * The lane changing model parameters read from the driver parameters XML file. They do not depend on the
+     * driver, so they are read once per parameter manager and shared by all the drivers (see getParameters())
+     */
+    struct Parameters
+    {
+        /**Minimum time require in lane before doing a lane change in the same direction as the previous lane change*/
+        double minTimeInLaneSameDir;
 
-    /**Minimum time require in lane before doing a lane change in a direction different to the previous lane change*/
-    double minTimeInLaneDiffDir;
+        /**Minimum time require in lane before doing a lane change in a direction different to the previous lane change*/
+        double minTimeInLaneDiffDir;
 
-    /**Max distance for nosing*/
-    double lcMaxNosingDis;
+        /**Max distance for nosing*/
+        double lcMaxNosingDis;
 
-    /**This parameter is used to change drivers reaction time when in a nosing behaviour*/
-    double CF_CRITICAL_TIMER_RATIO;
+        /**This parameter is used to change drivers reaction time when in a nosing behaviour*/
+        double CF_CRITICAL_TIMER_RATIO;
 
-    /**The maximum time a vehicle is stuck while attempting to nose*/
-    double lcMaxStuckTime;
+        /**The maximum time a vehicle is stuck while attempting to nose*/
+        double lcMaxStuckTime;
 
-    /**Minimum speed to consider for a moving vehicle*/
-    double minSpeed;
+        /**Minimum speed to consider for a moving vehicle*/
+        double minSpeed;
 
-    /**The look ahead distance*/
-    double lookAheadDistance;
+        /**Specifies the time horizon (in second) for constant acceleration while nosing*/
+        float lcNosingConstStateTime;
+
+        /**Holds the parameters required to calculate critical gap*/
+        vector<double> criticalGapParams;
+
+        /**Holds the nosing parameters*/
+        vector<double> kaziNosingParams;
 
-    /**Specifies the time horizon (in second) for constant acceleration while nosing*/
-    float lcNosingConstStateTime;
+        /**Holds the probabilities of yielding to other vehicles*/
+        vector<double> lcYieldingProb;
 
-    /**Holds the parameters required to calculate critical gap*/
-    vector<double> criticalGapParams;
+        /**Holds the lane utility model. This model describes drivers’ choice of lane they would want to travel in*/
+        vector<double> laneUtilityParams;
 
-    /**Holds the nosing parameters*/
-    vector<double> kaziNosingParams;
+        /**Holds the parameters the define how a gap is chosen*/
+        std::vector< std::vector<double> > GAP_PARAM;
 
-    /**Holds the probabilities of yielding to other vehicles*/
-    vector<double> lcYieldingProb;
+        /**Holds the mandatory lane changing parameters*/
+        MandatoryLaneChangeParams MLC_PARAMETERS;
 
-    /**Holds the lane utility model. This model describes drivers’ choice of lane they would want to travel in*/
-    vector<double> laneUtilityParams;
+        /**The critical gap parameters of the Kazi LC gap model (copied to the driver parameters)*/
+        std::vector< std::vector<double> > LC_GAP_MODELS;
 
-    /**Holds the parameters the define how a gap is chosen*/
-    std::vector< std::vector<double> > GAP_PARAM;
+        /**The nosing parameters (copied to the driver parameters)*/
+        vector<double> nosingParams;
 
-    /**Holds the mandatory lane changing parameters*/
-    MandatoryLaneChangeParams MLC_PARAMETERS;
+        /**The maximum time to yield (copied to the driver parameters)*/
+        double lcMaxYieldingTime;
+
+        /**The target gap model parameters (copied to the driver parameters)*/
+        vector<double> targetGapParams;
+
+        /**The distance at which the stop points are checked (copied to the driver parameters)*/
+        double stopVisibilityDistance;
+    };
+
+    /**The shared lane changing model parameters*/
+    boost::shared_ptr<const Parameters> parameters;
+
+    /**The look ahead distance*/
+    double lookAheadDistance;
 
     /**
-     * Reads the lane changing model parameters from the driver parameters XML file
+     * Gets the shared lane changing model parameters and draws the parameters of this driver
      *
      * @param params the drivers parameters
      */
     void readDriverParameters(DriverUpdateParams &params);
 
+    /**
+     * Returns the lane changing model parameters of the given parameter manager, reading them on the first call
+     *
+     * @param isAMOD true for the parameters of the AMOD drivers
+     *
+     * @return the shared parameters
+     */
+    boost::shared_ptr<const Parameters> getParameters(bool isAMOD);
+
+    /**
+     * Reads the lane changing model parameters from the driver parameters XML file
+     *
+     * @param parameterMgr the parameter manager
+     *
+     * @return the parameters read
+     */
+    boost::shared_ptr<const Parameters> readParameters(ParameterManager *parameterMgr);
+
     /**
      * Helper function to parse parameters read in string format and store them
      *
+     * @param p the parameters to fill
      * @param str parameters read from driver parameters XML
      */
-    void makeCriticalGapParams(std::string &str);
+    void makeCriticalGapParams(Parameters &p, std::string &str);
 
     /**
      * Helper function to parse parameters read in string format and store them
      *
-     * @param params driver parameters
+     * @param p the parameters to fill
      * @param str parameters read from driver parameters XML
      */
-    void makeNosingParams(DriverUpdateParams &params, string &str);
+    void makeNosingParams(Parameters &p, string &str);
 
     /**
      * Helper function to parse parameters read in string format and store them
      *
+     * @param p the parameters to fill
      * @param str parameters read from driver parameters XML
      */
-    void makeLC_YieldingProbabilities(string &str);
+    void makeLC_YieldingProbabilities(Parameters &p, string &str);
 
     /**
      * Helper function to parse parameters read in string format and store them
      *
+     * @param p the parameters to fill
      * @param str parameters read from driver parameters XML
      */
-    void makeLaneUtilityParams(std::string &str);
+    void makeLaneUtilityParams(Parameters &p, std::string &str);
 
     /**
      * Helper function to parse parameters read in string format and store them
      *
+     * @param p the parameters to fill
      * @param str parameters read from driver parameters XML
      */
-    void makeMLCParam(std::string &str);
+    void makeMLCParam(Parameters &p, std::string &str);
 
     /**
      * Helper function to parse parameters read in string format and store them
      *
-     * @param params driver parameters
+     * @param p the parameters to fill
      * @param strMatrix parameters read from driver parameters XML
      */
-    void makeCriticalGapParams(DriverUpdateParams &params, std::vector<std::string> &strMatrix);
+    void makeCriticalGapParams(Parameters &p, std::vector<std::string> &strMatrix);
 
     /**
      * Helper function to parse parameters read in string format and store them
      *
+     * @param p the parameters to fill
      * @param strMatrix parameters read from driver parameters XML
      */
-    void makeTargetGapPram(std::vector<std::string> &strMatrix);
+    void makeTargetGapPram(Parameters &p, std::vector<std::string> &strMatrix);
 
     /**
      * Helper function to parse parameters read in string format and store them
      *
+     * @param p the parameters to fill
      * @param str parameters read from driver parameters XML
      */
-    void makeKaziNosingParams(string &str);
+    void makeKaziNosingParams(Parameters &p, string &str);
 
     /**
      * Calculates target gap utility
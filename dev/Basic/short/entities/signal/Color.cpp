@@ -78,4 +78,36 @@ TrafficColor ColorSequence::computeColor(double duration)
     Warn() << "\nReturning TRAFFIC_COLOUR_RED...";
     
     return TRAFFIC_COLOUR_RED;
-}
\ No newline at end of file
+}
+std::vector< std::pair<int, TrafficColor> > ColorSequence::computeColourChanges() const
+{
+    std::vector< std::pair<int, TrafficColor> > changes;
+    int sum = 0;
+    
+    //The first time lapse that is not covered by the changes found so far
+    int start = 0;
+
+    for (std::vector< std::pair<TrafficColor, int> >::const_iterator itDurations = colourDurations.begin(); itDurations != colourDurations.end(); ++itDurations)
+    {
+        sum += (*itDurations).second;
+        
+        //computeColor() returns this colour for the time lapses from 'start' to 'sum'
+        if (sum >= start)
+        {
+            if (changes.empty() || changes.back().second != (*itDurations).first)
+            {
+                changes.push_back(std::make_pair(start, (*itDurations).first));
+            }
+            
+            start = sum + 1;
+        }
+    }
+    
+    //Beyond the sum of the durations, computeColor() returns red
+    if (changes.empty() || changes.back().second != TRAFFIC_COLOUR_RED)
+    {
+        changes.push_back(std::make_pair(start, TRAFFIC_COLOUR_RED));
+    }
+    
+    return changes;
+}
@@ -90,6 +90,14 @@ public:
      * @return colour
      */
     TrafficColor computeColor(double duration);
+
+    /**
+     * Computes the times at which the colour computed by computeColor() changes. As computeColor() only considers the
+     * whole seconds of the time lapse, the colours change at whole seconds
+     * @return pairs of time lapse and the colour computed from that time lapse until the next change, ordered by time
+     * lapse. The first pair is at time lapse 0
+     */
+    std::vector< std::pair<int, TrafficColor> > computeColourChanges() const;
     
     friend class sim_mob::Phase;
 } ;
@@ -34,40 +34,6 @@ void Phase::addLinkMapping(unsigned int fromLink, ToLinkColourSequence toLinkClr
     linksMap.insert(std::pair<unsigned int, ToLinkColourSequence>(fromLink, toLinkClrSeq));
 }
 
-void Phase::update(double currentCycleTimer) const
-{
-    std::stringstream out;
-    double lapse = currentCycleTimer - phaseOffset;
-    
-    //When time lapse = zero it means that:
-    //1. Signal update was called at time zero (not likely)
-    //or
-    //2. We are at the beginning of this phase [so the rest (computeColor) will be OK]
-    if (lapse < 0)
-    {
-        Warn() << "\nPhase::update(): " << phaseName << " has lapse < 0";
-        Warn() << "\nlapse (" << lapse << ") = currentCycleTimer (" << currentCycleTimer << ") - phaseOffset (" << phaseOffset << ")";
-        return;
-    }
-    
-    //Update the signal colour for all links
-    for (linksMappingIterator linkIterator = linksMap.begin(); linkIterator != linksMap.end(); ++linkIterator)
-    {
-        //If no time lapse, don't change the colour
-        //This is especially important when a full cycle has passed and current cycle timer is zero!
-        //Then instead of moving to the first phase again, the last phase may reset to green
-        
-        (*linkIterator).second.currColor = (*linkIterator).second.colorSequence.computeColor(lapse);
-        
-        if (((*linkIterator).second.currColor > TrafficColor::TRAFFIC_COLOUR_GREEN) || ((*linkIterator).second.currColor < TrafficColor::TRAFFIC_COLOUR_RED))
-        {
-            out << __func__ << ": Colour out of range\n";
-            out << "currentCycleTimer :" << currentCycleTimer << " phaseOffset :" << phaseOffset << "--->lapse :" << lapse;
-            throw std::runtime_error(out.str());
-        }
-    }
-}
-
 double Phase::computeTotalGreenTime()const
 {
     double green = 0, maxGreen = 0;
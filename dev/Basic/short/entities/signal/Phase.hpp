@@ -121,12 +121,6 @@ public:
      */
     void addLinkMapping(unsigned int fromLink, ToLinkColourSequence toLinkClrSeq) const;
     
-    /**
-     * Updates the colour for the phase
-     * @param currentCycleTimer
-     */
-    void update(double currentCycleTimer) const;
-    
     /**
      * Computes the total green time for the phase
      * Assumption : Total green time = the whole duration in the colour sequence except red!
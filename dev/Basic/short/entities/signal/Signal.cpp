@@ -2,6 +2,7 @@
 //Licensed under the terms of the MIT License, as described in the file:
 //   license.txt   (http://opensource.org/licenses/MIT)
 
+#include <algorithm>
 #include <cmath>
 #include <bits/localefwd.h>
 
@@ -31,6 +32,20 @@ using namespace std;
 
 std::map<unsigned int, Signal *> Signal::mapOfIdVsSignals;
 
+namespace
+{
+/**
+ * Gets the key of a turning in the turning indices of the signals
+ * @param fromLink the id of the link the turning starts from
+ * @param toLink the id of the link the turning ends at
+ * @return the key
+ */
+inline unsigned long long getTurningKey(unsigned int fromLink, unsigned int toLink)
+{
+    return (static_cast<unsigned long long>(fromLink) << 32) | toLink;
+}
+}
+
 Signal::Signal(const Node *node, const MutexStrategy &mtxStrat, unsigned int id, SignalType)
 : Agent(mtxStrat, id), trafficLightId(node->getTrafficLightId())
 {
@@ -100,7 +115,8 @@ bool Signal::isNonspatial()
 }
 
 Signal_SCATS::Signal_SCATS(const Node *node, const MutexStrategy &mtxStrat)
-: Signal(node, mtxStrat, -1, SignalType::SIGNAL_TYPE_SCATS), currCycleTimer(0), currPhaseAtGreen(0), isNewCycle(false)
+: Signal(node, mtxStrat, -1, SignalType::SIGNAL_TYPE_SCATS), currCycleTimer(0), currPhaseAtGreen(0), isNewCycle(false),
+colouredPhase(0), nextColourChange(0), phaseSearchStart(0)
 {
     updateInterval = ST_Config::getInstance().granSignalsTicks * ConfigManager::GetInstance().FullConfig().baseGranMS() / 1000;
     splitPlan = new SplitPlan();
@@ -159,6 +175,13 @@ Entity::UpdateStatus Signal_SCATS::frame_tick(timeslice now)
     }
 
     isNewCycle = updateCurrCycleTimer();
+    
+    if (isNewCycle)
+    {
+        //The timer is back at the start of the cycle, so the phases and colour changes are run through again
+        phaseSearchStart = 0;
+        nextColourChange = 0;
+    }
 
     //We do not update currPhaseAtGreen to the new value as we still need some information 
     //(degree of saturation) obtained during the last phase
@@ -166,7 +189,7 @@ Entity::UpdateStatus Signal_SCATS::frame_tick(timeslice now)
 
     if (phaseId < phases.size())
     {
-        phases[phaseId]->update(currCycleTimer);
+        updateColours(phaseId);
     }
     else
     {
@@ -215,6 +238,7 @@ void Signal_SCATS::initialise()
     
     //Create plans and phases
     createPlans();
+    createTurnings();
     
     //Initialise the phases
     initialisePhases();
@@ -239,16 +263,12 @@ bool Signal_SCATS::updateCurrCycleTimer()
 
 std::size_t Signal_SCATS::computeCurrPhase(double currCycleTimer)
 {
-    const std::vector< double > &currSplitPlan = splitPlan->getCurrSplitPlan();
-    double sum = 0;
     std::size_t phase = 0;
     
-    for (phase = 0; phase < phases.size(); phase++)
+    //The phases before the search start ended before the previous update of the timer
+    for (phase = phaseSearchStart; phase < phaseEndTimes.size(); phase++)
     {
-        //In each iteration, the sum will represent the time (with respect to cycle length) each phase would end at
-        sum += splitPlan->getCycleLength() * currSplitPlan[phase] / 100;
-        
-        if (sum > currCycleTimer)
+        if (phaseEndTimes[phase] > currCycleTimer)
         {
             break;
         }
@@ -258,13 +278,66 @@ std::size_t Signal_SCATS::computeCurrPhase(double currCycleTimer)
     {
         std::stringstream str;
         str << __func__ << ": Signal_SCATS::computeCurrPhase(): phase (" << phase << ") >= numOfPhases (" << phases.size() << ")";
-        str << "\ncurrCycleTimer(" << currCycleTimer << ") <= sum (" << sum << ")";
+        str << "\ncurrCycleTimer(" << currCycleTimer << ") <= sum (" << (phaseEndTimes.empty() ? 0 : phaseEndTimes.back()) << ")";
         throw std::runtime_error(str.str());
     }
 
+    phaseSearchStart = phase;
     return phase;
 }
 
+void Signal_SCATS::updateColours(std::size_t phaseId)
+{
+    if (phaseId != colouredPhase)
+    {
+        //The turnings of the previous phase turn red, unless they are in this phase as well
+        const std::vector< std::pair<std::size_t, const ToLinkColourSequence *> > &prevTurnings = phaseTurnings[colouredPhase];
+        for (std::size_t i = 0; i < prevTurnings.size(); ++i)
+        {
+            turningColours[prevTurnings[i].first] = TrafficColor::TRAFFIC_COLOUR_RED;
+        }
+        
+        const std::vector< std::pair<std::size_t, const ToLinkColourSequence *> > &turnings = phaseTurnings[phaseId];
+        for (std::size_t i = 0; i < turnings.size(); ++i)
+        {
+            turningColours[turnings[i].first] = turnings[i].second->currColor;
+        }
+        
+        colouredPhase = phaseId;
+        nextColourChange = 0;
+    }
+    
+    const Phase *phase = phases[phaseId];
+    double lapse = currCycleTimer - phase->phaseOffset;
+    
+    if (lapse < 0)
+    {
+        Warn() << "\nSignal_SCATS::updateColours(): " << phase->getName() << " has lapse < 0";
+        Warn() << "\nlapse (" << lapse << ") = currCycleTimer (" << currCycleTimer << ") - phaseOffset (" << phase->phaseOffset << ")";
+        return;
+    }
+    
+    //Only the whole seconds of the lapse matter, so the changes are due once the lapse reaches their time
+    const std::vector<ColourChange> &changes = phaseColourChanges[phaseId];
+    
+    while (nextColourChange < changes.size() && lapse >= changes[nextColourChange].lapse)
+    {
+        const ColourChange &change = changes[nextColourChange];
+        
+        if (change.colour > TrafficColor::TRAFFIC_COLOUR_GREEN || change.colour < TrafficColor::TRAFFIC_COLOUR_RED)
+        {
+            std::stringstream out;
+            out << __func__ << ": Colour out of range\n";
+            out << "currCycleTimer :" << currCycleTimer << " phaseOffset :" << phase->phaseOffset << "--->lapse :" << lapse;
+            throw std::runtime_error(out.str());
+        }
+        
+        change.colourSequence->currColor = change.colour;
+        turningColours[change.turning] = change.colour;
+        ++nextColourChange;
+    }
+}
+
 double Signal_SCATS::computePhaseDS(int phaseId, const timeslice &now)
 {
     double lane_DS = 0, maxPhaseDS = 0;
@@ -272,31 +345,16 @@ double Signal_SCATS::computePhaseDS(int phaseId, const timeslice &now)
 
     double totalGreen = phase->computeTotalGreenTime();
     
-    Phase::linksMappingIterator linkIterator = phase->getLinksMapBegin();
-    for (; linkIterator != phase->getLinksMapEnd(); linkIterator++)
-    {
-        const RoadNetwork *network = RoadNetwork::getInstance();
-        const Link *link = network->getById(network->getMapOfIdVsLinks(), linkIterator->first);
-        
-        const std::vector<const Lane *> lanes = link->getRoadSegments().back()->getLanes();
-        
-        for (std::size_t i = 0; i < lanes.size(); i++)
-        { 
-            const Lane *lane = NULL;
-            lane = lanes.at(i);
-            
-            if (lane->isPedestrianLane())
-            {
-                continue;
-            }
-            
-            const Sensor::CountAndTimePair &ctPair = loopDetectorAgent->getCountAndTimePair(*lane);
-            lane_DS = computeLaneDS(ctPair, totalGreen);
-            
-            if (lane_DS > maxPhaseDS)
-            {
-                maxPhaseDS = lane_DS;
-            }
+    const std::vector<const Lane *> &lanes = phaseLanes[phaseId];
+    
+    for (std::size_t i = 0; i < lanes.size(); i++)
+    { 
+        const Sensor::CountAndTimePair &ctPair = loopDetectorAgent->getCountAndTimePair(*lanes[i]);
+        lane_DS = computeLaneDS(ctPair, totalGreen);
+
+        if (lane_DS > maxPhaseDS)
+        {
+            maxPhaseDS = lane_DS;
         }
     }
 
@@ -345,25 +403,15 @@ TrafficColor Signal_SCATS::getDriverLight(unsigned int fromLink, unsigned int to
         return TrafficColor::TRAFFIC_COLOUR_GREEN;
     }
     
-    const Phase *currPhase = phases[currPhaseAtGreen];
-    Phase::linksMappingEqualRange range = currPhase->getLinkTos(fromLink);
-    Phase::linksMappingConstIterator iter;
-    
-    for (iter = range.first; iter != range.second; iter++)
-    {
-        if ((*iter).second.toLink == toLink)
-        {
-            break;
-        }
-    }
+    std::unordered_map<unsigned long long, std::size_t>::const_iterator itTurning = turningIndices.find(getTurningKey(fromLink, toLink));
 
-    //If the link is not listed in the current phase return red
-    if (iter == range.second)
+    //If the link is not listed in any phase return red
+    if (itTurning == turningIndices.end())
     {
         return TrafficColor::TRAFFIC_COLOUR_RED;
     }
     
-    return (*iter).second.currColor;
+    return turningColours[itTurning->second];
 }
 
 void Signal_SCATS::createPlans()
@@ -489,6 +537,105 @@ void Signal_SCATS::initialisePhases()
     {
         phases[phase]->initialize(splitPlan);
     }
+    
+    scheduleCycle();
+}
+
+void Signal_SCATS::createTurnings()
+{
+    const RoadNetwork *network = RoadNetwork::getInstance();
+    phaseTurnings.resize(phases.size());
+    phaseLanes.resize(phases.size());
+    
+    for (std::size_t phaseId = 0; phaseId < phases.size(); ++phaseId)
+    {
+        const linksMapping &linksMap = phases[phaseId]->getLinksMap();
+        std::vector< std::pair<std::size_t, const ToLinkColourSequence *> > &turnings = phaseTurnings[phaseId];
+        std::vector<const Lane *> &lanes = phaseLanes[phaseId];
+        
+        for (Phase::linksMappingConstIterator itLinksMap = linksMap.begin(); itLinksMap != linksMap.end(); ++itLinksMap)
+        {
+            unsigned long long key = getTurningKey(itLinksMap->first, itLinksMap->second.toLink);
+            std::unordered_map<unsigned long long, std::size_t>::iterator itTurning = turningIndices.find(key);
+            
+            if (itTurning == turningIndices.end())
+            {
+                itTurning = turningIndices.insert(std::make_pair(key, turningColours.size())).first;
+                turningColours.push_back(TrafficColor::TRAFFIC_COLOUR_RED);
+            }
+            
+            //If a turning is listed more than once in a phase, the drivers are shown the colour of the first one
+            bool isListed = false;
+            for (std::size_t i = 0; i < turnings.size() && !isListed; ++i)
+            {
+                isListed = (turnings[i].first == itTurning->second);
+            }
+            
+            if (!isListed)
+            {
+                turnings.push_back(std::make_pair(itTurning->second, &itLinksMap->second));
+            }
+            
+            //The DS of the phase is computed from the lanes at the end of the 'from link'
+            const Link *link = network->getById(network->getMapOfIdVsLinks(), itLinksMap->first);
+            const std::vector<const Lane *> &linkLanes = link->getRoadSegments().back()->getLanes();
+            
+            for (std::size_t i = 0; i < linkLanes.size(); ++i)
+            {
+                if (!linkLanes[i]->isPedestrianLane() && std::find(lanes.begin(), lanes.end(), linkLanes[i]) == lanes.end())
+                {
+                    lanes.push_back(linkLanes[i]);
+                }
+            }
+        }
+    }
+}
+
+void Signal_SCATS::scheduleCycle()
+{
+    const std::vector< double > &currSplitPlan = splitPlan->getCurrSplitPlan();
+    double sum = 0;
+    
+    phaseEndTimes.resize(phases.size());
+    phaseColourChanges.resize(phases.size());
+    
+    for (std::size_t phaseId = 0; phaseId < phases.size(); ++phaseId)
+    {
+        //The sum represents the time (with respect to cycle length) the phase ends at
+        sum += splitPlan->getCycleLength() * currSplitPlan[phaseId] / 100;
+        phaseEndTimes[phaseId] = sum;
+        
+        const std::vector< std::pair<std::size_t, const ToLinkColourSequence *> > &turnings = phaseTurnings[phaseId];
+        std::vector<ColourChange> &changes = phaseColourChanges[phaseId];
+        changes.clear();
+        
+        for (std::size_t i = 0; i < turnings.size(); ++i)
+        {
+            const std::vector< std::pair<int, TrafficColor> > colourChanges = turnings[i].second->colorSequence.computeColourChanges();
+            
+            for (std::size_t j = 0; j < colourChanges.size(); ++j)
+            {
+                ColourChange change = { colourChanges[j].first, turnings[i].first, turnings[i].second, colourChanges[j].second };
+                changes.push_back(change);
+            }
+        }
+        
+        std::stable_sort(changes.begin(), changes.end(), [](const ColourChange &first, const ColourChange &second)
+        {
+            return first.lapse < second.lapse;
+        });
+    }
+    
+    //The new schedule is run through from the start
+    phaseSearchStart = 0;
+    nextColourChange = 0;
+    
+    //Show the colours of the current phase right away, so the turnings of the first phase are not red until the
+    //first frame_tick
+    if (!phases.empty())
+    {
+        updateColours(computeCurrPhase(currCycleTimer));
+    }
 }
 
 void Signal_SCATS::createTrafficSignals(const MutexStrategy &mtxStrat)
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <stdexcept>
 #include <sstream>
@@ -181,6 +182,22 @@ public:
 class Signal_SCATS : public Signal
 {
 private:
+    /**A change of the colour shown for a turning, at a time lapse from the start of a phase*/
+    struct ColourChange
+    {
+        /**The time lapse (in whole seconds) from the start of the phase*/
+        int lapse;
+        
+        /**Index of the turning in turningColours*/
+        std::size_t turning;
+        
+        /**The colour sequence structure of the turning in the phase*/
+        const ToLinkColourSequence *colourSequence;
+        
+        /**The colour shown from this time lapse on*/
+        TrafficColor colour;
+    };
+    
     /**The interval on which the frame_tick method is called for the signal*/
     double updateInterval;
     
@@ -203,6 +220,33 @@ private:
     /**Indicates whether operations pertaining to a new cycle should be performed*/
     bool isNewCycle;
     
+    /**Index of the turnings (from link, to link) of all the phases in turningColours*/
+    std::unordered_map<unsigned long long, std::size_t> turningIndices;
+    
+    /**The colour shown to the drivers on each turning. The turnings that are not in the phase at green are red*/
+    std::vector<TrafficColor> turningColours;
+    
+    /**The turnings of each phase, as the index in turningColours and the colour sequence structure*/
+    std::vector< std::vector< std::pair<std::size_t, const ToLinkColourSequence *> > > phaseTurnings;
+    
+    /**The lanes of the 'from links' of each phase, whose loop detectors give the DS of the phase*/
+    std::vector< std::vector<const Lane *> > phaseLanes;
+    
+    /**The time (with respect to cycle start) at which each phase ends in the current cycle*/
+    std::vector<double> phaseEndTimes;
+    
+    /**The colour changes of each phase in the current cycle, ordered by time lapse*/
+    std::vector< std::vector<ColourChange> > phaseColourChanges;
+    
+    /**The phase whose colours are shown in turningColours*/
+    std::size_t colouredPhase;
+    
+    /**Index of the next colour change of the coloured phase*/
+    std::size_t nextColourChange;
+    
+    /**The phase from which the search for the current phase starts. Phases never end earlier within a cycle*/
+    std::size_t phaseSearchStart;
+    
     /**
      * Initialises the signal
      */
@@ -223,6 +267,13 @@ private:
      */
     std::size_t computeCurrPhase(double currCycleTimer);
     
+    /**
+     * Applies the colour changes of the given phase that are due at the current cycle timer
+     * 
+     * @param phaseId the current phase
+     */
+    void updateColours(std::size_t phaseId);
+    
     /**
      * Calculates the degree of saturation (DS) at the end of each phase considering only the maximum DS of the lane in the LinkFrom(s).
      * LinkFrom(s) are the links from which vehicles enter the intersection during the corresponding phase
@@ -266,10 +317,20 @@ private:
      */
     void createPhases();
     
+    /**
+     * Creates the look up of the turnings and the lanes of the phases
+     */
+    void createTurnings();
+    
     /**
      * Initialises the phases
      */
     void initialisePhases();
+    
+    /**
+     * Computes the phase end times and the colour changes of the phases for the current cycle
+     */
+    void scheduleCycle();
 
 protected:
     VehicleCounter curVehicleCounter;
@@ -287,7 +348,7 @@ protected:
      * This method is called for every tick of the traffic signal. This method does the following:
      * 1. Update the current cycle timer
      * 2. Update the current phase
-     * 3. Update the current phase colour
+     * 3. Apply the colour changes of the current phase that are due
      * 4. If the cycle has ended:
      *  4.1 Compute the degree of saturation (DS)
      *  4.2 Update cycle length
@@ -0,0 +1,101 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <utility>
+#include <vector>
+
+#include "entities/signal/Color.hpp"
+
+#include "ColorSequenceUnitTests.hpp"
+
+using namespace sim_mob;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(unit_tests::ColorSequenceUnitTests);
+
+namespace
+{
+    //The colour shown at a time lapse, when the changes due by then have been applied
+    TrafficColor colourAt(const std::vector< std::pair<int, TrafficColor> >& changes, double lapse)
+    {
+        TrafficColor colour = TRAFFIC_COLOUR_INVALID;
+        for (std::size_t i = 0; i < changes.size() && lapse >= changes[i].first; ++i)
+        {
+            colour = changes[i].second;
+        }
+        return colour;
+    }
+
+    //Compares the colour changes with computeColor() in half-second steps, up to a few seconds past the end of the
+    //sequence
+    void checkColourChanges(ColorSequence& sequence, int total)
+    {
+        std::vector< std::pair<int, TrafficColor> > changes = sequence.computeColourChanges();
+
+        CPPUNIT_ASSERT(!changes.empty());
+        CPPUNIT_ASSERT(0 == changes.front().first);
+
+        for (std::size_t i = 1; i < changes.size(); ++i)
+        {
+            CPPUNIT_ASSERT(changes[i - 1].first < changes[i].first);
+            CPPUNIT_ASSERT(changes[i - 1].second != changes[i].second);
+        }
+
+        for (int halfSeconds = 0; halfSeconds <= 2 * (total + 3); ++halfSeconds)
+        {
+            double lapse = halfSeconds / 2.0;
+            CPPUNIT_ASSERT(sequence.computeColor(lapse) == colourAt(changes, lapse));
+        }
+    }
+}
+
+void unit_tests::ColorSequenceUnitTests::test_colour_changes_match_computeColor()
+{
+    ColorSequence sequence;
+    sequence.addColorDuration(TRAFFIC_COLOUR_GREEN, 20);
+    sequence.addColorDuration(TRAFFIC_COLOUR_AMBER, 3);
+    sequence.addColorDuration(TRAFFIC_COLOUR_RED, 2);
+    checkColourChanges(sequence, 25);
+
+    //computeColor() gives green up to and including the 20th second
+    std::vector< std::pair<int, TrafficColor> > changes = sequence.computeColourChanges();
+    CPPUNIT_ASSERT(3 == changes.size());
+    CPPUNIT_ASSERT(std::make_pair(0, TRAFFIC_COLOUR_GREEN) == changes[0]);
+    CPPUNIT_ASSERT(std::make_pair(21, TRAFFIC_COLOUR_AMBER) == changes[1]);
+    CPPUNIT_ASSERT(std::make_pair(24, TRAFFIC_COLOUR_RED) == changes[2]);
+
+    //Consecutive durations of the same colour give a single change
+    ColorSequence repeated;
+    repeated.addColorDuration(TRAFFIC_COLOUR_GREEN, 5);
+    repeated.addColorDuration(TRAFFIC_COLOUR_GREEN, 5);
+    repeated.addColorDuration(TRAFFIC_COLOUR_AMBER, 3);
+    checkColourChanges(repeated, 13);
+    CPPUNIT_ASSERT(3 == repeated.computeColourChanges().size());
+}
+
+void unit_tests::ColorSequenceUnitTests::test_colour_changes_with_zero_durations()
+{
+    ColorSequence leadingZero;
+    leadingZero.addColorDuration(TRAFFIC_COLOUR_GREEN, 0);
+    leadingZero.addColorDuration(TRAFFIC_COLOUR_AMBER, 3);
+    leadingZero.addColorDuration(TRAFFIC_COLOUR_RED, 0);
+    checkColourChanges(leadingZero, 3);
+
+    ColorSequence middleZero;
+    middleZero.addColorDuration(TRAFFIC_COLOUR_GREEN, 2);
+    middleZero.addColorDuration(TRAFFIC_COLOUR_AMBER, 0);
+    middleZero.addColorDuration(TRAFFIC_COLOUR_RED, 1);
+    checkColourChanges(middleZero, 3);
+
+    ColorSequence allZero;
+    allZero.addColorDuration(TRAFFIC_COLOUR_GREEN, 0);
+    allZero.addColorDuration(TRAFFIC_COLOUR_AMBER, 0);
+    checkColourChanges(allZero, 0);
+}
+
+void unit_tests::ColorSequenceUnitTests::test_colour_changes_of_empty_sequence()
+{
+    ColorSequence sequence;
+    checkColourChanges(sequence, 0);
+    CPPUNIT_ASSERT(1 == sequence.computeColourChanges().size());
+}
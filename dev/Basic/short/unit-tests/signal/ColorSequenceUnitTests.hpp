@@ -0,0 +1,38 @@
+//Copyright (c) 2013 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#pragma once
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace unit_tests
+{
+
+/**
+ * Unit Tests for the ColorSequence class in short/entities/signal
+ */
+class ColorSequenceUnitTests : public CppUnit::TestFixture
+{
+public:
+    ///Check that the colour changes give the colour computed by computeColor() at whole seconds and in between.
+    void test_colour_changes_match_computeColor();
+
+    ///Check the colour changes of sequences with zero-length durations.
+    ///A colour with a zero duration is only shown at the time lapse it starts, or not at all if it follows another
+    ///colour.
+    void test_colour_changes_with_zero_durations();
+
+    ///Check that an empty sequence is red at all time lapses.
+    void test_colour_changes_of_empty_sequence();
+
+private:
+    CPPUNIT_TEST_SUITE(ColorSequenceUnitTests);
+        CPPUNIT_TEST(test_colour_changes_match_computeColor);
+        CPPUNIT_TEST(test_colour_changes_with_zero_durations);
+        CPPUNIT_TEST(test_colour_changes_of_empty_sequence);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+}
@@ -0,0 +1,568 @@
+//Copyright (c) 2014 Singapore-MIT Alliance for Research and Technology
+//Licensed under the terms of the MIT License, as described in the file:
+//   license.txt   (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+#include <boost/chrono.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Synthetic commsim client, used to benchmark the Broker without Android emulators or ns-3.
+//  It opens a few TCP connections to Sim Mobility and multiplexes many fake Android clients over them (the same way
+//  the relay does): the first client on each connection answers the Broker's id_request, and every other client sends
+//  a new_client message to get its own id_request. Every tick, each registered client answers the Broker's
+//  ticked_simmob with an optional mix of remote_log/opaque_send messages, followed by ticked_client.
+//  It reports the Broker's throughput, the per-tick latency (from the last ticked_client of a tick to the first
+//  ticked_simmob of the next one), and the CPU time per message of the load generator and (optionally) of Sim Mobility.
+//  NOTE: Like the relay, this application does not bother cleaning up; it simply stops once it is done.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+using boost::asio::ip::tcp;
+using boost::system::error_code;
+
+typedef boost::chrono::steady_clock Clock;
+
+namespace {
+
+///Command-line options.
+struct Options {
+	std::string host;
+	std::string port;
+	unsigned int agents; ///<Number of fake Android clients.
+	unsigned int connections; ///<Number of TCP connections the clients are multiplexed over.
+	unsigned int threads; ///<Number of threads running the io_service.
+	unsigned int delayMs; ///<Delay before a client answers a ticked_simmob.
+	unsigned int jitterMs; ///<Random extra delay (0 to jitterMs) before a client answers.
+	double logRate; ///<Probability that a client sends a remote_log on a given tick.
+	double opaqueRate; ///<Probability that a client broadcasts an opaque_send on a given tick.
+	unsigned int payloadBytes; ///<Size of the data of each opaque_send.
+	std::string services; ///<Service requested by every client (e.g., srv_location).
+	unsigned int reportTicks; ///<Report every N ticks.
+	unsigned int maxTicks; ///<Stop after this tick (0 runs until Sim Mobility disconnects).
+	int brokerPid; ///<Process ID of Sim Mobility, to report its CPU time (0 to skip).
+
+	Options() : host("127.0.0.1"), port("6745"), agents(100), connections(1), threads(1), delayMs(0), jitterMs(0),
+		logRate(0.0), opaqueRate(0.0), payloadBytes(64), services("srv_location"), reportTicks(100), maxTicks(0), brokerPid(0)
+	{}
+} opts;
+
+boost::asio::io_service io_service;
+
+
+///Returns the CPU time (user+system) of this process, in seconds.
+double getOwnCpuSeconds()
+{
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec)/1e6;
+}
+
+///Returns the CPU time (user+system) of another process from /proc, in seconds (or -1 if it can't be read).
+double getProcessCpuSeconds(int pid)
+{
+	std::stringstream path;
+	path <<"/proc/" <<pid <<"/stat";
+	std::ifstream in(path.str().c_str());
+	std::string line;
+	if (!std::getline(in, line)) {
+		return -1;
+	}
+
+	//The command name may contain spaces; the remaining fields start after its closing parenthesis.
+	//utime and stime are the 14th and 15th fields; the first field after the parenthesis is the 3rd.
+	std::istringstream fields(line.substr(line.rfind(')')+1));
+	std::string skip;
+	for (int i=3; i<14; i++) {
+		fields >>skip;
+	}
+	unsigned long utime = 0;
+	unsigned long stime = 0;
+	if (!(fields >>utime >>stime)) {
+		return -1;
+	}
+	return static_cast<double>(utime + stime)/sysconf(_SC_CLK_TCK);
+}
+
+
+///Benchmark counters, shared by all connections.
+class Stats {
+public:
+	Stats() : lastTick(0), registered(0), answered(false), msgsIn(0), msgsOut(0), bytesIn(0), bytesOut(0), ticks(0), ownCpu(0), brokerCpu(0), done(false) {
+		windowStart = Clock::now();
+		lastAnswer = windowStart;
+		ownCpu = getOwnCpuSeconds();
+		brokerCpu = opts.brokerPid ? getProcessCpuSeconds(opts.brokerPid) : -1;
+	}
+
+	void onRegistered() {
+		boost::lock_guard<boost::mutex> lock(mutex);
+		registered++;
+		if (registered==opts.agents) {
+			std::cout <<"All " <<registered <<" clients registered.\n";
+		}
+	}
+
+	void onBundleIn(size_t msgs, size_t bytes) {
+		boost::lock_guard<boost::mutex> lock(mutex);
+		msgsIn += msgs;
+		bytesIn += bytes;
+	}
+
+	void onBundleOut(size_t msgs, size_t bytes) {
+		boost::lock_guard<boost::mutex> lock(mutex);
+		msgsOut += msgs;
+		bytesOut += bytes;
+	}
+
+	///Called when a client answers a tick.
+	void onTickAnswered() {
+		boost::lock_guard<boost::mutex> lock(mutex);
+		lastAnswer = Clock::now();
+		answered = true;
+	}
+
+	///Called for every ticked_simmob received. Returns false once the benchmark is over.
+	bool onTickReceived(unsigned int tick) {
+		boost::lock_guard<boost::mutex> lock(mutex);
+		if (done) {
+			return false;
+		}
+		if (tick<=lastTick) {
+			return true;
+		}
+
+		//First client to see this tick: the Broker was waiting since the last answer of the previous tick.
+		//(With a lookahead, the Broker may not have waited at all.)
+		Clock::time_point now = Clock::now();
+		if (answered) {
+			latenciesMs.push_back(std::max(0.0, boost::chrono::duration<double, boost::milli>(now-lastAnswer).count()));
+		}
+		lastTick = tick;
+		ticks++;
+
+		if (ticks>=opts.reportTicks) {
+			report(now);
+		}
+		if (opts.maxTicks && tick>=opts.maxTicks) {
+			if (ticks>0) {
+				report(now);
+			}
+			done = true;
+			std::cout <<"Reached tick " <<tick <<"; stopping.\n";
+			io_service.stop();
+			return false;
+		}
+		return true;
+	}
+
+private:
+	//Print the counters of the current window, and start a new one. Must be locked.
+	void report(Clock::time_point now) {
+		double secs = boost::chrono::duration<double>(now-windowStart).count();
+		double newOwnCpu = getOwnCpuSeconds();
+		double newBrokerCpu = opts.brokerPid ? getProcessCpuSeconds(opts.brokerPid) : -1;
+		size_t msgs = msgsIn + msgsOut;
+
+		std::sort(latenciesMs.begin(), latenciesMs.end());
+		double meanMs = 0;
+		for (std::vector<double>::const_iterator it=latenciesMs.begin(); it!=latenciesMs.end(); it++) {
+			meanMs += *it;
+		}
+		if (latenciesMs.empty()) {
+			latenciesMs.push_back(0);
+		}
+		meanMs /= latenciesMs.size();
+
+		std::cout <<std::fixed <<std::setprecision(2)
+			<<"tick " <<lastTick <<": " <<ticks/secs <<" ticks/s, "
+			<<"in " <<msgsIn/secs <<" msg/s (" <<bytesIn/secs/1024 <<" KB/s), "
+			<<"out " <<msgsOut/secs <<" msg/s (" <<bytesOut/secs/1024 <<" KB/s), "
+			<<"latency ms mean " <<meanMs <<" p50 " <<latenciesMs[latenciesMs.size()/2]
+			<<" p95 " <<latenciesMs[latenciesMs.size()*95/100] <<" max " <<latenciesMs.back() <<", "
+			<<"cpu us/msg loadgen " <<(msgs ? (newOwnCpu-ownCpu)*1e6/msgs : 0);
+		if (newBrokerCpu>=0 && brokerCpu>=0) {
+			std::cout <<" simmob " <<(msgs ? (newBrokerCpu-brokerCpu)*1e6/msgs : 0);
+		}
+		std::cout <<"\n";
+
+		//Start a new window.
+		windowStart = now;
+		ownCpu = newOwnCpu;
+		brokerCpu = newBrokerCpu;
+		msgsIn = msgsOut = bytesIn = bytesOut = 0;
+		ticks = 0;
+		latenciesMs.clear();
+	}
+
+	boost::mutex mutex;
+	unsigned int lastTick; ///<Highest tick received so far.
+	unsigned int registered; ///<Clients that received their id_ack.
+	bool answered; ///<Has any client answered a tick yet?
+
+	//The current window.
+	Clock::time_point windowStart;
+	Clock::time_point lastAnswer;
+	size_t msgsIn;
+	size_t msgsOut;
+	size_t bytesIn;
+	size_t bytesOut;
+	unsigned int ticks;
+	double ownCpu;
+	double brokerCpu;
+	std::vector<double> latenciesMs;
+	bool done;
+} *stats;
+
+
+///Serialize a v1 bundle. (The Broker accepts both v1 and v2 bundles.)
+std::string makeBundle(const std::string& sendId, const std::string& destId, const std::vector<std::string>& messages)
+{
+	std::string body = sendId + destId;
+	for (std::vector<std::string>::const_iterator it=messages.begin(); it!=messages.end(); it++) {
+		body.push_back(static_cast<char>((it->size()>>16)&0xFF));
+		body.push_back(static_cast<char>((it->size()>>8)&0xFF));
+		body.push_back(static_cast<char>(it->size()&0xFF));
+	}
+	for (std::vector<std::string>::const_iterator it=messages.begin(); it!=messages.end(); it++) {
+		body += *it;
+	}
+
+	std::string res(8, '\0');
+	res[0] = 1;
+	res[1] = static_cast<char>(sendId.size());
+	res[2] = static_cast<char>(destId.size());
+	res[3] = static_cast<char>(messages.size());
+	res[4] = static_cast<char>((body.size()>>24)&0xFF);
+	res[5] = static_cast<char>((body.size()>>16)&0xFF);
+	res[6] = static_cast<char>((body.size()>>8)&0xFF);
+	res[7] = static_cast<char>(body.size()&0xFF);
+	return res + body;
+}
+
+///Retrieve a string property from a JSON message. Sim Mobility writes its messages without whitespace, so we avoid a full parser.
+std::string getJsonString(const std::string& msg, const std::string& key)
+{
+	std::string pattern = "\"" + key + "\":\"";
+	size_t start = msg.find(pattern);
+	if (start==std::string::npos) {
+		return "";
+	}
+	start += pattern.size();
+	return msg.substr(start, msg.find('"', start)-start);
+}
+
+///Retrieve an unsigned integer property from a JSON message.
+unsigned int getJsonUInt(const std::string& msg, const std::string& key)
+{
+	std::string pattern = "\"" + key + "\":";
+	size_t start = msg.find(pattern);
+	if (start==std::string::npos) {
+		return 0;
+	}
+	return std::strtoul(msg.c_str()+start+pattern.size(), nullptr, 10);
+}
+
+
+///A TCP connection to Sim Mobility, shared by several fake clients.
+class Connection {
+public:
+	Connection(const tcp::resolver::iterator& endpoints, unsigned int firstId, unsigned int numClients, unsigned int seed)
+		: socket(io_service), strand(io_service), newClientsSent(false), rng(seed)
+	{
+		for (unsigned int i=0; i<numClients; i++) {
+			std::stringstream id;
+			id <<(firstId+i);
+			unassignedIds.push_back(id.str());
+		}
+		boost::asio::async_connect(socket, endpoints, strand.wrap(boost::bind(&Connection::handle_connect, this, boost::asio::placeholders::error)));
+	}
+
+private:
+	void handle_connect(const error_code& err) {
+		if (err) { throw std::runtime_error("Error connecting to Sim Mobility."); }
+		socket.set_option(tcp::no_delay(true));
+
+		//The Broker sends an id_request to every new connection.
+		readHeader();
+	}
+
+	void readHeader() {
+		boost::asio::async_read(socket, boost::asio::buffer(header, 8), strand.wrap(boost::bind(&Connection::handle_read_header, this, boost::asio::placeholders::error)));
+	}
+
+	void handle_read_header(const error_code& err) {
+		if (err) {
+			std::cout <<"Sim Mobility closed the connection.\n";
+			io_service.stop();
+			return;
+		}
+
+		//Decode the remaining length.
+		unsigned int rem_len = ((int(header[4])&0xFF)<<24) | ((int(header[5])&0xFF)<<16) | ((int(header[6])&0xFF)<<8) | (int(header[7])&0xFF);
+		data.resize(rem_len);
+		boost::asio::async_read(socket, boost::asio::buffer(data), strand.wrap(boost::bind(&Connection::handle_read_data, this, boost::asio::placeholders::error)));
+	}
+
+	void handle_read_data(const error_code& err) {
+		if (err) {
+			std::cout <<"Sim Mobility closed the connection.\n";
+			io_service.stop();
+			return;
+		}
+
+		//Bundle layout (v1 and v2): sendId, destId, a 3-byte length per message, then the messages.
+		unsigned int sendIdLen = int(header[1])&0xFF;
+		unsigned int destIdLen = int(header[2])&0xFF;
+		unsigned int msgCount = int(header[3])&0xFF;
+		size_t offset = sendIdLen + destIdLen + 3*msgCount;
+		if (offset > data.size()) { throw std::runtime_error("Received a bundle shorter than its ids and message lengths."); }
+		std::string destId(data.begin()+sendIdLen, data.begin()+sendIdLen+destIdLen);
+		stats->onBundleIn(msgCount, data.size()+8);
+
+		for (unsigned int i=0; i<msgCount; i++) {
+			const char* len = data.data() + sendIdLen + destIdLen + 3*i;
+			size_t msgLen = ((int(len[0])&0xFF)<<16) | ((int(len[1])&0xFF)<<8) | (int(len[2])&0xFF);
+			if (msgLen > data.size()-offset) { throw std::runtime_error("Received a bundle shorter than its messages."); }
+			handleMessage(destId, std::string(data.begin()+offset, data.begin()+offset+msgLen));
+			offset += msgLen;
+		}
+
+		readHeader();
+	}
+
+	void handleMessage(const std::string& destId, const std::string& msg) {
+		if (msg.empty()) {
+			return;
+		}
+
+		//Binary messages (v2 bundles): only ticked_simmob matters to us.
+		if (static_cast<unsigned char>(msg[0])==0xBB) {
+			if (msg.size()>=6 && msg[1]==1) {
+				unsigned int tick = ((int(msg[2])&0xFF)<<24) | ((int(msg[3])&0xFF)<<16) | ((int(msg[4])&0xFF)<<8) | (int(msg[5])&0xFF);
+				onTicked(destId, tick);
+			}
+			return;
+		}
+
+		std::string type = getJsonString(msg, "msg_type");
+		if (type=="id_request") {
+			onIdRequest(getJsonString(msg, "token"));
+		} else if (type=="id_ack") {
+			stats->onRegistered();
+		} else if (type=="ticked_simmob") {
+			onTicked(destId, getJsonUInt(msg, "tick"));
+		}
+	}
+
+	void onIdRequest(const std::string& token) {
+		if (unassignedIds.empty()) { throw std::runtime_error("Received an id_request, but all clients already have an ID."); }
+		std::string id = unassignedIds.front();
+		unassignedIds.pop_front();
+
+		std::vector<std::string> messages;
+		messages.push_back("{\"msg_type\":\"id_response\",\"id\":\"" + id + "\",\"token\":\"" + token + "\",\"type\":\"android\",\"services\":[\"" + opts.services + "\"]}");
+		send(makeBundle(id, "0", messages), messages.size());
+
+		//Every other client on this connection asks for its own id_request.
+		if (!newClientsSent) {
+			newClientsSent = true;
+			std::vector<std::string> newClient(1, "{\"msg_type\":\"new_client\"}");
+			std::string bundle = makeBundle("0", "0", newClient);
+			for (size_t i=0; i<unassignedIds.size(); i++) {
+				send(bundle, 1);
+			}
+		}
+	}
+
+	void onTicked(const std::string& clientId, unsigned int tick) {
+		if (!stats->onTickReceived(tick)) {
+			return;
+		}
+
+		unsigned int delayMs = opts.delayMs + (opts.jitterMs ? std::uniform_int_distribution<unsigned int>(0, opts.jitterMs)(rng) : 0);
+		if (delayMs==0) {
+			answerTick(clientId);
+		} else {
+			boost::shared_ptr<boost::asio::deadline_timer> timer(new boost::asio::deadline_timer(io_service, boost::posix_time::milliseconds(delayMs)));
+			timer->async_wait(strand.wrap(boost::bind(&Connection::handle_delay, this, clientId, timer, boost::asio::placeholders::error)));
+		}
+	}
+
+	///The timer is only bound to this handler to keep it alive until it expires.
+	void handle_delay(const std::string& clientId, boost::shared_ptr<boost::asio::deadline_timer> /*timer*/, const error_code& err) {
+		if (err) { throw std::runtime_error("Error waiting to answer a tick."); }
+		answerTick(clientId);
+	}
+
+	///Send this client's messages for the current tick, followed by ticked_client.
+	void answerTick(const std::string& clientId) {
+		std::vector<std::string> messages;
+		std::uniform_real_distribution<double> chance(0.0, 1.0);
+		if (opts.logRate>0 && chance(rng)<opts.logRate) {
+			messages.push_back("{\"msg_type\":\"remote_log\",\"log_msg\":\"commsim-loadgen\"}");
+		}
+		if (opts.opaqueRate>0 && chance(rng)<opts.opaqueRate) {
+			messages.push_back("{\"msg_type\":\"opaque_send\",\"from_id\":\"" + clientId + "\",\"to_ids\":[],\"broadcast\":true,"
+				"\"format\":\"base64escape\",\"tech\":\"dsrc\",\"data\":\"" + std::string(opts.payloadBytes, 'A') + "\"}");
+		}
+		messages.push_back("{\"msg_type\":\"ticked_client\"}");
+
+		send(makeBundle(clientId, "0", messages), messages.size());
+		stats->onTickAnswered();
+	}
+
+	void send(const std::string& bundle, size_t msgCount) {
+		stats->onBundleOut(msgCount, bundle.size());
+
+		bool alreadyWriting = false;
+		{
+		boost::lock_guard<boost::mutex> lock(writeQueueMUTEX);
+		alreadyWriting = !writeQueue.empty();
+		writeQueue.push_back(bundle);
+		}
+
+		//"Wake" if this is the first new message in the queue.
+		if (!alreadyWriting) {
+			writeFrontMessage();
+		}
+	}
+
+	void writeFrontMessage() {
+		boost::asio::async_write(socket, boost::asio::buffer(writeQueue.front()), strand.wrap(boost::bind(&Connection::handle_write, this, boost::asio::placeholders::error)));
+	}
+
+	void handle_write(const error_code& err) {
+		if (err) { throw std::runtime_error("Error writing to Sim Mobility."); }
+
+		//Remove this message; it's been written correctly.
+		bool empty = false;
+		{
+		boost::lock_guard<boost::mutex> lock(writeQueueMUTEX);
+		writeQueue.pop_front();
+		empty = writeQueue.empty();
+		}
+
+		//Is there anything else in the queue to write?
+		if (!empty) {
+			writeFrontMessage();
+		}
+	}
+
+private:
+	tcp::socket socket;
+	boost::asio::io_service::strand strand; ///<Serializes the handlers of this connection (and its random numbers).
+	char header[8];
+	std::vector<char> data;
+
+	std::list<std::string> unassignedIds; ///<Clients still waiting for an id_request.
+	bool newClientsSent;
+
+	std::list<std::string> writeQueue;
+	boost::mutex writeQueueMUTEX;
+
+	std::mt19937 rng;
+};
+
+
+void printUsage()
+{
+	std::cout <<"Usage: ./commsim-loadgen [options]\n"
+		<<"  --host HOST          Sim Mobility host (default 127.0.0.1)\n"
+		<<"  --port PORT          Sim Mobility commsim port (default 6745)\n"
+		<<"  --agents N           Number of fake Android clients (default 100)\n"
+		<<"  --connections N      Number of TCP connections the clients share (default 1)\n"
+		<<"  --threads N          Number of I/O threads (default 1)\n"
+		<<"  --delay-ms N         Delay before a client answers a tick (default 0)\n"
+		<<"  --jitter-ms N        Random extra delay, up to N ms (default 0)\n"
+		<<"  --log-rate P         Probability of a remote_log per client and tick (default 0)\n"
+		<<"  --opaque-rate P      Probability of a broadcast opaque_send per client and tick (default 0)\n"
+		<<"  --payload-bytes N    Size of each opaque_send's data (default 64)\n"
+		<<"  --services SRV       Service requested by the clients (default srv_location)\n"
+		<<"  --report-ticks N     Report every N ticks (default 100)\n"
+		<<"  --max-ticks N        Stop after tick N (default 0: run until Sim Mobility disconnects)\n"
+		<<"  --broker-pid PID     Also report the CPU time of this (Sim Mobility) process\n";
+}
+
+} //End un-named namespace
+
+
+int main(int argc, char* argv[])
+{
+	//Parse args
+	for (int i=1; i<argc; i++) {
+		std::string arg = argv[i];
+		if (arg=="--help" || i+1>=argc) {
+			printUsage();
+			return arg=="--help" ? 0 : 1;
+		}
+		std::string val = argv[++i];
+		if (arg=="--host") { opts.host = val; }
+		else if (arg=="--port") { opts.port = val; }
+		else if (arg=="--agents") { opts.agents = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--connections") { opts.connections = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--threads") { opts.threads = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--delay-ms") { opts.delayMs = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--jitter-ms") { opts.jitterMs = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--log-rate") { opts.logRate = std::strtod(val.c_str(), nullptr); }
+		else if (arg=="--opaque-rate") { opts.opaqueRate = std::strtod(val.c_str(), nullptr); }
+		else if (arg=="--payload-bytes") { opts.payloadBytes = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--services") { opts.services = val; }
+		else if (arg=="--report-ticks") { opts.reportTicks = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--max-ticks") { opts.maxTicks = std::strtoul(val.c_str(), nullptr, 10); }
+		else if (arg=="--broker-pid") { opts.brokerPid = std::atoi(val.c_str()); }
+		else {
+			printUsage();
+			return 1;
+		}
+	}
+	if (opts.agents==0 || opts.connections==0 || opts.connections>opts.agents || opts.threads==0 || opts.reportTicks==0) {
+		std::cout <<"Error: agents, connections, threads and report-ticks must be positive, with at most one connection per agent.\n";
+		return 1;
+	}
+
+	stats = new Stats(); //Leaks.
+
+	//Spread the clients over the connections. Client IDs start at 1 (0 is Sim Mobility).
+	tcp::resolver resolver(io_service);
+	tcp::resolver::iterator endpoints = resolver.resolve(tcp::resolver::query(opts.host, opts.port));
+	unsigned int nextId = 1;
+	for (unsigned int i=0; i<opts.connections; i++) {
+		unsigned int numClients = opts.agents/opts.connections + (i<opts.agents%opts.connections ? 1 : 0);
+		new Connection(endpoints, nextId, numClients, i); //Leaks.
+		nextId += numClients;
+	}
+	std::cout <<"Connecting " <<opts.agents <<" clients over " <<opts.connections <<" connection(s) to " <<opts.host <<":" <<opts.port <<".\n";
+
+	//Additional threads here (+ the main one).
+	boost::thread_group threads;
+	for (unsigned int i=1; i<opts.threads; i++) {
+		threads.create_thread(boost::bind(&boost::asio::io_service::run, &io_service));
+	}
+
+	//Perform all I/O
+	io_service.run();
+	threads.join_all();
+
+	std::cout <<"Done\n";
+	return 0;
+}